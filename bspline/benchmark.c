@@ -0,0 +1,83 @@
+/* bspline/benchmark.c
+ *
+ * Copyright (C) 2026 Patrick Alken
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* timings of the banded least squares B-spline fit as a function of the
+ * number of data points; usage: benchmark [nmax] [nbreak] */
+
+#include <config.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <time.h>
+#include <gsl/gsl_bspline.h>
+#include <gsl/gsl_rng.h>
+#include <gsl/gsl_randist.h>
+
+static double
+seconds (clock_t start)
+{
+  return (clock () - start) / (double) CLOCKS_PER_SEC;
+}
+
+int
+main (int argc, char *argv[])
+{
+  const size_t nmax = (argc > 1) ? (size_t) atol (argv[1]) : 10000000;
+  const size_t nbreak = (argc > 2) ? (size_t) atol (argv[2]) : 1000;
+  gsl_rng *r = gsl_rng_alloc (gsl_rng_default);
+  gsl_bspline_workspace *bw = gsl_bspline_alloc (4, nbreak);
+  gsl_vector *x = gsl_vector_alloc (nmax);
+  gsl_vector *y = gsl_vector_alloc (nmax);
+  gsl_vector *c = gsl_vector_alloc (gsl_bspline_ncoeffs (bw));
+  size_t n, i;
+
+  gsl_bspline_knots_uniform (0.0, 1.0, bw);
+
+  printf ("cubic B-spline, %zu coefficients\n", gsl_bspline_ncoeffs (bw));
+  printf ("%10s %10s %12s\n", "n", "lssolve", "chisq/n");
+
+  for (n = 10000; n <= nmax; n *= 10)
+    {
+      gsl_vector_view xv = gsl_vector_subvector (x, 0, n);
+      gsl_vector_view yv = gsl_vector_subvector (y, 0, n);
+      double chisq, t;
+      clock_t start;
+
+      for (i = 0; i < n; ++i)
+        {
+          double xi = gsl_rng_uniform (r);
+          gsl_vector_set (x, i, xi);
+          gsl_vector_set (y, i, sin (20.0 * xi) + gsl_ran_gaussian (r, 0.1));
+        }
+
+      start = clock ();
+      gsl_bspline_lssolve (&xv.vector, &yv.vector, c, &chisq, bw);
+      t = seconds (start);
+
+      printf ("%10zu %10.3f %12.4e\n", n, t, chisq / n);
+    }
+
+  gsl_vector_free (x);
+  gsl_vector_free (y);
+  gsl_vector_free (c);
+  gsl_bspline_free (bw);
+  gsl_rng_free (r);
+
+  return 0;
+}
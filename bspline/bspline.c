@@ -214,7 +214,7 @@ The repeated knots at the beginning and end of the interval
 correspond to the continuity condition there. See pg. 119
 of [1].
 
-Inputs: breakpts - breakpoints
+Inputs: breakpts - breakpoints, non-decreasing
         w        - bspline workspace
 
 Return: success or error
@@ -231,6 +231,16 @@ gsl_bspline_knots (const gsl_vector * breakpts, gsl_bspline_workspace * w)
     {
       size_t i; /* looping */
 
+      /* the interval search of the evaluation functions requires
+         non-decreasing knots */
+      for (i = 0; i < w->l; i++)
+        {
+          if (!(gsl_vector_get (breakpts, i) <= gsl_vector_get (breakpts, i + 1)))
+            {
+              GSL_ERROR ("knots vector is not increasing", GSL_EINVAL);
+            }
+        }
+
       for (i = 0; i < w->k; i++)
         gsl_vector_set (w->knots, i, gsl_vector_get (breakpts, 0));
 
@@ -255,7 +265,7 @@ of the first breakpoint and 'b' is the position of the last
 breakpoint.
 
 Inputs: a - left side of interval
-        b - right side of interval
+        b - right side of interval, b >= a
         w - bspline workspace
 
 Return: success or error
@@ -278,6 +288,11 @@ gsl_bspline_knots_uniform (const double a, const double b,
   double delta; /* interval spacing */
   double x;
 
+  if (!(a <= b))
+    {
+      GSL_ERROR ("knots vector is not increasing", GSL_EINVAL);
+    }
+
   delta = (b - a) / (double) w->l;
 
   for (i = 0; i < w->k; i++)
@@ -566,7 +581,8 @@ gsl_bspline_deriv_eval_nonzero (const double x, const size_t nderiv,
 /*
 bspline_find_interval()
   Find knot interval such that t_i <= x < t_{i + 1}
-where the t_i are knot values.
+where the t_i are knot values, which gsl_bspline_knots and
+gsl_bspline_knots_uniform have checked to be non-decreasing.
 
 Inputs: x    - x value
         flag - (output) error flag
@@ -587,39 +603,52 @@ Notes: The error conditions are reported as follows:
 static inline size_t
 bspline_find_interval (const double x, int *flag, gsl_bspline_workspace * w)
 {
-  size_t i;
+  const double *t = w->knots->data;
+  size_t lo = w->k - 1;
+  size_t hi = w->k + w->l - 1; /* t_hi is the right end point */
 
-  if (x < gsl_vector_get (w->knots, 0))
+  if (x < t[0])
     {
       *flag = -1;
       return 0;
     }
 
-  /* find i such that t_i <= x < t_{i+1} */
-  for (i = w->k - 1; i < w->k + w->l - 1; i++)
+  if (!(x < t[hi]))
     {
-      const double ti = gsl_vector_get (w->knots, i);
-      const double tip1 = gsl_vector_get (w->knots, i + 1);
+      if (x == t[hi] && t[lo] < x)
+        {
+          /* last i with t_i < x = t_{i+1}, keeping t_lo < x <= t_hi */
+          while (hi - lo > 1)
+            {
+              size_t mid = (lo + hi) / 2;
 
-      if (tip1 < ti)
-	{
-	  GSL_ERROR ("knots vector is not increasing", GSL_EINVAL);
-	}
+              if (t[mid] < x)
+                lo = mid;
+              else
+                hi = mid;
+            }
 
-      if (ti <= x && x < tip1)
-	break;
+          *flag = 0;
+          return lo;
+        }
 
-      if (ti < x && x == tip1 && tip1 == gsl_vector_get (w->knots, w->k + w->l
-							 - 1))
-	break;
+      *flag = 1;
+      return hi;
     }
 
-  if (i == w->k + w->l - 1)
-    *flag = 1;
-  else
-    *flag = 0;
+  /* binary search keeping t_lo <= x < t_hi, for non-decreasing knots */
+  while (hi - lo > 1)
+    {
+      size_t mid = (lo + hi) / 2;
+
+      if (x < t[mid])
+        hi = mid;
+      else
+        lo = mid;
+    }
 
-  return i;
+  *flag = 0;
+  return lo;
 }				/* bspline_find_interval() */
 
 /*
@@ -146,6 +146,29 @@ gsl_bspline_knots_greville (const gsl_vector *abscissae,
       gsl_vector_set (&x.vector, x.vector.size - 1,
                       gsl_vector_get (abscissae, abscissae->size - 1));
 
+      /* Repeated breakpoints may come out decreasing by rounding errors,
+       * so replace each decreasing run by its mean (pool adjacent
+       * violators), the closest non-decreasing breakpoints in the least
+       * squares sense; abserr below measures the resulting fit. */
+      for (i = 1; i < x.vector.size; ++i)
+        {
+          if (gsl_vector_get (&x.vector, i) < gsl_vector_get (&x.vector, i - 1))
+            {
+              size_t j = i, m;
+              double sum = gsl_vector_get (&x.vector, i);
+
+              do
+                {
+                  --j;
+                  sum += gsl_vector_get (&x.vector, j);
+                }
+              while (j > 0 && sum / (i - j + 1) < gsl_vector_get (&x.vector, j - 1));
+
+              for (m = j; m <= i; ++m)
+                gsl_vector_set (&x.vector, m, sum / (i - j + 1));
+            }
+        }
+
       /* Finally, initialize workspace knots using the now-known breakpoints */
       s = gsl_bspline_knots (&x.vector, w);
       free (storage);
@@ -23,6 +23,7 @@
 
 #include <stdlib.h>
 #include <gsl/gsl_math.h>
+#include <gsl/gsl_executor.h>
 #include <gsl/gsl_vector.h>
 #include <gsl/gsl_matrix.h>
 
@@ -103,6 +104,31 @@ gsl_bspline_deriv_eval_nonzero(const double x,
                                size_t *iend,
                                gsl_bspline_workspace *w);
 
+int
+gsl_bspline_calc(const double x, const gsl_vector *c, double *result,
+                 gsl_bspline_workspace *w);
+
+int
+gsl_bspline_lsnormal(const gsl_vector *x, const gsl_vector *y,
+                     const gsl_vector *wts, gsl_vector *XTy,
+                     gsl_matrix *XTX, gsl_bspline_workspace *w);
+
+int
+gsl_bspline_lsnormal_parallel(const gsl_vector *x, const gsl_vector *y,
+                              const gsl_vector *wts, gsl_vector *XTy,
+                              gsl_matrix *XTX, gsl_bspline_workspace *w,
+                              const size_t ntasks, const gsl_executor *exec);
+
+int
+gsl_bspline_lssolve(const gsl_vector *x, const gsl_vector *y,
+                    gsl_vector *c, double *chisq,
+                    gsl_bspline_workspace *w);
+
+int
+gsl_bspline_wlssolve(const gsl_vector *x, const gsl_vector *y,
+                     const gsl_vector *wts, gsl_vector *c,
+                     double *chisq, gsl_bspline_workspace *w);
+
 __END_DECLS
 
 #endif /* __GSL_BSPLINE_H__ */
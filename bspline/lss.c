@@ -0,0 +1,436 @@
+/* bspline/lss.c
+ *
+ * Copyright (C) 2026 Patrick Alken
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#include <config.h>
+#include <stdlib.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_executor.h>
+#include <gsl/gsl_vector.h>
+#include <gsl/gsl_matrix.h>
+#include <gsl/gsl_linalg.h>
+#include <gsl/gsl_bspline.h>
+
+/*
+ * Least squares fitting of a B-spline to data. Each row of the design
+ * matrix X_{ij} = B_j(x_i) has at most k nonzero elements, found with
+ * gsl_bspline_eval_nonzero(), so the normal equations
+ *
+ *   X^T W X c = X^T W y
+ *
+ * have a symmetric banded matrix with k diagonals. It is accumulated
+ * directly in the band format of gsl_linalg_cholesky_band_decomp(),
+ * using O(n k) memory for n coefficients, independent of the number of
+ * data points.
+ */
+
+static int bspline_lsfit (const gsl_vector * x, const gsl_vector * y,
+                          const gsl_vector * wts, gsl_vector * c,
+                          double * chisq, gsl_bspline_workspace * w);
+
+/*
+gsl_bspline_calc()
+  Evaluate the spline sum_i c_i B_i(x)
+
+Inputs: x      - point for evaluation
+        c      - spline coefficients, length n
+        result - (output) value of the spline at x
+        w      - bspline workspace
+
+Return: success or error
+*/
+
+int
+gsl_bspline_calc (const double x, const gsl_vector * c, double * result,
+                  gsl_bspline_workspace * w)
+{
+  if (c->size != w->n)
+    {
+      GSL_ERROR ("coefficient vector does not match workspace", GSL_EBADLEN);
+    }
+  else
+    {
+      size_t istart, iend, j;
+      double sum = 0.0;
+      int status;
+
+      status = gsl_bspline_eval_nonzero (x, w->B, &istart, &iend, w);
+      if (status)
+        return status;
+
+      for (j = 0; j < w->k; j++)
+        sum += gsl_vector_get (c, istart + j) * gsl_vector_get (w->B, j);
+
+      *result = sum;
+
+      return GSL_SUCCESS;
+    }
+} /* gsl_bspline_calc() */
+
+/*
+gsl_bspline_lsnormal()
+  Add the contribution of the data (x_i, y_i) with weights w_i to the
+normal equations X^T W X c = X^T W y
+
+Inputs: x   - data abscissae, in the knot interval
+        y   - data values
+        wts - data weights, or NULL for unit weights
+        XTy - (input/output) X^T W y, length n
+        XTX - (input/output) X^T W X in symmetric band format,
+              n-by-k: XTX(i,d) holds element (i+d,i)
+        w   - bspline workspace
+
+Return: success or error
+
+Notes: XTX and XTy are accumulated, not overwritten, so they must be
+       zeroed by the caller. Data may then be passed in chunks; see
+       gsl_bspline_lsnormal_parallel() for processing them concurrently.
+*/
+
+int
+gsl_bspline_lsnormal (const gsl_vector * x, const gsl_vector * y,
+                      const gsl_vector * wts, gsl_vector * XTy,
+                      gsl_matrix * XTX, gsl_bspline_workspace * w)
+{
+  const size_t n = x->size;
+  const size_t k = w->k;
+
+  if (y->size != n)
+    {
+      GSL_ERROR ("x and y vectors must have same length", GSL_EBADLEN);
+    }
+  else if (wts != NULL && wts->size != n)
+    {
+      GSL_ERROR ("weight vector must match data length", GSL_EBADLEN);
+    }
+  else if (XTy->size != w->n)
+    {
+      GSL_ERROR ("XTy vector does not match workspace", GSL_EBADLEN);
+    }
+  else if (XTX->size1 != w->n || XTX->size2 != k)
+    {
+      GSL_ERROR ("XTX matrix must be n-by-k", GSL_EBADLEN);
+    }
+  else
+    {
+      const double *B = w->B->data;
+      size_t i, a, b;
+
+      for (i = 0; i < n; i++)
+        {
+          const double xi = gsl_vector_get (x, i);
+          const double yi = gsl_vector_get (y, i);
+          const double wi = (wts != NULL) ? gsl_vector_get (wts, i) : 1.0;
+          size_t istart, iend;
+          int status;
+
+          status = gsl_bspline_eval_nonzero (xi, w->B, &istart, &iend, w);
+          if (status)
+            return status;
+
+          for (a = 0; a < k; a++)
+            {
+              const double wBa = wi * B[a];
+              double *row = gsl_matrix_ptr (XTX, istart + a, 0);
+
+              *gsl_vector_ptr (XTy, istart + a) += wBa * yi;
+
+              for (b = a; b < k; b++)
+                row[b - a] += wBa * B[b];
+            }
+        }
+
+      return GSL_SUCCESS;
+    }
+} /* gsl_bspline_lsnormal() */
+
+typedef struct
+{
+  const gsl_vector *x;
+  const gsl_vector *y;
+  const gsl_vector *wts;
+  size_t ntasks;
+  gsl_vector **XTy;             /* X^T W y of each task */
+  gsl_matrix **XTX;             /* X^T W X of each task */
+  gsl_bspline_workspace **w;    /* workspace of each task */
+  int *status;                  /* status of each task */
+} lsnormal_workspace;
+
+/* accumulate the normal equations of the block of data of task t */
+static void
+lsnormal_task (size_t t, void *vw)
+{
+  lsnormal_workspace *lw = (lsnormal_workspace *) vw;
+  const size_t n = lw->x->size;
+  const size_t i0 = gsl_executor_block (n, lw->ntasks, t);
+  const size_t i1 = gsl_executor_block (n, lw->ntasks, t + 1);
+
+  lw->status[t] = GSL_SUCCESS;
+
+  if (i1 > i0)
+    {
+      gsl_vector_const_view xt = gsl_vector_const_subvector (lw->x, i0, i1 - i0);
+      gsl_vector_const_view yt = gsl_vector_const_subvector (lw->y, i0, i1 - i0);
+
+      if (lw->wts != NULL)
+        {
+          gsl_vector_const_view wt = gsl_vector_const_subvector (lw->wts, i0, i1 - i0);
+          lw->status[t] = gsl_bspline_lsnormal (&xt.vector, &yt.vector, &wt.vector,
+                                                lw->XTy[t], lw->XTX[t], lw->w[t]);
+        }
+      else
+        {
+          lw->status[t] = gsl_bspline_lsnormal (&xt.vector, &yt.vector, NULL,
+                                                lw->XTy[t], lw->XTX[t], lw->w[t]);
+        }
+    }
+}
+
+/* free the matrices and workspaces of tasks 1 .. ntasks-1 */
+static void
+lsnormal_free (lsnormal_workspace * lw)
+{
+  size_t t;
+
+  for (t = 1; t < lw->ntasks; t++)
+    {
+      if (lw->XTy != NULL && lw->XTy[t] != NULL)
+        gsl_vector_free (lw->XTy[t]);
+
+      if (lw->XTX != NULL && lw->XTX[t] != NULL)
+        gsl_matrix_free (lw->XTX[t]);
+
+      if (lw->w != NULL && lw->w[t] != NULL)
+        gsl_bspline_free (lw->w[t]);
+    }
+
+  free (lw->XTy);
+  free (lw->XTX);
+  free (lw->w);
+  free (lw->status);
+}
+
+/*
+gsl_bspline_lsnormal_parallel()
+  As gsl_bspline_lsnormal(), with the data split into ntasks contiguous
+blocks whose contributions are computed by tasks run by exec. Task 0
+adds to XTX and XTy with the workspace w, and the other tasks to their
+own matrices with copies of w, which are added to XTX and XTy in task
+order, so the result does not depend on the order in which the tasks
+are run and with one task it is that of gsl_bspline_lsnormal().
+
+Inputs: x      - data abscissae, in the knot interval
+        y      - data values
+        wts    - data weights, or NULL for unit weights
+        XTy    - (input/output) X^T W y, length n
+        XTX    - (input/output) X^T W X in symmetric band format
+        w      - bspline workspace
+        ntasks - number of tasks
+        exec   - executor, or NULL to run the tasks in turn
+
+Return: success or error
+*/
+
+int
+gsl_bspline_lsnormal_parallel (const gsl_vector * x, const gsl_vector * y,
+                               const gsl_vector * wts, gsl_vector * XTy,
+                               gsl_matrix * XTX, gsl_bspline_workspace * w,
+                               const size_t ntasks, const gsl_executor * exec)
+{
+  const size_t n = x->size;
+  const size_t k = w->k;
+
+  if (ntasks == 0)
+    {
+      GSL_ERROR ("number of tasks must be positive", GSL_EINVAL);
+    }
+  else if (y->size != n)
+    {
+      GSL_ERROR ("x and y vectors must have same length", GSL_EBADLEN);
+    }
+  else if (wts != NULL && wts->size != n)
+    {
+      GSL_ERROR ("weight vector must match data length", GSL_EBADLEN);
+    }
+  else if (XTy->size != w->n)
+    {
+      GSL_ERROR ("XTy vector does not match workspace", GSL_EBADLEN);
+    }
+  else if (XTX->size1 != w->n || XTX->size2 != k)
+    {
+      GSL_ERROR ("XTX matrix must be n-by-k", GSL_EBADLEN);
+    }
+  else
+    {
+      lsnormal_workspace lw;
+      int status = GSL_SUCCESS;
+      size_t t;
+
+      lw.x = x;
+      lw.y = y;
+      lw.wts = wts;
+      lw.ntasks = ntasks;
+      lw.XTy = (gsl_vector **) calloc (ntasks, sizeof (gsl_vector *));
+      lw.XTX = (gsl_matrix **) calloc (ntasks, sizeof (gsl_matrix *));
+      lw.w = (gsl_bspline_workspace **) calloc (ntasks, sizeof (gsl_bspline_workspace *));
+      lw.status = (int *) malloc (ntasks * sizeof (int));
+
+      if (lw.XTy == NULL || lw.XTX == NULL || lw.w == NULL || lw.status == NULL)
+        {
+          lsnormal_free (&lw);
+          GSL_ERROR ("failed to allocate space for tasks", GSL_ENOMEM);
+        }
+
+      lw.XTy[0] = XTy;
+      lw.XTX[0] = XTX;
+      lw.w[0] = w;
+
+      for (t = 1; t < ntasks; t++)
+        {
+          lw.XTy[t] = gsl_vector_calloc (w->n);
+          lw.XTX[t] = gsl_matrix_calloc (w->n, k);
+          lw.w[t] = gsl_bspline_alloc (k, w->nbreak);
+
+          if (lw.XTy[t] == NULL || lw.XTX[t] == NULL || lw.w[t] == NULL)
+            {
+              lsnormal_free (&lw);
+              GSL_ERROR ("failed to allocate space for task normal equations",
+                         GSL_ENOMEM);
+            }
+
+          gsl_vector_memcpy (lw.w[t]->knots, w->knots);
+        }
+
+      gsl_executor_run (exec, ntasks, &lsnormal_task, &lw);
+
+      for (t = 0; t < ntasks; t++)
+        {
+          if (lw.status[t])
+            {
+              status = lw.status[t];
+              break;
+            }
+        }
+
+      if (!status)
+        {
+          for (t = 1; t < ntasks; t++)
+            {
+              gsl_vector_add (XTy, lw.XTy[t]);
+              gsl_matrix_add (XTX, lw.XTX[t]);
+            }
+        }
+
+      lsnormal_free (&lw);
+
+      return status;
+    }
+} /* gsl_bspline_lsnormal_parallel() */
+
+/*
+gsl_bspline_lssolve()
+  Least squares fit of the spline coefficients to data (x_i, y_i)
+
+Inputs: x     - data abscissae, in the knot interval
+        y     - data values
+        c     - (output) spline coefficients, length n
+        chisq - (output) residual sum of squares
+        w     - bspline workspace
+
+Return: success or error
+*/
+
+int
+gsl_bspline_lssolve (const gsl_vector * x, const gsl_vector * y,
+                     gsl_vector * c, double * chisq,
+                     gsl_bspline_workspace * w)
+{
+  return bspline_lsfit (x, y, NULL, c, chisq, w);
+} /* gsl_bspline_lssolve() */
+
+/*
+gsl_bspline_wlssolve()
+  Weighted least squares fit of the spline coefficients to data
+(x_i, y_i) with weights w_i; chisq = sum_i w_i (y_i - s(x_i))^2
+*/
+
+int
+gsl_bspline_wlssolve (const gsl_vector * x, const gsl_vector * y,
+                      const gsl_vector * wts, gsl_vector * c,
+                      double * chisq, gsl_bspline_workspace * w)
+{
+  if (wts->size != x->size)
+    {
+      GSL_ERROR ("weight vector must match data length", GSL_EBADLEN);
+    }
+
+  return bspline_lsfit (x, y, wts, c, chisq, w);
+} /* gsl_bspline_wlssolve() */
+
+static int
+bspline_lsfit (const gsl_vector * x, const gsl_vector * y,
+               const gsl_vector * wts, gsl_vector * c,
+               double * chisq, gsl_bspline_workspace * w)
+{
+  if (c->size != w->n)
+    {
+      GSL_ERROR ("coefficient vector does not match workspace", GSL_EBADLEN);
+    }
+  else
+    {
+      gsl_matrix *XTX = gsl_matrix_calloc (w->n, w->k);
+      double sum = 0.0;
+      size_t i;
+      int status;
+
+      if (XTX == NULL)
+        {
+          GSL_ERROR ("failed to allocate space for normal equations", GSL_ENOMEM);
+        }
+
+      gsl_vector_set_zero (c);
+
+      /* c holds X^T W y until it is overwritten by the solution */
+      status = gsl_bspline_lsnormal (x, y, wts, c, XTX, w);
+
+      if (!status)
+        status = gsl_linalg_cholesky_band_decomp (XTX);
+
+      if (!status)
+        status = gsl_linalg_cholesky_band_svx (XTX, c);
+
+      gsl_matrix_free (XTX);
+
+      if (status)
+        return status;
+
+      for (i = 0; i < x->size; i++)
+        {
+          const double wi = (wts != NULL) ? gsl_vector_get (wts, i) : 1.0;
+          double si, ri;
+
+          gsl_bspline_calc (gsl_vector_get (x, i), c, &si, w);
+          ri = gsl_vector_get (y, i) - si;
+          sum += wi * ri * ri;
+        }
+
+      *chisq = sum;
+
+      return GSL_SUCCESS;
+    }
+}
@@ -19,12 +19,35 @@
  */
 
 #include <config.h>
+#include <math.h>
 #include <gsl/gsl_test.h>
 #include <gsl/gsl_errno.h>
 #include <gsl/gsl_bspline.h>
 #include <gsl/gsl_ieee_utils.h>
 #include <gsl/gsl_nan.h>
 
+#define NTASKS 4
+
+/* An executor which runs the tasks in reverse order, to check that
+   the results of the parallel functions do not depend on the order in
+   which the tasks are run */
+
+static void
+reverse_run (size_t ntasks, void (*task) (size_t i, void * data),
+             void * data, void * params)
+{
+  size_t i;
+
+  (void) params;
+
+  for (i = ntasks; i-- > 0;)
+    {
+      task (i, data);
+    }
+}
+
+static const gsl_executor reverse_exec = { &reverse_run, 0 };
+
 void
 test_bspline(gsl_bspline_workspace * bw)
 {
@@ -84,6 +107,174 @@ test_bspline(gsl_bspline_workspace * bw)
   gsl_matrix_free(dB);
 }
 
+/* least squares fits using the banded normal equations */
+void
+test_lssolve(const size_t order, const size_t nbreak)
+{
+  const size_t n = 500;
+  const double a = -2.0, b = 3.0;
+  gsl_bspline_workspace *bw = gsl_bspline_alloc(order, nbreak);
+  const size_t ncoeffs = gsl_bspline_ncoeffs(bw);
+  gsl_vector *x = gsl_vector_alloc(n);
+  gsl_vector *y = gsl_vector_alloc(n);
+  gsl_vector *wts = gsl_vector_alloc(n);
+  gsl_vector *c0 = gsl_vector_alloc(ncoeffs);
+  gsl_vector *c = gsl_vector_alloc(ncoeffs);
+  gsl_vector *B = gsl_vector_alloc(ncoeffs);
+  gsl_vector *XTy = gsl_vector_calloc(ncoeffs);
+  gsl_vector *XTy2 = gsl_vector_calloc(ncoeffs);
+  gsl_matrix *XTX = gsl_matrix_calloc(ncoeffs, order);
+  gsl_matrix *XTX2 = gsl_matrix_calloc(ncoeffs, order);
+  gsl_matrix *A = gsl_matrix_calloc(ncoeffs, ncoeffs);
+  gsl_vector *rhs = gsl_vector_calloc(ncoeffs);
+  double chisq;
+  size_t i, j, l;
+
+  gsl_bspline_knots_uniform(a, b, bw);
+
+  for (j = 0; j < ncoeffs; j++)
+    gsl_vector_set(c0, j, cos(1.3 * j) + 0.1 * j);
+
+  for (i = 0; i < n; i++)
+    {
+      double xi = a + (b - a) * i / (n - 1.0);
+      double si;
+
+      gsl_bspline_calc(xi, c0, &si, bw);
+      gsl_vector_set(x, i, xi);
+      gsl_vector_set(y, i, si);
+      gsl_vector_set(wts, i, 1.0 + 0.5 * sin(7.0 * i));
+    }
+
+  /* data on a spline are fitted exactly */
+  gsl_bspline_lssolve(x, y, c, &chisq, bw);
+  for (j = 0; j < ncoeffs; j++)
+    gsl_test_rel(gsl_vector_get(c, j), gsl_vector_get(c0, j), 1.0e-8,
+                 "bspline lssolve order=%zu nbreak=%zu coefficient %zu",
+                 order, nbreak, j);
+  gsl_test_abs(chisq, 0.0, 1.0e-16,
+               "bspline lssolve order=%zu nbreak=%zu chisq", order, nbreak);
+
+  /* add a perturbation and compare with the dense normal equations */
+  for (i = 0; i < n; i++)
+    *gsl_vector_ptr(y, i) += 0.1 * cos(37.0 * gsl_vector_get(x, i));
+
+  gsl_bspline_wlssolve(x, y, wts, c, &chisq, bw);
+
+  for (i = 0; i < n; i++)
+    {
+      double wi = gsl_vector_get(wts, i);
+      gsl_bspline_eval(gsl_vector_get(x, i), B, bw);
+
+      for (j = 0; j < ncoeffs; j++)
+        {
+          double Bj = gsl_vector_get(B, j);
+          *gsl_vector_ptr(rhs, j) += wi * Bj * gsl_vector_get(y, i);
+          for (l = 0; l < ncoeffs; l++)
+            *gsl_matrix_ptr(A, j, l) += wi * Bj * gsl_vector_get(B, l);
+        }
+    }
+
+  /* normal equations accumulated in two chunks */
+  {
+    gsl_vector_const_view x1 = gsl_vector_const_subvector(x, 0, n / 3);
+    gsl_vector_const_view y1 = gsl_vector_const_subvector(y, 0, n / 3);
+    gsl_vector_const_view w1 = gsl_vector_const_subvector(wts, 0, n / 3);
+    gsl_vector_const_view x2 = gsl_vector_const_subvector(x, n / 3, n - n / 3);
+    gsl_vector_const_view y2 = gsl_vector_const_subvector(y, n / 3, n - n / 3);
+    gsl_vector_const_view w2 = gsl_vector_const_subvector(wts, n / 3, n - n / 3);
+
+    gsl_bspline_lsnormal(&x1.vector, &y1.vector, &w1.vector, XTy, XTX, bw);
+    gsl_bspline_lsnormal(&x2.vector, &y2.vector, &w2.vector, XTy2, XTX2, bw);
+    gsl_matrix_add(XTX, XTX2);
+    gsl_vector_add(XTy, XTy2);
+  }
+
+  /* parallel accumulation: one task gives the serial result, and
+     several tasks give the same result in any order */
+  {
+    gsl_vector *XTy3 = gsl_vector_calloc(ncoeffs);
+    gsl_matrix *XTX3 = gsl_matrix_calloc(ncoeffs, order);
+    int status;
+
+    gsl_vector_set_zero(XTy2);
+    gsl_matrix_set_zero(XTX2);
+    gsl_bspline_lsnormal(x, y, wts, XTy2, XTX2, bw);
+    gsl_bspline_lsnormal_parallel(x, y, wts, XTy3, XTX3, bw, 1, NULL);
+
+    status = !gsl_vector_equal(XTy2, XTy3) || !gsl_matrix_equal(XTX2, XTX3);
+    gsl_test(status, "bspline lsnormal_parallel order=%zu nbreak=%zu one task",
+             order, nbreak);
+
+    gsl_vector_set_zero(XTy2);
+    gsl_matrix_set_zero(XTX2);
+    gsl_vector_set_zero(XTy3);
+    gsl_matrix_set_zero(XTX3);
+    gsl_bspline_lsnormal_parallel(x, y, wts, XTy2, XTX2, bw, NTASKS, NULL);
+    gsl_bspline_lsnormal_parallel(x, y, wts, XTy3, XTX3, bw, NTASKS, &reverse_exec);
+
+    status = !gsl_vector_equal(XTy2, XTy3) || !gsl_matrix_equal(XTX2, XTX3);
+    gsl_test(status, "bspline lsnormal_parallel order=%zu nbreak=%zu %d tasks",
+             order, nbreak, NTASKS);
+
+    for (j = 0; j < ncoeffs; j++)
+      {
+        gsl_test_rel(gsl_vector_get(XTy3, j), gsl_vector_get(XTy, j), 1.0e-12,
+                     "bspline lsnormal_parallel order=%zu nbreak=%zu XTy %zu",
+                     order, nbreak, j);
+
+        for (l = 0; l < order; l++)
+          gsl_test_rel(gsl_matrix_get(XTX3, j, l), gsl_matrix_get(XTX, j, l), 1.0e-12,
+                       "bspline lsnormal_parallel order=%zu nbreak=%zu XTX(%zu,%zu)",
+                       order, nbreak, j, l);
+      }
+
+    gsl_vector_free(XTy3);
+    gsl_matrix_free(XTX3);
+  }
+
+  for (j = 0; j < ncoeffs; j++)
+    {
+      double r = -gsl_vector_get(rhs, j);
+
+      gsl_test_rel(gsl_vector_get(XTy, j), gsl_vector_get(rhs, j), 1.0e-12,
+                   "bspline lsnormal order=%zu nbreak=%zu XTy %zu", order, nbreak, j);
+
+      for (l = 0; l < ncoeffs; l++)
+        {
+          if (l >= j && l - j < order)
+            gsl_test_rel(gsl_matrix_get(XTX, j, l - j), gsl_matrix_get(A, l, j), 1.0e-12,
+                         "bspline lsnormal order=%zu nbreak=%zu XTX(%zu,%zu)",
+                         order, nbreak, l, j);
+          else if (l >= j)
+            gsl_test_abs(gsl_matrix_get(A, l, j), 0.0, 0.0,
+                         "bspline lsnormal order=%zu nbreak=%zu outside band (%zu,%zu)",
+                         order, nbreak, l, j);
+
+          r += gsl_matrix_get(A, j, l) * gsl_vector_get(c, l);
+        }
+
+      /* the solution satisfies the dense normal equations */
+      gsl_test_abs(r, 0.0, 1.0e-10 * n,
+                   "bspline wlssolve order=%zu nbreak=%zu normal equation %zu",
+                   order, nbreak, j);
+    }
+
+  gsl_vector_free(x);
+  gsl_vector_free(y);
+  gsl_vector_free(wts);
+  gsl_vector_free(c0);
+  gsl_vector_free(c);
+  gsl_vector_free(B);
+  gsl_vector_free(XTy);
+  gsl_vector_free(XTy2);
+  gsl_vector_free(rhs);
+  gsl_matrix_free(XTX);
+  gsl_matrix_free(XTX2);
+  gsl_matrix_free(A);
+  gsl_bspline_free(bw);
+}
+
 int
 main(int argc, char **argv)
 {
@@ -128,6 +319,28 @@ main(int argc, char **argv)
         }
     }
 
+  /* decreasing breakpoints are rejected */
+  {
+    gsl_bspline_workspace *bw = gsl_bspline_alloc(4, 5);
+    gsl_vector *breakpts = gsl_vector_alloc(5);
+    gsl_error_handler_t *old_handler = gsl_set_error_handler_off();
+    int status;
+
+    for (i = 0; i < 5; i++)
+      gsl_vector_set(breakpts, i, (double) i);
+
+    gsl_vector_set(breakpts, 3, 1.5);
+    status = gsl_bspline_knots(breakpts, bw);
+    gsl_test_int(status, GSL_EINVAL, "b-spline decreasing breakpoints");
+
+    status = gsl_bspline_knots_uniform(1.0, 0.0, bw);
+    gsl_test_int(status, GSL_EINVAL, "b-spline uniform knots with b < a");
+
+    gsl_set_error_handler(old_handler);
+    gsl_vector_free(breakpts);
+    gsl_bspline_free(bw);
+  }
+
   /* Spot check known 0th, 1st, 2nd derivative
      evaluations for a particular k = 2 case.  */
   {
@@ -431,7 +644,8 @@ main(int argc, char **argv)
         gsl_test_abs(gsl_bspline_breakpoint(i,w), bpoint_data[i], GSL_DBL_EPSILON*50,
             "b-spline k=%d knots_greville breakpoint #%d", k, i);
       }
-    gsl_test_abs(abserr, 0.0, GSL_DBL_EPSILON*15,
+    /* the rounded breakpoints are made non-decreasing */
+    gsl_test_abs(abserr, 0.0, GSL_DBL_EPSILON*20,
         "b-spline k=%d nbreak=%d knots_greville abserr", k, nbreak);
 
     gsl_bspline_free(w);
@@ -514,5 +728,11 @@ main(int argc, char **argv)
     gsl_bspline_free(w);
   }
 
+  test_lssolve(1, 20);
+  test_lssolve(2, 2);
+  test_lssolve(4, 10);
+  test_lssolve(4, 40);
+  test_lssolve(6, 25);
+
   exit(gsl_test_summary());
 }
@@ -0,0 +1,59 @@
+/* gsl_executor.h
+ * 
+ * Copyright (C) 2026 Patrick Alken
+ * 
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#ifndef __GSL_EXECUTOR_H__
+#define __GSL_EXECUTOR_H__
+#include <stddef.h>
+
+#undef __BEGIN_DECLS
+#undef __END_DECLS
+#ifdef __cplusplus
+# define __BEGIN_DECLS extern "C" {
+# define __END_DECLS }
+#else
+# define __BEGIN_DECLS /* empty */
+# define __END_DECLS /* empty */
+#endif
+
+__BEGIN_DECLS
+
+/* A way of running independent tasks, for the parallel functions of
+   the library, which does not create any threads itself. The function
+   run must call task(i, data) exactly once for each i = 0, ...,
+   ntasks-1, in any order and on any threads, and return when all the
+   calls have finished. A null executor runs the tasks in order on the
+   calling thread.
+*/
+
+struct gsl_executor_struct {
+  void (*run) (size_t ntasks, void (*task) (size_t i, void * data),
+               void * data, void * params);
+  void * params;
+};
+
+typedef struct gsl_executor_struct gsl_executor;
+
+void gsl_executor_run (const gsl_executor * exec, const size_t ntasks,
+                       void (*task) (size_t i, void * data), void * data);
+
+size_t gsl_executor_block (const size_t n, const size_t ntasks, const size_t t);
+
+__END_DECLS
+
+#endif /* __GSL_EXECUTOR_H__ */
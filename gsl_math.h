@@ -20,6 +20,7 @@
 #ifndef __GSL_MATH_H__
 #define __GSL_MATH_H__
 #include <math.h>
+#include <stddef.h>
 #include <gsl/gsl_sys.h>
 #include <gsl/gsl_inline.h>
 #include <gsl/gsl_machine.h>
@@ -159,6 +160,19 @@ typedef struct gsl_function_vec_struct gsl_function_vec ;
 
 #define GSL_FN_VEC_EVAL(F,x,y) (*((F)->function))(x,y,(F)->params)
 
+/* Definition of an arbitrary function evaluated at the n points x[],
+   storing the values in y[] */
+
+struct gsl_function_batch_struct 
+{
+  void (* function) (size_t n, const double x[], double y[], void * params);
+  void * params;
+};
+
+typedef struct gsl_function_batch_struct gsl_function_batch ;
+
+#define GSL_FN_BATCH_EVAL(F,n,x,y) (*((F)->function))(n,x,y,(F)->params)
+
 __END_DECLS
 
 #endif /* __GSL_MATH_H__ */
@@ -18,10 +18,14 @@
  */
 
 #include <config.h>
+#include <stdlib.h>
+#include <gsl/gsl_math.h>
 #include <gsl/gsl_errno.h>
+#include <gsl/gsl_executor.h>
 #include <gsl/gsl_histogram.h>
 
 #include "find.c"
+#include "findarray.c"
 
 int
 gsl_histogram_increment (gsl_histogram * h, double x)
@@ -53,3 +57,181 @@ gsl_histogram_accumulate (gsl_histogram * h, double x, double weight)
 
   return GSL_SUCCESS;
 }
+
+int
+gsl_histogram_increment_array (gsl_histogram * h, const double x[],
+                               const size_t stride, const size_t n)
+{
+  return gsl_histogram_accumulate_array (h, x, stride, NULL, 0, n);
+}
+
+/*
+gsl_histogram_accumulate_array()
+  Add the weights w[i*wstride] to the bins containing x[i*xstride],
+i = 0 .. n-1. The ranges are checked for uniformity once, and the bins
+are then computed arithmetically or by a branchless binary search.
+
+Inputs: h       - histogram
+        x       - data values
+        xstride - stride of x
+        w       - weights, or NULL for unit weights
+        wstride - stride of w
+        n       - number of values
+
+Return: GSL_SUCCESS if all values are in range; GSL_EDOM if some
+values lie outside the histogram range, in which case they are skipped
+and the others are still added
+*/
+
+int
+gsl_histogram_accumulate_array (gsl_histogram * h, const double x[],
+                                const size_t xstride, const double w[],
+                                const size_t wstride, const size_t n)
+{
+  const size_t nbins = h->n;
+  find_table t;
+  size_t nout = 0;
+  size_t i;
+
+  find_table_init (&t, nbins, h->range);
+
+  for (i = 0; i < n; i++)
+    {
+      const size_t index = find_fast (&t, x[i * xstride]);
+
+      if (index < nbins)
+        {
+          h->bin[index] += (w == NULL) ? 1.0 : w[i * wstride];
+        }
+      else
+        {
+          nout++;
+        }
+    }
+
+  return (nout > 0) ? GSL_EDOM : GSL_SUCCESS;
+}
+
+int
+gsl_histogram_increment_array_parallel (gsl_histogram * h, const double x[],
+                                        const size_t stride, const size_t n,
+                                        const size_t ntasks,
+                                        const gsl_executor * exec)
+{
+  return gsl_histogram_accumulate_array_parallel (h, x, stride, NULL, 0, n,
+                                                  ntasks, exec);
+}
+
+typedef struct
+{
+  find_table t;
+  const double *x;
+  size_t xstride;
+  const double *w;
+  size_t wstride;
+  size_t n;
+  size_t ntasks;
+  double *bin[2];               /* bins of h, and the private bins of
+                                   tasks 1 .. ntasks-1 */
+  size_t *nout;                 /* values out of range in each task */
+} accumulate_workspace;
+
+/* fill the bins of task t from its block of the data */
+static void
+accumulate_task (size_t t, void *vw)
+{
+  accumulate_workspace *a = (accumulate_workspace *) vw;
+  const size_t nbins = a->t.n;
+  const size_t i1 = gsl_executor_block (a->n, a->ntasks, t + 1);
+  double *bin = (t == 0) ? a->bin[0] : a->bin[1] + (t - 1) * nbins;
+  size_t nout = 0;
+  size_t i;
+
+  for (i = gsl_executor_block (a->n, a->ntasks, t); i < i1; i++)
+    {
+      const size_t index = find_fast (&a->t, a->x[i * a->xstride]);
+
+      if (index < nbins)
+        {
+          bin[index] += (a->w == NULL) ? 1.0 : a->w[i * a->wstride];
+        }
+      else
+        {
+          nout++;
+        }
+    }
+
+  a->nout[t] = nout;
+}
+
+/*
+gsl_histogram_accumulate_array_parallel()
+  As gsl_histogram_accumulate_array(), with the data split into ntasks
+contiguous blocks which are run by exec. The first task adds to the
+bins of h and the others to private copies, which are then added to h
+in task order, so the result does not depend on the order in which the
+tasks are run, and with one task it is the same as the serial result.
+*/
+
+int
+gsl_histogram_accumulate_array_parallel (gsl_histogram * h, const double x[],
+                                         const size_t xstride,
+                                         const double w[],
+                                         const size_t wstride,
+                                         const size_t n, const size_t ntasks,
+                                         const gsl_executor * exec)
+{
+  const size_t nbins = h->n;
+  accumulate_workspace a;
+  size_t nout = 0;
+  size_t i, t;
+
+  if (ntasks == 0)
+    {
+      GSL_ERROR ("number of tasks must be positive", GSL_EINVAL);
+    }
+
+  a.bin[1] = (ntasks > 1) ? calloc ((ntasks - 1) * nbins, sizeof (double)) : NULL;
+
+  if (ntasks > 1 && a.bin[1] == NULL)
+    {
+      GSL_ERROR ("failed to allocate space for task bins", GSL_ENOMEM);
+    }
+
+  a.nout = malloc (ntasks * sizeof (size_t));
+
+  if (a.nout == NULL)
+    {
+      free (a.bin[1]);
+      GSL_ERROR ("failed to allocate space for task counts", GSL_ENOMEM);
+    }
+
+  find_table_init (&a.t, nbins, h->range);
+  a.x = x;
+  a.xstride = xstride;
+  a.w = w;
+  a.wstride = wstride;
+  a.n = n;
+  a.ntasks = ntasks;
+  a.bin[0] = h->bin;
+
+  gsl_executor_run (exec, ntasks, &accumulate_task, &a);
+
+  for (t = 0; t < ntasks; t++)
+    {
+      nout += a.nout[t];
+
+      if (t > 0)
+        {
+          const double *bin = a.bin[1] + (t - 1) * nbins;
+
+          for (i = 0; i < nbins; i++)
+            h->bin[i] += bin[i];
+        }
+    }
+
+  free (a.bin[1]);
+  free (a.nout);
+
+  return (nout > 0) ? GSL_EDOM : GSL_SUCCESS;
+}
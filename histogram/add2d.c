@@ -19,11 +19,14 @@
 
 #include <config.h>
 #include <stdlib.h>
+#include <gsl/gsl_math.h>
 #include <gsl/gsl_errno.h>
+#include <gsl/gsl_executor.h>
 #include <gsl/gsl_histogram.h>
 #include <gsl/gsl_histogram2d.h>
 
 #include "find2d.c"
+#include "findarray.c"
 
 int
 gsl_histogram2d_increment (gsl_histogram2d * h, double x, double y)
@@ -64,3 +67,183 @@ gsl_histogram2d_accumulate (gsl_histogram2d * h,
 
   return GSL_SUCCESS;
 }
+
+int
+gsl_histogram2d_increment_array (gsl_histogram2d * h,
+                                 const double x[], const size_t xstride,
+                                 const double y[], const size_t ystride,
+                                 const size_t n)
+{
+  return gsl_histogram2d_accumulate_array (h, x, xstride, y, ystride, NULL, 0, n);
+}
+
+/*
+gsl_histogram2d_accumulate_array()
+  Add the weights w[i*wstride] to the bins containing
+(x[i*xstride], y[i*ystride]), i = 0 .. n-1. See
+gsl_histogram_accumulate_array().
+*/
+
+int
+gsl_histogram2d_accumulate_array (gsl_histogram2d * h,
+                                  const double x[], const size_t xstride,
+                                  const double y[], const size_t ystride,
+                                  const double w[], const size_t wstride,
+                                  const size_t n)
+{
+  const size_t nx = h->nx;
+  const size_t ny = h->ny;
+  find_table tx, ty;
+  size_t nout = 0;
+  size_t i;
+
+  find_table_init (&tx, nx, h->xrange);
+  find_table_init (&ty, ny, h->yrange);
+
+  for (i = 0; i < n; i++)
+    {
+      const size_t ix = find_fast (&tx, x[i * xstride]);
+      const size_t iy = find_fast (&ty, y[i * ystride]);
+
+      if (ix < nx && iy < ny)
+        {
+          h->bin[ix * ny + iy] += (w == NULL) ? 1.0 : w[i * wstride];
+        }
+      else
+        {
+          nout++;
+        }
+    }
+
+  return (nout > 0) ? GSL_EDOM : GSL_SUCCESS;
+}
+
+int
+gsl_histogram2d_increment_array_parallel (gsl_histogram2d * h,
+                                          const double x[], const size_t xstride,
+                                          const double y[], const size_t ystride,
+                                          const size_t n, const size_t ntasks,
+                                          const gsl_executor * exec)
+{
+  return gsl_histogram2d_accumulate_array_parallel (h, x, xstride, y, ystride,
+                                                    NULL, 0, n, ntasks, exec);
+}
+
+typedef struct
+{
+  find_table tx;
+  find_table ty;
+  const double *x;
+  size_t xstride;
+  const double *y;
+  size_t ystride;
+  const double *w;
+  size_t wstride;
+  size_t n;
+  size_t ntasks;
+  double *bin[2];               /* bins of h, and the private bins of
+                                   tasks 1 .. ntasks-1 */
+  size_t *nout;                 /* points out of range in each task */
+} accumulate2d_workspace;
+
+/* fill the bins of task t from its block of the data */
+static void
+accumulate2d_task (size_t t, void *vw)
+{
+  accumulate2d_workspace *a = (accumulate2d_workspace *) vw;
+  const size_t nx = a->tx.n;
+  const size_t ny = a->ty.n;
+  const size_t i1 = gsl_executor_block (a->n, a->ntasks, t + 1);
+  double *bin = (t == 0) ? a->bin[0] : a->bin[1] + (t - 1) * nx * ny;
+  size_t nout = 0;
+  size_t i;
+
+  for (i = gsl_executor_block (a->n, a->ntasks, t); i < i1; i++)
+    {
+      const size_t ix = find_fast (&a->tx, a->x[i * a->xstride]);
+      const size_t iy = find_fast (&a->ty, a->y[i * a->ystride]);
+
+      if (ix < nx && iy < ny)
+        {
+          bin[ix * ny + iy] += (a->w == NULL) ? 1.0 : a->w[i * a->wstride];
+        }
+      else
+        {
+          nout++;
+        }
+    }
+
+  a->nout[t] = nout;
+}
+
+/*
+gsl_histogram2d_accumulate_array_parallel()
+  As gsl_histogram2d_accumulate_array(), with the data split into
+ntasks blocks. See gsl_histogram_accumulate_array_parallel().
+*/
+
+int
+gsl_histogram2d_accumulate_array_parallel (gsl_histogram2d * h,
+                                           const double x[], const size_t xstride,
+                                           const double y[], const size_t ystride,
+                                           const double w[], const size_t wstride,
+                                           const size_t n, const size_t ntasks,
+                                           const gsl_executor * exec)
+{
+  const size_t nbins = h->nx * h->ny;
+  accumulate2d_workspace a;
+  size_t nout = 0;
+  size_t i, t;
+
+  if (ntasks == 0)
+    {
+      GSL_ERROR ("number of tasks must be positive", GSL_EINVAL);
+    }
+
+  a.bin[1] = (ntasks > 1) ? calloc ((ntasks - 1) * nbins, sizeof (double)) : NULL;
+
+  if (ntasks > 1 && a.bin[1] == NULL)
+    {
+      GSL_ERROR ("failed to allocate space for task bins", GSL_ENOMEM);
+    }
+
+  a.nout = malloc (ntasks * sizeof (size_t));
+
+  if (a.nout == NULL)
+    {
+      free (a.bin[1]);
+      GSL_ERROR ("failed to allocate space for task counts", GSL_ENOMEM);
+    }
+
+  find_table_init (&a.tx, h->nx, h->xrange);
+  find_table_init (&a.ty, h->ny, h->yrange);
+  a.x = x;
+  a.xstride = xstride;
+  a.y = y;
+  a.ystride = ystride;
+  a.w = w;
+  a.wstride = wstride;
+  a.n = n;
+  a.ntasks = ntasks;
+  a.bin[0] = h->bin;
+
+  gsl_executor_run (exec, ntasks, &accumulate2d_task, &a);
+
+  for (t = 0; t < ntasks; t++)
+    {
+      nout += a.nout[t];
+
+      if (t > 0)
+        {
+          const double *bin = a.bin[1] + (t - 1) * nbins;
+
+          for (i = 0; i < nbins; i++)
+            h->bin[i] += bin[i];
+        }
+    }
+
+  free (a.bin[1]);
+  free (a.nout);
+
+  return (nout > 0) ? GSL_EDOM : GSL_SUCCESS;
+}
@@ -0,0 +1,131 @@
+/* histogram/alias.c
+ * 
+ * Copyright (C) 2026 Patrick Alken
+ * 
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+
+/* Construction of Walker's alias table for sampling a discrete
+ * distribution in O(1) time, using the method of Vose (IEEE Trans. Soft.
+ * Eng. 17, 972 (1991)), which is numerically stable and O(n).
+ *
+ * The weights w[i] need not be normalized.  On output bin i is chosen
+ * with probability prob[i] and its alias alias[i] otherwise. */
+
+static int alias_init (const size_t n, const double w[],
+                       double prob[], size_t alias[]);
+
+static int
+alias_init (const size_t n, const double w[],
+            double prob[], size_t alias[])
+{
+  /* small bins are pushed at the front of stack, large bins at the back */
+  size_t *stack = malloc (n * sizeof (size_t));
+  size_t nsmall = 0, nlarge = 0;
+  double total = 0;
+  size_t i;
+
+  if (stack == 0)
+    {
+      GSL_ERROR ("failed to allocate space for alias table workspace",
+                 GSL_ENOMEM);
+    }
+
+  for (i = 0; i < n; i++)
+    {
+      total += w[i];
+    }
+
+  for (i = 0; i < n; i++)
+    {
+      /* scaled so that the average bin has probability 1 */
+      prob[i] = (total > 0) ? (w[i] / total) * n : 1.0;
+      alias[i] = i;
+
+      if (prob[i] < 1.0)
+        stack[nsmall++] = i;
+      else
+        stack[n - ++nlarge] = i;
+    }
+
+  while (nsmall > 0 && nlarge > 0)
+    {
+      size_t s = stack[--nsmall];
+      size_t l = stack[n - nlarge];
+
+      alias[s] = l;
+      prob[l] -= 1.0 - prob[s];
+
+      if (prob[l] < 1.0)
+        {
+          nlarge--;
+          stack[nsmall++] = l;
+        }
+    }
+
+  /* whatever is left over differs from 1 only by rounding error */
+
+  while (nlarge > 0)
+    {
+      prob[stack[n - nlarge--]] = 1.0;
+    }
+
+  while (nsmall > 0)
+    {
+      prob[stack[--nsmall]] = 1.0;
+    }
+
+  free (stack);
+
+  return GSL_SUCCESS;
+}
+
+/* map a uniform random number r in [0,1) to a bin k using the alias
+ * table, returning in delta a uniform position within the bin derived
+ * from the unused low order part of r */
+
+static size_t alias_find (const size_t n, const double prob[],
+                          const size_t alias[], double r, double * delta);
+
+static size_t
+alias_find (const size_t n, const double prob[], const size_t alias[],
+            double r, double * delta)
+{
+  double u = r * n;
+  size_t k = (size_t) u;
+  double f;
+
+  if (k >= n)
+    {
+      /* r = 1 wraps to the bottom of the first bin as in
+         gsl_histogram_pdf_sample; negative r is handled by the caller */
+      k = 0;
+      u = 0.0;
+    }
+
+  f = u - k;
+
+  if (f < prob[k])
+    {
+      *delta = f / prob[k];
+      return k;
+    }
+  else
+    {
+      *delta = (f - prob[k]) / (1.0 - prob[k]);
+      return alias[k];
+    }
+}
@@ -0,0 +1,122 @@
+/* histogram/benchmark.c
+ *
+ * Copyright (C) 2026 Patrick Alken
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* fill rates of gsl_histogram_increment and gsl_histogram_increment_array
+ * for uniform and non-uniform bins, and sampling rates of the cumulative
+ * and alias table pdf samplers; usage: benchmark [n] [nbins] */
+
+#include <config.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <time.h>
+#include <gsl/gsl_histogram.h>
+#include <gsl/gsl_rng.h>
+#include <gsl/gsl_randist.h>
+
+static double
+seconds (clock_t start)
+{
+  return (clock () - start) / (double) CLOCKS_PER_SEC;
+}
+
+int
+main (int argc, char *argv[])
+{
+  const size_t n = (argc > 1) ? (size_t) atol (argv[1]) : 10000000;
+  const size_t nbins = (argc > 2) ? (size_t) atol (argv[2]) : 1000;
+  gsl_rng *r = gsl_rng_alloc (gsl_rng_default);
+  gsl_histogram *h = gsl_histogram_calloc_uniform (nbins, -4.0, 4.0);
+  double *x = malloc (n * sizeof (double));
+  int uniform;
+  size_t i;
+
+  for (i = 0; i < n; ++i)
+    x[i] = gsl_ran_gaussian (r, 1.0);
+
+  printf ("n = %zu, %zu bins\n", n, nbins);
+  printf ("%12s %12s %12s\n", "bins", "increment", "array");
+
+  for (uniform = 1; uniform >= 0; --uniform)
+    {
+      double t_single, t_array;
+      clock_t start;
+
+      if (!uniform)
+        {
+          /* bins of increasing width */
+          for (i = 0; i <= nbins; ++i)
+            {
+              double u = (double) i / (double) nbins;
+              h->range[i] = -4.0 + 8.0 * u * u;
+            }
+        }
+
+      gsl_histogram_reset (h);
+      start = clock ();
+      for (i = 0; i < n; ++i)
+        gsl_histogram_increment (h, x[i]);
+      t_single = seconds (start);
+
+      gsl_histogram_reset (h);
+      start = clock ();
+      gsl_histogram_increment_array (h, x, 1, n);
+      t_array = seconds (start);
+
+      printf ("%12s %10.1f M/s %8.1f M/s\n", uniform ? "uniform" : "non-uniform",
+              n / t_single * 1.0e-6, n / t_array * 1.0e-6);
+    }
+
+  {
+    gsl_histogram_pdf *p = gsl_histogram_pdf_alloc (nbins);
+    double t_cdf, t_alias, t_n;
+    clock_t start;
+
+    gsl_histogram_pdf_init (p, h);
+
+    for (i = 0; i < n; ++i)
+      x[i] = gsl_rng_uniform (r);
+
+    start = clock ();
+    for (i = 0; i < n; ++i)
+      gsl_histogram_pdf_sample (p, x[i]);
+    t_cdf = seconds (start);
+
+    start = clock ();
+    for (i = 0; i < n; ++i)
+      gsl_histogram_pdf_sample_alias (p, x[i]);
+    t_alias = seconds (start);
+
+    start = clock ();
+    gsl_histogram_pdf_sample_n (p, x, x, n);
+    t_n = seconds (start);
+
+    printf ("%12s %12s %12s %12s\n", "pdf", "sample", "alias", "sample_n");
+    printf ("%12s %10.1f M/s %8.1f M/s %8.1f M/s\n", "non-uniform",
+            n / t_cdf * 1.0e-6, n / t_alias * 1.0e-6, n / t_n * 1.0e-6);
+
+    gsl_histogram_pdf_free (p);
+  }
+
+  free (x);
+  gsl_histogram_free (h);
+  gsl_rng_free (r);
+
+  return 0;
+}
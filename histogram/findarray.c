@@ -0,0 +1,108 @@
+/* histogram/findarray.c
+ * 
+ * Copyright (C) 2026 Patrick Alken
+ * 
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* fast bin lookup for the _array functions: the ranges are examined
+ * once, and if they are uniform the bin is computed arithmetically and
+ * corrected against the stored ranges, otherwise a binary search without
+ * data dependent branches is used */
+
+typedef struct
+{
+  size_t n;
+  const double *range;
+  int uniform;
+  double xmin;
+  double xmax;
+  double scale;
+} find_table;
+
+static void find_table_init (find_table * t, const size_t n, const double range[]);
+static inline size_t find_fast (const find_table * t, const double x);
+
+static void
+find_table_init (find_table * t, const size_t n, const double range[])
+{
+  const double xmin = range[0];
+  const double xmax = range[n];
+  const double dx = (xmax - xmin) / (double) n;
+  size_t i;
+
+  t->n = n;
+  t->range = range;
+  t->xmin = xmin;
+  t->xmax = xmax;
+  t->scale = (double) n / (xmax - xmin);
+
+  /* if every range lies within half a bin width of its uniform
+   * position, the arithmetic guess is off by at most one bin */
+  t->uniform = 1;
+
+  for (i = 1; i < n; i++)
+    {
+      if (fabs (range[i] - (xmin + i * dx)) > 0.5 * dx)
+        {
+          t->uniform = 0;
+          break;
+        }
+    }
+}
+
+/* return the bin containing x, as find() would, or n if x lies outside
+ * the histogram range or is a nan */
+static inline size_t
+find_fast (const find_table * t, const double x)
+{
+  const size_t n = t->n;
+  const double *range = t->range;
+  size_t i;
+
+  if (!(x >= t->xmin && x < t->xmax))
+    {
+      return n;
+    }
+
+  if (t->uniform)
+    {
+      /* conversion through long is faster than directly to size_t */
+      i = (size_t) (long) ((x - t->xmin) * t->scale);
+
+      if (i > n - 1)
+        i = n - 1;
+
+      if (x < range[i])
+        i--;
+      else if (x >= range[i + 1])
+        i++;
+    }
+  else
+    {
+      size_t len = n;
+
+      i = 0;
+
+      while (len > 1)
+        {
+          const size_t half = len / 2;
+          i = (range[i + half] <= x) ? i + half : i;
+          len -= half;
+        }
+    }
+
+  return i;
+}
@@ -22,6 +22,7 @@
 
 #include <stdlib.h>
 #include <stdio.h>
+#include <gsl/gsl_executor.h>
 
 #undef __BEGIN_DECLS
 #undef __END_DECLS
@@ -45,6 +46,8 @@ typedef struct {
   size_t n ;
   double * range ;
   double * sum ;
+  double * prob ;   /* alias table */
+  size_t * alias ;
 } gsl_histogram_pdf ;
 
 gsl_histogram * gsl_histogram_alloc (size_t n);
@@ -54,6 +57,20 @@ gsl_histogram * gsl_histogram_calloc_uniform (const size_t n, const double xmin,
 void gsl_histogram_free (gsl_histogram * h);
 int gsl_histogram_increment (gsl_histogram * h, double x);
 int gsl_histogram_accumulate (gsl_histogram * h, double x, double weight);
+int gsl_histogram_increment_array (gsl_histogram * h, const double x[],
+                                   const size_t stride, const size_t n);
+int gsl_histogram_accumulate_array (gsl_histogram * h, const double x[],
+                                    const size_t xstride, const double w[],
+                                    const size_t wstride, const size_t n);
+int gsl_histogram_increment_array_parallel (gsl_histogram * h, const double x[],
+                                            const size_t stride, const size_t n,
+                                            const size_t ntasks,
+                                            const gsl_executor * exec);
+int gsl_histogram_accumulate_array_parallel (gsl_histogram * h, const double x[],
+                                             const size_t xstride, const double w[],
+                                             const size_t wstride, const size_t n,
+                                             const size_t ntasks,
+                                             const gsl_executor * exec);
 int gsl_histogram_find (const gsl_histogram * h, 
                         const double x, size_t * i);
 
@@ -128,6 +145,9 @@ gsl_histogram_pdf * gsl_histogram_pdf_alloc (const size_t n);
 int gsl_histogram_pdf_init (gsl_histogram_pdf * p, const gsl_histogram * h);
 void gsl_histogram_pdf_free (gsl_histogram_pdf * p);
 double gsl_histogram_pdf_sample (const gsl_histogram_pdf * p, double r);
+double gsl_histogram_pdf_sample_alias (const gsl_histogram_pdf * p, double r);
+int gsl_histogram_pdf_sample_n (const gsl_histogram_pdf * p, const double r[],
+                                double x[], const size_t n);
 
 __END_DECLS
 
@@ -22,6 +22,7 @@
 
 #include <stdlib.h>
 #include <stdio.h>
+#include <gsl/gsl_executor.h>
 
 #undef __BEGIN_DECLS
 #undef __END_DECLS
@@ -47,8 +48,32 @@ typedef struct {
   double * xrange ;
   double * yrange ;
   double * sum ;
+  double * prob ;   /* alias table */
+  size_t * alias ;
 } gsl_histogram2d_pdf ;
 
+typedef struct {
+  size_t nx, ny ;
+  double * xrange ;
+  double * yrange ;
+  size_t nnz ;      /* number of stored bins */
+  size_t nmax ;     /* allocated length of key and bin */
+  size_t * key ;    /* bin index i * ny + j of each stored bin */
+  double * bin ;
+  size_t tsize ;    /* hash table size, a power of 2 */
+  size_t * table ;  /* entry number + 1, or 0 for an empty slot */
+} gsl_histogram2d_sparse ;
+
+typedef struct {
+  size_t nx, ny ;
+  double * xrange ;
+  double * yrange ;
+  size_t n ;        /* number of populated bins */
+  size_t nmax ;
+  size_t * key ;
+  double * sum ;
+} gsl_histogram2d_sparse_pdf ;
+
 gsl_histogram2d * gsl_histogram2d_alloc (const size_t nx, const size_t ny);
 gsl_histogram2d * gsl_histogram2d_calloc (const size_t nx, const size_t ny);
 gsl_histogram2d * gsl_histogram2d_calloc_uniform (const size_t nx, const size_t ny,
@@ -60,6 +85,26 @@ void gsl_histogram2d_free (gsl_histogram2d * h);
 int gsl_histogram2d_increment (gsl_histogram2d * h, double x, double y);
 int gsl_histogram2d_accumulate (gsl_histogram2d * h, 
                                 double x, double y, double weight);
+int gsl_histogram2d_increment_array (gsl_histogram2d * h,
+                                     const double x[], const size_t xstride,
+                                     const double y[], const size_t ystride,
+                                     const size_t n);
+int gsl_histogram2d_accumulate_array (gsl_histogram2d * h,
+                                      const double x[], const size_t xstride,
+                                      const double y[], const size_t ystride,
+                                      const double w[], const size_t wstride,
+                                      const size_t n);
+int gsl_histogram2d_increment_array_parallel (gsl_histogram2d * h,
+                                              const double x[], const size_t xstride,
+                                              const double y[], const size_t ystride,
+                                              const size_t n, const size_t ntasks,
+                                              const gsl_executor * exec);
+int gsl_histogram2d_accumulate_array_parallel (gsl_histogram2d * h,
+                                               const double x[], const size_t xstride,
+                                               const double y[], const size_t ystride,
+                                               const double w[], const size_t wstride,
+                                               const size_t n, const size_t ntasks,
+                                               const gsl_executor * exec);
 int gsl_histogram2d_find (const gsl_histogram2d * h, 
                           const double x, const double y, size_t * i, size_t * j);
 
@@ -165,6 +210,57 @@ void gsl_histogram2d_pdf_free (gsl_histogram2d_pdf * p);
 int gsl_histogram2d_pdf_sample (const gsl_histogram2d_pdf * p, 
                                    double r1, double r2, 
                                    double * x, double * y);
+int gsl_histogram2d_pdf_sample_alias (const gsl_histogram2d_pdf * p,
+                                      double r1, double r2,
+                                      double * x, double * y);
+int gsl_histogram2d_pdf_sample_n (const gsl_histogram2d_pdf * p,
+                                  const double r1[], const double r2[],
+                                  double x[], double y[], const size_t n);
+
+gsl_histogram2d_sparse * gsl_histogram2d_sparse_alloc (const size_t nx, const size_t ny);
+void gsl_histogram2d_sparse_free (gsl_histogram2d_sparse * h);
+void gsl_histogram2d_sparse_reset (gsl_histogram2d_sparse * h);
+int gsl_histogram2d_sparse_set_ranges_uniform (gsl_histogram2d_sparse * h,
+                                               double xmin, double xmax,
+                                               double ymin, double ymax);
+int gsl_histogram2d_sparse_set_ranges (gsl_histogram2d_sparse * h,
+                                       const double xrange[], size_t xsize,
+                                       const double yrange[], size_t ysize);
+int gsl_histogram2d_sparse_increment (gsl_histogram2d_sparse * h, double x, double y);
+int gsl_histogram2d_sparse_accumulate (gsl_histogram2d_sparse * h,
+                                       double x, double y, double weight);
+int gsl_histogram2d_sparse_find (const gsl_histogram2d_sparse * h,
+                                 const double x, const double y,
+                                 size_t * i, size_t * j);
+double gsl_histogram2d_sparse_get (const gsl_histogram2d_sparse * h,
+                                   const size_t i, const size_t j);
+size_t gsl_histogram2d_sparse_nnz (const gsl_histogram2d_sparse * h);
+int gsl_histogram2d_sparse_get_entry (const gsl_histogram2d_sparse * h, const size_t k,
+                                      size_t * i, size_t * j, double * value);
+int gsl_histogram2d_sparse_equal_bins_p (const gsl_histogram2d_sparse * h1,
+                                         const gsl_histogram2d_sparse * h2);
+int gsl_histogram2d_sparse_add (gsl_histogram2d_sparse * h1,
+                                const gsl_histogram2d_sparse * h2);
+int gsl_histogram2d_sparse_scale (gsl_histogram2d_sparse * h, double scale);
+int gsl_histogram2d_sparse_sp2d (gsl_histogram2d * h, const gsl_histogram2d_sparse * S);
+int gsl_histogram2d_sparse_d2sp (gsl_histogram2d_sparse * S, const gsl_histogram2d * h);
+
+double gsl_histogram2d_sparse_sum (const gsl_histogram2d_sparse * h);
+double gsl_histogram2d_sparse_max_val (const gsl_histogram2d_sparse * h);
+double gsl_histogram2d_sparse_min_val (const gsl_histogram2d_sparse * h);
+double gsl_histogram2d_sparse_xmean (const gsl_histogram2d_sparse * h);
+double gsl_histogram2d_sparse_ymean (const gsl_histogram2d_sparse * h);
+double gsl_histogram2d_sparse_xsigma (const gsl_histogram2d_sparse * h);
+double gsl_histogram2d_sparse_ysigma (const gsl_histogram2d_sparse * h);
+double gsl_histogram2d_sparse_cov (const gsl_histogram2d_sparse * h);
+
+gsl_histogram2d_sparse_pdf * gsl_histogram2d_sparse_pdf_alloc (const size_t nx, const size_t ny);
+int gsl_histogram2d_sparse_pdf_init (gsl_histogram2d_sparse_pdf * p,
+                                     const gsl_histogram2d_sparse * h);
+void gsl_histogram2d_sparse_pdf_free (gsl_histogram2d_sparse_pdf * p);
+int gsl_histogram2d_sparse_pdf_sample (const gsl_histogram2d_sparse_pdf * p,
+                                       double r1, double r2,
+                                       double * x, double * y);
 
 __END_DECLS
 
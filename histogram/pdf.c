@@ -23,6 +23,7 @@
 #include <gsl/gsl_histogram.h>
 
 #include "find.c"
+#include "alias.c"
 
 double
 gsl_histogram_pdf_sample (const gsl_histogram_pdf * p, double r)
@@ -53,6 +54,49 @@ gsl_histogram_pdf_sample (const gsl_histogram_pdf * p, double r)
     }
 }
 
+double
+gsl_histogram_pdf_sample_alias (const gsl_histogram_pdf * p, double r)
+{
+  size_t i;
+  double delta;
+
+  if (!(r >= 0.0 && r <= 1.0))
+    {
+      GSL_ERROR_VAL ("r must lie in the range [0,1]", GSL_EDOM, 0);
+    }
+
+  i = alias_find (p->n, p->prob, p->alias, r, &delta);
+
+  return p->range[i] + delta * (p->range[i + 1] - p->range[i]);
+}
+
+/* draw n samples from the alias table, one for each uniform random
+   number in r[], which may be the same array as x[] */
+int
+gsl_histogram_pdf_sample_n (const gsl_histogram_pdf * p, const double r[],
+                            double x[], const size_t n)
+{
+  const double *range = p->range;
+  size_t k;
+
+  for (k = 0; k < n; k++)
+    {
+      const double rk = r[k];
+      size_t i;
+      double delta;
+
+      if (!(rk >= 0.0 && rk <= 1.0))
+        {
+          GSL_ERROR ("r must lie in the range [0,1]", GSL_EDOM);
+        }
+
+      i = alias_find (p->n, p->prob, p->alias, rk, &delta);
+      x[k] = range[i] + delta * (range[i + 1] - range[i]);
+    }
+
+  return GSL_SUCCESS;
+}
+
 gsl_histogram_pdf *
 gsl_histogram_pdf_alloc (const size_t n)
 {
@@ -93,6 +137,21 @@ gsl_histogram_pdf_alloc (const size_t n)
                         GSL_ENOMEM, 0);
     }
 
+  p->prob = (double *) malloc (n * sizeof (double));
+  p->alias = (size_t *) malloc (n * sizeof (size_t));
+
+  if (p->prob == 0 || p->alias == 0)
+    {
+      free (p->alias);
+      free (p->prob);
+      free (p->sum);
+      free (p->range);
+      free (p);         /* exception in constructor, avoid memory leak */
+
+      GSL_ERROR_VAL ("failed to allocate space for histogram pdf alias table",
+                        GSL_ENOMEM, 0);
+    }
+
   p->n = n;
 
   return p;
@@ -140,7 +199,7 @@ gsl_histogram_pdf_init (gsl_histogram_pdf * p, const gsl_histogram * h)
       }
   }
 
-  return GSL_SUCCESS;
+  return alias_init (n, h->bin, p->prob, p->alias);
 }
 
 
@@ -150,5 +209,7 @@ gsl_histogram_pdf_free (gsl_histogram_pdf * p)
   RETURN_IF_NULL (p);
   free (p->range);
   free (p->sum);
+  free (p->prob);
+  free (p->alias);
   free (p);
 }
@@ -24,6 +24,7 @@
 #include <gsl/gsl_histogram2d.h>
 
 #include "find.c"
+#include "alias.c"
 
 int
 gsl_histogram2d_pdf_sample (const gsl_histogram2d_pdf * p,
@@ -63,6 +64,71 @@ gsl_histogram2d_pdf_sample (const gsl_histogram2d_pdf * p,
     }
 }
 
+int
+gsl_histogram2d_pdf_sample_alias (const gsl_histogram2d_pdf * p,
+                                  double r1, double r2,
+                                  double *x, double *y)
+{
+  size_t k, i, j;
+  double delta;
+
+  if (!(r1 >= 0.0 && r1 <= 1.0) || !(r2 >= 0.0 && r2 <= 1.0))
+    {
+      GSL_ERROR ("r1 and r2 must lie in the range [0,1]", GSL_EDOM);
+    }
+
+  if (r2 == 1.0)
+    {
+      r2 = 0.0;
+    }
+
+  k = alias_find (p->nx * p->ny, p->prob, p->alias, r1, &delta);
+  i = k / p->ny;
+  j = k - (i * p->ny);
+  *x = p->xrange[i] + delta * (p->xrange[i + 1] - p->xrange[i]);
+  *y = p->yrange[j] + r2 * (p->yrange[j + 1] - p->yrange[j]);
+
+  return GSL_SUCCESS;
+}
+
+/* draw n samples from the alias table, using the pairs of uniform
+   random numbers r1[], r2[], which may be the same arrays as x[], y[] */
+int
+gsl_histogram2d_pdf_sample_n (const gsl_histogram2d_pdf * p,
+                              const double r1[], const double r2[],
+                              double x[], double y[], const size_t n)
+{
+  const size_t ny = p->ny;
+  const size_t nbins = p->nx * ny;
+  size_t m;
+
+  for (m = 0; m < n; m++)
+    {
+      const double u1 = r1[m];
+      double u2 = r2[m];
+      size_t k, i, j;
+      double delta;
+
+      if (!(u1 >= 0.0 && u1 <= 1.0) || !(u2 >= 0.0 && u2 <= 1.0))
+        {
+          GSL_ERROR ("r1 and r2 must lie in the range [0,1]", GSL_EDOM);
+        }
+
+      if (u2 == 1.0)
+        {
+          u2 = 0.0;
+        }
+
+      k = alias_find (nbins, p->prob, p->alias, u1, &delta);
+      i = k / ny;
+      j = k - (i * ny);
+      x[m] = p->xrange[i] + delta * (p->xrange[i + 1] - p->xrange[i]);
+      y[m] = p->yrange[j] + u2 * (p->yrange[j + 1] - p->yrange[j]);
+    }
+
+  return GSL_SUCCESS;
+}
+
 gsl_histogram2d_pdf *
 gsl_histogram2d_pdf_alloc (const size_t nx, const size_t ny)
 {
@@ -117,6 +183,22 @@ gsl_histogram2d_pdf_alloc (const size_t nx, const size_t ny)
                         GSL_ENOMEM, 0);
     }
 
+  p->prob = (double *) malloc (n * sizeof (double));
+  p->alias = (size_t *) malloc (n * sizeof (size_t));
+
+  if (p->prob == 0 || p->alias == 0)
+    {
+      free (p->alias);
+      free (p->prob);
+      free (p->sum);
+      free (p->yrange);
+      free (p->xrange);
+      free (p);         /* exception in constructor, avoid memory leak */
+
+      GSL_ERROR_VAL ("failed to allocate space for histogram2d pdf alias table",
+                        GSL_ENOMEM, 0);
+    }
+
   p->nx = nx;
   p->ny = ny;
 
@@ -172,7 +254,7 @@ gsl_histogram2d_pdf_init (gsl_histogram2d_pdf * p, const gsl_histogram2d * h)
       }
   }
 
-  return GSL_SUCCESS;
+  return alias_init (n, h->bin, p->prob, p->alias);
 }
 
 
@@ -183,5 +265,7 @@ gsl_histogram2d_pdf_free (gsl_histogram2d_pdf * p)
   free (p->xrange);
   free (p->yrange);
   free (p->sum);
+  free (p->prob);
+  free (p->alias);
   free (p);
 }
@@ -0,0 +1,531 @@
+/* histogram/sparse2d.c
+ * 
+ * Copyright (C) 2026 Patrick Alken
+ * 
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/*
+ * Sparse 2D histograms. Only bins which have been accumulated into are
+ * stored, as (key, value) pairs with key = i * ny + j, in arrays of
+ * entries in order of first use. An open addressing hash table with
+ * linear probing maps keys to entries, and is kept at most half full.
+ */
+
+#include <config.h>
+#include <stdlib.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_histogram.h>
+#include <gsl/gsl_histogram2d.h>
+
+#include "find2d.c"
+
+/* initial number of entries and hash table size */
+#define SPARSE_INIT_SIZE 64
+
+static int sparse_resize (gsl_histogram2d_sparse * h, const size_t nmax);
+static size_t *sparse_slot (const gsl_histogram2d_sparse * h, const size_t key);
+static double *sparse_bin (gsl_histogram2d_sparse * h, const size_t key);
+static void make_uniform (double range[], size_t n, double xmin, double xmax);
+
+gsl_histogram2d_sparse *
+gsl_histogram2d_sparse_alloc (const size_t nx, const size_t ny)
+{
+  gsl_histogram2d_sparse *h;
+  size_t i;
+
+  if (nx == 0)
+    {
+      GSL_ERROR_VAL ("histogram2d length nx must be positive integer",
+                     GSL_EDOM, 0);
+    }
+
+  if (ny == 0)
+    {
+      GSL_ERROR_VAL ("histogram2d length ny must be positive integer",
+                     GSL_EDOM, 0);
+    }
+
+  if (nx > ((size_t) -1) / ny)
+    {
+      GSL_ERROR_VAL ("number of bins nx * ny is too large", GSL_EDOM, 0);
+    }
+
+  h = calloc (1, sizeof (gsl_histogram2d_sparse));
+
+  if (h == 0)
+    {
+      GSL_ERROR_VAL ("failed to allocate space for histogram2d struct",
+                     GSL_ENOMEM, 0);
+    }
+
+  h->xrange = malloc ((nx + 1) * sizeof (double));
+  h->yrange = malloc ((ny + 1) * sizeof (double));
+
+  if (h->xrange == 0 || h->yrange == 0)
+    {
+      gsl_histogram2d_sparse_free (h);
+      GSL_ERROR_VAL ("failed to allocate space for histogram2d ranges",
+                     GSL_ENOMEM, 0);
+    }
+
+  h->nx = nx;
+  h->ny = ny;
+
+  if (sparse_resize (h, SPARSE_INIT_SIZE))
+    {
+      gsl_histogram2d_sparse_free (h);
+      GSL_ERROR_VAL ("failed to allocate space for histogram2d bins",
+                     GSL_ENOMEM, 0);
+    }
+
+  for (i = 0; i < nx + 1; i++)
+    {
+      h->xrange[i] = i;
+    }
+
+  for (i = 0; i < ny + 1; i++)
+    {
+      h->yrange[i] = i;
+    }
+
+  return h;
+}
+
+void
+gsl_histogram2d_sparse_free (gsl_histogram2d_sparse * h)
+{
+  RETURN_IF_NULL (h);
+  free (h->xrange);
+  free (h->yrange);
+  free (h->key);
+  free (h->bin);
+  free (h->table);
+  free (h);
+}
+
+void
+gsl_histogram2d_sparse_reset (gsl_histogram2d_sparse * h)
+{
+  size_t i;
+
+  for (i = 0; i < h->tsize; i++)
+    {
+      h->table[i] = 0;
+    }
+
+  h->nnz = 0;
+}
+
+int
+gsl_histogram2d_sparse_set_ranges_uniform (gsl_histogram2d_sparse * h,
+                                           double xmin, double xmax,
+                                           double ymin, double ymax)
+{
+  const size_t nx = h->nx, ny = h->ny;
+
+  if (xmin >= xmax)
+    {
+      GSL_ERROR ("xmin must be less than xmax", GSL_EINVAL);
+    }
+
+  if (ymin >= ymax)
+    {
+      GSL_ERROR ("ymin must be less than ymax", GSL_EINVAL);
+    }
+
+  /* same ranges as gsl_histogram2d_set_ranges_uniform */
+
+  make_uniform (h->xrange, nx, xmin, xmax);
+  make_uniform (h->yrange, ny, ymin, ymax);
+
+  gsl_histogram2d_sparse_reset (h);
+
+  return GSL_SUCCESS;
+}
+
+int
+gsl_histogram2d_sparse_set_ranges (gsl_histogram2d_sparse * h,
+                                   const double xrange[], size_t xsize,
+                                   const double yrange[], size_t ysize)
+{
+  size_t i;
+  const size_t nx = h->nx, ny = h->ny;
+
+  if (xsize != (nx + 1))
+    {
+      GSL_ERROR ("size of xrange must match size of histogram", GSL_EINVAL);
+    }
+
+  if (ysize != (ny + 1))
+    {
+      GSL_ERROR ("size of yrange must match size of histogram", GSL_EINVAL);
+    }
+
+  for (i = 0; i <= nx; i++)
+    {
+      h->xrange[i] = xrange[i];
+    }
+
+  for (i = 0; i <= ny; i++)
+    {
+      h->yrange[i] = yrange[i];
+    }
+
+  gsl_histogram2d_sparse_reset (h);
+
+  return GSL_SUCCESS;
+}
+
+int
+gsl_histogram2d_sparse_increment (gsl_histogram2d_sparse * h, double x, double y)
+{
+  return gsl_histogram2d_sparse_accumulate (h, x, y, 1.0);
+}
+
+int
+gsl_histogram2d_sparse_accumulate (gsl_histogram2d_sparse * h,
+                                   double x, double y, double weight)
+{
+  size_t i = 0, j = 0;
+  double *bin;
+
+  int status = find2d (h->nx, h->xrange, h->ny, h->yrange, x, y, &i, &j);
+
+  if (status)
+    {
+      return GSL_EDOM;
+    }
+
+  bin = sparse_bin (h, i * h->ny + j);
+
+  if (bin == 0)
+    {
+      GSL_ERROR ("failed to allocate space for histogram2d bins", GSL_ENOMEM);
+    }
+
+  *bin += weight;
+
+  return GSL_SUCCESS;
+}
+
+int
+gsl_histogram2d_sparse_find (const gsl_histogram2d_sparse * h,
+                             const double x, const double y,
+                             size_t * i, size_t * j)
+{
+  int status = find2d (h->nx, h->xrange, h->ny, h->yrange, x, y, i, j);
+
+  if (status)
+    {
+      GSL_ERROR ("x or y not found in range of h", GSL_EDOM);
+    }
+
+  return GSL_SUCCESS;
+}
+
+double
+gsl_histogram2d_sparse_get (const gsl_histogram2d_sparse * h,
+                            const size_t i, const size_t j)
+{
+  const size_t *slot;
+
+  if (i >= h->nx)
+    {
+      GSL_ERROR_VAL ("index i lies outside valid range of 0 .. nx - 1",
+                     GSL_EDOM, 0);
+    }
+
+  if (j >= h->ny)
+    {
+      GSL_ERROR_VAL ("index j lies outside valid range of 0 .. ny - 1",
+                     GSL_EDOM, 0);
+    }
+
+  slot = sparse_slot (h, i * h->ny + j);
+
+  return (*slot) ? h->bin[*slot - 1] : 0.0;
+}
+
+size_t
+gsl_histogram2d_sparse_nnz (const gsl_histogram2d_sparse * h)
+{
+  return h->nnz;
+}
+
+int
+gsl_histogram2d_sparse_get_entry (const gsl_histogram2d_sparse * h, const size_t k,
+                                  size_t * i, size_t * j, double * value)
+{
+  if (k >= h->nnz)
+    {
+      GSL_ERROR ("entry k lies outside valid range of 0 .. nnz - 1", GSL_EDOM);
+    }
+
+  *i = h->key[k] / h->ny;
+  *j = h->key[k] % h->ny;
+  *value = h->bin[k];
+
+  return GSL_SUCCESS;
+}
+
+int
+gsl_histogram2d_sparse_equal_bins_p (const gsl_histogram2d_sparse * h1,
+                                     const gsl_histogram2d_sparse * h2)
+{
+  size_t i;
+
+  if (h1->nx != h2->nx || h1->ny != h2->ny)
+    {
+      return 0;
+    }
+
+  for (i = 0; i <= h1->nx; i++)
+    {
+      if (h1->xrange[i] != h2->xrange[i])
+        {
+          return 0;
+        }
+    }
+
+  for (i = 0; i <= h1->ny; i++)
+    {
+      if (h1->yrange[i] != h2->yrange[i])
+        {
+          return 0;
+        }
+    }
+
+  return 1;
+}
+
+/* merge h2 into h1 */
+int
+gsl_histogram2d_sparse_add (gsl_histogram2d_sparse * h1,
+                            const gsl_histogram2d_sparse * h2)
+{
+  size_t k;
+
+  if (!gsl_histogram2d_sparse_equal_bins_p (h1, h2))
+    {
+      GSL_ERROR ("histograms have different binning", GSL_EINVAL);
+    }
+
+  for (k = 0; k < h2->nnz; k++)
+    {
+      double *bin = sparse_bin (h1, h2->key[k]);
+
+      if (bin == 0)
+        {
+          GSL_ERROR ("failed to allocate space for histogram2d bins", GSL_ENOMEM);
+        }
+
+      *bin += h2->bin[k];
+    }
+
+  return GSL_SUCCESS;
+}
+
+int
+gsl_histogram2d_sparse_scale (gsl_histogram2d_sparse * h, double scale)
+{
+  size_t k;
+
+  for (k = 0; k < h->nnz; k++)
+    {
+      h->bin[k] *= scale;
+    }
+
+  return GSL_SUCCESS;
+}
+
+/* convert the sparse histogram S to the dense histogram h */
+int
+gsl_histogram2d_sparse_sp2d (gsl_histogram2d * h, const gsl_histogram2d_sparse * S)
+{
+  if (h->nx != S->nx || h->ny != S->ny)
+    {
+      GSL_ERROR ("histograms must have the same dimensions", GSL_EBADLEN);
+    }
+  else
+    {
+      size_t i, k;
+
+      for (i = 0; i <= S->nx; i++)
+        {
+          h->xrange[i] = S->xrange[i];
+        }
+
+      for (i = 0; i <= S->ny; i++)
+        {
+          h->yrange[i] = S->yrange[i];
+        }
+
+      for (i = 0; i < S->nx * S->ny; i++)
+        {
+          h->bin[i] = 0.0;
+        }
+
+      for (k = 0; k < S->nnz; k++)
+        {
+          h->bin[S->key[k]] = S->bin[k];
+        }
+
+      return GSL_SUCCESS;
+    }
+}
+
+/* convert the dense histogram h to the sparse histogram S; only
+ * non-zero bins are stored */
+int
+gsl_histogram2d_sparse_d2sp (gsl_histogram2d_sparse * S, const gsl_histogram2d * h)
+{
+  if (h->nx != S->nx || h->ny != S->ny)
+    {
+      GSL_ERROR ("histograms must have the same dimensions", GSL_EBADLEN);
+    }
+  else
+    {
+      size_t i;
+
+      gsl_histogram2d_sparse_set_ranges (S, h->xrange, h->nx + 1, h->yrange, h->ny + 1);
+
+      for (i = 0; i < h->nx * h->ny; i++)
+        {
+          if (h->bin[i] != 0.0)
+            {
+              double *bin = sparse_bin (S, i);
+
+              if (bin == 0)
+                {
+                  GSL_ERROR ("failed to allocate space for histogram2d bins",
+                             GSL_ENOMEM);
+                }
+
+              *bin = h->bin[i];
+            }
+        }
+
+      return GSL_SUCCESS;
+    }
+}
+
+/* hash table slot for key: either the slot holding it, or the empty slot
+ * where it would be inserted */
+static size_t *
+sparse_slot (const gsl_histogram2d_sparse * h, const size_t key)
+{
+  const size_t mask = h->tsize - 1;
+  size_t hash = key * (size_t) 0x9e3779b97f4a7c15ULL;
+  size_t s;
+
+  hash ^= hash >> (4 * sizeof (size_t));
+
+  for (s = hash & mask; ; s = (s + 1) & mask)
+    {
+      const size_t e = h->table[s];
+
+      if (e == 0 || h->key[e - 1] == key)
+        {
+          return h->table + s;
+        }
+    }
+}
+
+/* return a pointer to the value of bin key, adding it with value 0 if
+ * it is not yet present, or a null pointer if memory runs out */
+static double *
+sparse_bin (gsl_histogram2d_sparse * h, const size_t key)
+{
+  size_t *slot = sparse_slot (h, key);
+
+  if (*slot == 0)
+    {
+      if (h->nnz == h->nmax)
+        {
+          if (sparse_resize (h, 2 * h->nmax))
+            {
+              return 0;
+            }
+
+          slot = sparse_slot (h, key);
+        }
+
+      h->key[h->nnz] = key;
+      h->bin[h->nnz] = 0.0;
+      *slot = ++h->nnz;
+    }
+
+  return h->bin + (*slot - 1);
+}
+
+/* grow the entry arrays to nmax and the hash table to 2 nmax slots */
+static int
+sparse_resize (gsl_histogram2d_sparse * h, const size_t nmax)
+{
+  const size_t tsize = 2 * nmax;
+  size_t *key = realloc (h->key, nmax * sizeof (size_t));
+  double *bin;
+  size_t *table;
+  size_t k;
+
+  if (key == 0)
+    {
+      return GSL_ENOMEM;
+    }
+
+  h->key = key;
+
+  bin = realloc (h->bin, nmax * sizeof (double));
+
+  if (bin == 0)
+    {
+      return GSL_ENOMEM;
+    }
+
+  h->bin = bin;
+
+  table = calloc (tsize, sizeof (size_t));
+
+  if (table == 0)
+    {
+      return GSL_ENOMEM;
+    }
+
+  free (h->table);
+  h->table = table;
+  h->tsize = tsize;
+  h->nmax = nmax;
+
+  for (k = 0; k < h->nnz; k++)
+    {
+      *sparse_slot (h, h->key[k]) = k + 1;
+    }
+
+  return GSL_SUCCESS;
+}
+
+static void
+make_uniform (double range[], size_t n, double xmin, double xmax)
+{
+  size_t i;
+
+  for (i = 0; i <= n; i++)
+    {
+      double f1 = ((double) (n-i) / (double) n);
+      double f2 = ((double) i / (double) n);
+      range[i] = f1 * xmin +  f2 * xmax;
+    }
+}
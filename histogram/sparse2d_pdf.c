@@ -0,0 +1,245 @@
+/* histogram/sparse2d_pdf.c
+ * 
+ * Copyright (C) 2026 Patrick Alken
+ * 
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+
+/* Sampling from a sparse 2D histogram. The cumulative distribution is
+ * stored only over the populated bins, in order of bin index, so the
+ * memory and setup cost is O(nnz) and sampling is a binary search over
+ * nnz entries instead of nx * ny. */
+
+#include <config.h>
+#include <stdlib.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_histogram.h>
+#include <gsl/gsl_histogram2d.h>
+
+#include "find.c"
+
+static int
+compare_key (const void *a, const void *b)
+{
+  const size_t ka = *(const size_t *) a;
+  const size_t kb = *(const size_t *) b;
+
+  return (ka > kb) - (ka < kb);
+}
+
+gsl_histogram2d_sparse_pdf *
+gsl_histogram2d_sparse_pdf_alloc (const size_t nx, const size_t ny)
+{
+  gsl_histogram2d_sparse_pdf *p;
+
+  if (nx == 0 || ny == 0)
+    {
+      GSL_ERROR_VAL ("histogram2d pdf lengths nx and ny must be positive integers",
+                     GSL_EDOM, 0);
+    }
+
+  p = calloc (1, sizeof (gsl_histogram2d_sparse_pdf));
+
+  if (p == 0)
+    {
+      GSL_ERROR_VAL ("failed to allocate space for histogram2d pdf struct",
+                     GSL_ENOMEM, 0);
+    }
+
+  p->xrange = malloc ((nx + 1) * sizeof (double));
+  p->yrange = malloc ((ny + 1) * sizeof (double));
+  p->sum = malloc (sizeof (double));
+
+  if (p->xrange == 0 || p->yrange == 0 || p->sum == 0)
+    {
+      gsl_histogram2d_sparse_pdf_free (p);
+      GSL_ERROR_VAL ("failed to allocate space for histogram2d pdf",
+                     GSL_ENOMEM, 0);
+    }
+
+  p->nx = nx;
+  p->ny = ny;
+  p->sum[0] = 0.0;
+
+  return p;
+}
+
+int
+gsl_histogram2d_sparse_pdf_init (gsl_histogram2d_sparse_pdf * p,
+                                 const gsl_histogram2d_sparse * h)
+{
+  const size_t nx = p->nx;
+  const size_t ny = p->ny;
+  size_t *index;
+  size_t i, k, n = 0;
+  double total = 0.0;
+
+  if (nx != h->nx || ny != h->ny)
+    {
+      GSL_ERROR ("histogram2d size must match pdf size", GSL_EDOM);
+    }
+
+  for (k = 0; k < h->nnz; k++)
+    {
+      if (h->bin[k] < 0)
+        {
+          GSL_ERROR ("histogram bins must be non-negative to compute"
+                     "a probability distribution", GSL_EDOM);
+        }
+      else if (h->bin[k] > 0)
+        {
+          n++;
+          total += h->bin[k];
+        }
+    }
+
+  if (total == 0.0)
+    {
+      GSL_ERROR ("histogram2d has no positive bins", GSL_EDOM);
+    }
+
+  if (n > p->nmax)
+    {
+      size_t *key = realloc (p->key, n * sizeof (size_t));
+      double *sum;
+
+      if (key == 0)
+        {
+          GSL_ERROR ("failed to allocate space for histogram2d pdf keys",
+                     GSL_ENOMEM);
+        }
+
+      p->key = key;
+
+      sum = realloc (p->sum, (n + 1) * sizeof (double));
+
+      if (sum == 0)
+        {
+          GSL_ERROR ("failed to allocate space for histogram2d pdf sums",
+                     GSL_ENOMEM);
+        }
+
+      p->sum = sum;
+      p->nmax = n;
+    }
+
+  /* sort the positive entries by bin index, using the entry numbers
+     stored temporarily in key[] */
+
+  index = malloc (n * 2 * sizeof (size_t));
+
+  if (index == 0)
+    {
+      GSL_ERROR ("failed to allocate workspace", GSL_ENOMEM);
+    }
+
+  for (k = 0, i = 0; k < h->nnz; k++)
+    {
+      if (h->bin[k] > 0)
+        {
+          index[2 * i] = h->key[k];
+          index[2 * i + 1] = k;
+          i++;
+        }
+    }
+
+  qsort (index, n, 2 * sizeof (size_t), compare_key);
+
+  for (i = 0; i < nx + 1; i++)
+    {
+      p->xrange[i] = h->xrange[i];
+    }
+
+  for (i = 0; i < ny + 1; i++)
+    {
+      p->yrange[i] = h->yrange[i];
+    }
+
+  {
+    double sum = 0;
+
+    p->sum[0] = 0;
+
+    for (i = 0; i < n; i++)
+      {
+        p->key[i] = index[2 * i];
+        sum += h->bin[index[2 * i + 1]] / total;
+        p->sum[i + 1] = sum;
+      }
+
+    /* guard against rounding so that every r1 < 1 is found */
+    p->sum[n] = 1.0;
+  }
+
+  p->n = n;
+
+  free (index);
+
+  return GSL_SUCCESS;
+}
+
+int
+gsl_histogram2d_sparse_pdf_sample (const gsl_histogram2d_sparse_pdf * p,
+                                   double r1, double r2,
+                                   double *x, double *y)
+{
+  size_t k;
+  int status;
+
+  /* Wrap the exclusive top of the bin down to the inclusive bottom of
+     the bin, as in gsl_histogram2d_pdf_sample */
+
+  if (r2 == 1.0)
+    {
+      r2 = 0.0;
+    }
+  if (r1 == 1.0)
+    {
+      r1 = 0.0;
+    }
+
+  if (p->n == 0)
+    {
+      GSL_ERROR ("histogram2d pdf has not been initialized", GSL_EINVAL);
+    }
+
+  status = find (p->n, p->sum, r1, &k);
+
+  if (status)
+    {
+      GSL_ERROR ("cannot find r1 in cumulative pdf", GSL_EDOM);
+    }
+  else
+    {
+      size_t i = p->key[k] / p->ny;
+      size_t j = p->key[k] - (i * p->ny);
+      double delta = (r1 - p->sum[k]) / (p->sum[k + 1] - p->sum[k]);
+      *x = p->xrange[i] + delta * (p->xrange[i + 1] - p->xrange[i]);
+      *y = p->yrange[j] + r2 * (p->yrange[j + 1] - p->yrange[j]);
+      return GSL_SUCCESS;
+    }
+}
+
+void
+gsl_histogram2d_sparse_pdf_free (gsl_histogram2d_sparse_pdf * p)
+{
+  RETURN_IF_NULL (p);
+  free (p->xrange);
+  free (p->yrange);
+  free (p->key);
+  free (p->sum);
+  free (p);
+}
@@ -0,0 +1,215 @@
+/* histogram/sparse2d_stat.c
+ * 
+ * Copyright (C) 2026 Patrick Alken
+ * 
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+
+/* Statistics of sparse 2D histograms. Only the stored entries are
+ * visited, so the cost is O(nnz) rather than O(nx * ny). Unstored bins
+ * are zero and, as for gsl_histogram2d, only bins with positive weight
+ * contribute to the means, standard deviations and covariance. */
+
+#include <config.h>
+#include <math.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_histogram2d.h>
+
+double
+gsl_histogram2d_sparse_sum (const gsl_histogram2d_sparse * h)
+{
+  double sum = 0;
+  size_t k;
+
+  for (k = 0; k < h->nnz; k++)
+    sum += h->bin[k];
+
+  return sum;
+}
+
+double
+gsl_histogram2d_sparse_max_val (const gsl_histogram2d_sparse * h)
+{
+  /* unstored bins are zero */
+  double max = (h->nnz < h->nx * h->ny) ? 0.0 : h->bin[0];
+  size_t k;
+
+  for (k = 0; k < h->nnz; k++)
+    {
+      if (h->bin[k] > max)
+        {
+          max = h->bin[k];
+        }
+    }
+
+  return max;
+}
+
+double
+gsl_histogram2d_sparse_min_val (const gsl_histogram2d_sparse * h)
+{
+  double min = (h->nnz < h->nx * h->ny) ? 0.0 : h->bin[0];
+  size_t k;
+
+  for (k = 0; k < h->nnz; k++)
+    {
+      if (h->bin[k] < min)
+        {
+          min = h->bin[k];
+        }
+    }
+
+  return min;
+}
+
+double
+gsl_histogram2d_sparse_xmean (const gsl_histogram2d_sparse * h)
+{
+  const size_t ny = h->ny;
+  size_t k;
+
+  /* Compute the bin-weighted arithmetic mean M of a histogram using the
+     recurrence relation
+
+     M(n) = M(n-1) + (x[n] - M(n-1)) (w(n)/(W(n-1) + w(n))) 
+     W(n) = W(n-1) + w(n)
+
+   */
+
+  long double wmean = 0;
+  long double W = 0;
+
+  for (k = 0; k < h->nnz; k++)
+    {
+      double wk = h->bin[k];
+
+      if (wk > 0)
+        {
+          size_t i = h->key[k] / ny;
+          double xi = (h->xrange[i + 1] + h->xrange[i]) / 2.0;
+          W += wk;
+          wmean += (xi - wmean) * (wk / W);
+        }
+    }
+
+  return wmean;
+}
+
+double
+gsl_histogram2d_sparse_ymean (const gsl_histogram2d_sparse * h)
+{
+  const size_t ny = h->ny;
+  size_t k;
+
+  long double wmean = 0;
+  long double W = 0;
+
+  for (k = 0; k < h->nnz; k++)
+    {
+      double wk = h->bin[k];
+
+      if (wk > 0)
+        {
+          size_t j = h->key[k] % ny;
+          double yj = (h->yrange[j + 1] + h->yrange[j]) / 2.0;
+          W += wk;
+          wmean += (yj - wmean) * (wk / W);
+        }
+    }
+
+  return wmean;
+}
+
+double
+gsl_histogram2d_sparse_xsigma (const gsl_histogram2d_sparse * h)
+{
+  const double xmean = gsl_histogram2d_sparse_xmean (h);
+  const size_t ny = h->ny;
+  size_t k;
+
+  long double wvariance = 0;
+  long double W = 0;
+
+  for (k = 0; k < h->nnz; k++)
+    {
+      double wk = h->bin[k];
+
+      if (wk > 0)
+        {
+          size_t i = h->key[k] / ny;
+          double xi = (h->xrange[i + 1] + h->xrange[i]) / 2.0 - xmean;
+          W += wk;
+          wvariance += ((xi * xi) - wvariance) * (wk / W);
+        }
+    }
+
+  return sqrt (wvariance);
+}
+
+double
+gsl_histogram2d_sparse_ysigma (const gsl_histogram2d_sparse * h)
+{
+  const double ymean = gsl_histogram2d_sparse_ymean (h);
+  const size_t ny = h->ny;
+  size_t k;
+
+  long double wvariance = 0;
+  long double W = 0;
+
+  for (k = 0; k < h->nnz; k++)
+    {
+      double wk = h->bin[k];
+
+      if (wk > 0)
+        {
+          size_t j = h->key[k] % ny;
+          double yj = (h->yrange[j + 1] + h->yrange[j]) / 2.0 - ymean;
+          W += wk;
+          wvariance += ((yj * yj) - wvariance) * (wk / W);
+        }
+    }
+
+  return sqrt (wvariance);
+}
+
+double
+gsl_histogram2d_sparse_cov (const gsl_histogram2d_sparse * h)
+{
+  const double xmean = gsl_histogram2d_sparse_xmean (h);
+  const double ymean = gsl_histogram2d_sparse_ymean (h);
+  const size_t ny = h->ny;
+  size_t k;
+
+  long double wcovariance = 0;
+  long double W = 0;
+
+  for (k = 0; k < h->nnz; k++)
+    {
+      double wk = h->bin[k];
+
+      if (wk > 0)
+        {
+          size_t i = h->key[k] / ny;
+          size_t j = h->key[k] % ny;
+          double xi = (h->xrange[i + 1] + h->xrange[i]) / 2.0 - xmean;
+          double yj = (h->yrange[j + 1] + h->yrange[j]) / 2.0 - ymean;
+          W += wk;
+          wcovariance += ((xi * yj) - wcovariance) * (wk / W);
+        }
+    }
+
+  return wcovariance;
+}
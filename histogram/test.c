@@ -28,8 +28,13 @@ void test1d (void);
 void test2d (void);
 void test1d_resample (void);
 void test2d_resample (void);
+void test1d_alias (void);
+void test2d_alias (void);
 void test1d_trap (void);
 void test2d_trap (void);
+void test1d_array (void);
+void test2d_array (void);
+void test2d_sparse (void);
 
 int
 main (void)
@@ -38,8 +43,13 @@ main (void)
   test2d();
   test1d_resample();
   test2d_resample();
+  test1d_alias();
+  test2d_alias();
   test1d_trap();
   test2d_trap();
+  test1d_array();
+  test2d_array();
+  test2d_sparse();
   
   exit (gsl_test_summary ());
 }
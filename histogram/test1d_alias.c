@@ -0,0 +1,122 @@
+/* histogram/test1d_alias.c
+ *
+ * Copyright (C) 2026 Patrick Alken
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#include <config.h>
+#include <stdlib.h>
+#include <math.h>
+#include <gsl/gsl_histogram.h>
+#include <gsl/gsl_test.h>
+#include <gsl/gsl_ieee_utils.h>
+
+#include "urand.c"
+
+/* the alias table sampling of test1d_resample, one draw at a time and
+   in a single call to gsl_histogram_pdf_sample_n */
+
+void
+test1d_alias (void)
+{
+  const size_t N = 100000;
+  size_t i;
+
+  gsl_histogram *h;
+
+  gsl_ieee_env_setup ();
+
+  h = gsl_histogram_calloc_uniform (10, 0.0, 1.0);
+
+  gsl_histogram_increment (h, 0.1);
+  gsl_histogram_increment (h, 0.2);
+  gsl_histogram_increment (h, 0.2);
+  gsl_histogram_increment (h, 0.3);
+
+  {
+    gsl_histogram_pdf *p = gsl_histogram_pdf_alloc (10);
+
+    gsl_histogram *hh = gsl_histogram_calloc_uniform (100, 0.0, 1.0);
+
+    double *u = malloc (N * sizeof (double));
+    double *r = malloc (N * sizeof (double));
+    double *x = malloc (N * sizeof (double));
+    int status = 0;
+
+    gsl_histogram_pdf_init (p, h);
+
+    for (i = 0; i < N; i++)
+      {
+        u[i] = urand();
+        r[i] = gsl_histogram_pdf_sample_alias (p, u[i]);
+        gsl_histogram_increment (hh, r[i]);
+      }
+
+    for (i = 0; i < 100; i++)
+      {
+        double y = gsl_histogram_get (hh, i) / 2500;
+        double x, xmax;
+        size_t k;
+        double ya;
+
+        gsl_histogram_get_range (hh, i, &x, &xmax);
+
+        gsl_histogram_find (h, x, &k);
+        ya = gsl_histogram_get (h, k);
+
+        if (ya == 0)
+          {
+            if (y != 0)
+              {
+                printf ("%d: %g vs %g\n", (int) i, y, ya);
+                status = 1;
+              }
+          }
+        else
+          {
+            double err = 1 / sqrt (gsl_histogram_get (hh, i));
+            double sigma = fabs ((y - ya) / (ya * err));
+            if (sigma > 3)
+              {
+                status = 1;
+                printf ("%g vs %g err=%g sigma=%g\n", y, ya, err, sigma);
+              }
+          }
+      }
+
+    gsl_test (status, "gsl_histogram_pdf_sample_alias within statistical errors");
+
+    /* the batch version gives the same draws */
+
+    status = gsl_histogram_pdf_sample_n (p, u, x, N);
+
+    for (i = 0; i < N; i++)
+      {
+        if (x[i] != r[i])
+          status = 1;
+      }
+
+    gsl_test (status, "gsl_histogram_pdf_sample_n equals gsl_histogram_pdf_sample_alias");
+
+    gsl_histogram_pdf_free (p) ;
+    gsl_histogram_free (hh);
+    free (u);
+    free (r);
+    free (x);
+  }
+
+  gsl_histogram_free (h);
+}
@@ -0,0 +1,240 @@
+/* histogram/test2d_sparse.c
+ * 
+ * Copyright (C) 2026 Patrick Alken
+ * 
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+
+#include <config.h>
+#include <stdlib.h>
+#include <math.h>
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_histogram2d.h>
+#include <gsl/gsl_test.h>
+#include <gsl/gsl_ieee_utils.h>
+
+#include "urand.c"
+
+#define NX 300
+#define NY 200
+#define NDATA 5000
+
+void test2d_sparse (void);
+
+/* compare a sparse histogram with a dense one filled with the same data */
+static void
+compare_dense (const gsl_histogram2d_sparse * s, const gsl_histogram2d * h,
+               const char * desc)
+{
+  const double tol = 1.0e-12;
+  size_t i, j, nnz = 0, nerr = 0;
+
+  for (i = 0; i < NX; i++)
+    {
+      for (j = 0; j < NY; j++)
+        {
+          double v = gsl_histogram2d_sparse_get (s, i, j);
+
+          if (v != gsl_histogram2d_get (h, i, j))
+            nerr++;
+        }
+    }
+
+  for (i = 0; i < NX * NY; i++)
+    {
+      if (h->bin[i] != 0.0)
+        nnz++;
+    }
+
+  gsl_test (nerr, "gsl_histogram2d_sparse %s bins", desc);
+  gsl_test (gsl_histogram2d_sparse_nnz (s) < nnz,
+            "gsl_histogram2d_sparse %s nnz", desc);
+
+  gsl_test_rel (gsl_histogram2d_sparse_sum (s), gsl_histogram2d_sum (h), tol,
+                "gsl_histogram2d_sparse_sum %s", desc);
+  gsl_test_rel (gsl_histogram2d_sparse_max_val (s), gsl_histogram2d_max_val (h), tol,
+                "gsl_histogram2d_sparse_max_val %s", desc);
+  gsl_test_rel (gsl_histogram2d_sparse_min_val (s), gsl_histogram2d_min_val (h), tol,
+                "gsl_histogram2d_sparse_min_val %s", desc);
+  gsl_test_rel (gsl_histogram2d_sparse_xmean (s), gsl_histogram2d_xmean (h), tol,
+                "gsl_histogram2d_sparse_xmean %s", desc);
+  gsl_test_rel (gsl_histogram2d_sparse_ymean (s), gsl_histogram2d_ymean (h), tol,
+                "gsl_histogram2d_sparse_ymean %s", desc);
+  gsl_test_rel (gsl_histogram2d_sparse_xsigma (s), gsl_histogram2d_xsigma (h), tol,
+                "gsl_histogram2d_sparse_xsigma %s", desc);
+  gsl_test_rel (gsl_histogram2d_sparse_ysigma (s), gsl_histogram2d_ysigma (h), tol,
+                "gsl_histogram2d_sparse_ysigma %s", desc);
+  gsl_test_rel (gsl_histogram2d_sparse_cov (s), gsl_histogram2d_cov (h), tol,
+                "gsl_histogram2d_sparse_cov %s", desc);
+}
+
+void
+test2d_sparse (void)
+{
+  gsl_histogram2d *h = gsl_histogram2d_calloc_uniform (NX, NY, -1.0, 2.0, 0.0, 5.0);
+  gsl_histogram2d *h2 = gsl_histogram2d_calloc (NX, NY);
+  gsl_histogram2d_sparse *s = gsl_histogram2d_sparse_alloc (NX, NY);
+  gsl_histogram2d_sparse *s2 = gsl_histogram2d_sparse_alloc (NX, NY);
+  gsl_histogram2d_pdf *p = gsl_histogram2d_pdf_alloc (NX, NY);
+  gsl_histogram2d_sparse_pdf *sp = gsl_histogram2d_sparse_pdf_alloc (NX, NY);
+  size_t n, k;
+
+  gsl_histogram2d_sparse_set_ranges_uniform (s, -1.0, 2.0, 0.0, 5.0);
+  gsl_histogram2d_sparse_set_ranges_uniform (s2, -1.0, 2.0, 0.0, 5.0);
+
+  /* a clustered sample which touches only a fraction of the bins, with
+     some points outside the ranges */
+
+  for (n = 0; n < NDATA; n++)
+    {
+      double x = 0.3 + 0.4 * urand () * urand () - 0.05;
+      double y = 5.5 * urand () * urand ();
+      double w = (n % 7 == 0) ? -0.5 : 1.0 + urand ();
+      int s1 = gsl_histogram2d_accumulate (h, x, y, w);
+      int s2 = gsl_histogram2d_sparse_accumulate (s, x, y, w);
+
+      if (s1 != s2)
+        gsl_test (1, "gsl_histogram2d_sparse_accumulate status");
+    }
+
+  gsl_test (gsl_histogram2d_sparse_nnz (s) >= NX * NY / 2,
+            "gsl_histogram2d_sparse_accumulate sparsity");
+
+  compare_dense (s, h, "accumulate");
+
+  /* entries */
+
+  {
+    size_t nerr = 0;
+
+    for (k = 0; k < gsl_histogram2d_sparse_nnz (s); k++)
+      {
+        size_t i, j;
+        double v;
+
+        gsl_histogram2d_sparse_get_entry (s, k, &i, &j, &v);
+
+        if (v != gsl_histogram2d_get (h, i, j))
+          nerr++;
+      }
+
+    gsl_test (nerr, "gsl_histogram2d_sparse_get_entry");
+  }
+
+  /* find */
+
+  {
+    size_t i, j, id, jd;
+    int status = gsl_histogram2d_sparse_find (s, 0.51, 3.7, &i, &j);
+    gsl_histogram2d_find (h, 0.51, 3.7, &id, &jd);
+    gsl_test (status || i != id || j != jd, "gsl_histogram2d_sparse_find");
+  }
+
+  /* conversions */
+
+  gsl_histogram2d_sparse_sp2d (h2, s);
+  gsl_test (!gsl_histogram2d_equal_bins_p (h, h2),
+            "gsl_histogram2d_sparse_sp2d ranges");
+  {
+    size_t nerr = 0;
+
+    for (n = 0; n < NX * NY; n++)
+      {
+        if (h2->bin[n] != h->bin[n])
+          nerr++;
+      }
+
+    gsl_test (nerr, "gsl_histogram2d_sparse_sp2d bins");
+  }
+
+  gsl_histogram2d_sparse_d2sp (s2, h);
+  compare_dense (s2, h, "d2sp");
+
+  /* merge and scale */
+
+  gsl_histogram2d_reset (h2);
+  gsl_histogram2d_sparse_reset (s2);
+  gsl_test (gsl_histogram2d_sparse_nnz (s2) != 0, "gsl_histogram2d_sparse_reset");
+
+  for (n = 0; n < NDATA; n++)
+    {
+      double x = 2.0 * urand () - 0.5;
+      double y = 5.0 * urand () * urand ();
+      gsl_histogram2d_increment (h2, x, y);
+      gsl_histogram2d_sparse_increment (s2, x, y);
+    }
+
+  gsl_histogram2d_add (h2, h);
+  gsl_histogram2d_sparse_add (s2, s);
+  gsl_histogram2d_scale (h2, 0.25);
+  gsl_histogram2d_sparse_scale (s2, 0.25);
+  compare_dense (s2, h2, "add");
+
+  /* pdf: remove negative bins, then the sparse and dense pdfs must give
+     the same samples */
+
+  for (n = 0; n < NX * NY; n++)
+    {
+      if (h2->bin[n] < 0)
+        h2->bin[n] = 0.0;
+    }
+
+  gsl_histogram2d_sparse_d2sp (s2, h2);
+  gsl_histogram2d_pdf_init (p, h2);
+  gsl_histogram2d_sparse_pdf_init (sp, s2);
+
+  {
+    double maxerr = 0;
+
+    for (n = 0; n < NDATA; n++)
+      {
+        double r1 = urand (), r2 = urand ();
+        double x, y, xs, ys;
+
+        gsl_histogram2d_pdf_sample (p, r1, r2, &x, &y);
+        gsl_histogram2d_sparse_pdf_sample (sp, r1, r2, &xs, &ys);
+
+        maxerr = GSL_MAX (maxerr, fabs (x - xs));
+        maxerr = GSL_MAX (maxerr, fabs (y - ys));
+      }
+
+    gsl_test (maxerr > 1.0e-8, "gsl_histogram2d_sparse_pdf_sample");
+  }
+
+  /* a pdf of a histogram with negative bins is an error */
+
+  {
+    int status;
+
+    gsl_histogram2d_sparse_reset (s2);
+    gsl_histogram2d_sparse_increment (s2, 0.1, 0.1);
+    gsl_histogram2d_sparse_accumulate (s2, 0.5, 0.5, -1.0);
+
+    gsl_set_error_handler_off ();
+    status = gsl_histogram2d_sparse_pdf_init (sp, s2);
+    gsl_set_error_handler (NULL);
+
+    gsl_test (status != GSL_EDOM, "gsl_histogram2d_sparse_pdf_init negative bins");
+  }
+
+  gsl_histogram2d_free (h);
+  gsl_histogram2d_free (h2);
+  gsl_histogram2d_sparse_free (s);
+  gsl_histogram2d_sparse_free (s2);
+  gsl_histogram2d_pdf_free (p);
+  gsl_histogram2d_sparse_pdf_free (sp);
+}
@@ -0,0 +1,343 @@
+/* histogram/test_array.c
+ * 
+ * Copyright (C) 2026 Patrick Alken
+ * 
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#include <config.h>
+#include <stdlib.h>
+#include <math.h>
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_executor.h>
+#include <gsl/gsl_histogram.h>
+#include <gsl/gsl_histogram2d.h>
+#include <gsl/gsl_test.h>
+#include <gsl/gsl_ieee_utils.h>
+
+#include "urand.c"
+
+#define NDATA 2000
+#define NTASKS 5
+
+void test1d_array (void);
+void test2d_array (void);
+
+/* An executor which runs the tasks in reverse order, to check that
+   the results of the parallel functions do not depend on the order in
+   which the tasks are run */
+
+static void
+reverse_run (size_t ntasks, void (*task) (size_t i, void * data),
+             void * data, void * params)
+{
+  size_t i;
+
+  (void) params;
+
+  for (i = ntasks; i-- > 0;)
+    {
+      task (i, data);
+    }
+}
+
+static const gsl_executor reverse_exec = { &reverse_run, 0 };
+
+/* fill x with values inside and outside [xmin,xmax), exact range
+ * boundaries and a NaN */
+static void
+make_data (double x[], const size_t stride, const double range[], const size_t nbins)
+{
+  const double xmin = range[0], xmax = range[nbins];
+  const double width = xmax - xmin;
+  size_t i;
+
+  for (i = 0; i < NDATA; i++)
+    {
+      double xi;
+
+      if (i % 7 == 0)
+        xi = range[(i / 7) % (nbins + 1)];
+      else
+        xi = xmin - 0.1 * width + 1.2 * width * urand ();
+
+      x[i * stride] = xi;
+    }
+
+  x[13 * stride] = GSL_NAN;
+}
+
+static int
+test_hist1d (gsl_histogram * h, const char *desc)
+{
+  const size_t n = h->n;
+  gsl_histogram *h1 = gsl_histogram_clone (h);
+  gsl_histogram *h2 = gsl_histogram_clone (h);
+  double *x = malloc (2 * NDATA * sizeof (double));
+  double *w = malloc (NDATA * sizeof (double));
+  int status = 0, s1 = GSL_SUCCESS, s2, s3;
+  size_t i;
+
+  make_data (x, 2, h->range, n);
+
+  for (i = 0; i < NDATA; i++)
+    w[i] = urand ();
+
+  gsl_histogram_reset (h1);
+  gsl_histogram_reset (h2);
+
+  gsl_set_error_handler_off ();
+
+  for (i = 0; i < NDATA; i++)
+    {
+      if (gsl_histogram_accumulate (h1, x[2 * i], w[i]) != GSL_SUCCESS)
+        s1 = GSL_EDOM;
+    }
+
+  s2 = gsl_histogram_accumulate_array (h2, x, 2, w, 1, NDATA);
+
+  for (i = 0; i < n; i++)
+    status |= (h1->bin[i] != h2->bin[i]);
+
+  gsl_test (status, "gsl_histogram_accumulate_array, %s", desc);
+  gsl_test (s1 != GSL_EDOM || s2 != GSL_EDOM,
+            "gsl_histogram_accumulate_array, %s, out of range status", desc);
+
+  /* parallel versions: one task gives the serial result, and several
+     tasks give the same result whatever order they are run in */
+  {
+    gsl_histogram *h3 = gsl_histogram_clone (h);
+    gsl_histogram *h4 = gsl_histogram_clone (h);
+    int s4, s5, s6, pstatus = 0;
+
+    gsl_histogram_reset (h3);
+    gsl_histogram_reset (h4);
+
+    s4 = gsl_histogram_accumulate_array_parallel (h3, x, 2, w, 1, NDATA, 1, NULL);
+
+    for (i = 0; i < n; i++)
+      pstatus |= (h3->bin[i] != h2->bin[i]);
+
+    gsl_test (pstatus || s4 != GSL_EDOM,
+              "gsl_histogram_accumulate_array_parallel, %s, one task", desc);
+
+    gsl_histogram_reset (h3);
+    pstatus = 0;
+
+    s5 = gsl_histogram_accumulate_array_parallel (h3, x, 2, w, 1, NDATA, NTASKS, NULL);
+    s6 = gsl_histogram_accumulate_array_parallel (h4, x, 2, w, 1, NDATA, NTASKS, &reverse_exec);
+
+    for (i = 0; i < n; i++)
+      {
+        pstatus |= (h3->bin[i] != h4->bin[i]);
+        pstatus |= (fabs (h3->bin[i] - h2->bin[i]) > 1e-12 * fabs (h2->bin[i]));
+      }
+
+    gsl_test (pstatus || s5 != GSL_EDOM || s6 != GSL_EDOM,
+              "gsl_histogram_accumulate_array_parallel, %s, %d tasks", desc, NTASKS);
+
+    gsl_histogram_free (h3);
+    gsl_histogram_free (h4);
+  }
+
+  /* unit weights, all values in range */
+  gsl_histogram_reset (h1);
+  gsl_histogram_reset (h2);
+  status = 0;
+
+  for (i = 0; i < NDATA; i++)
+    {
+      x[i] = h->range[0] + (h->range[n] - h->range[0]) * urand ();
+      gsl_histogram_increment (h1, x[i]);
+    }
+
+  s3 = gsl_histogram_increment_array (h2, x, 1, NDATA);
+
+  for (i = 0; i < n; i++)
+    status |= (h1->bin[i] != h2->bin[i]);
+
+  gsl_test (status || s3 != GSL_SUCCESS, "gsl_histogram_increment_array, %s", desc);
+
+  gsl_histogram_reset (h2);
+
+  s3 = gsl_histogram_increment_array_parallel (h2, x, 1, NDATA, NTASKS, &reverse_exec);
+
+  for (i = 0; i < n; i++)
+    status |= (h1->bin[i] != h2->bin[i]);
+
+  gsl_test (status || s3 != GSL_SUCCESS,
+            "gsl_histogram_increment_array_parallel, %s", desc);
+
+  gsl_histogram_free (h1);
+  gsl_histogram_free (h2);
+  free (x);
+  free (w);
+
+  return status;
+}
+
+void
+test1d_array (void)
+{
+  const size_t n = 97;
+  gsl_histogram *h;
+  size_t i;
+
+  gsl_ieee_env_setup ();
+
+  h = gsl_histogram_calloc_uniform (n, -1.5, 2.3);
+  test_hist1d (h, "uniform");
+
+  /* geometric ranges, not uniform */
+  for (i = 0; i <= n; i++)
+    h->range[i] = pow (1.05, (double) i);
+  test_hist1d (h, "geometric");
+
+  /* uniform except for one slightly shifted range */
+  gsl_histogram_set_ranges_uniform (h, 0.0, 1.0);
+  h->range[50] += 0.3 / n;
+  test_hist1d (h, "perturbed");
+
+  gsl_histogram_free (h);
+
+  h = gsl_histogram_calloc_uniform (1, 0.0, 1.0);
+  test_hist1d (h, "single bin");
+  gsl_histogram_free (h);
+}
+
+void
+test2d_array (void)
+{
+  const size_t nx = 37, ny = 23;
+  gsl_histogram2d *h = gsl_histogram2d_calloc_uniform (nx, ny, -1.0, 1.0, 0.0, 10.0);
+  gsl_histogram2d *h1, *h2;
+  double *x = malloc (NDATA * sizeof (double));
+  double *y = malloc (3 * NDATA * sizeof (double));
+  double *w = malloc (NDATA * sizeof (double));
+  int pass;
+
+  gsl_ieee_env_setup ();
+
+  for (pass = 0; pass < 2; pass++)
+    {
+      int status = 0, s1 = GSL_SUCCESS, s2;
+      size_t i;
+
+      if (pass == 1)
+        {
+          /* non-uniform y ranges */
+          for (i = 0; i <= ny; i++)
+            h->yrange[i] = (double) (i * i);
+        }
+
+      h1 = gsl_histogram2d_clone (h);
+      h2 = gsl_histogram2d_clone (h);
+      gsl_histogram2d_reset (h1);
+      gsl_histogram2d_reset (h2);
+
+      make_data (x, 1, h->xrange, nx);
+      make_data (y, 3, h->yrange, ny);
+
+      for (i = 0; i < NDATA; i++)
+        w[i] = urand ();
+
+      gsl_set_error_handler_off ();
+
+      for (i = 0; i < NDATA; i++)
+        {
+          if (gsl_histogram2d_accumulate (h1, x[i], y[3 * i], w[i]) != GSL_SUCCESS)
+            s1 = GSL_EDOM;
+        }
+
+      s2 = gsl_histogram2d_accumulate_array (h2, x, 1, y, 3, w, 1, NDATA);
+
+      for (i = 0; i < nx * ny; i++)
+        status |= (h1->bin[i] != h2->bin[i]);
+
+      gsl_test (status || s1 != s2, "gsl_histogram2d_accumulate_array, %s",
+                pass ? "non-uniform" : "uniform");
+
+      {
+        gsl_histogram2d *h3 = gsl_histogram2d_clone (h);
+        gsl_histogram2d *h4 = gsl_histogram2d_clone (h);
+        int s3, s4, pstatus = 0;
+
+        gsl_histogram2d_reset (h3);
+        gsl_histogram2d_reset (h4);
+
+        s3 = gsl_histogram2d_accumulate_array_parallel (h3, x, 1, y, 3, w, 1, NDATA, 1, NULL);
+
+        for (i = 0; i < nx * ny; i++)
+          pstatus |= (h3->bin[i] != h2->bin[i]);
+
+        gsl_test (pstatus || s3 != s2,
+                  "gsl_histogram2d_accumulate_array_parallel, %s, one task",
+                  pass ? "non-uniform" : "uniform");
+
+        gsl_histogram2d_reset (h3);
+        pstatus = 0;
+
+        s3 = gsl_histogram2d_accumulate_array_parallel (h3, x, 1, y, 3, w, 1, NDATA, NTASKS, NULL);
+        s4 = gsl_histogram2d_accumulate_array_parallel (h4, x, 1, y, 3, w, 1, NDATA, NTASKS, &reverse_exec);
+
+        for (i = 0; i < nx * ny; i++)
+          {
+            pstatus |= (h3->bin[i] != h4->bin[i]);
+            pstatus |= (fabs (h3->bin[i] - h2->bin[i]) > 1e-12 * fabs (h2->bin[i]));
+          }
+
+        gsl_test (pstatus || s3 != s2 || s4 != s2,
+                  "gsl_histogram2d_accumulate_array_parallel, %s, %d tasks",
+                  pass ? "non-uniform" : "uniform", NTASKS);
+
+        gsl_histogram2d_free (h3);
+        gsl_histogram2d_free (h4);
+      }
+
+      gsl_histogram2d_reset (h1);
+      gsl_histogram2d_reset (h2);
+      status = 0;
+
+      for (i = 0; i < NDATA; i++)
+        gsl_histogram2d_increment (h1, x[i], y[3 * i]);
+
+      gsl_histogram2d_increment_array (h2, x, 1, y, 3, NDATA);
+
+      for (i = 0; i < nx * ny; i++)
+        status |= (h1->bin[i] != h2->bin[i]);
+
+      gsl_test (status, "gsl_histogram2d_increment_array, %s",
+                pass ? "non-uniform" : "uniform");
+
+      gsl_histogram2d_reset (h2);
+
+      gsl_histogram2d_increment_array_parallel (h2, x, 1, y, 3, NDATA, NTASKS, &reverse_exec);
+
+      for (i = 0; i < nx * ny; i++)
+        status |= (h1->bin[i] != h2->bin[i]);
+
+      gsl_test (status, "gsl_histogram2d_increment_array_parallel, %s",
+                pass ? "non-uniform" : "uniform");
+
+      gsl_histogram2d_free (h1);
+      gsl_histogram2d_free (h2);
+    }
+
+  gsl_histogram2d_free (h);
+  free (x);
+  free (y);
+  free (w);
+}
@@ -27,15 +27,17 @@
 #include "set_initial.c"
 #include "qpsrt.c"
 #include "util.c"
+#include "rule.c"
 
 static int
-qag (const gsl_function *f,
+qag (const integrand * g,
      const double a, const double b,
      const double epsabs, const double epsrel,
      const size_t limit,
      gsl_integration_workspace * workspace,
-     double * result, double * abserr,
-     gsl_integration_rule * q) ;
+     double * result, double * abserr) ;
+
+static int select_rule (int key, integrand * g);
 
 int
 gsl_integration_qag (const gsl_function *f,
@@ -46,8 +48,56 @@ gsl_integration_qag (const gsl_function *f,
                      double * result, double * abserr)
 {
   int status ;
-  gsl_integration_rule * integration_rule = gsl_integration_qk15 ;
+  integrand g ;
+
+  g.f = f ;
+  g.fb = 0 ;
+
+  status = select_rule (key, &g) ;
+
+  if (status)
+    {
+      return status ;
+    }
+
+  status = qag (&g, a, b, epsabs, epsrel, limit,
+                workspace, 
+                result, abserr) ;
+  
+  return status ;
+}
+
+int
+gsl_integration_qag_batch (const gsl_function_batch *f,
+                           double a, double b,
+                           double epsabs, double epsrel, size_t limit,
+                           int key,
+                           gsl_integration_workspace * workspace,
+                           double * result, double * abserr)
+{
+  int status ;
+  integrand g ;
 
+  g.f = 0 ;
+  g.fb = f ;
+
+  status = select_rule (key, &g) ;
+
+  if (status)
+    {
+      return status ;
+    }
+
+  status = qag (&g, a, b, epsabs, epsrel, limit,
+                workspace, 
+                result, abserr) ;
+  
+  return status ;
+}
+
+static int
+select_rule (int key, integrand * g)
+{
   if (key < GSL_INTEG_GAUSS15)
     {
       key = GSL_INTEG_GAUSS15 ;
@@ -60,44 +110,44 @@ gsl_integration_qag (const gsl_function *f,
   switch (key) 
     {
     case GSL_INTEG_GAUSS15:
-      integration_rule = gsl_integration_qk15 ;
+      g->q = gsl_integration_qk15 ;
+      g->qb = gsl_integration_qk15_batch ;
       break ;
     case GSL_INTEG_GAUSS21:
-      integration_rule = gsl_integration_qk21 ;
+      g->q = gsl_integration_qk21 ;
+      g->qb = gsl_integration_qk21_batch ;
       break ;
     case GSL_INTEG_GAUSS31:
-      integration_rule = gsl_integration_qk31 ; 
+      g->q = gsl_integration_qk31 ; 
+      g->qb = gsl_integration_qk31_batch ;
       break ;
     case GSL_INTEG_GAUSS41:
-      integration_rule = gsl_integration_qk41 ;
+      g->q = gsl_integration_qk41 ;
+      g->qb = gsl_integration_qk41_batch ;
       break ;      
     case GSL_INTEG_GAUSS51:
-      integration_rule = gsl_integration_qk51 ;
+      g->q = gsl_integration_qk51 ;
+      g->qb = gsl_integration_qk51_batch ;
       break ;      
     case GSL_INTEG_GAUSS61:
-      integration_rule = gsl_integration_qk61 ;
+      g->q = gsl_integration_qk61 ;
+      g->qb = gsl_integration_qk61_batch ;
       break ;      
     default:
       GSL_ERROR("value of key does specify a known integration rule", 
                 GSL_EINVAL) ;
     }
 
-  status = qag (f, a, b, epsabs, epsrel, limit,
-                workspace, 
-                result, abserr, 
-                integration_rule) ;
-  
-  return status ;
+  return GSL_SUCCESS ;
 }
 
 static int
-qag (const gsl_function * f,
+qag (const integrand * g,
      const double a, const double b,
      const double epsabs, const double epsrel,
      const size_t limit,
      gsl_integration_workspace * workspace,
-     double *result, double *abserr,
-     gsl_integration_rule * q)
+     double *result, double *abserr)
 {
   double area, errsum;
   double result0, abserr0, resabs0, resasc0;
@@ -127,7 +177,7 @@ qag (const gsl_function * f,
 
   /* perform the first integration */
 
-  q (f, a, b, &result0, &abserr0, &resabs0, &resasc0);
+  apply_rule (g, a, b, &result0, &abserr0, &resabs0, &resasc0);
 
   set_initial_result (workspace, result0, abserr0);
 
@@ -185,8 +235,8 @@ qag (const gsl_function * f,
       a2 = b1;
       b2 = b_i;
 
-      q (f, a1, b1, &area1, &error1, &resabs1, &resasc1);
-      q (f, a2, b2, &area2, &error2, &resabs2, &resasc2);
+      apply_rule (g, a1, b1, &area1, &error1, &resabs1, &resasc1);
+      apply_rule (g, a2, b2, &area2, &error2, &resabs2, &resasc2);
 
       area12 = area1 + area2;
       error12 = error1 + error2;
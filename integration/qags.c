@@ -30,11 +30,16 @@
 #include "qpsrt2.c"
 #include "qelg.c"
 #include "positivity.c"
+#include "rule.c"
 
-static int qags (const gsl_function * f, const double a, const double
+static int qags (const integrand * g, const double a, const double
   b, const double epsabs, const double epsrel, const size_t limit,
-  gsl_integration_workspace * workspace, double *result, double *abserr,
-  gsl_integration_rule * q);
+  gsl_integration_workspace * workspace, double *result, double *abserr);
+
+static int qags_scalar (const gsl_function * f, const double a,
+  const double b, const double epsabs, const double epsrel,
+  const size_t limit, gsl_integration_workspace * workspace,
+  double *result, double *abserr, gsl_integration_rule * q);
 
 int
 gsl_integration_qags (const gsl_function *f,
@@ -43,13 +48,53 @@ gsl_integration_qags (const gsl_function *f,
                       gsl_integration_workspace * workspace,
                       double * result, double * abserr)
 {
-  int status = qags (f, a, b, epsabs, epsrel, limit,
-                     workspace, 
-                     result, abserr, 
-                     &gsl_integration_qk21) ;
+  int status = qags_scalar (f, a, b, epsabs, epsrel, limit,
+                            workspace, 
+                            result, abserr, 
+                            &gsl_integration_qk21) ;
   return status ;
 }
 
+int
+gsl_integration_qags_batch (const gsl_function_batch *f,
+                            double a, double b,
+                            double epsabs, double epsrel, size_t limit,
+                            gsl_integration_workspace * workspace,
+                            double * result, double * abserr)
+{
+  integrand g;
+  int status;
+
+  g.f = 0;
+  g.q = 0;
+  g.fb = f;
+  g.qb = &gsl_integration_qk21_batch;
+
+  status = qags (&g, a, b, epsabs, epsrel, limit,
+                 workspace, 
+                 result, abserr) ;
+  return status ;
+}
+
+static int
+qags_scalar (const gsl_function * f,
+             const double a, const double b,
+             const double epsabs, const double epsrel,
+             const size_t limit,
+             gsl_integration_workspace * workspace,
+             double *result, double *abserr,
+             gsl_integration_rule * q)
+{
+  integrand g;
+
+  g.f = f;
+  g.q = q;
+  g.fb = 0;
+  g.qb = 0;
+
+  return qags (&g, a, b, epsabs, epsrel, limit, workspace, result, abserr);
+}
+
 /* QAGI: evaluate an integral over an infinite range using the
    transformation
 
@@ -72,7 +117,7 @@ gsl_integration_qagi (gsl_function * f,
   f_transform.function = &i_transform;
   f_transform.params = f;
 
-  status = qags (&f_transform, 0.0, 1.0, 
+  status = qags_scalar (&f_transform, 0.0, 1.0, 
                  epsabs, epsrel, limit,
                  workspace,
                  result, abserr,
@@ -120,7 +165,7 @@ gsl_integration_qagil (gsl_function * f,
   f_transform.function = &il_transform;
   f_transform.params = &transform_params;
 
-  status = qags (&f_transform, 0.0, 1.0, 
+  status = qags_scalar (&f_transform, 0.0, 1.0, 
                  epsabs, epsrel, limit,
                  workspace,
                  result, abserr,
@@ -169,7 +214,7 @@ gsl_integration_qagiu (gsl_function * f,
   f_transform.function = &iu_transform;
   f_transform.params = &transform_params;
 
-  status = qags (&f_transform, 0.0, 1.0, 
+  status = qags_scalar (&f_transform, 0.0, 1.0, 
                  epsabs, epsrel, limit,
                  workspace,
                  result, abserr,
@@ -192,13 +237,12 @@ iu_transform (double t, void *params)
 /* Main integration function */
 
 static int
-qags (const gsl_function * f,
+qags (const integrand * g,
       const double a, const double b,
       const double epsabs, const double epsrel,
       const size_t limit,
       gsl_integration_workspace * workspace,
-      double *result, double *abserr,
-      gsl_integration_rule * q)
+      double *result, double *abserr)
 {
   double area, errsum;
   double res_ext, err_ext;
@@ -242,7 +286,7 @@ qags (const gsl_function * f,
 
   /* Perform the first integration */
 
-  q (f, a, b, &result0, &abserr0, &resabs0, &resasc0);
+  apply_rule (g, a, b, &result0, &abserr0, &resabs0, &resasc0);
 
   set_initial_result (workspace, result0, abserr0);
 
@@ -310,8 +354,8 @@ qags (const gsl_function * f,
 
       iteration++;
 
-      q (f, a1, b1, &area1, &error1, &resabs1, &resasc1);
-      q (f, a2, b2, &area2, &error2, &resabs2, &resasc2);
+      apply_rule (g, a1, b1, &area1, &error1, &resabs1, &resasc1);
+      apply_rule (g, a2, b2, &area2, &error2, &resabs2, &resasc2);
 
       area12 = area1 + area2;
       error12 = error1 + error2;
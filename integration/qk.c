@@ -20,9 +20,20 @@
 #include <config.h>
 #include <float.h>
 #include <math.h>
+#include <gsl/gsl_errno.h>
 #include <gsl/gsl_integration.h>
 #include "err.c"
 
+/* maximum number of Kronrod abscissae of the batch version */
+#define QK_MAX 31
+
+static void qk_sum (const int n,
+                    const double wg[], const double wgk[],
+                    const double fv1[], const double fv2[], double f_center,
+                    double a, double b,
+                    double *result, double *abserr,
+                    double *resabs, double *resasc);
+
 void
 gsl_integration_qk (const int n, 
                     const double xgk[], const double wg[], const double wgk[],
@@ -34,9 +45,105 @@ gsl_integration_qk (const int n,
 
   const double center = 0.5 * (a + b);
   const double half_length = 0.5 * (b - a);
-  const double abs_half_length = fabs (half_length);
   const double f_center = GSL_FN_EVAL (f, center);
 
+  int j;
+
+  for (j = 0; j < (n - 1) / 2; j++)
+    {
+      const int jtw = j * 2 + 1;  /* in original fortran j=1,2,3 jtw=2,4,6 */
+      const double abscissa = half_length * xgk[jtw];
+      fv1[jtw] = GSL_FN_EVAL (f, center - abscissa);
+      fv2[jtw] = GSL_FN_EVAL (f, center + abscissa);
+    }
+
+  for (j = 0; j < n / 2; j++)
+    {
+      int jtwm1 = j * 2;
+      const double abscissa = half_length * xgk[jtwm1];
+      fv1[jtwm1] = GSL_FN_EVAL (f, center - abscissa);
+      fv2[jtwm1] = GSL_FN_EVAL (f, center + abscissa);
+    };
+
+  qk_sum (n, wg, wgk, fv1, fv2, f_center, a, b,
+          result, abserr, resabs, resasc);
+}
+
+/* The batch version evaluates the function at all 2n-1 points in a
+   single call, in the same order as gsl_integration_qk */
+
+void
+gsl_integration_qk_batch (const int n, 
+                          const double xgk[], const double wg[],
+                          const double wgk[],
+                          double fv1[], double fv2[],
+                          const gsl_function_batch * f, double a, double b,
+                          double *result, double *abserr,
+                          double *resabs, double *resasc)
+{
+
+  const double center = 0.5 * (a + b);
+  const double half_length = 0.5 * (b - a);
+
+  double x[2 * QK_MAX - 1], y[2 * QK_MAX - 1];
+  size_t k = 0;
+  int j;
+
+  if (n > QK_MAX)
+    {
+      GSL_ERROR_VOID ("rule has too many points", GSL_EINVAL);
+    }
+
+  x[k++] = center;
+
+  for (j = 0; j < (n - 1) / 2; j++)
+    {
+      const double abscissa = half_length * xgk[j * 2 + 1];
+      x[k++] = center - abscissa;
+      x[k++] = center + abscissa;
+    }
+
+  for (j = 0; j < n / 2; j++)
+    {
+      const double abscissa = half_length * xgk[j * 2];
+      x[k++] = center - abscissa;
+      x[k++] = center + abscissa;
+    }
+
+  GSL_FN_BATCH_EVAL (f, k, x, y);
+
+  k = 1;
+
+  for (j = 0; j < (n - 1) / 2; j++)
+    {
+      fv1[j * 2 + 1] = y[k++];
+      fv2[j * 2 + 1] = y[k++];
+    }
+
+  for (j = 0; j < n / 2; j++)
+    {
+      fv1[j * 2] = y[k++];
+      fv2[j * 2] = y[k++];
+    }
+
+  qk_sum (n, wg, wgk, fv1, fv2, y[0], a, b,
+          result, abserr, resabs, resasc);
+}
+
+/* Form the Gauss and Kronrod sums from the function values */
+
+static void
+qk_sum (const int n,
+        const double wg[], const double wgk[],
+        const double fv1[], const double fv2[], double f_center,
+        double a, double b,
+        double *result, double *abserr,
+        double *resabs, double *resasc)
+{
+
+  const double half_length = 0.5 * (b - a);
+  const double abs_half_length = fabs (half_length);
+
   double result_gauss = 0;
   double result_kronrod = f_center * wgk[n - 1];
 
@@ -53,13 +160,10 @@ gsl_integration_qk (const int n,
 
   for (j = 0; j < (n - 1) / 2; j++)
     {
-      const int jtw = j * 2 + 1;  /* in original fortran j=1,2,3 jtw=2,4,6 */
-      const double abscissa = half_length * xgk[jtw];
-      const double fval1 = GSL_FN_EVAL (f, center - abscissa);
-      const double fval2 = GSL_FN_EVAL (f, center + abscissa);
+      const int jtw = j * 2 + 1;
+      const double fval1 = fv1[jtw];
+      const double fval2 = fv2[jtw];
       const double fsum = fval1 + fval2;
-      fv1[jtw] = fval1;
-      fv2[jtw] = fval2;
       result_gauss += wg[j] * fsum;
       result_kronrod += wgk[jtw] * fsum;
       result_abs += wgk[jtw] * (fabs (fval1) + fabs (fval2));
@@ -68,11 +172,8 @@ gsl_integration_qk (const int n,
   for (j = 0; j < n / 2; j++)
     {
       int jtwm1 = j * 2;
-      const double abscissa = half_length * xgk[jtwm1];
-      const double fval1 = GSL_FN_EVAL (f, center - abscissa);
-      const double fval2 = GSL_FN_EVAL (f, center + abscissa);
-      fv1[jtwm1] = fval1;
-      fv2[jtwm1] = fval2;
+      const double fval1 = fv1[jtwm1];
+      const double fval2 = fv2[jtwm1];
       result_kronrod += wgk[jtwm1] * (fval1 + fval2);
       result_abs += wgk[jtwm1] * (fabs (fval1) + fabs (fval2));
     };
@@ -100,3 +100,11 @@ gsl_integration_qk41 (const gsl_function * f, double a, double b,
   gsl_integration_qk (21, xgk, wg, wgk, fv1, fv2, f, a, b, result, abserr, resabs, resasc);
 }
 
+void
+gsl_integration_qk41_batch (const gsl_function_batch * f, double a, double b,
+                            double *result, double *abserr,
+                            double *resabs, double *resasc)
+{
+  double fv1[21], fv2[21];
+  gsl_integration_qk_batch (21, xgk, wg, wgk, fv1, fv2, f, a, b, result, abserr, resabs, resasc);
+}
@@ -0,0 +1,45 @@
+/* integration/rule.c
+ *
+ * Copyright (C) 2026 Patrick Alken
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* An integrand with its integration rule, using the batch function fb
+   and rule qb if fb is not null, and otherwise the scalar function f
+   and rule q */
+
+typedef struct
+{
+  const gsl_function *f;
+  gsl_integration_rule *q;
+  const gsl_function_batch *fb;
+  gsl_integration_rule_batch *qb;
+}
+integrand;
+
+static inline void
+apply_rule (const integrand * g, double a, double b,
+            double *result, double *abserr, double *resabs, double *resasc)
+{
+  if (g->fb != 0)
+    {
+      g->qb (g->fb, a, b, result, abserr, resabs, resasc);
+    }
+  else
+    {
+      g->q (g->f, a, b, result, abserr, resabs, resasc);
+    }
+}
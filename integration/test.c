@@ -105,6 +105,61 @@ test_fixed_quadrature(const gsl_integration_fixed_type * T, const size_t n,
   return status;
 }
 
+/* batch function which evaluates the scalar function in params at
+   each point */
+static void
+batch (size_t n, const double x[], double y[], void * params)
+{
+  const gsl_function * f = (const gsl_function *) params;
+  size_t i;
+
+  for (i = 0; i < n; i++)
+    y[i] = GSL_FN_EVAL (f, x[i]);
+}
+
+/* check that the batch integrators give the same results as the
+   scalar ones */
+static void
+test_batch (const gsl_function * f, const double a, const double b,
+            const char * desc)
+{
+  gsl_integration_workspace * w = gsl_integration_workspace_alloc (1000);
+  gsl_integration_cquad_workspace * ws = gsl_integration_cquad_workspace_alloc (200);
+  gsl_function_batch fb;
+  double result, abserr, result_b, abserr_b;
+  size_t neval, neval_b;
+  int key, status, status_b;
+
+  fb.function = &batch;
+  fb.params = (void *) f;
+
+  for (key = GSL_INTEG_GAUSS15; key <= GSL_INTEG_GAUSS61; key++)
+    {
+      status = gsl_integration_qag (f, a, b, 0.0, 1e-10, 1000, key, w,
+                                    &result, &abserr);
+      status_b = gsl_integration_qag_batch (&fb, a, b, 0.0, 1e-10, 1000, key, w,
+                                            &result_b, &abserr_b);
+      gsl_test (status != status_b || result != result_b || abserr != abserr_b,
+                "qag_batch %s key=%d", desc, key);
+    }
+
+  status = gsl_integration_qags (f, a, b, 0.0, 1e-10, 1000, w,
+                                 &result, &abserr);
+  status_b = gsl_integration_qags_batch (&fb, a, b, 0.0, 1e-10, 1000, w,
+                                         &result_b, &abserr_b);
+  gsl_test (status != status_b || result != result_b || abserr != abserr_b,
+            "qags_batch %s", desc);
+
+  status = gsl_integration_cquad (f, a, b, 0.0, 1e-12, ws,
+                                  &result, &abserr, &neval);
+  status_b = gsl_integration_cquad_batch (&fb, a, b, 0.0, 1e-12, ws,
+                                          &result_b, &abserr_b, &neval_b);
+  gsl_test (status != status_b || result != result_b || abserr != abserr_b
+            || neval != neval_b, "cquad_batch %s", desc);
+
+  gsl_integration_cquad_workspace_free (ws);
+  gsl_integration_workspace_free (w);
+}
 
 int
 main (void)
@@ -2442,6 +2497,15 @@ main (void)
 
       gsl_integration_cquad_workspace_free(ws);
     }
+
+    /* Compare the batch versions on the same functions */
+    for ( fid = 0 ; fid < 25 ; fid++ ) {
+      gsl_function f = make_function(funs[fid], NULL);
+      char desc[16];
+
+      sprintf (desc, "f%d", fid);
+      test_batch (&f, ranges[2*fid], ranges[2*fid+1], desc);
+    }
   }
 
   /* test fixed quadrature */
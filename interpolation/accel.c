@@ -21,9 +21,17 @@
  */
 #include <config.h>
 #include <stdlib.h>
+#include <math.h>
+#include <gsl/gsl_math.h>
 #include <gsl/gsl_errno.h>
 #include <gsl/gsl_interp.h>
 
+/* smallest non-uniform array for which a search tree is built */
+#define ACCEL_TREE_MIN 64
+
+static void accel_free_tables (gsl_interp_accel * a);
+static size_t tree_fill (gsl_interp_accel * a, const double xa[], size_t i, size_t k);
+
 gsl_interp_accel *
 gsl_interp_accel_alloc (void)
 {
@@ -36,10 +44,86 @@ gsl_interp_accel_alloc (void)
   a->cache = 0;
   a->hit_count = 0;
   a->miss_count = 0;
+  a->xa = NULL;
+  a->size = 0;
+  a->x0 = 0.0;
+  a->dxinv = 0.0;
+  a->tree = NULL;
+  a->tree_index = NULL;
 
   return a;
 }
 
+/* prepare the accelerator for lookups in the array xa, which must not
+   change while the accelerator is in use with it.  If the points are
+   uniformly spaced, to within half a spacing, the index of x is computed
+   directly; otherwise, for large arrays, a copy of xa is stored as a
+   static B-tree for a cache friendly search */
+int
+gsl_interp_accel_init (gsl_interp_accel * a, const double xa[], size_t size)
+{
+  size_t i;
+
+  gsl_interp_accel_reset (a);
+
+  if (size < 2)
+    {
+      GSL_ERROR ("array must have at least 2 points", GSL_EINVAL);
+    }
+
+  for (i = 1; i < size; i++)
+    {
+      if (!(xa[i-1] < xa[i]))
+        {
+          GSL_ERROR ("x values must be strictly increasing", GSL_EINVAL);
+        }
+    }
+
+  {
+    const double dx = (xa[size - 1] - xa[0]) / (size - 1);
+    int uniform = 1;
+
+    for (i = 1; i < size - 1 && uniform; i++)
+      {
+        uniform = fabs (xa[i] - (xa[0] + i * dx)) <= 0.5 * dx;
+      }
+
+    if (uniform)
+      {
+        a->x0 = xa[0];
+        a->dxinv = 1.0 / dx;
+      }
+    else if (size >= ACCEL_TREE_MIN)
+      {
+        const size_t B = GSL_INTERP_ACCEL_NODE;
+        const size_t ntree = B * ((size + B - 1) / B);
+
+        a->tree = malloc (ntree * sizeof (double));
+        a->tree_index = malloc (ntree * sizeof (size_t));
+
+        if (a->tree == NULL || a->tree_index == NULL)
+          {
+            accel_free_tables (a);
+            GSL_ERROR ("failed to allocate space for accelerator index",
+                       GSL_ENOMEM);
+          }
+
+        a->size = size;
+        tree_fill (a, xa, 0, 0);
+      }
+    else
+      {
+        /* plain binary search is fast enough */
+        return GSL_SUCCESS;
+      }
+  }
+
+  a->xa = xa;
+  a->size = size;
+
+  return GSL_SUCCESS;
+}
+
 int
 gsl_interp_accel_reset (gsl_interp_accel * a)
 {
@@ -47,6 +131,8 @@ gsl_interp_accel_reset (gsl_interp_accel * a)
   a->hit_count = 0;
   a->miss_count = 0;
 
+  accel_free_tables (a);
+
   return GSL_SUCCESS;
 }
 
@@ -54,5 +140,57 @@ void
 gsl_interp_accel_free (gsl_interp_accel * a)
 {
   RETURN_IF_NULL (a);
+  accel_free_tables (a);
   free (a);
 }
+
+static void
+accel_free_tables (gsl_interp_accel * a)
+{
+  free (a->tree);
+  free (a->tree_index);
+  a->xa = NULL;
+  a->size = 0;
+  a->x0 = 0.0;
+  a->dxinv = 0.0;
+  a->tree = NULL;
+  a->tree_index = NULL;
+}
+
+/* store xa[i], xa[i+1], ... in the subtree rooted at node k by an
+   in-order traversal, returning the next unused index of xa.  Node k
+   holds keys tree[k*B .. k*B+B-1] and its children are the nodes
+   k*(B+1)+1 .. k*(B+1)+B+1; unused keys at the end are +infinity */
+static size_t
+tree_fill (gsl_interp_accel * a, const double xa[], size_t i, size_t k)
+{
+  const size_t B = GSL_INTERP_ACCEL_NODE;
+  const size_t nnodes = (a->size + B - 1) / B;
+
+  if (k < nnodes)
+    {
+      size_t j;
+
+      for (j = 0; j <= B; j++)
+        {
+          i = tree_fill (a, xa, i, k * (B + 1) + j + 1);
+
+          if (j < B)
+            {
+              if (i < a->size)
+                {
+                  a->tree[k * B + j] = xa[i];
+                  a->tree_index[k * B + j] = i;
+                  i++;
+                }
+              else
+                {
+                  a->tree[k * B + j] = GSL_POSINF;
+                  a->tree_index[k * B + j] = a->size;
+                }
+            }
+        }
+    }
+
+  return i;
+}
@@ -25,6 +25,7 @@
 #include <gsl/gsl_errno.h>
 #include "integ_eval.h"
 #include <gsl/gsl_interp.h>
+#include "eval_array.h"
 
 typedef struct
 {
@@ -358,6 +359,30 @@ akima_eval_integ (const void * vstate,
 }
 
 
+static void
+akima_coeffs (const void * vstate, const double x_array[],
+              const double y_array[], size_t index, double c[4])
+{
+  const akima_state_t *state = (const akima_state_t *) vstate;
+
+  DISCARD_POINTER(x_array); /* prevent warning about unused parameter */
+
+  c[0] = y_array[index];
+  c[1] = state->b[index];
+  c[2] = state->c[index];
+  c[3] = state->d[index];
+}
+
+static int
+akima_eval_array (const void * vstate,
+                 const double x_array[], const double y_array[], size_t size,
+                 const double x[], size_t n, unsigned int nderiv,
+                 gsl_interp_accel * a, double y[])
+{
+  return eval_array_cubic (vstate, &akima_coeffs, x_array, y_array, size,
+                           x, n, nderiv, a, y);
+}
+
 static const gsl_interp_type akima_type = 
 {
   "akima", 
@@ -368,7 +393,8 @@ static const gsl_interp_type akima_type =
   &akima_eval_deriv,
   &akima_eval_deriv2,
   &akima_eval_integ,
-  &akima_free
+  &akima_free,
+  &akima_eval_array
 };
 
 const gsl_interp_type * gsl_interp_akima = &akima_type;
@@ -383,7 +409,8 @@ static const gsl_interp_type akima_periodic_type =
   &akima_eval_deriv,
   &akima_eval_deriv2,
   &akima_eval_integ,
-  &akima_free
+  &akima_free,
+  &akima_eval_array
 };
 
 const gsl_interp_type * gsl_interp_akima_periodic = &akima_periodic_type;
@@ -0,0 +1,230 @@
+/* interpolation/benchmark.c
+ *
+ * Copyright (C) 2026 Patrick Alken
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* evaluation rates of gsl_spline_eval, with a plain and an initialized
+ * accelerator, and of gsl_spline_eval_array, for sorted and random query
+ * points on uniform and non-uniform grids, then the rates of pointwise
+ * and tensor grid evaluation of gsl_spline2d and gsl_spline3d;
+ * usage: benchmark [n] [size] */
+
+#include <config.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <time.h>
+#include <gsl/gsl_spline.h>
+#include <gsl/gsl_spline2d.h>
+#include <gsl/gsl_spline3d.h>
+#include <gsl/gsl_sort.h>
+#include <gsl/gsl_rng.h>
+
+static double
+seconds (clock_t start)
+{
+  return (clock () - start) / (double) CLOCKS_PER_SEC;
+}
+
+int
+main (int argc, char *argv[])
+{
+  const size_t n = (argc > 1) ? (size_t) atol (argv[1]) : 10000000;
+  const size_t size = (argc > 2) ? (size_t) atol (argv[2]) : 1000;
+  const gsl_interp_type *types[] = { gsl_interp_linear, gsl_interp_cspline,
+                                     gsl_interp_akima, gsl_interp_steffen };
+  gsl_rng *r = gsl_rng_alloc (gsl_rng_default);
+  gsl_interp_accel *acc = gsl_interp_accel_alloc ();
+  double *xa = malloc (size * sizeof (double));
+  double *ya = malloc (size * sizeof (double));
+  double *x = malloc (n * sizeof (double));
+  double *y = malloc (n * sizeof (double));
+  size_t i, j, k, t;
+  int sorted, uniform;
+
+  printf ("n = %zu, size = %zu\n", n, size);
+  printf ("%12s %8s %8s %12s %12s %12s\n", "grid", "type", "x", "eval", "eval+init", "eval_array");
+
+  for (uniform = 1; uniform >= 0; --uniform)
+    {
+      for (i = 0; i < size; ++i)
+        {
+          double u = (double) i / (double) size;
+          xa[i] = uniform ? (double) i : size * u * u;
+          ya[i] = sin (0.1 * xa[i]);
+        }
+
+      for (sorted = 1; sorted >= 0; --sorted)
+        {
+          for (i = 0; i < n; ++i)
+            x[i] = xa[0] + (xa[size - 1] - xa[0]) * gsl_rng_uniform (r);
+
+          if (sorted)
+            gsl_sort (x, 1, n);
+
+          for (t = 0; t < sizeof (types) / sizeof (types[0]); ++t)
+            {
+              gsl_spline *spline = gsl_spline_alloc (types[t], size);
+              double t_eval, t_init, t_array;
+              clock_t start;
+
+              gsl_spline_init (spline, xa, ya, size);
+
+              gsl_interp_accel_reset (acc);
+              start = clock ();
+              for (i = 0; i < n; ++i)
+                y[i] = gsl_spline_eval (spline, x[i], acc);
+              t_eval = seconds (start);
+
+              /* the spline keeps its own copy of xa */
+              gsl_interp_accel_init (acc, spline->x, size);
+              start = clock ();
+              for (i = 0; i < n; ++i)
+                y[i] = gsl_spline_eval (spline, x[i], acc);
+              t_init = seconds (start);
+
+              start = clock ();
+              gsl_spline_eval_array (spline, x, n, acc, y);
+              t_array = seconds (start);
+
+              printf ("%12s %8s %8s %8.1f M/s %8.1f M/s %8.1f M/s\n",
+                      uniform ? "uniform" : "non-uniform",
+                      gsl_spline_name (spline), sorted ? "sorted" : "random",
+                      n / t_eval * 1.0e-6, n / t_init * 1.0e-6,
+                      n / t_array * 1.0e-6);
+
+              gsl_spline_free (spline);
+            }
+        }
+    }
+
+  /* 2D: size by size nodes, queried on a tensor grid of about n points */
+  {
+    const gsl_interp2d_type *types2[] = { gsl_interp2d_bilinear, gsl_interp2d_bicubic };
+    const size_t m = (size_t) sqrt ((double) n);
+    gsl_interp_accel *yacc = gsl_interp_accel_alloc ();
+    double *za = malloc (size * size * sizeof (double));
+    double *z = malloc (m * m * sizeof (double));
+
+    for (i = 0; i < size; ++i)
+      xa[i] = (double) i;
+
+    for (j = 0; j < size; ++j)
+      for (i = 0; i < size; ++i)
+        za[j * size + i] = sin (0.1 * xa[i]) * cos (0.07 * xa[j]);
+
+    for (i = 0; i < m; ++i)
+      x[i] = xa[size - 1] * (i + 0.5) / m;
+
+    printf ("\n2D, %zu^2 nodes, %zu^2 grid points\n", size, m);
+    printf ("%12s %12s %12s\n", "type", "eval", "eval_grid");
+
+    for (t = 0; t < sizeof (types2) / sizeof (types2[0]); ++t)
+      {
+        gsl_spline2d *spline = gsl_spline2d_alloc (types2[t], size, size);
+        double t_eval, t_grid;
+        clock_t start;
+
+        gsl_spline2d_init (spline, xa, xa, za, size, size);
+
+        gsl_interp_accel_reset (acc);
+        gsl_interp_accel_reset (yacc);
+        start = clock ();
+        for (j = 0; j < m; ++j)
+          for (i = 0; i < m; ++i)
+            z[j * m + i] = gsl_spline2d_eval (spline, x[i], x[j], acc, yacc);
+        t_eval = seconds (start);
+
+        start = clock ();
+        gsl_spline2d_eval_grid (spline, x, m, x, m, acc, yacc, z);
+        t_grid = seconds (start);
+
+        printf ("%12s %8.1f M/s %8.1f M/s\n", gsl_spline2d_name (spline),
+                m * m / t_eval * 1.0e-6, m * m / t_grid * 1.0e-6);
+
+        gsl_spline2d_free (spline);
+      }
+
+    free (za);
+    free (z);
+    gsl_interp_accel_free (yacc);
+  }
+
+  /* 3D: 50^3 nodes, queried on a tensor grid of about n points */
+  {
+    const gsl_interp3d_type *types3[] = { gsl_interp3d_trilinear, gsl_interp3d_tricubic };
+    const size_t s3 = 50;
+    const size_t m = (size_t) cbrt ((double) n);
+    gsl_interp_accel *yacc = gsl_interp_accel_alloc ();
+    gsl_interp_accel *zacc = gsl_interp_accel_alloc ();
+    double *fa = malloc (s3 * s3 * s3 * sizeof (double));
+    double *f = malloc (m * m * m * sizeof (double));
+
+    for (k = 0; k < s3; ++k)
+      for (j = 0; j < s3; ++j)
+        for (i = 0; i < s3; ++i)
+          fa[(k * s3 + j) * s3 + i] = sin (0.1 * xa[i]) * cos (0.07 * xa[j]) * exp (-0.01 * xa[k]);
+
+    for (i = 0; i < m; ++i)
+      x[i] = xa[s3 - 1] * (i + 0.5) / m;
+
+    printf ("\n3D, %zu^3 nodes, %zu^3 grid points\n", s3, m);
+    printf ("%12s %12s %12s\n", "type", "eval", "eval_grid");
+
+    for (t = 0; t < sizeof (types3) / sizeof (types3[0]); ++t)
+      {
+        gsl_spline3d *spline = gsl_spline3d_alloc (types3[t], s3, s3, s3);
+        double t_eval, t_grid;
+        clock_t start;
+
+        gsl_spline3d_init (spline, xa, xa, xa, fa, s3, s3, s3);
+
+        gsl_interp_accel_reset (acc);
+        gsl_interp_accel_reset (yacc);
+        gsl_interp_accel_reset (zacc);
+        start = clock ();
+        for (k = 0; k < m; ++k)
+          for (j = 0; j < m; ++j)
+            for (i = 0; i < m; ++i)
+              f[(k * m + j) * m + i] = gsl_spline3d_eval (spline, x[i], x[j], x[k], acc, yacc, zacc);
+        t_eval = seconds (start);
+
+        start = clock ();
+        gsl_spline3d_eval_grid (spline, x, m, x, m, x, m, acc, yacc, zacc, f);
+        t_grid = seconds (start);
+
+        printf ("%12s %8.1f M/s %8.1f M/s\n", gsl_spline3d_name (spline),
+                m * m * m / t_eval * 1.0e-6, m * m * m / t_grid * 1.0e-6);
+
+        gsl_spline3d_free (spline);
+      }
+
+    free (fa);
+    free (f);
+    gsl_interp_accel_free (yacc);
+    gsl_interp_accel_free (zacc);
+  }
+
+  free (xa);
+  free (ya);
+  free (x);
+  free (y);
+  gsl_interp_accel_free (acc);
+  gsl_rng_free (r);
+
+  return 0;
+}
@@ -26,6 +26,7 @@
 #include <gsl/gsl_vector.h>
 #include "integ_eval.h"
 #include <gsl/gsl_interp.h>
+#include "eval_array.h"
 
 typedef struct
 {
@@ -442,6 +443,28 @@ cspline_eval_integ (const void * vstate,
   return GSL_SUCCESS;
 }
 
+static void
+cspline_coeffs (const void * vstate, const double x_array[],
+                const double y_array[], size_t index, double c[4])
+{
+  const cspline_state_t *state = (const cspline_state_t *) vstate;
+  const double dx = x_array[index + 1] - x_array[index];
+  const double dy = y_array[index + 1] - y_array[index];
+
+  c[0] = y_array[index];
+  coeff_calc (state->c, dy, dx, index, &c[1], &c[2], &c[3]);
+}
+
+static int
+cspline_eval_array (const void * vstate,
+                   const double x_array[], const double y_array[], size_t size,
+                   const double x[], size_t n, unsigned int nderiv,
+                   gsl_interp_accel * a, double y[])
+{
+  return eval_array_cubic (vstate, &cspline_coeffs, x_array, y_array, size,
+                           x, n, nderiv, a, y);
+}
+
 static const gsl_interp_type cspline_type = 
 {
   "cspline", 
@@ -452,7 +475,8 @@ static const gsl_interp_type cspline_type =
   &cspline_eval_deriv,
   &cspline_eval_deriv2,
   &cspline_eval_integ,
-  &cspline_free
+  &cspline_free,
+  &cspline_eval_array
 };
 
 const gsl_interp_type * gsl_interp_cspline = &cspline_type;
@@ -467,7 +491,8 @@ static const gsl_interp_type cspline_periodic_type =
   &cspline_eval_deriv,
   &cspline_eval_deriv2,
   &cspline_eval_integ,
-  &cspline_free
+  &cspline_free,
+  &cspline_eval_array
 };
 
 const gsl_interp_type * gsl_interp_cspline_periodic = &cspline_periodic_type;
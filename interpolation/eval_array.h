@@ -0,0 +1,122 @@
+/* interpolation/eval_array.h
+ * 
+ * Copyright (C) 2026 Patrick Alken
+ * 
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+
+/* evaluation of piecewise cubic interpolants at an array of points,
+   common to the linear, cspline, akima and steffen methods.  On
+   interval i the interpolant is
+
+     y(x) = c[0] + t (c[1] + t (c[2] + t c[3])),  t = x - xa[i]
+
+   and the coefficients are computed by the method-specific function
+   coeffs only when the interval changes, so that sorted queries cost
+   one polynomial evaluation per point plus a walk over the intervals */
+
+typedef void eval_array_coeffs (const void * vstate, const double xa[],
+                                const double ya[], size_t index,
+                                double c[4]);
+
+/* index of the interval containing x, with the same conventions as
+   gsl_interp_bsearch, starting from the interval of the previous point
+   and using the lookup tables of the accelerator if it has them */
+static inline size_t
+eval_array_find (const double xa[], const size_t size, const double x,
+                 size_t index, const gsl_interp_accel * acc)
+{
+  size_t ilo, ihi;
+
+  if (x < xa[index])
+    {
+      ilo = 0;
+      ihi = index;
+    }
+  else if (x >= xa[index + 1])
+    {
+      /* sorted queries usually land in the next interval */
+      if (index + 2 >= size)
+        return index;
+      else if (x < xa[index + 2])
+        return index + 1;
+
+      ilo = index + 1;
+      ihi = size - 1;
+    }
+  else
+    {
+      return index;
+    }
+
+  if (acc != 0 && acc->xa == xa && acc->size == size)
+    return gsl_interp_accel_lookup (acc, x);
+
+  while (ihi > ilo + 1)
+    {
+      size_t i = (ihi + ilo) / 2;
+      if (xa[i] > x)
+        ihi = i;
+      else
+        ilo = i;
+    }
+
+  return ilo;
+}
+
+static int
+eval_array_cubic (const void * vstate, eval_array_coeffs * coeffs,
+                  const double xa[], const double ya[], size_t size,
+                  const double x[], size_t n, unsigned int nderiv,
+                  gsl_interp_accel * acc, double y[])
+{
+  size_t index = (acc != 0 && acc->cache < size - 1) ? acc->cache : 0;
+  size_t cindex = size;         /* no coefficients computed yet */
+  double c[4] = { 0.0, 0.0, 0.0, 0.0 };
+  double x_lo = 0.0;
+  size_t k;
+
+  for (k = 0; k < n; k++)
+    {
+      const double xk = x[k];
+      double t;
+
+      index = eval_array_find (xa, size, xk, index, acc);
+
+      if (index != cindex)
+        {
+          coeffs (vstate, xa, ya, index, c);
+          x_lo = xa[index];
+          cindex = index;
+        }
+
+      t = xk - x_lo;
+
+      if (nderiv == 0)
+        y[k] = c[0] + t * (c[1] + t * (c[2] + t * c[3]));
+      else if (nderiv == 1)
+        y[k] = c[1] + t * (2.0 * c[2] + 3.0 * t * c[3]);
+      else
+        y[k] = 2.0 * c[2] + 6.0 * t * c[3];
+    }
+
+  if (acc != 0)
+    {
+      acc->cache = index;
+    }
+
+  return GSL_SUCCESS;
+}
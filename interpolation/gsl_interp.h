@@ -24,6 +24,7 @@
 #include <stdlib.h>
 #include <gsl/gsl_inline.h>
 #include <gsl/gsl_types.h>
+#include <gsl/gsl_executor.h>
 
 #undef __BEGIN_DECLS
 #undef __END_DECLS
@@ -37,11 +38,20 @@
 
 __BEGIN_DECLS
 
+/* number of keys in each node of the accelerator search tree */
+#define GSL_INTERP_ACCEL_NODE 8
+
 /* evaluation accelerator */
 typedef struct {
   size_t  cache;        /* cache of index   */
   size_t  miss_count;   /* keep statistics  */
   size_t  hit_count;
+  const double * xa;    /* array indexed by gsl_interp_accel_init, or NULL */
+  size_t  size;
+  double  x0;           /* uniform grid xa[i] = x0 + i / dxinv */
+  double  dxinv;        /* 0 if the grid is not uniform */
+  double * tree;        /* xa in static B-tree order */
+  size_t * tree_index;  /* index in xa of each element of tree */
 }
 gsl_interp_accel;
 
@@ -57,6 +67,7 @@ typedef struct {
   int     (*eval_deriv2) (const void *, const double xa[], const double ya[], size_t size, double x, gsl_interp_accel *, double * y_pp);
   int     (*eval_integ)  (const void *, const double xa[], const double ya[], size_t size, gsl_interp_accel *, double a, double b, double * result);
   void    (*free)         (void *);
+  int     (*eval_array)   (const void *, const double xa[], const double ya[], size_t size, const double x[], size_t n, unsigned int nderiv, gsl_interp_accel *, double y[]);
 
 } gsl_interp_type;
 
@@ -83,6 +94,9 @@ GSL_VAR const gsl_interp_type * gsl_interp_steffen;
 gsl_interp_accel *
 gsl_interp_accel_alloc(void);
 
+int
+gsl_interp_accel_init (gsl_interp_accel * a, const double xa[], size_t size);
+
 int
 gsl_interp_accel_reset (gsl_interp_accel * a);
 
@@ -145,6 +159,51 @@ gsl_interp_eval_integ(const gsl_interp * obj,
                       double a, double b,
                       gsl_interp_accel * acc);
 
+int
+gsl_interp_eval_array(const gsl_interp * obj,
+                      const double xa[], const double ya[],
+                      const double x[], size_t n,
+                      gsl_interp_accel * a, double y[]);
+
+int
+gsl_interp_eval_deriv_array(const gsl_interp * obj,
+                            const double xa[], const double ya[],
+                            const double x[], size_t n,
+                            gsl_interp_accel * a, double d[]);
+
+int
+gsl_interp_eval_deriv2_array(const gsl_interp * obj,
+                             const double xa[], const double ya[],
+                             const double x[], size_t n,
+                             gsl_interp_accel * a, double d2[]);
+
+int
+gsl_interp_eval_array_parallel(const gsl_interp * obj,
+                               const double xa[], const double ya[],
+                               const double x[], size_t n,
+                               gsl_interp_accel * a, double y[],
+                               size_t ntasks, const gsl_executor * exec);
+
+int
+gsl_interp_eval_deriv_array_parallel(const gsl_interp * obj,
+                                     const double xa[], const double ya[],
+                                     const double x[], size_t n,
+                                     gsl_interp_accel * a, double d[],
+                                     size_t ntasks, const gsl_executor * exec);
+
+int
+gsl_interp_eval_deriv2_array_parallel(const gsl_interp * obj,
+                                      const double xa[], const double ya[],
+                                      const double x[], size_t n,
+                                      gsl_interp_accel * a, double d2[],
+                                      size_t ntasks, const gsl_executor * exec);
+
+int
+gsl_interp_eval_integ_array(const gsl_interp * obj,
+                            const double xa[], const double ya[],
+                            double a, const double b[], size_t n,
+                            gsl_interp_accel * acc, double result[]);
+
 void
 gsl_interp_free(gsl_interp * interp);
 
@@ -194,6 +253,63 @@ gsl_interp_bsearch(const double x_array[], double x,
 }
 #endif
 
+INLINE_DECL size_t
+gsl_interp_accel_lookup(const gsl_interp_accel * a, double x);
+
+#ifdef HAVE_INLINE
+
+/* Find the index of x in the array a->xa using the tables built by
+ * gsl_interp_accel_init, with the same result as gsl_interp_bsearch
+ * over the whole array.  For a uniform grid the index is computed
+ * directly and corrected for rounding; otherwise the search descends a
+ * static B-tree whose nodes hold GSL_INTERP_ACCEL_NODE keys each, so
+ * that each level costs at most one cache miss.
+ */
+
+INLINE_FUN size_t
+gsl_interp_accel_lookup(const gsl_interp_accel * a, double x)
+{
+  const double * xa = a->xa;
+  const size_t imax = a->size - 2;
+  size_t i;
+
+  if (a->dxinv > 0.0) {
+    double u = (x - a->x0) * a->dxinv;
+    i = (u > 0.0) ? ((u < (double) imax) ? (size_t) u : imax) : 0;
+    while (i > 0 && x < xa[i])
+      i--;
+    while (i < imax && x >= xa[i + 1])
+      i++;
+  }
+  else {
+    const size_t B = GSL_INTERP_ACCEL_NODE;
+    const size_t nnodes = (a->size + B - 1) / B;
+    size_t k = 0, pos = 0, found = 0;
+
+    while (k < nnodes) {
+      const double * node = a->tree + k * B;
+      size_t j, c = 0;
+      for (j = 0; j < B; j++)
+        c += (node[j] <= x);
+      if (c < B) {
+        /* node[c] is the smallest key > x seen so far */
+        pos = k * B + c;
+        found = 1;
+      }
+      k = k * (B + 1) + c + 1;
+    }
+
+    /* first element greater than x, or size if there is none */
+    i = found ? a->tree_index[pos] : a->size;
+    i = (i == 0) ? 0 : i - 1;
+    if (i > imax)
+      i = imax;
+  }
+
+  return i;
+}
+#endif
+
 INLINE_DECL size_t 
 gsl_interp_accel_find(gsl_interp_accel * a, const double x_array[], size_t size, double x);
 
@@ -205,11 +321,17 @@ gsl_interp_accel_find(gsl_interp_accel * a, const double xa[], size_t len, doubl
  
   if(x < xa[x_index]) {
     a->miss_count++;
-    a->cache = gsl_interp_bsearch(xa, x, 0, x_index);
+    if (xa == a->xa && len == a->size)
+      a->cache = gsl_interp_accel_lookup(a, x);
+    else
+      a->cache = gsl_interp_bsearch(xa, x, 0, x_index);
   }
   else if(x >= xa[x_index + 1]) {
     a->miss_count++;
-    a->cache = gsl_interp_bsearch(xa, x, x_index, len-1);
+    if (xa == a->xa && len == a->size)
+      a->cache = gsl_interp_accel_lookup(a, x);
+    else
+      a->cache = gsl_interp_bsearch(xa, x, x_index, len-1);
   }
   else {
     a->hit_count++;
@@ -168,6 +168,17 @@ int gsl_interp2d_eval_deriv_xy_e(const gsl_interp2d * interp, const double xarr[
                                  const double x, const double y,
                                  gsl_interp_accel * xa, gsl_interp_accel * ya, double * z);
 
+int gsl_interp2d_eval_array(const gsl_interp2d * interp, const double xarr[],
+                            const double yarr[], const double zarr[],
+                            const double x[], const double y[], const size_t n,
+                            gsl_interp_accel * xa, gsl_interp_accel * ya, double z[]);
+
+int gsl_interp2d_eval_grid(const gsl_interp2d * interp, const double xarr[],
+                           const double yarr[], const double zarr[],
+                           const double x[], const size_t nx,
+                           const double y[], const size_t ny,
+                           gsl_interp_accel * xa, gsl_interp_accel * ya, double z[]);
+
 
 __END_DECLS
 
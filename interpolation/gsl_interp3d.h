@@ -0,0 +1,164 @@
+/* interpolation/gsl_interp3d.h
+ * 
+ * Copyright (C) 2026 Patrick Alken
+ * 
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#ifndef __GSL_INTERP3D_H__
+#define __GSL_INTERP3D_H__
+
+#include <gsl/gsl_interp.h>
+
+#undef __BEGIN_DECLS
+#undef __END_DECLS
+#ifdef __cplusplus
+# define __BEGIN_DECLS extern "C" {
+# define __END_DECLS }
+#else
+# define __BEGIN_DECLS /* empty */
+# define __END_DECLS /* empty */
+#endif
+
+__BEGIN_DECLS
+
+typedef struct {
+    const char* name;
+    unsigned int min_size;
+    void * (*alloc)(size_t xsize, size_t ysize, size_t zsize);
+    int    (*init)(void *, const double xa[], const double ya[], const double za[], const double fa[], size_t xsize, size_t ysize, size_t zsize);
+    int    (*eval)(const void *, const double xa[], const double ya[], const double za[], const double fa[], size_t xsize, size_t ysize, size_t zsize, double x, double y, double z, gsl_interp_accel*, gsl_interp_accel*, gsl_interp_accel*, double* f);
+    int    (*eval_deriv_x) (const void *, const double xa[], const double ya[], const double za[], const double fa[], size_t xsize, size_t ysize, size_t zsize, double x, double y, double z, gsl_interp_accel*, gsl_interp_accel*, gsl_interp_accel*, double* f_p);
+    int    (*eval_deriv_y) (const void *, const double xa[], const double ya[], const double za[], const double fa[], size_t xsize, size_t ysize, size_t zsize, double x, double y, double z, gsl_interp_accel*, gsl_interp_accel*, gsl_interp_accel*, double* f_p);
+    int    (*eval_deriv_z) (const void *, const double xa[], const double ya[], const double za[], const double fa[], size_t xsize, size_t ysize, size_t zsize, double x, double y, double z, gsl_interp_accel*, gsl_interp_accel*, gsl_interp_accel*, double* f_p);
+    void   (*free)(void *);
+} gsl_interp3d_type;
+
+typedef struct {
+    const gsl_interp3d_type * type; /* interpolation type */
+    double xmin;                    /* minimum value of x for which data have been provided */
+    double xmax;                    /* maximum value of x for which data have been provided */
+    double ymin;                    /* minimum value of y for which data have been provided */
+    double ymax;                    /* maximum value of y for which data have been provided */
+    double zmin;                    /* minimum value of z for which data have been provided */
+    double zmax;                    /* maximum value of z for which data have been provided */
+    size_t xsize;                   /* number of x values provided */
+    size_t ysize;                   /* number of y values provided */
+    size_t zsize;                   /* number of z values provided */
+    void * state;                   /* internal state object specific to the interpolation type */
+} gsl_interp3d;
+
+/* available types */
+GSL_VAR const gsl_interp3d_type * gsl_interp3d_trilinear;
+GSL_VAR const gsl_interp3d_type * gsl_interp3d_tricubic;
+
+gsl_interp3d * gsl_interp3d_alloc(const gsl_interp3d_type * T, const size_t xsize,
+                                  const size_t ysize, const size_t zsize);
+
+const char * gsl_interp3d_name(const gsl_interp3d * interp);
+size_t gsl_interp3d_min_size(const gsl_interp3d * interp);
+size_t gsl_interp3d_type_min_size(const gsl_interp3d_type * T);
+int gsl_interp3d_set(const gsl_interp3d * interp, double farr[],
+                     const size_t i, const size_t j, const size_t k, const double f);
+double gsl_interp3d_get(const gsl_interp3d * interp, const double farr[],
+                        const size_t i, const size_t j, const size_t k);
+size_t gsl_interp3d_idx(const gsl_interp3d * interp,
+                        const size_t i, const size_t j, const size_t k);
+int gsl_interp3d_init(gsl_interp3d * interp, const double xa[], const double ya[],
+                      const double za[], const double fa[],
+                      const size_t xsize, const size_t ysize, const size_t zsize);
+void gsl_interp3d_free(gsl_interp3d * interp);
+
+double gsl_interp3d_eval(const gsl_interp3d * interp, const double xarr[],
+                         const double yarr[], const double zarr[],
+                         const double farr[], const double x,
+                         const double y, const double z, gsl_interp_accel * xa,
+                         gsl_interp_accel * ya, gsl_interp_accel * za);
+
+double gsl_interp3d_eval_extrap(const gsl_interp3d * interp,
+                                const double xarr[], const double yarr[],
+                                const double zarr[], const double farr[],
+                                const double x, const double y, const double z,
+                                gsl_interp_accel * xa, gsl_interp_accel * ya,
+                                gsl_interp_accel * za);
+
+int gsl_interp3d_eval_e(const gsl_interp3d * interp, const double xarr[],
+                        const double yarr[], const double zarr[],
+                        const double farr[], const double x,
+                        const double y, const double z, gsl_interp_accel * xa,
+                        gsl_interp_accel * ya, gsl_interp_accel * za, double * f);
+
+int gsl_interp3d_eval_extrap_e(const gsl_interp3d * interp,
+                               const double xarr[], const double yarr[],
+                               const double zarr[], const double farr[],
+                               const double x, const double y, const double z,
+                               gsl_interp_accel * xa, gsl_interp_accel * ya,
+                               gsl_interp_accel * za, double * f);
+
+double gsl_interp3d_eval_deriv_x(const gsl_interp3d * interp, const double xarr[],
+                                 const double yarr[], const double zarr[],
+                                 const double farr[], const double x,
+                                 const double y, const double z, gsl_interp_accel * xa,
+                                 gsl_interp_accel * ya, gsl_interp_accel * za);
+
+int gsl_interp3d_eval_deriv_x_e(const gsl_interp3d * interp, const double xarr[],
+                                const double yarr[], const double zarr[],
+                                const double farr[], const double x,
+                                const double y, const double z, gsl_interp_accel * xa,
+                                gsl_interp_accel * ya, gsl_interp_accel * za, double * f);
+
+double gsl_interp3d_eval_deriv_y(const gsl_interp3d * interp, const double xarr[],
+                                 const double yarr[], const double zarr[],
+                                 const double farr[], const double x,
+                                 const double y, const double z, gsl_interp_accel * xa,
+                                 gsl_interp_accel * ya, gsl_interp_accel * za);
+
+int gsl_interp3d_eval_deriv_y_e(const gsl_interp3d * interp, const double xarr[],
+                                const double yarr[], const double zarr[],
+                                const double farr[], const double x,
+                                const double y, const double z, gsl_interp_accel * xa,
+                                gsl_interp_accel * ya, gsl_interp_accel * za, double * f);
+
+double gsl_interp3d_eval_deriv_z(const gsl_interp3d * interp, const double xarr[],
+                                 const double yarr[], const double zarr[],
+                                 const double farr[], const double x,
+                                 const double y, const double z, gsl_interp_accel * xa,
+                                 gsl_interp_accel * ya, gsl_interp_accel * za);
+
+int gsl_interp3d_eval_deriv_z_e(const gsl_interp3d * interp, const double xarr[],
+                                const double yarr[], const double zarr[],
+                                const double farr[], const double x,
+                                const double y, const double z, gsl_interp_accel * xa,
+                                gsl_interp_accel * ya, gsl_interp_accel * za, double * f);
+
+int gsl_interp3d_eval_array(const gsl_interp3d * interp, const double xarr[],
+                            const double yarr[], const double zarr[],
+                            const double farr[], const double x[],
+                            const double y[], const double z[], const size_t n,
+                            gsl_interp_accel * xa, gsl_interp_accel * ya,
+                            gsl_interp_accel * za, double f[]);
+
+int gsl_interp3d_eval_grid(const gsl_interp3d * interp, const double xarr[],
+                           const double yarr[], const double zarr[],
+                           const double farr[],
+                           const double x[], const size_t nx,
+                           const double y[], const size_t ny,
+                           const double z[], const size_t nz,
+                           gsl_interp_accel * xa, gsl_interp_accel * ya,
+                           gsl_interp_accel * za, double f[]);
+
+__END_DECLS
+
+#endif /* __GSL_INTERP3D_H__ */
@@ -93,6 +93,44 @@ gsl_spline_eval_integ(const gsl_spline * spline,
                       double a, double b,
                       gsl_interp_accel * acc);
 
+int
+gsl_spline_eval_array(const gsl_spline * spline,
+                      const double x[], size_t n,
+                      gsl_interp_accel * a, double y[]);
+
+int
+gsl_spline_eval_deriv_array(const gsl_spline * spline,
+                            const double x[], size_t n,
+                            gsl_interp_accel * a, double d[]);
+
+int
+gsl_spline_eval_deriv2_array(const gsl_spline * spline,
+                             const double x[], size_t n,
+                             gsl_interp_accel * a, double d2[]);
+
+int
+gsl_spline_eval_array_parallel(const gsl_spline * spline,
+                               const double x[], size_t n,
+                               gsl_interp_accel * a, double y[],
+                               size_t ntasks, const gsl_executor * exec);
+
+int
+gsl_spline_eval_deriv_array_parallel(const gsl_spline * spline,
+                                     const double x[], size_t n,
+                                     gsl_interp_accel * a, double d[],
+                                     size_t ntasks, const gsl_executor * exec);
+
+int
+gsl_spline_eval_deriv2_array_parallel(const gsl_spline * spline,
+                                      const double x[], size_t n,
+                                      gsl_interp_accel * a, double d2[],
+                                      size_t ntasks, const gsl_executor * exec);
+
+int
+gsl_spline_eval_integ_array(const gsl_spline * spline,
+                            double a, const double b[], size_t n,
+                            gsl_interp_accel * acc, double result[]);
+
 void
 gsl_spline_free(gsl_spline * spline);
 
@@ -99,6 +99,15 @@ int gsl_spline2d_eval_deriv_xy_e(const gsl_spline2d * interp, const double x,
                                  const double y, gsl_interp_accel* xa,
                                  gsl_interp_accel* ya, double * z);
 
+int gsl_spline2d_eval_array(const gsl_spline2d * interp, const double x[],
+                            const double y[], const size_t n,
+                            gsl_interp_accel * xa, gsl_interp_accel * ya, double z[]);
+
+int gsl_spline2d_eval_grid(const gsl_spline2d * interp,
+                           const double x[], const size_t nx,
+                           const double y[], const size_t ny,
+                           gsl_interp_accel * xa, gsl_interp_accel * ya, double z[]);
+
 size_t gsl_spline2d_min_size(const gsl_spline2d * interp);
 
 const char * gsl_spline2d_name(const gsl_spline2d * interp);
@@ -0,0 +1,116 @@
+/* interpolation/gsl_spline3d.h
+ * 
+ * Copyright (C) 2026 Patrick Alken
+ * 
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#ifndef __GSL_SPLINE3D_H__
+#define __GSL_SPLINE3D_H__
+
+#include <gsl/gsl_interp.h>
+#include <gsl/gsl_interp3d.h>
+
+#undef __BEGIN_DECLS
+#undef __END_DECLS
+#ifdef __cplusplus
+# define __BEGIN_DECLS extern "C" {
+# define __END_DECLS }
+#else
+# define __BEGIN_DECLS /* empty */
+# define __END_DECLS /* empty */
+#endif
+
+__BEGIN_DECLS
+
+
+/*
+ * A 3D interpolation object which stores the arrays defining the function.
+ * In all other respects, this is just like a gsl_interp3d object.
+ */
+typedef struct
+{
+  gsl_interp3d interp_object; /* low-level interpolation object */
+  double * xarr;              /* x data array */
+  double * yarr;              /* y data array */
+  double * zarr;              /* z data array */
+  double * farr;              /* function values */
+} gsl_spline3d;
+
+gsl_spline3d * gsl_spline3d_alloc(const gsl_interp3d_type * T, size_t xsize,
+                                  size_t ysize, size_t zsize);
+
+int gsl_spline3d_init(gsl_spline3d * interp, const double xa[],
+                      const double ya[], const double za[], const double fa[],
+                      size_t xsize, size_t ysize, size_t zsize);
+
+void gsl_spline3d_free(gsl_spline3d * interp);
+
+double gsl_spline3d_eval(const gsl_spline3d * interp, const double x,
+                         const double y, const double z, gsl_interp_accel * xa,
+                         gsl_interp_accel * ya, gsl_interp_accel * za);
+
+int gsl_spline3d_eval_e(const gsl_spline3d * interp, const double x,
+                        const double y, const double z, gsl_interp_accel * xa,
+                        gsl_interp_accel * ya, gsl_interp_accel * za, double * f);
+
+double gsl_spline3d_eval_deriv_x(const gsl_spline3d * interp, const double x,
+                                 const double y, const double z, gsl_interp_accel * xa,
+                                 gsl_interp_accel * ya, gsl_interp_accel * za);
+
+int gsl_spline3d_eval_deriv_x_e(const gsl_spline3d * interp, const double x,
+                                const double y, const double z, gsl_interp_accel * xa,
+                                gsl_interp_accel * ya, gsl_interp_accel * za, double * f);
+
+double gsl_spline3d_eval_deriv_y(const gsl_spline3d * interp, const double x,
+                                 const double y, const double z, gsl_interp_accel * xa,
+                                 gsl_interp_accel * ya, gsl_interp_accel * za);
+
+int gsl_spline3d_eval_deriv_y_e(const gsl_spline3d * interp, const double x,
+                                const double y, const double z, gsl_interp_accel * xa,
+                                gsl_interp_accel * ya, gsl_interp_accel * za, double * f);
+
+double gsl_spline3d_eval_deriv_z(const gsl_spline3d * interp, const double x,
+                                 const double y, const double z, gsl_interp_accel * xa,
+                                 gsl_interp_accel * ya, gsl_interp_accel * za);
+
+int gsl_spline3d_eval_deriv_z_e(const gsl_spline3d * interp, const double x,
+                                const double y, const double z, gsl_interp_accel * xa,
+                                gsl_interp_accel * ya, gsl_interp_accel * za, double * f);
+
+int gsl_spline3d_eval_array(const gsl_spline3d * interp, const double x[],
+                            const double y[], const double z[], const size_t n,
+                            gsl_interp_accel * xa, gsl_interp_accel * ya,
+                            gsl_interp_accel * za, double f[]);
+
+int gsl_spline3d_eval_grid(const gsl_spline3d * interp,
+                           const double x[], const size_t nx,
+                           const double y[], const size_t ny,
+                           const double z[], const size_t nz,
+                           gsl_interp_accel * xa, gsl_interp_accel * ya,
+                           gsl_interp_accel * za, double f[]);
+
+size_t gsl_spline3d_min_size(const gsl_spline3d * interp);
+
+const char * gsl_spline3d_name(const gsl_spline3d * interp);
+
+int gsl_spline3d_set(const gsl_spline3d * interp, double farr[],
+                     const size_t i, const size_t j, const size_t k, const double f);
+double gsl_spline3d_get(const gsl_spline3d * interp, const double farr[],
+                        const size_t i, const size_t j, const size_t k);
+
+__END_DECLS
+
+#endif /* __GSL_SPLINE3D_H__ */
@@ -21,8 +21,10 @@
 /* Author:  G. Jungman
  */
 #include <config.h>
+#include <stdlib.h>
 #include <gsl/gsl_errno.h>
 #include <gsl/gsl_math.h>
+#include <gsl/gsl_executor.h>
 #include <gsl/gsl_interp.h>
 
 #define DISCARD_STATUS(s) if ((s) != GSL_SUCCESS) { GSL_ERROR_VAL("interpolation error", (s),  GSL_NAN); }
@@ -278,3 +280,294 @@ gsl_interp_eval_integ (const gsl_interp * interp,
 }
 
 
+
+/* evaluate the nderiv-th derivative at points x[] which all lie within
+   [xmin,xmax], using the method-specific array function if there is one */
+static int
+eval_array_range (const gsl_interp * interp,
+                  const double xa[], const double ya[],
+                  const double x[], size_t n, unsigned int nderiv,
+                  gsl_interp_accel * a, double y[])
+{
+  const gsl_interp_type * T = interp->type;
+
+  if (T->eval_array != NULL)
+    {
+      return T->eval_array (interp->state, xa, ya, interp->size, x, n, nderiv, a, y);
+    }
+  else
+    {
+      int (*eval) (const void *, const double xa[], const double ya[], size_t size,
+                   double x, gsl_interp_accel *, double * y) =
+        (nderiv == 0) ? T->eval : (nderiv == 1) ? T->eval_deriv : T->eval_deriv2;
+      size_t i;
+
+      for (i = 0; i < n; i++)
+        {
+          int status = eval (interp->state, xa, ya, interp->size, x[i], a, &y[i]);
+
+          if (status)
+            return status;
+        }
+
+      return GSL_SUCCESS;
+    }
+}
+
+/* evaluate at an array of points, in runs of points inside the range of
+   the data; points outside the range give NaN and a status of GSL_EDOM.
+   An accelerator is used even if a is null, so that the cost for sorted
+   x is linear in n */
+static int
+eval_array (const gsl_interp * interp,
+            const double xa[], const double ya[],
+            const double x[], size_t n, unsigned int nderiv,
+            gsl_interp_accel * a, double y[])
+{
+  gsl_interp_accel acc_local = { 0, 0, 0, NULL, 0, 0.0, 0.0, NULL, NULL };
+  int status = GSL_SUCCESS;
+  size_t k = 0;
+
+  if (a == NULL)
+    a = &acc_local;
+
+  while (k < n)
+    {
+      size_t k1 = k;
+
+      while (k1 < n && !(x[k1] < interp->xmin || x[k1] > interp->xmax))
+        k1++;
+
+      if (k1 > k)
+        {
+          int s = eval_array_range (interp, xa, ya, x + k, k1 - k, nderiv, a, y + k);
+
+          if (s && !status)
+            status = s;
+
+          k = k1;
+        }
+      else
+        {
+          y[k++] = GSL_NAN;
+          status = GSL_EDOM;
+        }
+    }
+
+  return status;
+}
+
+int
+gsl_interp_eval_array (const gsl_interp * interp,
+                       const double xa[], const double ya[],
+                       const double x[], size_t n,
+                       gsl_interp_accel * a, double y[])
+{
+  return eval_array (interp, xa, ya, x, n, 0, a, y);
+}
+
+int
+gsl_interp_eval_deriv_array (const gsl_interp * interp,
+                             const double xa[], const double ya[],
+                             const double x[], size_t n,
+                             gsl_interp_accel * a, double d[])
+{
+  return eval_array (interp, xa, ya, x, n, 1, a, d);
+}
+
+int
+gsl_interp_eval_deriv2_array (const gsl_interp * interp,
+                              const double xa[], const double ya[],
+                              const double x[], size_t n,
+                              gsl_interp_accel * a, double d2[])
+{
+  return eval_array (interp, xa, ya, x, n, 2, a, d2);
+}
+
+typedef struct
+{
+  const gsl_interp *interp;
+  const double *xa;
+  const double *ya;
+  const double *x;
+  size_t n;
+  unsigned int nderiv;
+  double *y;
+  size_t ntasks;
+  gsl_interp_accel *acc;        /* accelerator of each task */
+  int *status;                  /* status of each task */
+} eval_array_workspace;
+
+/* evaluate the block of points of task t */
+static void
+eval_array_task (size_t t, void *vw)
+{
+  eval_array_workspace *w = (eval_array_workspace *) vw;
+  const size_t k0 = gsl_executor_block (w->n, w->ntasks, t);
+  const size_t k1 = gsl_executor_block (w->n, w->ntasks, t + 1);
+
+  w->status[t] = eval_array (w->interp, w->xa, w->ya, w->x + k0, k1 - k0,
+                             w->nderiv, &(w->acc[t]), w->y + k0);
+}
+
+/* evaluate at an array of points split into ntasks contiguous blocks,
+   each with its own copy of the accelerator. The copies share the
+   lookup tables of a, which are only read, and their statistics and
+   final position are returned to a, so that with one task a ends in
+   the same state as after eval_array */
+static int
+eval_array_parallel (const gsl_interp * interp,
+                     const double xa[], const double ya[],
+                     const double x[], size_t n, unsigned int nderiv,
+                     gsl_interp_accel * a, double y[],
+                     size_t ntasks, const gsl_executor * exec)
+{
+  gsl_interp_accel acc_local = { 0, 0, 0, NULL, 0, 0.0, 0.0, NULL, NULL };
+  eval_array_workspace w;
+  int status = GSL_SUCCESS;
+  size_t hit_count, miss_count;
+  size_t t;
+
+  if (ntasks == 0)
+    {
+      GSL_ERROR ("number of tasks must be positive", GSL_EINVAL);
+    }
+
+  w.acc = (gsl_interp_accel *) malloc (ntasks * sizeof (gsl_interp_accel));
+  w.status = (int *) malloc (ntasks * sizeof (int));
+
+  if (w.acc == NULL || w.status == NULL)
+    {
+      free (w.acc);
+      free (w.status);
+      GSL_ERROR ("failed to allocate space for task accelerators", GSL_ENOMEM);
+    }
+
+  if (a == NULL)
+    a = &acc_local;
+
+  for (t = 0; t < ntasks; t++)
+    w.acc[t] = *a;
+
+  w.interp = interp;
+  w.xa = xa;
+  w.ya = ya;
+  w.x = x;
+  w.n = n;
+  w.nderiv = nderiv;
+  w.y = y;
+  w.ntasks = ntasks;
+
+  gsl_executor_run (exec, ntasks, &eval_array_task, &w);
+
+  hit_count = a->hit_count;
+  miss_count = a->miss_count;
+
+  for (t = 0; t < ntasks; t++)
+    {
+      if (w.status[t] && !status)
+        status = w.status[t];
+
+      a->hit_count += w.acc[t].hit_count - hit_count;
+      a->miss_count += w.acc[t].miss_count - miss_count;
+
+      if (gsl_executor_block (n, ntasks, t + 1) > gsl_executor_block (n, ntasks, t))
+        a->cache = w.acc[t].cache;
+    }
+
+  free (w.acc);
+  free (w.status);
+
+  return status;
+}
+
+int
+gsl_interp_eval_array_parallel (const gsl_interp * interp,
+                                const double xa[], const double ya[],
+                                const double x[], size_t n,
+                                gsl_interp_accel * a, double y[],
+                                size_t ntasks, const gsl_executor * exec)
+{
+  return eval_array_parallel (interp, xa, ya, x, n, 0, a, y, ntasks, exec);
+}
+
+int
+gsl_interp_eval_deriv_array_parallel (const gsl_interp * interp,
+                                      const double xa[], const double ya[],
+                                      const double x[], size_t n,
+                                      gsl_interp_accel * a, double d[],
+                                      size_t ntasks, const gsl_executor * exec)
+{
+  return eval_array_parallel (interp, xa, ya, x, n, 1, a, d, ntasks, exec);
+}
+
+int
+gsl_interp_eval_deriv2_array_parallel (const gsl_interp * interp,
+                                       const double xa[], const double ya[],
+                                       const double x[], size_t n,
+                                       gsl_interp_accel * a, double d2[],
+                                       size_t ntasks, const gsl_executor * exec)
+{
+  return eval_array_parallel (interp, xa, ya, x, n, 2, a, d2, ntasks, exec);
+}
+
+/* integrals from a to each b[k]. When b[] is increasing each integral is
+   found by adding the integral over [b[k-1],b[k]] to the previous one,
+   so that the total cost is linear in n and the size of the data */
+int
+gsl_interp_eval_integ_array (const gsl_interp * interp,
+                             const double xa[], const double ya[],
+                             double a, const double b[], size_t n,
+                             gsl_interp_accel * acc, double result[])
+{
+  gsl_interp_accel acc_local = { 0, 0, 0, NULL, 0, 0.0, 0.0, NULL, NULL };
+  int status = GSL_SUCCESS;
+  double b_prev = a, sum_prev = 0.0;
+  size_t k;
+
+  if (acc == NULL)
+    acc = &acc_local;
+
+  for (k = 0; k < n; k++)
+    {
+      const double bk = b[k];
+      double lo, sum;
+      int s;
+
+      if (a < interp->xmin || !(bk >= a && bk <= interp->xmax))
+        {
+          result[k] = GSL_NAN;
+          status = GSL_EDOM;
+          continue;
+        }
+
+      if (bk >= b_prev)
+        {
+          lo = b_prev;
+          sum = sum_prev;
+        }
+      else
+        {
+          lo = a;
+          sum = 0.0;
+        }
+
+      if (bk > lo)
+        {
+          double r;
+
+          s = interp->type->eval_integ (interp->state, xa, ya, interp->size, acc, lo, bk, &r);
+
+          if (s && !status)
+            status = s;
+
+          sum += r;
+        }
+
+      result[k] = sum;
+      b_prev = bk;
+      sum_prev = sum;
+    }
+
+  return status;
+}
@@ -350,6 +350,126 @@ gsl_interp2d_eval_deriv_xy_e (const gsl_interp2d * interp, const double xarr[],
                        xarr, yarr, zarr, x, y, xa, ya, z);
 }
 
+/*
+ * Evaluate at the points (x[k],y[k]). Points outside the grid give NaN
+ * and a status of GSL_EDOM; local accelerators are used if xa or ya is
+ * null so that nearby points share the interval search.
+ */
+int
+gsl_interp2d_eval_array (const gsl_interp2d * interp, const double xarr[],
+                         const double yarr[], const double zarr[],
+                         const double x[], const double y[], const size_t n,
+                         gsl_interp_accel * xa, gsl_interp_accel * ya, double z[])
+{
+  gsl_interp_accel xa_local = { 0, 0, 0, NULL, 0, 0.0, 0.0, NULL, NULL };
+  gsl_interp_accel ya_local = { 0, 0, 0, NULL, 0, 0.0, 0.0, NULL, NULL };
+  int status = GSL_SUCCESS;
+  size_t k;
+
+  if (xa == NULL)
+    xa = &xa_local;
+
+  if (ya == NULL)
+    ya = &ya_local;
+
+  for (k = 0; k < n; k++)
+    {
+      if (!(x[k] >= interp->xmin && x[k] <= interp->xmax) ||
+          !(y[k] >= interp->ymin && y[k] <= interp->ymax))
+        {
+          z[k] = GSL_NAN;
+          status = GSL_EDOM;
+        }
+      else
+        {
+          int s = interp->type->eval(interp->state, xarr, yarr, zarr,
+                                     interp->xsize, interp->ysize,
+                                     x[k], y[k], xa, ya, &z[k]);
+          if (s && !status)
+            status = s;
+        }
+    }
+
+  return status;
+} /* gsl_interp2d_eval_array() */
+
+/*
+ * Evaluate on the tensor product grid x[0..nx-1] by y[0..ny-1], storing
+ * the value at (x[i],y[j]) in z[j*nx + i]. The x intervals are located
+ * once and reused for every row by presetting the cache of the x
+ * accelerator, so the evaluator finds its interval without a search.
+ */
+int
+gsl_interp2d_eval_grid (const gsl_interp2d * interp, const double xarr[],
+                        const double yarr[], const double zarr[],
+                        const double x[], const size_t nx,
+                        const double y[], const size_t ny,
+                        gsl_interp_accel * xa, gsl_interp_accel * ya, double z[])
+{
+  gsl_interp_accel xa_local = { 0, 0, 0, NULL, 0, 0.0, 0.0, NULL, NULL };
+  gsl_interp_accel ya_local = { 0, 0, 0, NULL, 0, 0.0, 0.0, NULL, NULL };
+  int status = GSL_SUCCESS;
+  size_t * xidx;
+  size_t i, j;
+
+  if (nx == 0 || ny == 0)
+    return GSL_SUCCESS;
+
+  xidx = malloc(nx * sizeof(size_t));
+  if (xidx == NULL)
+    {
+      GSL_ERROR ("failed to allocate space for x indices", GSL_ENOMEM);
+    }
+
+  if (xa == NULL)
+    xa = &xa_local;
+
+  if (ya == NULL)
+    ya = &ya_local;
+
+  /* xsize marks a column outside the grid */
+  for (i = 0; i < nx; i++)
+    {
+      if (x[i] >= interp->xmin && x[i] <= interp->xmax)
+        xidx[i] = gsl_interp_accel_find(xa, xarr, interp->xsize, x[i]);
+      else
+        xidx[i] = interp->xsize;
+    }
+
+  for (j = 0; j < ny; j++)
+    {
+      double * zj = z + j * nx;
+      int yok = (y[j] >= interp->ymin && y[j] <= interp->ymax);
+
+      if (yok)
+        gsl_interp_accel_find(ya, yarr, interp->ysize, y[j]);
+
+      for (i = 0; i < nx; i++)
+        {
+          if (!yok || xidx[i] == interp->xsize)
+            {
+              zj[i] = GSL_NAN;
+              status = GSL_EDOM;
+            }
+          else
+            {
+              int s;
+
+              xa->cache = xidx[i];
+              s = interp->type->eval(interp->state, xarr, yarr, zarr,
+                                     interp->xsize, interp->ysize,
+                                     x[i], y[j], xa, ya, &zj[i]);
+              if (s && !status)
+                status = s;
+            }
+        }
+    }
+
+  free(xidx);
+
+  return status;
+} /* gsl_interp2d_eval_grid() */
+
 size_t
 gsl_interp2d_type_min_size(const gsl_interp2d_type * T)
 {
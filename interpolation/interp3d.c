@@ -0,0 +1,529 @@
+/* interpolation/interp3d.c
+ * 
+ * Copyright (C) 2026 Patrick Alken
+ * 
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#include <config.h>
+#include <stdlib.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_interp.h>
+#include <gsl/gsl_interp3d.h>
+
+/**
+ * Triggers a GSL error if the argument is not equal to GSL_SUCCESS.
+ * If the argument is GSL_SUCCESS, this does nothing.
+ */
+#define DISCARD_STATUS(s) if ((s) != GSL_SUCCESS) { GSL_ERROR_VAL("interpolation error", (s),  GSL_NAN); }
+
+#define IDX3D(i, j, k, w) (((k) * ((w)->ysize) + (j)) * ((w)->xsize) + (i))
+
+typedef int (*interp3d_evaluator)(const void *, const double xa[], const double ya[],
+                                  const double za[], const double fa[],
+                                  size_t xsize, size_t ysize, size_t zsize,
+                                  double x, double y, double z,
+                                  gsl_interp_accel *, gsl_interp_accel *,
+                                  gsl_interp_accel *, double * f);
+
+gsl_interp3d *
+gsl_interp3d_alloc(const gsl_interp3d_type * T, const size_t xsize,
+                   const size_t ysize, const size_t zsize)
+{
+  gsl_interp3d * interp;
+
+  if (xsize < T->min_size || ysize < T->min_size || zsize < T->min_size)
+    {
+      GSL_ERROR_NULL ("insufficient number of points for interpolation type",
+                      GSL_EINVAL);
+    }
+
+  interp = (gsl_interp3d *) calloc(1, sizeof(gsl_interp3d));
+  if (interp == NULL)
+    {
+      GSL_ERROR_NULL ("failed to allocate space for gsl_interp3d struct",
+                      GSL_ENOMEM);
+    }
+
+  interp->type = T;
+  interp->xsize = xsize;
+  interp->ysize = ysize;
+  interp->zsize = zsize;
+
+  if (interp->type->alloc == NULL)
+    {
+      interp->state = NULL;
+      return interp;
+    }
+
+  interp->state = interp->type->alloc(xsize, ysize, zsize);
+  if (interp->state == NULL)
+    {
+      free(interp);
+      GSL_ERROR_NULL ("failed to allocate space for gsl_interp3d state",
+                      GSL_ENOMEM);
+    }
+
+  return interp;
+} /* gsl_interp3d_alloc() */
+
+void
+gsl_interp3d_free (gsl_interp3d * interp)
+{
+  RETURN_IF_NULL(interp);
+
+  if (interp->type->free)
+    interp->type->free(interp->state);
+
+  free(interp);
+} /* gsl_interp3d_free() */
+
+int
+gsl_interp3d_init (gsl_interp3d * interp, const double xarr[], const double yarr[],
+                   const double zarr[], const double farr[],
+                   const size_t xsize, const size_t ysize, const size_t zsize)
+{
+  size_t i;
+
+  if (xsize != interp->xsize || ysize != interp->ysize || zsize != interp->zsize)
+    {
+      GSL_ERROR("data must match size of interpolation object", GSL_EINVAL);
+    }
+
+  for (i = 1; i < xsize; i++)
+    {
+      if (xarr[i-1] >= xarr[i])
+        {
+          GSL_ERROR("x values must be strictly increasing", GSL_EINVAL);
+        }
+    }
+
+  for (i = 1; i < ysize; i++)
+    {
+      if (yarr[i-1] >= yarr[i])
+        {
+          GSL_ERROR("y values must be strictly increasing", GSL_EINVAL);
+        }
+    }
+
+  for (i = 1; i < zsize; i++)
+    {
+      if (zarr[i-1] >= zarr[i])
+        {
+          GSL_ERROR("z values must be strictly increasing", GSL_EINVAL);
+        }
+    }
+
+  interp->xmin = xarr[0];
+  interp->xmax = xarr[xsize - 1];
+  interp->ymin = yarr[0];
+  interp->ymax = yarr[ysize - 1];
+  interp->zmin = zarr[0];
+  interp->zmax = zarr[zsize - 1];
+
+  {
+    int status = interp->type->init(interp->state, xarr, yarr, zarr, farr,
+                                    xsize, ysize, zsize);
+    return status;
+  }
+} /* gsl_interp3d_init() */
+
+/*
+ * A wrapper function that checks boundary conditions, calls an evaluator
+ * which implements the actual calculation of the function value or
+ * derivative etc., and checks the return status.
+ */
+static int
+interp3d_eval(interp3d_evaluator evaluator, const gsl_interp3d * interp,
+              const double xarr[], const double yarr[], const double zarr[],
+              const double farr[], const double x, const double y, const double z,
+              gsl_interp_accel * xa, gsl_interp_accel * ya, gsl_interp_accel * za,
+              double * result)
+{
+  if (x < interp->xmin || x > interp->xmax)
+    {
+      GSL_ERROR ("interpolation x value out of range", GSL_EDOM);
+    }
+  else if (y < interp->ymin || y > interp->ymax)
+    {
+      GSL_ERROR ("interpolation y value out of range", GSL_EDOM);
+    }
+  else if (z < interp->zmin || z > interp->zmax)
+    {
+      GSL_ERROR ("interpolation z value out of range", GSL_EDOM);
+    }
+
+  return evaluator(interp->state, xarr, yarr, zarr, farr,
+                   interp->xsize, interp->ysize, interp->zsize,
+                   x, y, z, xa, ya, za, result);
+}
+
+double
+gsl_interp3d_eval (const gsl_interp3d * interp, const double xarr[],
+                   const double yarr[], const double zarr[],
+                   const double farr[], const double x,
+                   const double y, const double z, gsl_interp_accel * xa,
+                   gsl_interp_accel * ya, gsl_interp_accel * za)
+{
+  double f;
+  int status = gsl_interp3d_eval_e(interp, xarr, yarr, zarr, farr, x, y, z,
+                                   xa, ya, za, &f);
+  DISCARD_STATUS(status)
+  return f;
+} /* gsl_interp3d_eval() */
+
+int
+gsl_interp3d_eval_e (const gsl_interp3d * interp, const double xarr[],
+                     const double yarr[], const double zarr[],
+                     const double farr[], const double x,
+                     const double y, const double z, gsl_interp_accel * xa,
+                     gsl_interp_accel * ya, gsl_interp_accel * za, double * f)
+{
+  return interp3d_eval(interp->type->eval, interp, xarr, yarr, zarr, farr,
+                       x, y, z, xa, ya, za, f);
+} /* gsl_interp3d_eval_e() */
+
+double
+gsl_interp3d_eval_extrap (const gsl_interp3d * interp,
+                          const double xarr[], const double yarr[],
+                          const double zarr[], const double farr[],
+                          const double x, const double y, const double z,
+                          gsl_interp_accel * xa, gsl_interp_accel * ya,
+                          gsl_interp_accel * za)
+{
+  double f;
+  int status = gsl_interp3d_eval_extrap_e(interp, xarr, yarr, zarr, farr,
+                                          x, y, z, xa, ya, za, &f);
+  DISCARD_STATUS(status)
+  return f;
+}
+
+/* as gsl_interp3d_eval_e but without the bounds check */
+int
+gsl_interp3d_eval_extrap_e (const gsl_interp3d * interp,
+                            const double xarr[], const double yarr[],
+                            const double zarr[], const double farr[],
+                            const double x, const double y, const double z,
+                            gsl_interp_accel * xa, gsl_interp_accel * ya,
+                            gsl_interp_accel * za, double * f)
+{
+  return interp->type->eval(interp->state, xarr, yarr, zarr, farr,
+                            interp->xsize, interp->ysize, interp->zsize,
+                            x, y, z, xa, ya, za, f);
+}
+
+double
+gsl_interp3d_eval_deriv_x (const gsl_interp3d * interp, const double xarr[],
+                           const double yarr[], const double zarr[],
+                           const double farr[], const double x,
+                           const double y, const double z, gsl_interp_accel * xa,
+                           gsl_interp_accel * ya, gsl_interp_accel * za)
+{
+  double f;
+  int status = gsl_interp3d_eval_deriv_x_e(interp, xarr, yarr, zarr, farr,
+                                           x, y, z, xa, ya, za, &f);
+  DISCARD_STATUS(status)
+  return f;
+}
+
+int
+gsl_interp3d_eval_deriv_x_e (const gsl_interp3d * interp, const double xarr[],
+                             const double yarr[], const double zarr[],
+                             const double farr[], const double x,
+                             const double y, const double z, gsl_interp_accel * xa,
+                             gsl_interp_accel * ya, gsl_interp_accel * za, double * f)
+{
+  return interp3d_eval(interp->type->eval_deriv_x, interp, xarr, yarr, zarr, farr,
+                       x, y, z, xa, ya, za, f);
+}
+
+double
+gsl_interp3d_eval_deriv_y (const gsl_interp3d * interp, const double xarr[],
+                           const double yarr[], const double zarr[],
+                           const double farr[], const double x,
+                           const double y, const double z, gsl_interp_accel * xa,
+                           gsl_interp_accel * ya, gsl_interp_accel * za)
+{
+  double f;
+  int status = gsl_interp3d_eval_deriv_y_e(interp, xarr, yarr, zarr, farr,
+                                           x, y, z, xa, ya, za, &f);
+  DISCARD_STATUS(status)
+  return f;
+}
+
+int
+gsl_interp3d_eval_deriv_y_e (const gsl_interp3d * interp, const double xarr[],
+                             const double yarr[], const double zarr[],
+                             const double farr[], const double x,
+                             const double y, const double z, gsl_interp_accel * xa,
+                             gsl_interp_accel * ya, gsl_interp_accel * za, double * f)
+{
+  return interp3d_eval(interp->type->eval_deriv_y, interp, xarr, yarr, zarr, farr,
+                       x, y, z, xa, ya, za, f);
+}
+
+double
+gsl_interp3d_eval_deriv_z (const gsl_interp3d * interp, const double xarr[],
+                           const double yarr[], const double zarr[],
+                           const double farr[], const double x,
+                           const double y, const double z, gsl_interp_accel * xa,
+                           gsl_interp_accel * ya, gsl_interp_accel * za)
+{
+  double f;
+  int status = gsl_interp3d_eval_deriv_z_e(interp, xarr, yarr, zarr, farr,
+                                           x, y, z, xa, ya, za, &f);
+  DISCARD_STATUS(status)
+  return f;
+}
+
+int
+gsl_interp3d_eval_deriv_z_e (const gsl_interp3d * interp, const double xarr[],
+                             const double yarr[], const double zarr[],
+                             const double farr[], const double x,
+                             const double y, const double z, gsl_interp_accel * xa,
+                             gsl_interp_accel * ya, gsl_interp_accel * za, double * f)
+{
+  return interp3d_eval(interp->type->eval_deriv_z, interp, xarr, yarr, zarr, farr,
+                       x, y, z, xa, ya, za, f);
+}
+
+/*
+ * Evaluate at the points (x[m],y[m],z[m]). Points outside the grid give
+ * NaN and a status of GSL_EDOM, as for gsl_interp2d_eval_array.
+ */
+int
+gsl_interp3d_eval_array (const gsl_interp3d * interp, const double xarr[],
+                         const double yarr[], const double zarr[],
+                         const double farr[], const double x[],
+                         const double y[], const double z[], const size_t n,
+                         gsl_interp_accel * xa, gsl_interp_accel * ya,
+                         gsl_interp_accel * za, double f[])
+{
+  gsl_interp_accel xa_local = { 0, 0, 0, NULL, 0, 0.0, 0.0, NULL, NULL };
+  gsl_interp_accel ya_local = { 0, 0, 0, NULL, 0, 0.0, 0.0, NULL, NULL };
+  gsl_interp_accel za_local = { 0, 0, 0, NULL, 0, 0.0, 0.0, NULL, NULL };
+  int status = GSL_SUCCESS;
+  size_t m;
+
+  if (xa == NULL)
+    xa = &xa_local;
+
+  if (ya == NULL)
+    ya = &ya_local;
+
+  if (za == NULL)
+    za = &za_local;
+
+  for (m = 0; m < n; m++)
+    {
+      if (!(x[m] >= interp->xmin && x[m] <= interp->xmax) ||
+          !(y[m] >= interp->ymin && y[m] <= interp->ymax) ||
+          !(z[m] >= interp->zmin && z[m] <= interp->zmax))
+        {
+          f[m] = GSL_NAN;
+          status = GSL_EDOM;
+        }
+      else
+        {
+          int s = interp->type->eval(interp->state, xarr, yarr, zarr, farr,
+                                     interp->xsize, interp->ysize, interp->zsize,
+                                     x[m], y[m], z[m], xa, ya, za, &f[m]);
+          if (s && !status)
+            status = s;
+        }
+    }
+
+  return status;
+} /* gsl_interp3d_eval_array() */
+
+/*
+ * Evaluate on the tensor product grid x[0..nx-1] by y[0..ny-1] by
+ * z[0..nz-1], storing the value at (x[i],y[j],z[k]) in
+ * f[(k*ny + j)*nx + i]. The x intervals are located once and reused
+ * for every row, as in gsl_interp2d_eval_grid.
+ */
+int
+gsl_interp3d_eval_grid (const gsl_interp3d * interp, const double xarr[],
+                        const double yarr[], const double zarr[],
+                        const double farr[],
+                        const double x[], const size_t nx,
+                        const double y[], const size_t ny,
+                        const double z[], const size_t nz,
+                        gsl_interp_accel * xa, gsl_interp_accel * ya,
+                        gsl_interp_accel * za, double f[])
+{
+  gsl_interp_accel xa_local = { 0, 0, 0, NULL, 0, 0.0, 0.0, NULL, NULL };
+  gsl_interp_accel ya_local = { 0, 0, 0, NULL, 0, 0.0, 0.0, NULL, NULL };
+  gsl_interp_accel za_local = { 0, 0, 0, NULL, 0, 0.0, 0.0, NULL, NULL };
+  int status = GSL_SUCCESS;
+  size_t * xidx;
+  size_t i, j, k;
+
+  if (nx == 0 || ny == 0 || nz == 0)
+    return GSL_SUCCESS;
+
+  xidx = malloc(nx * sizeof(size_t));
+  if (xidx == NULL)
+    {
+      GSL_ERROR ("failed to allocate space for x indices", GSL_ENOMEM);
+    }
+
+  if (xa == NULL)
+    xa = &xa_local;
+
+  if (ya == NULL)
+    ya = &ya_local;
+
+  if (za == NULL)
+    za = &za_local;
+
+  /* xsize marks a column outside the grid */
+  for (i = 0; i < nx; i++)
+    {
+      if (x[i] >= interp->xmin && x[i] <= interp->xmax)
+        xidx[i] = gsl_interp_accel_find(xa, xarr, interp->xsize, x[i]);
+      else
+        xidx[i] = interp->xsize;
+    }
+
+  for (k = 0; k < nz; k++)
+    {
+      int zok = (z[k] >= interp->zmin && z[k] <= interp->zmax);
+
+      if (zok)
+        gsl_interp_accel_find(za, zarr, interp->zsize, z[k]);
+
+      for (j = 0; j < ny; j++)
+        {
+          double * fjk = f + (k * ny + j) * nx;
+          int yok = zok && (y[j] >= interp->ymin && y[j] <= interp->ymax);
+
+          if (yok)
+            gsl_interp_accel_find(ya, yarr, interp->ysize, y[j]);
+
+          for (i = 0; i < nx; i++)
+            {
+              if (!yok || xidx[i] == interp->xsize)
+                {
+                  fjk[i] = GSL_NAN;
+                  status = GSL_EDOM;
+                }
+              else
+                {
+                  int s;
+
+                  xa->cache = xidx[i];
+                  s = interp->type->eval(interp->state, xarr, yarr, zarr, farr,
+                                         interp->xsize, interp->ysize, interp->zsize,
+                                         x[i], y[j], z[k], xa, ya, za, &fjk[i]);
+                  if (s && !status)
+                    status = s;
+                }
+            }
+        }
+    }
+
+  free(xidx);
+
+  return status;
+} /* gsl_interp3d_eval_grid() */
+
+size_t
+gsl_interp3d_type_min_size(const gsl_interp3d_type * T)
+{
+  return T->min_size;
+}
+
+size_t
+gsl_interp3d_min_size(const gsl_interp3d * interp)
+{
+  return interp->type->min_size;
+}
+
+const char *
+gsl_interp3d_name(const gsl_interp3d * interp)
+{
+  return interp->type->name;
+}
+
+size_t
+gsl_interp3d_idx(const gsl_interp3d * interp,
+                 const size_t i, const size_t j, const size_t k)
+{
+  if (i >= interp->xsize)
+    {
+      GSL_ERROR_VAL ("x index out of range", GSL_ERANGE, 0);
+    }
+  else if (j >= interp->ysize)
+    {
+      GSL_ERROR_VAL ("y index out of range", GSL_ERANGE, 0);
+    }
+  else if (k >= interp->zsize)
+    {
+      GSL_ERROR_VAL ("z index out of range", GSL_ERANGE, 0);
+    }
+  else
+    {
+      return IDX3D(i, j, k, interp);
+    }
+} /* gsl_interp3d_idx() */
+
+int
+gsl_interp3d_set(const gsl_interp3d * interp, double farr[],
+                 const size_t i, const size_t j, const size_t k, const double f)
+{
+  if (i >= interp->xsize)
+    {
+      GSL_ERROR ("x index out of range", GSL_ERANGE);
+    }
+  else if (j >= interp->ysize)
+    {
+      GSL_ERROR ("y index out of range", GSL_ERANGE);
+    }
+  else if (k >= interp->zsize)
+    {
+      GSL_ERROR ("z index out of range", GSL_ERANGE);
+    }
+  else
+    {
+      farr[IDX3D(i, j, k, interp)] = f;
+      return GSL_SUCCESS;
+    }
+} /* gsl_interp3d_set() */
+
+double
+gsl_interp3d_get(const gsl_interp3d * interp, const double farr[],
+                 const size_t i, const size_t j, const size_t k)
+{
+  if (i >= interp->xsize)
+    {
+      GSL_ERROR_VAL ("x index out of range", GSL_ERANGE, 0);
+    }
+  else if (j >= interp->ysize)
+    {
+      GSL_ERROR_VAL ("y index out of range", GSL_ERANGE, 0);
+    }
+  else if (k >= interp->zsize)
+    {
+      GSL_ERROR_VAL ("z index out of range", GSL_ERANGE, 0);
+    }
+  else
+    {
+      return farr[IDX3D(i, j, k, interp)];
+    }
+} /* gsl_interp3d_get() */
+
+#undef IDX3D
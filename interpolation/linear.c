@@ -23,6 +23,7 @@
 #include <stdlib.h>
 #include <gsl/gsl_errno.h>
 #include <gsl/gsl_interp.h>
+#include "eval_array.h"
 
 static int
 linear_init (void * vstate,
@@ -182,6 +183,30 @@ linear_eval_integ (const void * vstate,
   return GSL_SUCCESS;
 }
 
+static void
+linear_coeffs (const void * vstate, const double x_array[],
+               const double y_array[], size_t index, double c[4])
+{
+  const double dx = x_array[index + 1] - x_array[index];
+
+  DISCARD_POINTER(vstate); /* prevent warning about unused parameter */
+
+  c[0] = y_array[index];
+  c[1] = (y_array[index + 1] - y_array[index]) / dx;
+  c[2] = 0.0;
+  c[3] = 0.0;
+}
+
+static int
+linear_eval_array (const void * vstate,
+                  const double x_array[], const double y_array[], size_t size,
+                  const double x[], size_t n, unsigned int nderiv,
+                  gsl_interp_accel * a, double y[])
+{
+  return eval_array_cubic (vstate, &linear_coeffs, x_array, y_array, size,
+                           x, n, nderiv, a, y);
+}
+
 static const gsl_interp_type linear_type = 
 {
   "linear", 
@@ -193,6 +218,7 @@ static const gsl_interp_type linear_type =
   &linear_eval_deriv2,
   &linear_eval_integ,
   NULL, /* free, not applicable */
+  &linear_eval_array
 };
 
 const gsl_interp_type * gsl_interp_linear = &linear_type;
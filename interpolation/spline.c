@@ -192,3 +192,83 @@ gsl_spline_eval_integ (const gsl_spline * spline,
                                 a, b, acc);
 }
 
+
+
+int
+gsl_spline_eval_array (const gsl_spline * spline,
+                       const double x[], size_t n,
+                       gsl_interp_accel * a, double y[])
+{
+  return gsl_interp_eval_array (spline->interp,
+                                spline->x, spline->y,
+                                x, n, a, y);
+}
+
+
+int
+gsl_spline_eval_deriv_array (const gsl_spline * spline,
+                             const double x[], size_t n,
+                             gsl_interp_accel * a, double d[])
+{
+  return gsl_interp_eval_deriv_array (spline->interp,
+                                      spline->x, spline->y,
+                                      x, n, a, d);
+}
+
+
+int
+gsl_spline_eval_deriv2_array (const gsl_spline * spline,
+                              const double x[], size_t n,
+                              gsl_interp_accel * a, double d2[])
+{
+  return gsl_interp_eval_deriv2_array (spline->interp,
+                                       spline->x, spline->y,
+                                       x, n, a, d2);
+}
+
+
+int
+gsl_spline_eval_array_parallel (const gsl_spline * spline,
+                                const double x[], size_t n,
+                                gsl_interp_accel * a, double y[],
+                                size_t ntasks, const gsl_executor * exec)
+{
+  return gsl_interp_eval_array_parallel (spline->interp,
+                                         spline->x, spline->y,
+                                         x, n, a, y, ntasks, exec);
+}
+
+
+int
+gsl_spline_eval_deriv_array_parallel (const gsl_spline * spline,
+                                      const double x[], size_t n,
+                                      gsl_interp_accel * a, double d[],
+                                      size_t ntasks, const gsl_executor * exec)
+{
+  return gsl_interp_eval_deriv_array_parallel (spline->interp,
+                                               spline->x, spline->y,
+                                               x, n, a, d, ntasks, exec);
+}
+
+
+int
+gsl_spline_eval_deriv2_array_parallel (const gsl_spline * spline,
+                                       const double x[], size_t n,
+                                       gsl_interp_accel * a, double d2[],
+                                       size_t ntasks, const gsl_executor * exec)
+{
+  return gsl_interp_eval_deriv2_array_parallel (spline->interp,
+                                                spline->x, spline->y,
+                                                x, n, a, d2, ntasks, exec);
+}
+
+
+int
+gsl_spline_eval_integ_array (const gsl_spline * spline,
+                             double a, const double b[], size_t n,
+                             gsl_interp_accel * acc, double result[])
+{
+  return gsl_interp_eval_integ_array (spline->interp,
+                                      spline->x, spline->y,
+                                      a, b, n, acc, result);
+}
@@ -214,6 +214,25 @@ gsl_spline2d_eval_deriv_xy_e(const gsl_spline2d * interp, const double x,
                                       interp->zarr, x, y, xa, ya, z);
 }
 
+int
+gsl_spline2d_eval_array(const gsl_spline2d * interp, const double x[],
+                        const double y[], const size_t n,
+                        gsl_interp_accel * xa, gsl_interp_accel * ya, double z[])
+{
+  return gsl_interp2d_eval_array(&(interp->interp_object), interp->xarr, interp->yarr,
+                                 interp->zarr, x, y, n, xa, ya, z);
+}
+
+int
+gsl_spline2d_eval_grid(const gsl_spline2d * interp,
+                       const double x[], const size_t nx,
+                       const double y[], const size_t ny,
+                       gsl_interp_accel * xa, gsl_interp_accel * ya, double z[])
+{
+  return gsl_interp2d_eval_grid(&(interp->interp_object), interp->xarr, interp->yarr,
+                                interp->zarr, x, nx, y, ny, xa, ya, z);
+}
+
 size_t
 gsl_spline2d_min_size(const gsl_spline2d * interp)
 {
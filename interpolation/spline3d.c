@@ -0,0 +1,232 @@
+/* interpolation/spline3d.c
+ * 
+ * Copyright (C) 2026 Patrick Alken
+ * 
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#include <config.h>
+#include <string.h>
+#include <stdlib.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_interp.h>
+#include <gsl/gsl_interp3d.h>
+#include <gsl/gsl_spline3d.h>
+
+gsl_spline3d *
+gsl_spline3d_alloc(const gsl_interp3d_type * T, size_t xsize, size_t ysize,
+                   size_t zsize)
+{
+  double * array_mem;
+  gsl_spline3d * interp;
+
+  if (xsize < T->min_size || ysize < T->min_size || zsize < T->min_size)
+    {
+      GSL_ERROR_NULL("insufficient number of points for interpolation type", GSL_EINVAL);
+    }
+
+  interp = calloc(1, sizeof(gsl_spline3d));
+  if (interp == NULL)
+    {
+      GSL_ERROR_NULL("failed to allocate space for gsl_spline3d struct", GSL_ENOMEM);
+    }
+
+  interp->interp_object.type = T;
+  interp->interp_object.xsize = xsize;
+  interp->interp_object.ysize = ysize;
+  interp->interp_object.zsize = zsize;
+  if (interp->interp_object.type->alloc == NULL)
+    {
+      interp->interp_object.state = NULL;
+    }
+  else
+    {
+      interp->interp_object.state = interp->interp_object.type->alloc(xsize, ysize, zsize);
+      if (interp->interp_object.state == NULL)
+        {
+          gsl_spline3d_free(interp);
+          GSL_ERROR_NULL("failed to allocate space for gsl_spline3d state", GSL_ENOMEM);
+        }
+    }
+
+  /* one contiguous block holds all four data arrays, cf. gsl_spline2d_alloc() */
+  array_mem = (double *)calloc(xsize + ysize + zsize + xsize * ysize * zsize,
+                               sizeof(double));
+  if (array_mem == NULL)
+    {
+      gsl_spline3d_free(interp);
+      GSL_ERROR_NULL("failed to allocate space for data arrays", GSL_ENOMEM);
+    }
+
+  interp->xarr = array_mem;
+  interp->yarr = array_mem + xsize;
+  interp->zarr = array_mem + xsize + ysize;
+  interp->farr = array_mem + xsize + ysize + zsize;
+
+  return interp;
+} /* gsl_spline3d_alloc() */
+
+int
+gsl_spline3d_init(gsl_spline3d * interp, const double xarr[],
+                  const double yarr[], const double zarr[], const double farr[],
+                  size_t xsize, size_t ysize, size_t zsize)
+{
+  int status = gsl_interp3d_init(&(interp->interp_object), xarr, yarr, zarr, farr,
+                                 xsize, ysize, zsize);
+
+  memcpy(interp->xarr, xarr, xsize * sizeof(double));
+  memcpy(interp->yarr, yarr, ysize * sizeof(double));
+  memcpy(interp->zarr, zarr, zsize * sizeof(double));
+  memcpy(interp->farr, farr, xsize * ysize * zsize * sizeof(double));
+
+  return status;
+} /* gsl_spline3d_init() */
+
+void
+gsl_spline3d_free(gsl_spline3d * interp)
+{
+  RETURN_IF_NULL(interp);
+
+  if (interp->interp_object.type->free)
+    interp->interp_object.type->free(interp->interp_object.state);
+
+  /* interp->xarr is the start of the block holding all the data arrays */
+  if (interp->xarr)
+    free(interp->xarr);
+
+  free(interp);
+} /* gsl_spline3d_free() */
+
+double
+gsl_spline3d_eval(const gsl_spline3d * interp, const double x, const double y,
+                  const double z, gsl_interp_accel * xa, gsl_interp_accel * ya,
+                  gsl_interp_accel * za)
+{
+  return gsl_interp3d_eval(&(interp->interp_object), interp->xarr, interp->yarr,
+                           interp->zarr, interp->farr, x, y, z, xa, ya, za);
+}
+
+int
+gsl_spline3d_eval_e(const gsl_spline3d * interp, const double x, const double y,
+                    const double z, gsl_interp_accel * xa, gsl_interp_accel * ya,
+                    gsl_interp_accel * za, double * f)
+{
+  return gsl_interp3d_eval_e(&(interp->interp_object), interp->xarr, interp->yarr,
+                             interp->zarr, interp->farr, x, y, z, xa, ya, za, f);
+}
+
+double
+gsl_spline3d_eval_deriv_x(const gsl_spline3d * interp, const double x, const double y,
+                          const double z, gsl_interp_accel * xa, gsl_interp_accel * ya,
+                          gsl_interp_accel * za)
+{
+  return gsl_interp3d_eval_deriv_x(&(interp->interp_object), interp->xarr, interp->yarr,
+                                   interp->zarr, interp->farr, x, y, z, xa, ya, za);
+}
+
+int
+gsl_spline3d_eval_deriv_x_e(const gsl_spline3d * interp, const double x, const double y,
+                            const double z, gsl_interp_accel * xa, gsl_interp_accel * ya,
+                            gsl_interp_accel * za, double * f)
+{
+  return gsl_interp3d_eval_deriv_x_e(&(interp->interp_object), interp->xarr, interp->yarr,
+                                     interp->zarr, interp->farr, x, y, z, xa, ya, za, f);
+}
+
+double
+gsl_spline3d_eval_deriv_y(const gsl_spline3d * interp, const double x, const double y,
+                          const double z, gsl_interp_accel * xa, gsl_interp_accel * ya,
+                          gsl_interp_accel * za)
+{
+  return gsl_interp3d_eval_deriv_y(&(interp->interp_object), interp->xarr, interp->yarr,
+                                   interp->zarr, interp->farr, x, y, z, xa, ya, za);
+}
+
+int
+gsl_spline3d_eval_deriv_y_e(const gsl_spline3d * interp, const double x, const double y,
+                            const double z, gsl_interp_accel * xa, gsl_interp_accel * ya,
+                            gsl_interp_accel * za, double * f)
+{
+  return gsl_interp3d_eval_deriv_y_e(&(interp->interp_object), interp->xarr, interp->yarr,
+                                     interp->zarr, interp->farr, x, y, z, xa, ya, za, f);
+}
+
+double
+gsl_spline3d_eval_deriv_z(const gsl_spline3d * interp, const double x, const double y,
+                          const double z, gsl_interp_accel * xa, gsl_interp_accel * ya,
+                          gsl_interp_accel * za)
+{
+  return gsl_interp3d_eval_deriv_z(&(interp->interp_object), interp->xarr, interp->yarr,
+                                   interp->zarr, interp->farr, x, y, z, xa, ya, za);
+}
+
+int
+gsl_spline3d_eval_deriv_z_e(const gsl_spline3d * interp, const double x, const double y,
+                            const double z, gsl_interp_accel * xa, gsl_interp_accel * ya,
+                            gsl_interp_accel * za, double * f)
+{
+  return gsl_interp3d_eval_deriv_z_e(&(interp->interp_object), interp->xarr, interp->yarr,
+                                     interp->zarr, interp->farr, x, y, z, xa, ya, za, f);
+}
+
+int
+gsl_spline3d_eval_array(const gsl_spline3d * interp, const double x[],
+                        const double y[], const double z[], const size_t n,
+                        gsl_interp_accel * xa, gsl_interp_accel * ya,
+                        gsl_interp_accel * za, double f[])
+{
+  return gsl_interp3d_eval_array(&(interp->interp_object), interp->xarr, interp->yarr,
+                                 interp->zarr, interp->farr, x, y, z, n, xa, ya, za, f);
+}
+
+int
+gsl_spline3d_eval_grid(const gsl_spline3d * interp,
+                       const double x[], const size_t nx,
+                       const double y[], const size_t ny,
+                       const double z[], const size_t nz,
+                       gsl_interp_accel * xa, gsl_interp_accel * ya,
+                       gsl_interp_accel * za, double f[])
+{
+  return gsl_interp3d_eval_grid(&(interp->interp_object), interp->xarr, interp->yarr,
+                                interp->zarr, interp->farr, x, nx, y, ny, z, nz,
+                                xa, ya, za, f);
+}
+
+size_t
+gsl_spline3d_min_size(const gsl_spline3d * interp)
+{
+  return gsl_interp3d_min_size(&(interp->interp_object));
+}
+
+const char *
+gsl_spline3d_name(const gsl_spline3d * interp)
+{
+  return gsl_interp3d_name(&(interp->interp_object));
+}
+
+int
+gsl_spline3d_set(const gsl_spline3d * interp, double farr[],
+                 const size_t i, const size_t j, const size_t k, const double f)
+{
+  return gsl_interp3d_set(&(interp->interp_object), farr, i, j, k, f);
+} /* gsl_spline3d_set() */
+
+double
+gsl_spline3d_get(const gsl_spline3d * interp, const double farr[],
+                 const size_t i, const size_t j, const size_t k)
+{
+  return gsl_interp3d_get(&(interp->interp_object), farr, i, j, k);
+} /* gsl_spline3d_get() */
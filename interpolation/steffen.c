@@ -39,6 +39,7 @@
 #include <gsl/gsl_errno.h>
 #include "integ_eval.h"
 #include <gsl/gsl_interp.h>
+#include "eval_array.h"
 
 typedef struct
 {
@@ -370,6 +371,31 @@ steffen_copysign(const double x, const double y)
   return x;
 }
 
+static void
+steffen_coeffs (const void * vstate, const double x_array[],
+                const double y_array[], size_t index, double c[4])
+{
+  const steffen_state_t *state = (const steffen_state_t *) vstate;
+
+  DISCARD_POINTER(x_array); /* prevent warning about unused parameter */
+  DISCARD_POINTER(y_array);
+
+  c[0] = state->d[index];
+  c[1] = state->c[index];
+  c[2] = state->b[index];
+  c[3] = state->a[index];
+}
+
+static int
+steffen_eval_array (const void * vstate,
+                   const double x_array[], const double y_array[], size_t size,
+                   const double x[], size_t n, unsigned int nderiv,
+                   gsl_interp_accel * a, double y[])
+{
+  return eval_array_cubic (vstate, &steffen_coeffs, x_array, y_array, size,
+                           x, n, nderiv, a, y);
+}
+
 static const gsl_interp_type steffen_type = 
 {
   "steffen", 
@@ -380,7 +406,8 @@ static const gsl_interp_type steffen_type =
   &steffen_eval_deriv,
   &steffen_eval_deriv2,
   &steffen_eval_integ,
-  &steffen_free
+  &steffen_free,
+  &steffen_eval_array
 };
 
 const gsl_interp_type * gsl_interp_steffen = &steffen_type;
@@ -26,6 +26,7 @@
 #include <stdlib.h>
 #include <stdio.h>
 #include <math.h>
+#include <gsl/gsl_math.h>
 #include <gsl/gsl_test.h>
 #include <gsl/gsl_errno.h>
 #include <gsl/gsl_interp.h>
@@ -33,6 +34,29 @@
 
 #include "test2d.c"
 
+#define NTASKS 4
+
+/* An executor which runs the tasks in reverse order, to check that
+   the results of the parallel functions do not depend on the order in
+   which the tasks are run */
+
+static void
+reverse_run (size_t ntasks, void (*task) (size_t i, void * data),
+             void * data, void * params)
+{
+  size_t i;
+
+  (void) params;
+
+  for (i = ntasks; i-- > 0;)
+    {
+      task (i, data);
+    }
+}
+
+static const gsl_executor reverse_exec = { &reverse_run, 0 };
+#include "test3d.c"
+
 int
 test_bsearch(void)
 {
@@ -117,6 +141,77 @@ test_bsearch(void)
 
 
 typedef double TEST_FUNC (double);
+/* compare gsl_interp_accel_find using the lookup tables built by
+   gsl_interp_accel_init with a binary search over the whole array */
+static int
+test_accel_grid (const double xa[], const size_t size, const char * desc)
+{
+  gsl_interp_accel *a = gsl_interp_accel_alloc ();
+  const double xmin = xa[0], xmax = xa[size - 1];
+  const size_t ntest = 5000;
+  size_t i, nerr = 0;
+  unsigned long seed = 1;
+
+  gsl_interp_accel_init (a, xa, size);
+
+  for (i = 0; i < ntest + 2 * size; i++)
+    {
+      double x;
+      size_t k1, k2;
+
+      if (i < 2 * size)
+        {
+          /* the points themselves and the midpoints */
+          x = (i % 2) ? 0.5 * (xa[i / 2] + xa[GSL_MIN (i / 2 + 1, size - 1)]) : xa[i / 2];
+        }
+      else
+        {
+          seed = (1103515245 * seed + 12345) & 0x7fffffffUL;
+          x = xmin + (xmax - xmin) * (1.2 * seed / 2147483648.0 - 0.1);
+        }
+
+      k1 = gsl_interp_accel_find (a, xa, size, x);
+      k2 = gsl_interp_bsearch (xa, x, 0, size - 1);
+
+      if (k1 != k2)
+        nerr++;
+    }
+
+  gsl_test (nerr, "gsl_interp_accel_init %s", desc);
+
+  gsl_interp_accel_free (a);
+
+  return nerr != 0;
+}
+
+static int
+test_accel (void)
+{
+  const size_t size = 1000;
+  double *xa = malloc (size * sizeof (double));
+  int status = 0;
+  size_t i;
+
+  for (i = 0; i < size; i++)
+    xa[i] = -3.0 + 0.1 * i;
+  status += test_accel_grid (xa, size, "uniform");
+
+  for (i = 0; i < size; i++)
+    xa[i] = -3.0 + 0.1 * i + 0.02 * sin (i);
+  status += test_accel_grid (xa, size, "perturbed uniform");
+
+  for (i = 0; i < size; i++)
+    xa[i] = exp (0.01 * i);
+  status += test_accel_grid (xa, size, "non-uniform");
+  status += test_accel_grid (xa, 100, "non-uniform 100");
+  status += test_accel_grid (xa, 50, "non-uniform 50");
+  status += test_accel_grid (xa, 2, "two points");
+
+  free (xa);
+
+  return status;
+}
+
 typedef struct _xy_table xy_table;
 
 struct _xy_table
@@ -186,6 +281,91 @@ test_interp (
       }
     }
 
+  /* array evaluation, for increasing and decreasing x and with a point
+     outside the range of the data */
+  {
+    const size_t n = test_table->n;
+    double *x = malloc ((n + 1) * sizeof (double));
+    double *y = malloc ((n + 1) * sizeof (double));
+    double *deriv = malloc ((n + 1) * sizeof (double));
+    double *integ = malloc ((n + 1) * sizeof (double));
+    const double x0 = test_table->x[0];
+    int rev;
+
+    for (rev = 0; rev < 2; rev++)
+      {
+        gsl_interp_accel_reset (a);
+
+        for (i = 0; i < n; i++)
+          {
+            x[i] = rev ? test_table->x[n - 1 - i] : test_table->x[i];
+          }
+
+        s1 = gsl_interp_eval_array (interp, data_table->x, data_table->y, x, n, rev ? NULL : a, y);
+        s2 = gsl_interp_eval_deriv_array (interp, data_table->x, data_table->y, x, n, rev ? NULL : a, deriv);
+        s3 = gsl_interp_eval_integ_array (interp, data_table->x, data_table->y, x0, x, n, rev ? NULL : a, integ);
+
+        gsl_test (s1, "gsl_interp_eval_array %s rev=%d", gsl_interp_name(interp), rev);
+        gsl_test (s2, "gsl_interp_eval_deriv_array %s rev=%d", gsl_interp_name(interp), rev);
+        gsl_test (s3, "gsl_interp_eval_integ_array %s rev=%d", gsl_interp_name(interp), rev);
+
+        for (i = 0; i < n; i++)
+          {
+            size_t j = rev ? n - 1 - i : i;
+
+            if (fabs (y[i] - test_table->y[j]) > 1.0e-10 ||
+                fabs (deriv[i] - test_d_table->y[j]) > 1.0e-10 ||
+                fabs (integ[i] - test_i_table->y[j]) > 1.0e-10)
+              {
+                gsl_test (1, "%s array %d rev=%d", gsl_interp_name(interp), (int) i, rev);
+                status++;
+              }
+          }
+      }
+
+    x[n] = data_table->x[data_table->n - 1] + 1.0;
+    s1 = gsl_interp_eval_array (interp, data_table->x, data_table->y, x, n + 1, a, y);
+    gsl_test (s1 != GSL_EDOM || !gsl_isnan (y[n]) || gsl_isnan (y[0]),
+              "gsl_interp_eval_array %s out of range", gsl_interp_name(interp));
+
+    /* parallel evaluation gives the serial results, with any number of
+       tasks run in any order */
+    {
+      double *yp = malloc ((n + 1) * sizeof (double));
+      double *dp = malloc ((n + 1) * sizeof (double));
+      size_t ntasks;
+
+      for (ntasks = 1; ntasks <= NTASKS; ntasks++)
+        {
+          int fail = 0;
+
+          gsl_interp_accel_reset (a);
+          s1 = gsl_interp_eval_array_parallel (interp, data_table->x, data_table->y,
+                                               x, n + 1, a, yp, ntasks, &reverse_exec);
+          s2 = gsl_interp_eval_deriv_array_parallel (interp, data_table->x, data_table->y,
+                                                     x, n + 1, NULL, dp, ntasks, NULL);
+
+          fail |= (s1 != GSL_EDOM || s2 != GSL_EDOM);
+          fail |= !gsl_isnan (yp[n]) || !gsl_isnan (dp[n]);
+
+          for (i = 0; i < n; i++)
+            fail |= (yp[i] != y[i] || dp[i] != deriv[i]);
+
+          gsl_test (fail, "gsl_interp_eval_array_parallel %s ntasks=%d",
+                    gsl_interp_name(interp), (int) ntasks);
+          status += fail;
+        }
+
+      free (yp);
+      free (dp);
+    }
+
+    free (x);
+    free (y);
+    free (deriv);
+    free (integ);
+  }
+
   gsl_interp_accel_free (a);
   gsl_interp_free (interp);
 
@@ -1216,6 +1396,7 @@ main (int argc, char **argv)
   argv = 0;
 
   status += test_bsearch();
+  status += test_accel();
   status += test_linear();
   status += test_polynomial();
   status += test_cspline();
@@ -1228,6 +1409,7 @@ main (int argc, char **argv)
   status += test_steffen2();
 
   status += test_interp2d_main();
+  status += test_interp3d_main();
 
   exit (gsl_test_summary());
 }
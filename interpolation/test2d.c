@@ -19,7 +19,9 @@
 
 #include <config.h>
 #include <math.h>
+#include <stdlib.h>
 #include <gsl/gsl_errno.h>
+#include <gsl/gsl_math.h>
 #include <gsl/gsl_ieee_utils.h>
 #include <gsl/gsl_test.h>
 #include <gsl/gsl_interp.h>
@@ -160,6 +162,62 @@ const double xarr[], const double yarr[], const double zarr[], /* data */
       test_single_low_level(&gsl_interp2d_eval_extrap, &gsl_interp2d_eval_extrap_e, interp, xarr, yarr, zarr, x, y, xa, ya, zval, i);
     }
 
+  /* batch evaluation must agree with single point evaluation */
+  {
+    const size_t nx = 2 * xsize - 1, ny = 2 * ysize - 1;
+    double *xg = malloc(nx * sizeof(double));
+    double *yg = malloc(ny * sizeof(double));
+    double *zg = malloc(nx * ny * sizeof(double));
+    double *zp = malloc(test_size * sizeof(double));
+    size_t j;
+    int s;
+
+    /* grid of the nodes and the cell midpoints */
+    for (i = 0; i < nx; i++)
+      xg[i] = (i % 2) ? 0.5 * (xarr[i / 2] + xarr[i / 2 + 1]) : xarr[i / 2];
+    for (j = 0; j < ny; j++)
+      yg[j] = (j % 2) ? 0.5 * (yarr[j / 2] + yarr[j / 2 + 1]) : yarr[j / 2];
+
+    s = gsl_interp2d_eval_grid(interp, xarr, yarr, zarr, xg, nx, yg, ny, NULL, NULL, zg);
+    gsl_test(s, "gsl_interp2d_eval_grid %s status", gsl_interp2d_name(interp));
+    for (j = 0; j < ny; j++)
+      for (i = 0; i < nx; i++)
+        gsl_test_rel(zg[j * nx + i],
+                     gsl_interp2d_eval(interp, xarr, yarr, zarr, xg[i], yg[j], NULL, NULL),
+                     1e-14, "gsl_interp2d_eval_grid %s (%d,%d)",
+                     gsl_interp2d_name(interp), (int) i, (int) j);
+
+    s = gsl_spline2d_eval_grid(interp_s, xg, nx, yg, ny, xa, ya, zg);
+    gsl_test(s, "gsl_spline2d_eval_grid %s status", gsl_spline2d_name(interp_s));
+    gsl_test_rel(zg[nx * ny - 1], zarr[xsize * ysize - 1], 1e-10,
+                 "gsl_spline2d_eval_grid %s corner", gsl_spline2d_name(interp_s));
+
+    s = gsl_spline2d_eval_array(interp_s, xval, yval, test_size, xa, ya, zp);
+    gsl_test(s, "gsl_spline2d_eval_array %s status", gsl_spline2d_name(interp_s));
+    for (i = 0; i < test_size; i++)
+      gsl_test_rel(zp[i], gsl_interp2d_eval(interp, xarr, yarr, zarr, xval[i], yval[i], NULL, NULL),
+                   1e-14, "gsl_spline2d_eval_array %s %d", gsl_spline2d_name(interp_s), (int) i);
+
+    /* a point off the grid gives NaN and GSL_EDOM */
+    xg[1] = xarr[xsize - 1] + 1.0;
+    s = gsl_interp2d_eval_grid(interp, xarr, yarr, zarr, xg, nx, yg, ny, xa, ya, zg);
+    gsl_test_int(s, GSL_EDOM, "gsl_interp2d_eval_grid %s out of range status", gsl_interp2d_name(interp));
+    gsl_test(!gsl_isnan(zg[nx + 1]), "gsl_interp2d_eval_grid %s out of range NaN", gsl_interp2d_name(interp));
+    gsl_test_rel(zg[nx + 2],
+                 gsl_interp2d_eval(interp, xarr, yarr, zarr, xg[2], yg[1], NULL, NULL),
+                 1e-14, "gsl_interp2d_eval_grid %s next to out of range", gsl_interp2d_name(interp));
+
+    s = gsl_interp2d_eval_array(interp, xarr, yarr, zarr, xg, yg, 2, xa, ya, zp);
+    gsl_test_int(s, GSL_EDOM, "gsl_interp2d_eval_array %s out of range status", gsl_interp2d_name(interp));
+    gsl_test(!gsl_isnan(zp[1]), "gsl_interp2d_eval_array %s out of range NaN", gsl_interp2d_name(interp));
+    gsl_test_rel(zp[0], zarr[0], 1e-10, "gsl_interp2d_eval_array %s first point", gsl_interp2d_name(interp));
+
+    free(xg);
+    free(yg);
+    free(zg);
+    free(zp);
+  }
+
   gsl_interp_accel_free(xa);
   gsl_interp_accel_free(ya);
   gsl_interp2d_free(interp);
@@ -0,0 +1,252 @@
+/* interpolation/test3d.c
+ * 
+ * Copyright (C) 2026 Patrick Alken
+ * 
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#include <config.h>
+#include <math.h>
+#include <stdlib.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_test.h>
+#include <gsl/gsl_interp.h>
+#include <gsl/gsl_interp2d.h>
+#include <gsl/gsl_interp3d.h>
+#include <gsl/gsl_spline3d.h>
+
+/* a function linear in each variable, reproduced exactly by both types */
+static double
+test3d_func(const double x, const double y, const double z)
+{
+  return (1.0 + x) * (2.0 - 0.5 * y) * (3.0 + 0.25 * z);
+}
+
+/*
+ * Tests that an interpolation type reproduces the nodes of a non-uniform
+ * grid and a multilinear function and its derivatives between them, and
+ * that the batch routines agree with single point evaluation
+ */
+static int
+test_interp3d(const gsl_interp3d_type * T)
+{
+  const double xarr[] = { 0.0, 0.5, 1.5, 2.0, 3.5 };
+  const double yarr[] = { -1.0, 0.0, 0.3, 1.0 };
+  const double zarr[] = { 0.0, 1.0, 2.0, 4.0, 5.0, 5.5 };
+  const size_t xsize = sizeof(xarr) / sizeof(xarr[0]);
+  const size_t ysize = sizeof(yarr) / sizeof(yarr[0]);
+  const size_t zsize = sizeof(zarr) / sizeof(zarr[0]);
+  const double xval[] = { 0.1, 3.4, 1.7, 0.5, 2.9, 3.5 };
+  const double yval[] = { -0.9, 0.7, 0.15, 1.0, -0.2, 0.99 };
+  const double zval[] = { 5.3, 0.2, 2.2, 4.5, 3.7, 0.0 };
+  const size_t test_size = sizeof(xval) / sizeof(xval[0]);
+  gsl_interp3d *interp = gsl_interp3d_alloc(T, xsize, ysize, zsize);
+  gsl_spline3d *spline = gsl_spline3d_alloc(T, xsize, ysize, zsize);
+  gsl_interp_accel *xa = gsl_interp_accel_alloc();
+  gsl_interp_accel *ya = gsl_interp_accel_alloc();
+  gsl_interp_accel *za = gsl_interp_accel_alloc();
+  double *farr = malloc(xsize * ysize * zsize * sizeof(double));
+  double *fg = malloc(xsize * ysize * zsize * sizeof(double));
+  double fp[sizeof(xval) / sizeof(xval[0])];
+  const char *name = gsl_interp3d_name(interp);
+  size_t i, j, k;
+  int s;
+
+  gsl_test_int(gsl_interp3d_type_min_size(T), T->min_size,
+               "gsl_interp3d_type_min_size on %s", name);
+
+  for (k = 0; k < zsize; k++)
+    for (j = 0; j < ysize; j++)
+      for (i = 0; i < xsize; i++)
+        gsl_interp3d_set(interp, farr, i, j, k, test3d_func(xarr[i], yarr[j], zarr[k]));
+
+  gsl_test_int(gsl_interp3d_idx(interp, 1, 2, 3), (3 * ysize + 2) * xsize + 1,
+               "gsl_interp3d_idx on %s", name);
+
+  gsl_interp3d_init(interp, xarr, yarr, zarr, farr, xsize, ysize, zsize);
+  gsl_spline3d_init(spline, xarr, yarr, zarr, farr, xsize, ysize, zsize);
+
+  /* reproduction of the nodes */
+  for (k = 0; k < zsize; k++)
+    for (j = 0; j < ysize; j++)
+      for (i = 0; i < xsize; i++)
+        {
+          double f = gsl_interp3d_eval(interp, xarr, yarr, zarr, farr,
+                                       xarr[i], yarr[j], zarr[k], xa, ya, za);
+          gsl_test_rel(f, gsl_interp3d_get(interp, farr, i, j, k), 1e-12,
+                       "%s node (%d,%d,%d)", name, (int) i, (int) j, (int) k);
+        }
+
+  /* values and first derivatives between the nodes */
+  for (i = 0; i < test_size; i++)
+    {
+      const double x = xval[i], y = yval[i], z = zval[i];
+      double f;
+
+      gsl_test_rel(gsl_interp3d_eval(interp, xarr, yarr, zarr, farr, x, y, z, xa, ya, za),
+                   test3d_func(x, y, z), 1e-12, "%s eval %d", name, (int) i);
+      gsl_test_rel(gsl_interp3d_eval_extrap(interp, xarr, yarr, zarr, farr, x, y, z, NULL, NULL, NULL),
+                   test3d_func(x, y, z), 1e-12, "%s eval_extrap %d", name, (int) i);
+      gsl_test_rel(gsl_interp3d_eval_deriv_x(interp, xarr, yarr, zarr, farr, x, y, z, xa, ya, za),
+                   (2.0 - 0.5 * y) * (3.0 + 0.25 * z), 1e-12, "%s deriv_x %d", name, (int) i);
+      gsl_test_rel(gsl_interp3d_eval_deriv_y(interp, xarr, yarr, zarr, farr, x, y, z, xa, ya, za),
+                   -0.5 * (1.0 + x) * (3.0 + 0.25 * z), 1e-12, "%s deriv_y %d", name, (int) i);
+      gsl_test_rel(gsl_interp3d_eval_deriv_z(interp, xarr, yarr, zarr, farr, x, y, z, xa, ya, za),
+                   0.25 * (1.0 + x) * (2.0 - 0.5 * y), 1e-12, "%s deriv_z %d", name, (int) i);
+
+      s = gsl_spline3d_eval_e(spline, x, y, z, xa, ya, za, &f);
+      gsl_test(s, "%s spline3d_eval_e %d status", name, (int) i);
+      gsl_test_rel(f, test3d_func(x, y, z), 1e-12, "%s spline3d_eval_e %d", name, (int) i);
+      gsl_test_rel(gsl_spline3d_eval_deriv_z(spline, x, y, z, NULL, NULL, NULL),
+                   0.25 * (1.0 + x) * (2.0 - 0.5 * y), 1e-12,
+                   "%s spline3d_eval_deriv_z %d", name, (int) i);
+    }
+
+  /* extrapolation of a multilinear function is exact for trilinear */
+  if (T == gsl_interp3d_trilinear)
+    gsl_test_rel(gsl_interp3d_eval_extrap(interp, xarr, yarr, zarr, farr, 4.0, -1.5, 6.0, xa, ya, za),
+                 test3d_func(4.0, -1.5, 6.0), 1e-12, "%s extrapolation", name);
+
+  s = gsl_spline3d_eval_array(spline, xval, yval, zval, test_size, NULL, NULL, NULL, fp);
+  gsl_test(s, "%s spline3d_eval_array status", name);
+  for (i = 0; i < test_size; i++)
+    gsl_test_rel(fp[i], test3d_func(xval[i], yval[i], zval[i]), 1e-12,
+                 "%s spline3d_eval_array %d", name, (int) i);
+
+  /* the grid of the nodes gives back the data */
+  s = gsl_interp3d_eval_grid(interp, xarr, yarr, zarr, farr, xarr, xsize,
+                             yarr, ysize, zarr, zsize, NULL, NULL, NULL, fg);
+  gsl_test(s, "%s eval_grid status", name);
+  for (i = 0; i < xsize * ysize * zsize; i++)
+    gsl_test_rel(fg[i], farr[i], 1e-12, "%s eval_grid %d", name, (int) i);
+
+  s = gsl_spline3d_eval_grid(spline, xval, test_size, yval, 2, zval, 1, xa, ya, za, fg);
+  gsl_test(s, "%s spline3d_eval_grid status", name);
+  for (j = 0; j < 2; j++)
+    for (i = 0; i < test_size; i++)
+      gsl_test_rel(fg[j * test_size + i], test3d_func(xval[i], yval[j], zval[0]), 1e-12,
+                   "%s spline3d_eval_grid (%d,%d)", name, (int) i, (int) j);
+
+  /* points off the grid give NaN and GSL_EDOM */
+  {
+    const double xo[] = { 1.0, 1.0, 1.0 };
+    const double yo[] = { 0.5, 1.5, 0.5 };
+    const double zo[] = { 2.0, 2.0, -0.5 };
+    double fo[3];
+
+    s = gsl_interp3d_eval_array(interp, xarr, yarr, zarr, farr, xo, yo, zo, 3, xa, ya, za, fo);
+    gsl_test_int(s, GSL_EDOM, "%s eval_array out of range status", name);
+    gsl_test_rel(fo[0], test3d_func(1.0, 0.5, 2.0), 1e-12, "%s eval_array in range", name);
+    gsl_test(!gsl_isnan(fo[1]) || !gsl_isnan(fo[2]), "%s eval_array out of range NaN", name);
+
+    s = gsl_interp3d_eval_grid(interp, xarr, yarr, zarr, farr, xo, 1, yo, 2, zo, 1, xa, ya, za, fo);
+    gsl_test_int(s, GSL_EDOM, "%s eval_grid out of range status", name);
+    gsl_test_rel(fo[0], test3d_func(1.0, 0.5, 2.0), 1e-12, "%s eval_grid in range", name);
+    gsl_test(!gsl_isnan(fo[1]), "%s eval_grid out of range NaN", name);
+  }
+
+  free(farr);
+  free(fg);
+  gsl_interp_accel_free(xa);
+  gsl_interp_accel_free(ya);
+  gsl_interp_accel_free(za);
+  gsl_interp3d_free(interp);
+  gsl_spline3d_free(spline);
+
+  return 0;
+}
+
+/*
+ * Data independent of z: the tricubic interpolant must reduce to the
+ * bicubic one in every z plane, using the nonlinear data of
+ * test_bicubic_nonlinear
+ */
+static int
+test_tricubic_bicubic(void)
+{
+  const double xarr[] = { 1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0 };
+  const double yarr[] = { 1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0 };
+  const double zarr[] = { -1.0, 0.5, 1.0, 3.0, 3.5 };
+  const double xval[] = { 1.4, 2.3, 4.7, 3.3, 7.5, 6.6, 5.1 };
+  const double yval[] = { 1.0, 1.8, 1.9, 2.5, 2.7, 4.1, 3.3 };
+  const double zval[] = { -0.5, 3.2, 0.7, 1.0, 2.2, 3.5, 0.0 };
+  const size_t xsize = sizeof(xarr) / sizeof(xarr[0]);
+  const size_t ysize = sizeof(yarr) / sizeof(yarr[0]);
+  const size_t zsize = sizeof(zarr) / sizeof(zarr[0]);
+  const size_t test_size = sizeof(xval) / sizeof(xval[0]);
+  gsl_interp2d *interp2 = gsl_interp2d_alloc(gsl_interp2d_bicubic, xsize, ysize);
+  gsl_interp3d *interp3 = gsl_interp3d_alloc(gsl_interp3d_tricubic, xsize, ysize, zsize);
+  double za[8 * 8];
+  double *fa = malloc(xsize * ysize * zsize * sizeof(double));
+  size_t i, j, k;
+
+  /* least common multiple of x and y */
+  for (j = 0; j < ysize; j++)
+    for (i = 0; i < xsize; i++)
+      {
+        size_t a = i + 1, b = j + 1, g;
+        for (g = a; b != 0; )
+          {
+            size_t t = g % b;
+            g = b;
+            b = t;
+          }
+        za[j * xsize + i] = (double) ((i + 1) * (j + 1) / g);
+      }
+
+  for (k = 0; k < zsize; k++)
+    for (i = 0; i < xsize * ysize; i++)
+      fa[k * xsize * ysize + i] = za[i];
+
+  gsl_interp2d_init(interp2, xarr, yarr, za, xsize, ysize);
+  gsl_interp3d_init(interp3, xarr, yarr, zarr, fa, xsize, ysize, zsize);
+
+  for (i = 0; i < test_size; i++)
+    {
+      const double x = xval[i], y = yval[i], z = zval[i];
+
+      gsl_test_rel(gsl_interp3d_eval(interp3, xarr, yarr, zarr, fa, x, y, z, NULL, NULL, NULL),
+                   gsl_interp2d_eval(interp2, xarr, yarr, za, x, y, NULL, NULL),
+                   1e-12, "tricubic z-independent eval %d", (int) i);
+      gsl_test_rel(gsl_interp3d_eval_deriv_x(interp3, xarr, yarr, zarr, fa, x, y, z, NULL, NULL, NULL),
+                   gsl_interp2d_eval_deriv_x(interp2, xarr, yarr, za, x, y, NULL, NULL),
+                   1e-12, "tricubic z-independent deriv_x %d", (int) i);
+      gsl_test_rel(gsl_interp3d_eval_deriv_y(interp3, xarr, yarr, zarr, fa, x, y, z, NULL, NULL, NULL),
+                   gsl_interp2d_eval_deriv_y(interp2, xarr, yarr, za, x, y, NULL, NULL),
+                   1e-12, "tricubic z-independent deriv_y %d", (int) i);
+      gsl_test_abs(gsl_interp3d_eval_deriv_z(interp3, xarr, yarr, zarr, fa, x, y, z, NULL, NULL, NULL),
+                   0.0, 1e-12, "tricubic z-independent deriv_z %d", (int) i);
+    }
+
+  free(fa);
+  gsl_interp2d_free(interp2);
+  gsl_interp3d_free(interp3);
+
+  return 0;
+}
+
+/* runs all the tests */
+int
+test_interp3d_main(void)
+{
+  int status = 0;
+
+  status += test_interp3d(gsl_interp3d_trilinear);
+  status += test_interp3d(gsl_interp3d_tricubic);
+  status += test_tricubic_bicubic();
+
+  return status;
+}
@@ -0,0 +1,335 @@
+/* interpolation/tricubic.c
+ * 
+ * Copyright (C) 2026 Patrick Alken
+ * 
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#include <config.h>
+#include <stdlib.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_interp.h>
+#include <gsl/gsl_interp3d.h>
+
+#define IDX3D(i, j, k, w) ((((k) * ((w)->ysize)) + (j)) * ((w)->xsize) + (i))
+
+/*
+ * Tricubic Hermite interpolation. As for bicubic interpolation the
+ * partial derivatives at the nodes are taken from natural cubic splines
+ * through the grid lines, and the mixed derivatives from splines
+ * through the lower order derivatives.
+ */
+
+typedef struct
+{
+  double * d[8];   /* d[p + 2q + 4r] = d^(p+q+r) f / dx^p dy^q dz^r, d[0] unused */
+  size_t xsize;
+  size_t ysize;
+  size_t zsize;
+} tricubic_state_t;
+
+static void tricubic_free (void * vstate);
+
+static void *
+tricubic_alloc(size_t xsize, size_t ysize, size_t zsize)
+{
+  const size_t n = xsize * ysize * zsize;
+  tricubic_state_t *state;
+  size_t m;
+
+  state = calloc(1, sizeof (tricubic_state_t));
+  if (state == NULL)
+    {
+      GSL_ERROR_NULL("failed to allocate space for state", GSL_ENOMEM);
+    }
+
+  /* one block for the seven derivative arrays */
+  state->d[1] = malloc (7 * n * sizeof (double));
+  if (state->d[1] == NULL)
+    {
+      tricubic_free(state);
+      GSL_ERROR_NULL("failed to allocate space for derivatives", GSL_ENOMEM);
+    }
+
+  for (m = 2; m < 8; m++)
+    state->d[m] = state->d[m - 1] + n;
+
+  state->xsize = xsize;
+  state->ysize = ysize;
+  state->zsize = zsize;
+
+  return state;
+} /* tricubic_alloc() */
+
+static void
+tricubic_free (void * vstate)
+{
+  tricubic_state_t *state = (tricubic_state_t *) vstate;
+
+  RETURN_IF_NULL(state);
+
+  if (state->d[1])
+    free (state->d[1]);
+
+  free (state);
+} /* tricubic_free() */
+
+/*
+ * Differentiate src along the grid lines of one axis, with coordinates
+ * coord[0..n-1] and a stride of s between neighbouring nodes, using a
+ * natural cubic spline through each line
+ */
+static int
+tricubic_diff(const double coord[], const size_t n, const size_t s,
+              const size_t ntot, const double src[], double dst[],
+              double work[])
+{
+  const size_t nlines = ntot / n;
+  gsl_interp *interp = gsl_interp_alloc(gsl_interp_cspline, n);
+  gsl_interp_accel *acc = gsl_interp_accel_alloc();
+  size_t l, m;
+
+  if (interp == NULL || acc == NULL)
+    {
+      gsl_interp_free(interp);
+      gsl_interp_accel_free(acc);
+      GSL_ERROR("failed to allocate space for spline", GSL_ENOMEM);
+    }
+
+  for (l = 0; l < nlines; l++)
+    {
+      /* first node of line l */
+      const size_t offset = (l / s) * s * n + (l % s);
+      int status;
+
+      for (m = 0; m < n; m++)
+        work[m] = src[offset + m * s];
+
+      status = gsl_interp_init(interp, coord, work, n);
+      if (status)
+        {
+          gsl_interp_free(interp);
+          gsl_interp_accel_free(acc);
+          return status;
+        }
+
+      for (m = 0; m < n; m++)
+        dst[offset + m * s] = gsl_interp_eval_deriv(interp, coord, work, coord[m], acc);
+    }
+
+  gsl_interp_free(interp);
+  gsl_interp_accel_free(acc);
+
+  return GSL_SUCCESS;
+}
+
+static int
+tricubic_init(void * vstate, const double xa[], const double ya[],
+              const double za[], const double fa[], size_t xsize,
+              size_t ysize, size_t zsize)
+{
+  tricubic_state_t *state = (tricubic_state_t *) vstate;
+  const size_t ntot = xsize * ysize * zsize;
+  const size_t sxy = xsize * ysize;
+  size_t nmax = GSL_MAX(xsize, GSL_MAX(ysize, zsize));
+  double *work = malloc(nmax * sizeof(double));
+  int status;
+
+  if (work == NULL)
+    {
+      GSL_ERROR("failed to allocate space for work", GSL_ENOMEM);
+    }
+
+  status = tricubic_diff(xa, xsize, 1, ntot, fa, state->d[1], work);             /* fx */
+  if (!status)
+    status = tricubic_diff(ya, ysize, xsize, ntot, fa, state->d[2], work);       /* fy */
+  if (!status)
+    status = tricubic_diff(za, zsize, sxy, ntot, fa, state->d[4], work);         /* fz */
+  if (!status)
+    status = tricubic_diff(xa, xsize, 1, ntot, state->d[2], state->d[3], work);  /* fxy */
+  if (!status)
+    status = tricubic_diff(xa, xsize, 1, ntot, state->d[4], state->d[5], work);  /* fxz */
+  if (!status)
+    status = tricubic_diff(ya, ysize, xsize, ntot, state->d[4], state->d[6], work); /* fyz */
+  if (!status)
+    status = tricubic_diff(xa, xsize, 1, ntot, state->d[6], state->d[7], work);  /* fxyz */
+
+  free(work);
+
+  return status;
+} /* tricubic_init() */
+
+/*
+ * Cubic Hermite basis on a cell of width h at fractional position t:
+ * w[0], w[2] weight the values at the two ends and w[1], w[3] the
+ * derivatives. If deriv is set the derivatives of the weights with
+ * respect to x are returned instead.
+ */
+static void
+tricubic_basis(const double t, const double h, const int deriv, double w[4])
+{
+  const double t2 = t * t;
+
+  if (deriv)
+    {
+      w[0] = (6.0 * t2 - 6.0 * t) / h;
+      w[1] = 3.0 * t2 - 4.0 * t + 1.0;
+      w[2] = (6.0 * t - 6.0 * t2) / h;
+      w[3] = 3.0 * t2 - 2.0 * t;
+    }
+  else
+    {
+      const double t3 = t * t2;
+
+      w[0] = 2.0 * t3 - 3.0 * t2 + 1.0;
+      w[1] = h * (t3 - 2.0 * t2 + t);
+      w[2] = 3.0 * t2 - 2.0 * t3;
+      w[3] = h * (t3 - t2);
+    }
+}
+
+/*
+ * Evaluate f (deriv = 0) or df/dx, df/dy, df/dz (deriv = 1, 2, 3) from
+ * the values and the seven derivatives at the eight corners of the cell
+ */
+static int
+tricubic_eval_deriv(const tricubic_state_t * state, const double xarr[],
+                    const double yarr[], const double zarr[],
+                    const double farr[], double x, double y, double z,
+                    gsl_interp_accel * xa, gsl_interp_accel * ya,
+                    gsl_interp_accel * za, const int deriv, double * f)
+{
+  double wx[4], wy[4], wz[4];
+  double dx, dy, dz;
+  double sum = 0.0;
+  size_t xi, yi, zi;
+  size_t a, b, c, p, q, r;
+
+  if (xa != NULL)
+    xi = gsl_interp_accel_find(xa, xarr, state->xsize, x);
+  else
+    xi = gsl_interp_bsearch(xarr, x, 0, state->xsize - 1);
+
+  if (ya != NULL)
+    yi = gsl_interp_accel_find(ya, yarr, state->ysize, y);
+  else
+    yi = gsl_interp_bsearch(yarr, y, 0, state->ysize - 1);
+
+  if (za != NULL)
+    zi = gsl_interp_accel_find(za, zarr, state->zsize, z);
+  else
+    zi = gsl_interp_bsearch(zarr, z, 0, state->zsize - 1);
+
+  dx = xarr[xi + 1] - xarr[xi];
+  dy = yarr[yi + 1] - yarr[yi];
+  dz = zarr[zi + 1] - zarr[zi];
+
+  tricubic_basis((x - xarr[xi]) / dx, dx, deriv == 1, wx);
+  tricubic_basis((y - yarr[yi]) / dy, dy, deriv == 2, wy);
+  tricubic_basis((z - zarr[zi]) / dz, dz, deriv == 3, wz);
+
+  for (c = 0; c < 2; c++)
+    {
+      for (b = 0; b < 2; b++)
+        {
+          const size_t idx = IDX3D(xi, yi + b, zi + c, state);
+
+          for (r = 0; r < 2; r++)
+            {
+              for (q = 0; q < 2; q++)
+                {
+                  const double wyz = wy[2 * b + q] * wz[2 * c + r];
+                  double s = 0.0;
+
+                  for (p = 0; p < 2; p++)
+                    {
+                      const size_t m = p + 2 * q + 4 * r;
+                      const double * fm = (m == 0) ? farr : state->d[m];
+
+                      for (a = 0; a < 2; a++)
+                        s += wx[2 * a + p] * fm[idx + a];
+                    }
+
+                  sum += wyz * s;
+                }
+            }
+        }
+    }
+
+  *f = sum;
+
+  return GSL_SUCCESS;
+}
+
+static int
+tricubic_eval(const void * vstate, const double xarr[], const double yarr[],
+              const double zarr[], const double farr[], size_t xsize,
+              size_t ysize, size_t zsize, double x, double y, double z,
+              gsl_interp_accel * xa, gsl_interp_accel * ya,
+              gsl_interp_accel * za, double * f)
+{
+  return tricubic_eval_deriv((const tricubic_state_t *) vstate, xarr, yarr, zarr,
+                             farr, x, y, z, xa, ya, za, 0, f);
+}
+
+static int
+tricubic_deriv_x(const void * vstate, const double xarr[], const double yarr[],
+                 const double zarr[], const double farr[], size_t xsize,
+                 size_t ysize, size_t zsize, double x, double y, double z,
+                 gsl_interp_accel * xa, gsl_interp_accel * ya,
+                 gsl_interp_accel * za, double * f_p)
+{
+  return tricubic_eval_deriv((const tricubic_state_t *) vstate, xarr, yarr, zarr,
+                             farr, x, y, z, xa, ya, za, 1, f_p);
+}
+
+static int
+tricubic_deriv_y(const void * vstate, const double xarr[], const double yarr[],
+                 const double zarr[], const double farr[], size_t xsize,
+                 size_t ysize, size_t zsize, double x, double y, double z,
+                 gsl_interp_accel * xa, gsl_interp_accel * ya,
+                 gsl_interp_accel * za, double * f_p)
+{
+  return tricubic_eval_deriv((const tricubic_state_t *) vstate, xarr, yarr, zarr,
+                             farr, x, y, z, xa, ya, za, 2, f_p);
+}
+
+static int
+tricubic_deriv_z(const void * vstate, const double xarr[], const double yarr[],
+                 const double zarr[], const double farr[], size_t xsize,
+                 size_t ysize, size_t zsize, double x, double y, double z,
+                 gsl_interp_accel * xa, gsl_interp_accel * ya,
+                 gsl_interp_accel * za, double * f_p)
+{
+  return tricubic_eval_deriv((const tricubic_state_t *) vstate, xarr, yarr, zarr,
+                             farr, x, y, z, xa, ya, za, 3, f_p);
+}
+
+static const gsl_interp3d_type tricubic_type = {
+  "tricubic",
+  4,
+  &tricubic_alloc,
+  &tricubic_init,
+  &tricubic_eval,
+  &tricubic_deriv_x,
+  &tricubic_deriv_y,
+  &tricubic_deriv_z,
+  &tricubic_free
+};
+
+const gsl_interp3d_type * gsl_interp3d_tricubic = &tricubic_type;
+
+#undef IDX3D
@@ -0,0 +1,167 @@
+/* interpolation/trilinear.c
+ * 
+ * Copyright (C) 2026 Patrick Alken
+ * 
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#include <config.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_interp.h>
+#include <gsl/gsl_interp3d.h>
+
+#define IDX3D(i, j, k, xsize, ysize) ((((k) * (ysize)) + (j)) * (xsize) + (i))
+
+static int
+trilinear_init(void * state, const double xa[], const double ya[],
+               const double za[], const double fa[], size_t xsize,
+               size_t ysize, size_t zsize)
+{
+  return GSL_SUCCESS;
+}
+
+/*
+ * Linear weights of the two ends of a cell of width h at fractional
+ * position t, or their derivatives with respect to x if deriv is set
+ */
+static void
+trilinear_weights(const double t, const double h, const int deriv, double w[2])
+{
+  if (deriv)
+    {
+      w[0] = -1.0 / h;
+      w[1] = 1.0 / h;
+    }
+  else
+    {
+      w[0] = 1.0 - t;
+      w[1] = t;
+    }
+}
+
+/*
+ * Evaluate f (deriv = 0) or df/dx, df/dy, df/dz (deriv = 1, 2, 3) as a
+ * weighted sum over the eight corners of the cell containing (x,y,z)
+ */
+static int
+trilinear_eval_deriv(const double xarr[], const double yarr[],
+                     const double zarr[], const double farr[],
+                     size_t xsize, size_t ysize, size_t zsize,
+                     double x, double y, double z,
+                     gsl_interp_accel * xa, gsl_interp_accel * ya,
+                     gsl_interp_accel * za, const int deriv, double * f)
+{
+  double wx[2], wy[2], wz[2];
+  double dx, dy, dz;
+  double sum = 0.0;
+  size_t xi, yi, zi;
+  size_t b, c;
+
+  if (xa != NULL)
+    xi = gsl_interp_accel_find(xa, xarr, xsize, x);
+  else
+    xi = gsl_interp_bsearch(xarr, x, 0, xsize - 1);
+
+  if (ya != NULL)
+    yi = gsl_interp_accel_find(ya, yarr, ysize, y);
+  else
+    yi = gsl_interp_bsearch(yarr, y, 0, ysize - 1);
+
+  if (za != NULL)
+    zi = gsl_interp_accel_find(za, zarr, zsize, z);
+  else
+    zi = gsl_interp_bsearch(zarr, z, 0, zsize - 1);
+
+  dx = xarr[xi + 1] - xarr[xi];
+  dy = yarr[yi + 1] - yarr[yi];
+  dz = zarr[zi + 1] - zarr[zi];
+
+  trilinear_weights((x - xarr[xi]) / dx, dx, deriv == 1, wx);
+  trilinear_weights((y - yarr[yi]) / dy, dy, deriv == 2, wy);
+  trilinear_weights((z - zarr[zi]) / dz, dz, deriv == 3, wz);
+
+  for (c = 0; c < 2; c++)
+    {
+      for (b = 0; b < 2; b++)
+        {
+          const double * fbc = farr + IDX3D(xi, yi + b, zi + c, xsize, ysize);
+          sum += wz[c] * wy[b] * (wx[0] * fbc[0] + wx[1] * fbc[1]);
+        }
+    }
+
+  *f = sum;
+
+  return GSL_SUCCESS;
+}
+
+static int
+trilinear_eval(const void * state, const double xarr[], const double yarr[],
+               const double zarr[], const double farr[], size_t xsize,
+               size_t ysize, size_t zsize, double x, double y, double z,
+               gsl_interp_accel * xa, gsl_interp_accel * ya,
+               gsl_interp_accel * za, double * f)
+{
+  return trilinear_eval_deriv(xarr, yarr, zarr, farr, xsize, ysize, zsize,
+                              x, y, z, xa, ya, za, 0, f);
+}
+
+static int
+trilinear_deriv_x(const void * state, const double xarr[], const double yarr[],
+                  const double zarr[], const double farr[], size_t xsize,
+                  size_t ysize, size_t zsize, double x, double y, double z,
+                  gsl_interp_accel * xa, gsl_interp_accel * ya,
+                  gsl_interp_accel * za, double * f_p)
+{
+  return trilinear_eval_deriv(xarr, yarr, zarr, farr, xsize, ysize, zsize,
+                              x, y, z, xa, ya, za, 1, f_p);
+}
+
+static int
+trilinear_deriv_y(const void * state, const double xarr[], const double yarr[],
+                  const double zarr[], const double farr[], size_t xsize,
+                  size_t ysize, size_t zsize, double x, double y, double z,
+                  gsl_interp_accel * xa, gsl_interp_accel * ya,
+                  gsl_interp_accel * za, double * f_p)
+{
+  return trilinear_eval_deriv(xarr, yarr, zarr, farr, xsize, ysize, zsize,
+                              x, y, z, xa, ya, za, 2, f_p);
+}
+
+static int
+trilinear_deriv_z(const void * state, const double xarr[], const double yarr[],
+                  const double zarr[], const double farr[], size_t xsize,
+                  size_t ysize, size_t zsize, double x, double y, double z,
+                  gsl_interp_accel * xa, gsl_interp_accel * ya,
+                  gsl_interp_accel * za, double * f_p)
+{
+  return trilinear_eval_deriv(xarr, yarr, zarr, farr, xsize, ysize, zsize,
+                              x, y, z, xa, ya, za, 3, f_p);
+}
+
+static const gsl_interp3d_type trilinear_type = {
+  "trilinear",
+  2,
+  NULL,
+  &trilinear_init,
+  &trilinear_eval,
+  &trilinear_deriv_x,
+  &trilinear_deriv_y,
+  &trilinear_deriv_z,
+  NULL
+};
+
+const gsl_interp3d_type * gsl_interp3d_trilinear = &trilinear_type;
+
+#undef IDX3D
@@ -0,0 +1,150 @@
+/* monte/benchmark.c
+ *
+ * Copyright (C) 2026 Patrick Alken
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* timings of the serial and parallel MISER and VEGAS integrators for a
+ * gaussian peak in 4 dimensions with n calls, using 1, 2, 4 and 8
+ * tasks; the tasks are run by an OpenMP executor when compiled with
+ * -fopenmp, and serially otherwise; usage: benchmark [n] */
+
+#include <config.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <math.h>
+#include <gsl/gsl_rng.h>
+#include <gsl/gsl_monte_miser.h>
+#include <gsl/gsl_monte_vegas.h>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#define DIM 4
+#define MAX_TASKS 8
+
+static double
+seconds (void)
+{
+#ifdef _OPENMP
+  return omp_get_wtime ();
+#else
+  return clock () / (double) CLOCKS_PER_SEC;
+#endif
+}
+
+static double
+peak (double x[], size_t dim, void *params)
+{
+  double s = 0.0;
+  size_t i;
+
+  (void) params;
+
+  for (i = 0; i < dim; i++)
+    s += (x[i] - 0.5) * (x[i] - 0.5);
+
+  return exp (-50.0 * s);
+}
+
+static void
+run_omp (size_t ntasks, void (*task) (size_t i, void *data),
+         void *data, void *params)
+{
+  int i;
+
+  (void) params;
+
+#pragma omp parallel for schedule(dynamic)
+  for (i = 0; i < (int) ntasks; i++)
+    task (i, data);
+}
+
+int
+main (int argc, char *argv[])
+{
+  const size_t calls = (argc > 1) ? (size_t) atol (argv[1]) : 2000000;
+  double xl[DIM] = { 0.0, 0.0, 0.0, 0.0 };
+  double xu[DIM] = { 1.0, 1.0, 1.0, 1.0 };
+  gsl_monte_function F;
+  gsl_executor exec;
+  gsl_rng *r[MAX_TASKS];
+  double res, err, start;
+  size_t ntasks, i;
+
+  F.f = &peak;
+  F.dim = DIM;
+  F.params = 0;
+
+  exec.run = &run_omp;
+  exec.params = 0;
+
+  printf ("calls = %zu\n", calls);
+
+  for (i = 0; i < MAX_TASKS; i++)
+    r[i] = gsl_rng_alloc_substream (gsl_rng_philox4x64, 1, i);
+
+  {
+    gsl_monte_miser_state *s = gsl_monte_miser_alloc (DIM);
+
+    start = seconds ();
+    gsl_monte_miser_integrate (&F, xl, xu, DIM, calls, r[0], s, &res, &err);
+    printf ("%-36s %8.3f s  %.8f +/- %.2e\n", "gsl_monte_miser_integrate",
+            seconds () - start, res, err);
+
+    for (ntasks = 1; ntasks <= MAX_TASKS; ntasks *= 2)
+      {
+        start = seconds ();
+        gsl_monte_miser_integrate_parallel (&F, xl, xu, DIM, calls, r, ntasks,
+                                            &exec, s, &res, &err);
+        printf ("%-28s %2zu tasks %8.3f s  %.8f +/- %.2e\n",
+                "gsl_monte_miser_parallel", ntasks, seconds () - start,
+                res, err);
+      }
+
+    gsl_monte_miser_free (s);
+  }
+
+  {
+    gsl_monte_vegas_state *s = gsl_monte_vegas_alloc (DIM);
+
+    start = seconds ();
+    gsl_monte_vegas_integrate (&F, xl, xu, DIM, calls, r[0], s, &res, &err);
+    printf ("%-36s %8.3f s  %.8f +/- %.2e\n", "gsl_monte_vegas_integrate",
+            seconds () - start, res, err);
+
+    for (ntasks = 1; ntasks <= MAX_TASKS; ntasks *= 2)
+      {
+        gsl_monte_vegas_init (s);
+
+        start = seconds ();
+        gsl_monte_vegas_integrate_parallel (&F, xl, xu, DIM, calls, r, ntasks,
+                                            &exec, s, &res, &err);
+        printf ("%-28s %2zu tasks %8.3f s  %.8f +/- %.2e\n",
+                "gsl_monte_vegas_parallel", ntasks, seconds () - start,
+                res, err);
+      }
+
+    gsl_monte_vegas_free (s);
+  }
+
+  for (i = 0; i < MAX_TASKS; i++)
+    gsl_rng_free (r[i]);
+
+  return 0;
+}
@@ -24,6 +24,7 @@
 #define __GSL_MONTE_H__
 
 #include <stdlib.h>
+#include <gsl/gsl_executor.h>
 
 #undef __BEGIN_DECLS
 #undef __END_DECLS
@@ -51,6 +52,24 @@ typedef struct gsl_monte_function_struct gsl_monte_function;
 
 #define GSL_MONTE_FN_EVAL(F,x) (*((F)->f))(x,(F)->dim,(F)->params)
 
+/* A function evaluated at n points at once, with the coordinates of
+   point k in x[k*dim], ..., x[k*dim + dim - 1] and its value in y[k].
+*/
+
+struct gsl_monte_function_batch_struct {
+  void (*f)(size_t n, const double * x, size_t dim, double * y,
+            void * params);
+  size_t dim;
+  void * params;
+};
+
+typedef struct gsl_monte_function_batch_struct gsl_monte_function_batch;
+
+#define GSL_MONTE_FN_BATCH_EVAL(F,n,x,y) (*((F)->f))(n,x,(F)->dim,y,(F)->params)
+
+/* Number of points passed to a batch function at a time */
+
+#define GSL_MONTE_BATCH_SIZE 256
 
 __END_DECLS
 
@@ -72,6 +72,21 @@ int gsl_monte_miser_integrate(gsl_monte_function * f,
                               gsl_monte_miser_state* state,
                               double *result, double *abserr);
 
+int gsl_monte_miser_integrate_batch(const gsl_monte_function_batch * f, 
+                                    const double xl[], const double xh[], 
+                                    size_t dim, size_t calls, 
+                                    gsl_rng *r, 
+                                    gsl_monte_miser_state* state,
+                                    double *result, double *abserr);
+
+int gsl_monte_miser_integrate_parallel(gsl_monte_function * f, 
+                                       const double xl[], const double xh[], 
+                                       size_t dim, size_t calls, 
+                                       gsl_rng * r[], size_t ntasks,
+                                       const gsl_executor * exec,
+                                       gsl_monte_miser_state* state,
+                                       double *result, double *abserr);
+
 gsl_monte_miser_state* gsl_monte_miser_alloc(size_t dim);
 
 int gsl_monte_miser_init(gsl_monte_miser_state* state);
@@ -54,6 +54,15 @@ gsl_monte_plain_integrate (const gsl_monte_function * f,
                            gsl_monte_plain_state * state,
                            double *result, double *abserr);
 
+int
+gsl_monte_plain_integrate_batch (const gsl_monte_function_batch * f,
+                                 const double xl[], const double xu[],
+                                 const size_t dim,
+                                 const size_t calls, 
+                                 gsl_rng * r,
+                                 gsl_monte_plain_state * state,
+                                 double *result, double *abserr);
+
 gsl_monte_plain_state* gsl_monte_plain_alloc(size_t dim);
 
 int gsl_monte_plain_init(gsl_monte_plain_state* state);
@@ -95,6 +95,21 @@ int gsl_monte_vegas_integrate(gsl_monte_function * f,
                               gsl_monte_vegas_state *state,
                               double* result, double* abserr);
 
+int gsl_monte_vegas_integrate_batch(const gsl_monte_function_batch * f, 
+                                    double xl[], double xu[], 
+                                    size_t dim, size_t calls,
+                                    gsl_rng * r,
+                                    gsl_monte_vegas_state *state,
+                                    double* result, double* abserr);
+
+int gsl_monte_vegas_integrate_parallel(gsl_monte_function * f, 
+                                       double xl[], double xu[], 
+                                       size_t dim, size_t calls,
+                                       gsl_rng * r[], size_t ntasks,
+                                       const gsl_executor * exec,
+                                       gsl_monte_vegas_state *state,
+                                       double* result, double* abserr);
+
 gsl_monte_vegas_state* gsl_monte_vegas_alloc(size_t dim);
 
 int gsl_monte_vegas_init(gsl_monte_vegas_state* state);
@@ -24,6 +24,13 @@
    Multidimensional Monte Carlo Integration", Computers in Physics,
    v4 (1990), pp190-195.
 
+   The parallel version bisects the region serially down to a fixed
+   depth, giving at least as many subregions as tasks.  Each task then
+   integrates its share of the subregions with its own random number
+   generator and workspace, and the results are summed in the order
+   of the subregions, so that they do not depend on how the tasks are
+   scheduled.
+
 */
 
 /* Author: MJB */
@@ -39,8 +46,28 @@
 #include <gsl/gsl_monte.h>
 #include <gsl/gsl_monte_miser.h>
 
+/* The integrand, either the scalar function f or the batch function
+   fb, with space xb and yb for GSL_MONTE_BATCH_SIZE points */
+
+typedef struct
+{
+  gsl_monte_function *f;
+  const gsl_monte_function_batch *fb;
+  double *xb;
+  double *yb;
+}
+miser_integrand;
+
+static int
+miser_integrate (const miser_integrand * g,
+                 const double xl[], const double xu[],
+                 size_t dim, size_t calls,
+                 gsl_rng * r,
+                 gsl_monte_miser_state * state,
+                 double *result, double *abserr);
+
 static int
-estimate_corrmc (gsl_monte_function * f,
+estimate_corrmc (const miser_integrand * g,
                  const double xl[], const double xu[],
                  size_t dim, size_t calls,
                  gsl_rng * r,
@@ -48,6 +75,17 @@ estimate_corrmc (gsl_monte_function * f,
                  double *result, double *abserr,
                  const double xmid[], double sigma_l[], double sigma_r[]);
 
+static int check_region (const double xl[], const double xu[], size_t dim,
+                         const gsl_monte_miser_state * state);
+
+static int choose_bisection (const miser_integrand * g,
+                             const double xl[], const double xu[],
+                             size_t dim, size_t calls,
+                             gsl_rng * r,
+                             gsl_monte_miser_state * state,
+                             size_t * i_bisect,
+                             size_t * calls_l, size_t * calls_r);
+
 
 int
 gsl_monte_miser_integrate (gsl_monte_function * f,
@@ -57,45 +95,88 @@ gsl_monte_miser_integrate (gsl_monte_function * f,
                            gsl_monte_miser_state * state,
                            double *result, double *abserr)
 {
-  size_t n, estimate_calls, calls_l, calls_r;
-  const size_t min_calls = state->min_calls;
-  size_t i;
-  size_t i_bisect;
-  int found_best;
+  miser_integrand g;
 
-  double res_est = 0, err_est = 0;
-  double res_r = 0, err_r = 0, res_l = 0, err_l = 0;
-  double xbi_l, xbi_m, xbi_r, s;
+  g.f = f;
+  g.fb = 0;
+  g.xb = 0;
+  g.yb = 0;
 
-  double vol;
-  double weight_l, weight_r;
+  return miser_integrate (&g, xl, xu, dim, calls, r, state, result, abserr);
+}
 
-  double *x = state->x;
-  double *xmid = state->xmid;
-  double *sigma_l = state->sigma_l, *sigma_r = state->sigma_r;
+int
+gsl_monte_miser_integrate_batch (const gsl_monte_function_batch * f,
+                                 const double xl[], const double xu[],
+                                 size_t dim, size_t calls,
+                                 gsl_rng * r,
+                                 gsl_monte_miser_state * state,
+                                 double *result, double *abserr)
+{
+  miser_integrand g;
+  int status;
 
-  if (dim != state->dim)
+  g.f = 0;
+  g.fb = f;
+  g.xb = (double *) malloc (GSL_MONTE_BATCH_SIZE * dim * sizeof (double));
+  g.yb = (double *) malloc (GSL_MONTE_BATCH_SIZE * sizeof (double));
+
+  if (g.xb == 0 || g.yb == 0)
     {
-      GSL_ERROR ("number of dimensions must match allocated size", GSL_EINVAL);
+      free (g.xb);
+      free (g.yb);
+      GSL_ERROR ("failed to allocate space for points", GSL_ENOMEM);
     }
 
-  for (i = 0; i < dim; i++)
-    {
-      if (xu[i] <= xl[i])
-        {
-          GSL_ERROR ("xu must be greater than xl", GSL_EINVAL);
-        }
+  status = miser_integrate (&g, xl, xu, dim, calls, r, state, result, abserr);
 
-      if (xu[i] - xl[i] > GSL_DBL_MAX)
-        {
-          GSL_ERROR ("Range of integration is too large, please rescale",
-                     GSL_EINVAL);
-        }
+  free (g.xb);
+  free (g.yb);
+
+  return status;
+}
+
+/* Evaluate the integrand at the nb points x, at most one point for a
+   scalar function */
+
+static void
+eval_points (const miser_integrand * g, size_t nb, double x[], double y[])
+{
+  if (g->fb != 0)
+    {
+      GSL_MONTE_FN_BATCH_EVAL (g->fb, nb, x, y);
+    }
+  else
+    {
+      y[0] = GSL_MONTE_FN_EVAL (g->f, x);
     }
+}
 
-  if (state->alpha < 0)
+static int
+miser_integrate (const miser_integrand * g,
+                 const double xl[], const double xu[],
+                 size_t dim, size_t calls,
+                 gsl_rng * r,
+                 gsl_monte_miser_state * state,
+                 double *result, double *abserr)
+{
+  size_t n, calls_l, calls_r;
+  size_t i;
+  size_t i_bisect;
+  int status;
+
+  double res_r = 0, err_r = 0, res_l = 0, err_l = 0;
+  double xbi_m;
+
+  double vol;
+
+  double *x = state->x;
+
+  status = check_region (xl, xu, dim, state);
+
+  if (status != GSL_SUCCESS)
     {
-      GSL_ERROR ("alpha must be non-negative", GSL_EINVAL);
+      return status;
     }
 
   /* Compute volume */
@@ -109,31 +190,43 @@ gsl_monte_miser_integrate (gsl_monte_function * f,
 
   if (calls < state->min_calls_per_bisection)
     {
+      const size_t nmax = (g->fb != 0) ? GSL_MONTE_BATCH_SIZE : 1;
+      double *xp = (g->fb != 0) ? g->xb : x;
+      double y1, *yp = (g->fb != 0) ? g->yb : &y1;
       double m = 0.0, q = 0.0;
+      size_t nb, k;
 
       if (calls < 2)
         {
           GSL_ERROR ("insufficient calls for subvolume", GSL_EFAILED);
         }
 
-      for (n = 0; n < calls; n++)
+      for (n = 0; n < calls; n += nb)
         {
-          /* Choose a random point in the integration region */
+          nb = GSL_MIN (nmax, calls - n);
 
-          for (i = 0; i < dim; i++)
+          /* Choose random points in the integration region */
+
+          for (k = 0; k < nb; k++)
             {
-              x[i] = xl[i] + gsl_rng_uniform_pos (r) * (xu[i] - xl[i]);
+              for (i = 0; i < dim; i++)
+                {
+                  xp[k * dim + i] = xl[i] + gsl_rng_uniform_pos (r) * (xu[i] - xl[i]);
+                }
             }
 
-          {
-            double fval = GSL_MONTE_FN_EVAL (f, x);
+          eval_points (g, nb, xp, yp);
 
-            /* recurrence for mean and variance */
+          for (k = 0; k < nb; k++)
+            {
+              double fval = yp[k];
 
-            double d = fval - m;
-            m += d / (n + 1.0);
-            q += d * d * (n / (n + 1.0));
-          }
+              /* recurrence for mean and variance */
+
+              double d = fval - m;
+              m += d / (n + k + 1.0);
+              q += d * d * ((n + k) / (n + k + 1.0));
+            }
         }
 
       *result = vol * m;
@@ -143,6 +236,140 @@ gsl_monte_miser_integrate (gsl_monte_function * f,
       return GSL_SUCCESS;
     }
 
+  status = choose_bisection (g, xl, xu, dim, calls, r, state,
+                             &i_bisect, &calls_l, &calls_r);
+
+  if (status != GSL_SUCCESS)
+    {
+      return status;
+    }
+
+  xbi_m = state->xmid[i_bisect];
+
+  /* Compute the integral for the left hand side of the bisection */
+
+  /* Due to the recursive nature of the algorithm we must allocate
+     some new memory for each recursive call */
+
+  {
+    double *xu_tmp = (double *) malloc (dim * sizeof (double));
+
+    if (xu_tmp == 0)
+      {
+        GSL_ERROR_VAL ("out of memory for left workspace", GSL_ENOMEM, 0);
+      }
+
+    for (i = 0; i < dim; i++)
+      {
+        xu_tmp[i] = xu[i];
+      }
+
+    xu_tmp[i_bisect] = xbi_m;
+
+    status = miser_integrate (g, xl, xu_tmp,
+                                        dim, calls_l, r, state,
+                                        &res_l, &err_l);
+    free (xu_tmp);
+
+    if (status != GSL_SUCCESS)
+      {
+        return status;
+      }
+  }
+
+  /* Compute the integral for the right hand side of the bisection */
+
+  {
+    double *xl_tmp = (double *) malloc (dim * sizeof (double));
+
+    if (xl_tmp == 0)
+      {
+        GSL_ERROR_VAL ("out of memory for right workspace", GSL_ENOMEM, 0);
+      }
+
+    for (i = 0; i < dim; i++)
+      {
+        xl_tmp[i] = xl[i];
+      }
+
+    xl_tmp[i_bisect] = xbi_m;
+
+    status = miser_integrate (g, xl_tmp, xu,
+                                        dim, calls_r, r, state,
+                                        &res_r, &err_r);
+    free (xl_tmp);
+
+    if (status != GSL_SUCCESS)
+      {
+        return status;
+      }
+  }
+
+  *result = res_l + res_r;
+  *abserr = sqrt (err_l * err_l + err_r * err_r);
+
+  return GSL_SUCCESS;
+}
+
+static int
+check_region (const double xl[], const double xu[], size_t dim,
+              const gsl_monte_miser_state * state)
+{
+  size_t i;
+
+  if (dim != state->dim)
+    {
+      GSL_ERROR ("number of dimensions must match allocated size", GSL_EINVAL);
+    }
+
+  for (i = 0; i < dim; i++)
+    {
+      if (xu[i] <= xl[i])
+        {
+          GSL_ERROR ("xu must be greater than xl", GSL_EINVAL);
+        }
+
+      if (xu[i] - xl[i] > GSL_DBL_MAX)
+        {
+          GSL_ERROR ("Range of integration is too large, please rescale",
+                     GSL_EINVAL);
+        }
+    }
+
+  if (state->alpha < 0)
+    {
+      GSL_ERROR ("alpha must be non-negative", GSL_EINVAL);
+    }
+
+  return GSL_SUCCESS;
+}
+
+/* Choose the direction i_bisect in which to bisect the region, with
+   the midpoint in state->xmid, and divide the calls remaining after
+   the estimation between the two halves */
+
+static int
+choose_bisection (const miser_integrand * g,
+                  const double xl[], const double xu[],
+                  size_t dim, size_t calls,
+                  gsl_rng * r,
+                  gsl_monte_miser_state * state,
+                  size_t * i_bisect,
+                  size_t * calls_l, size_t * calls_r)
+{
+  size_t estimate_calls;
+  const size_t min_calls = state->min_calls;
+  size_t i;
+  int found_best;
+
+  double res_est = 0, err_est = 0;
+  double xbi_l, xbi_m, xbi_r, s;
+
+  double weight_l, weight_r;
+
+  double *xmid = state->xmid;
+  double *sigma_l = state->sigma_l, *sigma_r = state->sigma_r;
+
   estimate_calls = GSL_MAX (min_calls, calls * (state->estimate_frac));
 
   if (estimate_calls < 4 * dim)
@@ -164,7 +391,7 @@ gsl_monte_miser_integrate (gsl_monte_function * f,
      the variances by finding the min and max function values 
      for each half-region for each bisection. */
 
-  estimate_corrmc (f, xl, xu, dim, estimate_calls,
+  estimate_corrmc (g, xl, xu, dim, estimate_calls,
                    r, state, &res_est, &err_est, xmid, sigma_l, sigma_r);
 
   /* We have now used up some calls for the estimation */
@@ -177,7 +404,7 @@ gsl_monte_miser_integrate (gsl_monte_function * f,
     double best_var = GSL_DBL_MAX;
     double beta = 2.0 / (1.0 + state->alpha);
     found_best = 0;
-    i_bisect = 0;
+    *i_bisect = 0;
     weight_l = weight_r = 1.0;
 
     for (i = 0; i < dim; i++)
@@ -191,7 +418,7 @@ gsl_monte_miser_integrate (gsl_monte_function * f,
               {
                 found_best = 1;
                 best_var = var;
-                i_bisect = i;
+                *i_bisect = i;
                 weight_l = pow (sigma_l[i], beta);
                 weight_r = pow (sigma_r[i], beta);
 
@@ -220,12 +447,12 @@ gsl_monte_miser_integrate (gsl_monte_function * f,
     {
       /* All estimates were the same, so chose a direction at random */
 
-      i_bisect = gsl_rng_uniform_int (r, dim);
+      *i_bisect = gsl_rng_uniform_int (r, dim);
     }
 
-  xbi_l = xl[i_bisect];
-  xbi_m = xmid[i_bisect];
-  xbi_r = xu[i_bisect];
+  xbi_l = xl[*i_bisect];
+  xbi_m = xmid[*i_bisect];
+  xbi_r = xu[*i_bisect];
 
   /* Get the actual fractional sizes of the two "halves", and
      distribute the remaining calls among them */
@@ -237,77 +464,293 @@ gsl_monte_miser_integrate (gsl_monte_function * f,
     double a = fraction_l * weight_l;
     double b = fraction_r * weight_r;
 
-    calls_l = min_calls + (calls - 2 * min_calls) * a / (a + b);
-    calls_r = min_calls + (calls - 2 * min_calls) * b / (a + b);
+    *calls_l = min_calls + (calls - 2 * min_calls) * a / (a + b);
+    *calls_r = min_calls + (calls - 2 * min_calls) * b / (a + b);
   }
 
-  /* Compute the integral for the left hand side of the bisection */
+  return GSL_SUCCESS;
+}
 
-  /* Due to the recursive nature of the algorithm we must allocate
-     some new memory for each recursive call */
+/* Subregions of the parallel version */
 
-  {
-    int status;
+typedef struct
+{
+  gsl_monte_function *f;
+  size_t dim;
+  size_t nregion;
+  double *xl;                   /* lower limits, dim per region */
+  double *xu;                   /* upper limits, dim per region */
+  size_t *calls;
+  double *result;
+  double *abserr;
+  int *status;
+  gsl_rng **r;
+  gsl_monte_miser_state **state;
+  size_t ntasks;
+  size_t *first;                /* first region of each task, ntasks + 1 */
+}
+miser_regions;
 
-    double *xu_tmp = (double *) malloc (dim * sizeof (double));
+/* Bisect the region depth times, storing the subregions in order */
 
-    if (xu_tmp == 0)
-      {
-        GSL_ERROR_VAL ("out of memory for left workspace", GSL_ENOMEM, 0);
-      }
+static int
+split_region (miser_regions * p, const double xl[], const double xu[],
+              size_t calls, gsl_rng * r, gsl_monte_miser_state * state,
+              size_t depth)
+{
+  const size_t dim = p->dim;
+  size_t i, i_bisect, calls_l, calls_r;
+  double xbi_m, *xtmp;
+  int status;
 
-    for (i = 0; i < dim; i++)
-      {
-        xu_tmp[i] = xu[i];
-      }
+  if (depth == 0 || calls < state->min_calls_per_bisection)
+    {
+      const size_t k = p->nregion++;
 
-    xu_tmp[i_bisect] = xbi_m;
+      for (i = 0; i < dim; i++)
+        {
+          p->xl[k * dim + i] = xl[i];
+          p->xu[k * dim + i] = xu[i];
+        }
 
-    status = gsl_monte_miser_integrate (f, xl, xu_tmp,
-                                        dim, calls_l, r, state,
-                                        &res_l, &err_l);
-    free (xu_tmp);
+      p->calls[k] = calls;
 
-    if (status != GSL_SUCCESS)
-      {
-        return status;
-      }
+      return GSL_SUCCESS;
+    }
+
+  {
+    miser_integrand g;
+
+    g.f = p->f;
+    g.fb = 0;
+    g.xb = 0;
+    g.yb = 0;
+
+    status = choose_bisection (&g, xl, xu, dim, calls, r, state,
+                               &i_bisect, &calls_l, &calls_r);
   }
 
-  /* Compute the integral for the right hand side of the bisection */
+  if (status != GSL_SUCCESS)
+    {
+      return status;
+    }
 
-  {
-    int status;
+  xbi_m = state->xmid[i_bisect];
 
-    double *xl_tmp = (double *) malloc (dim * sizeof (double));
+  xtmp = (double *) malloc (dim * sizeof (double));
 
-    if (xl_tmp == 0)
-      {
-        GSL_ERROR_VAL ("out of memory for right workspace", GSL_ENOMEM, 0);
-      }
+  if (xtmp == 0)
+    {
+      GSL_ERROR ("out of memory for workspace", GSL_ENOMEM);
+    }
 
-    for (i = 0; i < dim; i++)
-      {
-        xl_tmp[i] = xl[i];
-      }
+  for (i = 0; i < dim; i++)
+    {
+      xtmp[i] = xu[i];
+    }
 
-    xl_tmp[i_bisect] = xbi_m;
+  xtmp[i_bisect] = xbi_m;
 
-    status = gsl_monte_miser_integrate (f, xl_tmp, xu,
-                                        dim, calls_r, r, state,
-                                        &res_r, &err_r);
-    free (xl_tmp);
+  status = split_region (p, xl, xtmp, calls_l, r, state, depth - 1);
 
-    if (status != GSL_SUCCESS)
+  if (status == GSL_SUCCESS)
+    {
+      for (i = 0; i < dim; i++)
+        {
+          xtmp[i] = xl[i];
+        }
+
+      xtmp[i_bisect] = xbi_m;
+
+      status = split_region (p, xtmp, xu, calls_r, r, state, depth - 1);
+    }
+
+  free (xtmp);
+
+  return status;
+}
+
+static void
+free_regions (miser_regions * p)
+{
+  size_t t;
+
+  if (p->state != 0)
+    {
+      for (t = 0; t < p->ntasks; t++)
+        gsl_monte_miser_free (p->state[t]);
+    }
+
+  free (p->state);
+  free (p->first);
+  free (p->status);
+  free (p->abserr);
+  free (p->result);
+  free (p->calls);
+  free (p->xu);
+  free (p->xl);
+}
+
+/* Divide the subregions, in order, into ntasks contiguous ranges with
+   about the same number of calls, giving each region to the task whose
+   share of the total contains the middle of its calls */
+
+static void
+assign_regions (miser_regions * p)
+{
+  double total = 0.0, cum = 0.0;
+  size_t t, k;
+
+  for (k = 0; k < p->nregion; k++)
+    {
+      total += p->calls[k];
+    }
+
+  p->first[0] = 0;
+
+  for (t = 1, k = 0; t < p->ntasks; t++)
+    {
+      const double target = total * t / p->ntasks;
+
+      while (k < p->nregion && cum + 0.5 * p->calls[k] < target)
+        {
+          cum += p->calls[k];
+          k++;
+        }
+
+      p->first[t] = k;
+    }
+
+  p->first[p->ntasks] = p->nregion;
+}
+
+/* Task t integrates the subregions first[t], ..., first[t+1] - 1 */
+
+static void
+miser_task (size_t t, void *data)
+{
+  miser_regions *p = (miser_regions *) data;
+  const size_t dim = p->dim;
+  size_t k;
+
+  for (k = p->first[t]; k < p->first[t + 1]; k++)
+    {
+      p->status[k] = gsl_monte_miser_integrate (p->f, p->xl + k * dim,
+                                                p->xu + k * dim, dim,
+                                                p->calls[k], p->r[t],
+                                                p->state[t], p->result + k,
+                                                p->abserr + k);
+    }
+}
+
+int
+gsl_monte_miser_integrate_parallel (gsl_monte_function * f,
+                                    const double xl[], const double xu[],
+                                    size_t dim, size_t calls,
+                                    gsl_rng * r[], size_t ntasks,
+                                    const gsl_executor * exec,
+                                    gsl_monte_miser_state * state,
+                                    double *result, double *abserr)
+{
+  miser_regions p;
+  gsl_monte_miser_params params;
+  size_t depth, nmax, t, k;
+  int status;
+
+  if (ntasks == 0)
+    {
+      GSL_ERROR ("number of tasks must be positive", GSL_EINVAL);
+    }
+
+  status = check_region (xl, xu, dim, state);
+
+  if (status != GSL_SUCCESS)
+    {
+      return status;
+    }
+
+  /* bisect until there are at least four subregions per task, so that
+     they can be shared out evenly by their numbers of calls */
+
+  for (depth = 0, nmax = 1; ntasks > 1 && nmax < 4 * ntasks; depth++)
+    {
+      nmax *= 2;
+    }
+
+  p.f = f;
+  p.dim = dim;
+  p.nregion = 0;
+  p.ntasks = ntasks;
+  p.r = r;
+  p.xl = (double *) malloc (nmax * dim * sizeof (double));
+  p.xu = (double *) malloc (nmax * dim * sizeof (double));
+  p.calls = (size_t *) malloc (nmax * sizeof (size_t));
+  p.result = (double *) malloc (nmax * sizeof (double));
+  p.abserr = (double *) malloc (nmax * sizeof (double));
+  p.status = (int *) malloc (nmax * sizeof (int));
+  p.first = (size_t *) malloc ((ntasks + 1) * sizeof (size_t));
+  p.state = (gsl_monte_miser_state **) calloc (ntasks,
+                                               sizeof (gsl_monte_miser_state *));
+
+  if (p.xl == 0 || p.xu == 0 || p.calls == 0 || p.result == 0
+      || p.abserr == 0 || p.status == 0 || p.first == 0 || p.state == 0)
+    {
+      free_regions (&p);
+      GSL_ERROR ("failed to allocate space for subregions", GSL_ENOMEM);
+    }
+
+  gsl_monte_miser_params_get (state, &params);
+
+  for (t = 0; t < ntasks; t++)
+    {
+      p.state[t] = gsl_monte_miser_alloc (dim);
+
+      if (p.state[t] == 0)
+        {
+          free_regions (&p);
+          GSL_ERROR ("failed to allocate space for task states", GSL_ENOMEM);
+        }
+
+      gsl_monte_miser_params_set (p.state[t], &params);
+    }
+
+  status = split_region (&p, xl, xu, calls, r[0], state, depth);
+
+  if (status != GSL_SUCCESS)
+    {
+      free_regions (&p);
+      return status;
+    }
+
+  assign_regions (&p);
+
+  gsl_executor_run (exec, ntasks, &miser_task, &p);
+
+  {
+    double res = 0.0, var = 0.0;
+
+    for (k = 0; k < p.nregion; k++)
       {
-        return status;
+        if (p.status[k] != GSL_SUCCESS)
+          {
+            status = p.status[k];
+            break;
+          }
+
+        res += p.result[k];
+        var += p.abserr[k] * p.abserr[k];
+      }
+
+    if (status == GSL_SUCCESS)
+      {
+        *result = res;
+        *abserr = sqrt (var);
       }
   }
 
-  *result = res_l + res_r;
-  *abserr = sqrt (err_l * err_l + err_r * err_r);
+  free_regions (&p);
 
-  return GSL_SUCCESS;
+  return status;
 }
 
 gsl_monte_miser_state *
@@ -589,7 +1032,7 @@ gsl_monte_miser_params_set (gsl_monte_miser_state * s, const gsl_monte_miser_par
 }
 
 static int
-estimate_corrmc (gsl_monte_function * f,
+estimate_corrmc (const miser_integrand * g,
                  const double xl[], const double xu[],
                  size_t dim, size_t calls,
                  gsl_rng * r,
@@ -597,9 +1040,11 @@ estimate_corrmc (gsl_monte_function * f,
                  double *result, double *abserr,
                  const double xmid[], double sigma_l[], double sigma_r[])
 {
-  size_t i, n;
+  size_t i, n, nb, k;
   
-  double *x = state->x;
+  const size_t nmax = (g->fb != 0) ? GSL_MONTE_BATCH_SIZE : 1;
+  double *xp = (g->fb != 0) ? g->xb : state->x;
+  double y1, *yp = (g->fb != 0) ? g->yb : &y1;
   double *fsum_l = state->fsum_l;
   double *fsum_r = state->fsum_r;
   double *fsum2_l = state->fsum2_l;
@@ -619,57 +1064,67 @@ estimate_corrmc (gsl_monte_function * f,
       sigma_l[i] = sigma_r[i] = -1;
     }
 
-  for (n = 0; n < calls; n++)
+  for (n = 0; n < calls; n += nb)
     {
-      double fval;
-      
-      unsigned int j = (n/2) % dim;
-      unsigned int side = (n % 2);
+      nb = GSL_MIN (nmax, calls - n);
 
-      for (i = 0; i < dim; i++)
+      for (k = 0; k < nb; k++)
         {
-          double z = gsl_rng_uniform_pos (r) ;
+          double *x = xp + k * dim;
+          unsigned int j = ((n + k)/2) % dim;
+          unsigned int side = ((n + k) % 2);
 
-          if (i != j) 
-            {
-              x[i] = xl[i] + z * (xu[i] - xl[i]);
-            }
-          else
+          for (i = 0; i < dim; i++)
             {
-              if (side == 0) 
+              double z = gsl_rng_uniform_pos (r) ;
+
+              if (i != j) 
                 {
-                  x[i] = xmid[i] + z * (xu[i] - xmid[i]);
+                  x[i] = xl[i] + z * (xu[i] - xl[i]);
                 }
               else
                 {
-                  x[i] = xl[i] + z * (xmid[i] - xl[i]);
+                  if (side == 0) 
+                    {
+                      x[i] = xmid[i] + z * (xu[i] - xmid[i]);
+                    }
+                  else
+                    {
+                      x[i] = xl[i] + z * (xmid[i] - xl[i]);
+                    }
                 }
             }
         }
 
-      fval = GSL_MONTE_FN_EVAL (f, x);
+      eval_points (g, nb, xp, yp);
 
-      /* recurrence for mean and variance */
-      {
-        double d = fval - m;
-        m += d / (n + 1.0);
-        q += d * d * (n / (n + 1.0));
-      }
-
-      /* compute the variances on each side of the bisection */
-      for (i = 0; i < dim; i++)
+      for (k = 0; k < nb; k++)
         {
-          if (x[i] <= xmid[i])
-            {
-              fsum_l[i] += fval;
-              fsum2_l[i] += fval * fval;
-              hits_l[i]++;
-            }
-          else
+          const double *x = xp + k * dim;
+          double fval = yp[k];
+
+          /* recurrence for mean and variance */
+          {
+            double d = fval - m;
+            m += d / (n + k + 1.0);
+            q += d * d * ((n + k) / (n + k + 1.0));
+          }
+
+          /* compute the variances on each side of the bisection */
+          for (i = 0; i < dim; i++)
             {
-              fsum_r[i] += fval;
-              fsum2_r[i] += fval * fval;
-              hits_r[i]++;
+              if (x[i] <= xmid[i])
+                {
+                  fsum_l[i] += fval;
+                  fsum2_l[i] += fval * fval;
+                  hits_l[i]++;
+                }
+              else
+                {
+                  fsum_r[i] += fval;
+                  fsum2_r[i] += fval * fval;
+                  hits_r[i]++;
+                }
             }
         }
     }
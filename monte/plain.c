@@ -23,10 +23,19 @@
 
 #include <config.h>
 #include <math.h>
+#include <stdlib.h>
 #include <gsl/gsl_math.h>
 #include <gsl/gsl_rng.h>
 #include <gsl/gsl_monte_plain.h>
 
+static int plain_integrate (const gsl_monte_function * f,
+                            const gsl_monte_function_batch * fb,
+                            const double xl[], const double xu[],
+                            const size_t dim, const size_t calls,
+                            gsl_rng * r, gsl_monte_plain_state * state,
+                            double *x, double *y,
+                            double *result, double *abserr);
+
 int
 gsl_monte_plain_integrate (const gsl_monte_function * f,
                            const double xl[], const double xu[],
@@ -36,9 +45,57 @@ gsl_monte_plain_integrate (const gsl_monte_function * f,
                            gsl_monte_plain_state * state,
                            double *result, double *abserr)
 {
+  double y;
+
+  return plain_integrate (f, 0, xl, xu, dim, calls, r, state,
+                          state->x, &y, result, abserr);
+}
+
+int
+gsl_monte_plain_integrate_batch (const gsl_monte_function_batch * f,
+                                 const double xl[], const double xu[],
+                                 const size_t dim,
+                                 const size_t calls,
+                                 gsl_rng * r,
+                                 gsl_monte_plain_state * state,
+                                 double *result, double *abserr)
+{
+  int status;
+  double *x = (double *) malloc (GSL_MONTE_BATCH_SIZE * dim * sizeof (double));
+  double *y = (double *) malloc (GSL_MONTE_BATCH_SIZE * sizeof (double));
+
+  if (x == 0 || y == 0)
+    {
+      free (x);
+      free (y);
+      GSL_ERROR ("failed to allocate space for points", GSL_ENOMEM);
+    }
+
+  status = plain_integrate (0, f, xl, xu, dim, calls, r, state,
+                            x, y, result, abserr);
+
+  free (x);
+  free (y);
+
+  return status;
+}
+
+/* Integrate with the scalar function f one point at a time, or with
+   the batch function fb if it is not null, using the space x and y for
+   GSL_MONTE_BATCH_SIZE points */
+
+static int
+plain_integrate (const gsl_monte_function * f,
+                 const gsl_monte_function_batch * fb,
+                 const double xl[], const double xu[],
+                 const size_t dim, const size_t calls,
+                 gsl_rng * r, gsl_monte_plain_state * state,
+                 double *x, double *y,
+                 double *result, double *abserr)
+{
+  const size_t nmax = (fb != 0) ? GSL_MONTE_BATCH_SIZE : 1;
   double vol, m = 0, q = 0;
-  double *x = state->x;
-  size_t n, i;
+  size_t n, nb, k, i;
 
   if (dim != state->dim)
     {
@@ -68,24 +125,39 @@ gsl_monte_plain_integrate (const gsl_monte_function * f,
       vol *= xu[i] - xl[i];
     }
 
-  for (n = 0; n < calls; n++)
+  for (n = 0; n < calls; n += nb)
     {
-      /* Choose a random point in the integration region */
+      nb = GSL_MIN (nmax, calls - n);
 
-      for (i = 0; i < dim; i++)
+      /* Choose random points in the integration region */
+
+      for (k = 0; k < nb; k++)
         {
-          x[i] = xl[i] + gsl_rng_uniform_pos (r) * (xu[i] - xl[i]);
+          for (i = 0; i < dim; i++)
+            {
+              x[k * dim + i] = xl[i] + gsl_rng_uniform_pos (r) * (xu[i] - xl[i]);
+            }
         }
 
-      {
-        double fval = GSL_MONTE_FN_EVAL (f, x);
+      if (fb != 0)
+        {
+          GSL_MONTE_FN_BATCH_EVAL (fb, nb, x, y);
+        }
+      else
+        {
+          y[0] = GSL_MONTE_FN_EVAL (f, x);
+        }
 
-        /* recurrence for mean and variance */
+      for (k = 0; k < nb; k++)
+        {
+          double fval = y[k];
 
-        double d = fval - m;
-        m += d / (n + 1.0);
-        q += d * d * (n / (n + 1.0));
-      }
+          /* recurrence for mean and variance */
+
+          double d = fval - m;
+          m += d / (n + k + 1.0);
+          q += d * d * ((n + k) / (n + k + 1.0));
+        }
     }
 
   *result = vol * m;
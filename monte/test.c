@@ -110,6 +110,230 @@ add (struct problem * problems, int * n,
 }
 
 #define TRIALS 10
+#define NTASKS 4
+
+gsl_rng * rp[NTASKS];
+
+/* An executor which runs the tasks in reverse order, to check that
+   the results do not depend on the order of the tasks */
+
+static void
+reverse_run (size_t ntasks, void (*task) (size_t i, void * data),
+             void * data, void * params)
+{
+  size_t i;
+
+  (void) params;
+
+  for (i = ntasks; i-- > 0;)
+    {
+      task (i, data);
+    }
+}
+
+const gsl_executor reverse_exec = { &reverse_run, 0 };
+
+static void
+alloc_streams (gsl_rng * r[], size_t n)
+{
+  size_t i;
+
+  for (i = 0; i < n; i++)
+    {
+      r[i] = gsl_rng_alloc_substream (gsl_rng_philox4x64, 1, i);
+    }
+}
+
+static void
+free_streams (gsl_rng * r[], size_t n)
+{
+  size_t i;
+
+  for (i = 0; i < n; i++)
+    {
+      gsl_rng_free (r[i]);
+    }
+}
+
+/* Batch function which evaluates the scalar function in params at
+   each point */
+
+static void
+batch (size_t n, const double * x, size_t dim, double * y, void * params)
+{
+  gsl_monte_function * f = (gsl_monte_function *) params;
+  double xk[11];
+  size_t i, k;
+
+  for (k = 0; k < n; k++)
+    {
+      for (i = 0; i < dim; i++)
+        xk[i] = x[k * dim + i];
+
+      y[k] = GSL_MONTE_FN_EVAL (f, xk);
+    }
+}
+
+/* Check that the batch integrators give the same results as the
+   scalar ones */
+
+static void
+test_batch (gsl_monte_function * f, size_t dim, size_t calls,
+            const char * desc)
+{
+  double res1, err1, res2, err2;
+  gsl_rng * r1 = gsl_rng_alloc (gsl_rng_default);
+  gsl_rng * r2 = gsl_rng_alloc (gsl_rng_default);
+  gsl_monte_function_batch fb;
+
+  f->dim = dim;
+  fb.f = &batch;
+  fb.dim = dim;
+  fb.params = f;
+
+  {
+    gsl_monte_plain_state * s = gsl_monte_plain_alloc (dim);
+
+    gsl_monte_plain_integrate (f, xl, xu, dim, calls, r1, s, &res1, &err1);
+    gsl_monte_plain_integrate_batch (&fb, xl, xu, dim, calls, r2, s,
+                                     &res2, &err2);
+
+    gsl_test (res1 != res2 || err1 != err2,
+              "plain(batch), %s, matches scalar", desc);
+
+    gsl_monte_plain_free (s);
+  }
+
+  {
+    gsl_monte_miser_state * s = gsl_monte_miser_alloc (dim);
+
+    gsl_monte_miser_integrate (f, xl, xu, dim, calls, r1, s, &res1, &err1);
+    gsl_monte_miser_integrate_batch (&fb, xl, xu, dim, calls, r2, s,
+                                     &res2, &err2);
+
+    gsl_test (res1 != res2 || err1 != err2,
+              "miser(batch), %s, matches scalar", desc);
+
+    gsl_monte_miser_free (s);
+  }
+
+  {
+    gsl_monte_vegas_state * s1 = gsl_monte_vegas_alloc (dim);
+    gsl_monte_vegas_state * s2 = gsl_monte_vegas_alloc (dim);
+
+    gsl_monte_vegas_integrate (f, xl, xu, dim, calls, r1, s1, &res1, &err1);
+    gsl_monte_vegas_integrate_batch (&fb, xl, xu, dim, calls, r2, s2,
+                                     &res2, &err2);
+
+    gsl_test (res1 != res2 || err1 != err2,
+              "vegas(batch), %s, matches scalar", desc);
+
+    s1->mode = GSL_VEGAS_MODE_STRATIFIED;
+    s2->mode = GSL_VEGAS_MODE_STRATIFIED;
+
+    gsl_monte_vegas_integrate (f, xl, xu, dim, calls, r1, s1, &res1, &err1);
+    gsl_monte_vegas_integrate_batch (&fb, xl, xu, dim, calls, r2, s2,
+                                     &res2, &err2);
+
+    gsl_test (res1 != res2 || err1 != err2,
+              "vegas(batch), %s, stratified, matches scalar", desc);
+
+    gsl_monte_vegas_free (s1);
+    gsl_monte_vegas_free (s2);
+  }
+
+  gsl_rng_free (r1);
+  gsl_rng_free (r2);
+}
+
+/* Check that the parallel integrators give the same results as the
+   serial ones for a single task, and the same results in any order
+   of the tasks */
+
+static void
+test_parallel (gsl_monte_function * f, size_t dim, size_t calls,
+               const char * desc)
+{
+  double res1, err1, res2, err2;
+  gsl_rng * r1[NTASKS], * r2[NTASKS];
+
+  {
+    gsl_monte_vegas_state * s1 = gsl_monte_vegas_alloc (dim);
+    gsl_monte_vegas_state * s2 = gsl_monte_vegas_alloc (dim);
+
+    f->dim = dim;
+
+    alloc_streams (r1, 1);
+    alloc_streams (r2, 1);
+
+    gsl_monte_vegas_integrate (f, xl, xu, dim, calls, r1[0], s1,
+                               &res1, &err1);
+    gsl_monte_vegas_integrate_parallel (f, xl, xu, dim, calls, r2, 1, 0, s2,
+                                        &res2, &err2);
+
+    gsl_test (res1 != res2 || err1 != err2,
+              "vegas(parallel), %s, one task matches serial", desc);
+
+    free_streams (r1, 1);
+    free_streams (r2, 1);
+
+    gsl_monte_vegas_init (s1);
+    gsl_monte_vegas_init (s2);
+
+    alloc_streams (r1, NTASKS);
+    alloc_streams (r2, NTASKS);
+
+    gsl_monte_vegas_integrate_parallel (f, xl, xu, dim, calls, r1, NTASKS,
+                                        0, s1, &res1, &err1);
+    gsl_monte_vegas_integrate_parallel (f, xl, xu, dim, calls, r2, NTASKS,
+                                        &reverse_exec, s2, &res2, &err2);
+
+    gsl_test (res1 != res2 || err1 != err2,
+              "vegas(parallel), %s, reproducible in reverse order", desc);
+
+    free_streams (r1, NTASKS);
+    free_streams (r2, NTASKS);
+
+    gsl_monte_vegas_free (s1);
+    gsl_monte_vegas_free (s2);
+  }
+
+  {
+    gsl_monte_miser_state * s1 = gsl_monte_miser_alloc (dim);
+    gsl_monte_miser_state * s2 = gsl_monte_miser_alloc (dim);
+
+    alloc_streams (r1, 1);
+    alloc_streams (r2, 1);
+
+    gsl_monte_miser_integrate (f, xl, xu, dim, calls, r1[0], s1,
+                               &res1, &err1);
+    gsl_monte_miser_integrate_parallel (f, xl, xu, dim, calls, r2, 1, 0, s2,
+                                        &res2, &err2);
+
+    gsl_test (res1 != res2 || err1 != err2,
+              "miser(parallel), %s, one task matches serial", desc);
+
+    free_streams (r1, 1);
+    free_streams (r2, 1);
+
+    alloc_streams (r1, NTASKS);
+    alloc_streams (r2, NTASKS);
+
+    gsl_monte_miser_integrate_parallel (f, xl, xu, dim, calls, r1, NTASKS,
+                                        0, s1, &res1, &err1);
+    gsl_monte_miser_integrate_parallel (f, xl, xu, dim, calls, r2, NTASKS,
+                                        &reverse_exec, s2, &res2, &err2);
+
+    gsl_test (res1 != res2 || err1 != err2,
+              "miser(parallel), %s, reproducible in reverse order", desc);
+
+    free_streams (r1, NTASKS);
+    free_streams (r2, NTASKS);
+
+    gsl_monte_miser_free (s1);
+    gsl_monte_miser_free (s2);
+  }
+}
 
 int
 main (void)
@@ -234,6 +458,8 @@ main (void)
   gsl_ieee_env_setup ();
   gsl_rng_env_setup ();
 
+  alloc_streams (rp, NTASKS);
+
 #ifdef A
   printf ("testing allocation/input checks\n");
 
@@ -381,7 +607,59 @@ main (void)
 #undef MONTE_SPEEDUP
 #endif
 
-      
+
+#ifdef MISER
+#define NAME "miser(parallel)"
+#define MONTE_STATE gsl_monte_miser_state
+#define MONTE_ALLOC gsl_monte_miser_alloc
+#define MONTE_INTEGRATE(f,xl,xu,dim,calls,r,s,res,err) { gsl_monte_miser_integrate_parallel(f,xl,xu,dim,calls,rp,NTASKS,&reverse_exec,s,res,err); }
+#define MONTE_FREE gsl_monte_miser_free
+#define MONTE_SPEEDUP 2
+#define MONTE_ERROR_TEST(err,expected) gsl_test(err > 5.0 * expected, NAME ", %s, abserr[%d] (obs %g vs plain %g)", I->description, i, err, expected)
+#include "test_main.c"
+#undef NAME
+#undef MONTE_STATE
+#undef MONTE_ALLOC
+#undef MONTE_INTEGRATE
+#undef MONTE_FREE
+#undef MONTE_ERROR_TEST
+#undef MONTE_SPEEDUP
+#endif
+
+  /* start each parallel ensemble from the same streams, so that it does
+     not depend on the number of draws made by the previous one */
+
+  free_streams (rp, NTASKS);
+  alloc_streams (rp, NTASKS);
+
+#ifdef VEGAS
+#define NAME "vegas(parallel)"
+#define MONTE_STATE gsl_monte_vegas_state
+#define MONTE_ALLOC gsl_monte_vegas_alloc
+#define MONTE_INTEGRATE(f,xl,xu,dim,calls,r,s,res,err) { gsl_monte_vegas_integrate_parallel(f,xl,xu,dim,calls,rp,NTASKS,&reverse_exec,s,res,err) ;  }
+#define MONTE_FREE gsl_monte_vegas_free
+#define MONTE_SPEEDUP 3
+#define MONTE_ERROR_TEST(err,expected) gsl_test(err > 3.0 * (expected == 0 ? 1.0/(I->calls/MONTE_SPEEDUP) : expected), NAME ", %s, abserr[%d] (obs %g vs exp %g)", I->description, i, err, expected) ; gsl_test(gsl_monte_vegas_chisq(s) < 0, NAME " returns valid chisq (%g)", gsl_monte_vegas_chisq(s))
+#include "test_main.c"
+#undef NAME
+#undef MONTE_STATE
+#undef MONTE_ALLOC
+#undef MONTE_INTEGRATE
+#undef MONTE_FREE
+#undef MONTE_ERROR_TEST
+#undef MONTE_SPEEDUP
+#endif
+
+  test_parallel (&F1, 1, 200, "gaussian, 1d");
+  test_parallel (&F0, 3, 50000, "product, 3d");
+  test_parallel (&F2, 2, 100000, "double gaussian, 2d");
+
+  test_batch (&F1, 1, 1000, "gaussian, 1d");
+  test_batch (&F0, 3, 50001, "product, 3d");
+  test_batch (&F2, 2, 99999, "double gaussian, 2d");
+
+  free_streams (rp, NTASKS);
+
   exit (gsl_test_summary ());
 }
 
@@ -49,6 +49,13 @@
    alpha = 0 means never change the grid.  Alpha is typically set between
    1 and 2.
 
+   The parallel version divides the boxes of each iteration into
+   contiguous ranges, one for each task, or when there are fewer boxes
+   than tasks divides the calls in each box.  Each task uses its own
+   random number generator and accumulates its own distribution d[],
+   and the results of the tasks are combined in order, so that they do
+   not depend on how the tasks are scheduled.
+
    */
 
 /* configuration headers */
@@ -81,10 +88,11 @@ typedef int coord;
 static void init_grid (gsl_monte_vegas_state * s, double xl[], double xu[],
                 size_t dim);
 static void reset_grid_values (gsl_monte_vegas_state * s);
-static void init_box_coord (gsl_monte_vegas_state * s, coord box[]);
+static void set_box_coord (gsl_monte_vegas_state * s, coord box[],
+                           size_t index);
 static int change_box_coord (gsl_monte_vegas_state * s, coord box[]);
-static void accumulate_distribution (gsl_monte_vegas_state * s, coord bin[],
-                                     double y);
+static void accumulate_distribution (gsl_monte_vegas_state * s, double d[],
+                                     const coord bin[], double y);
 static void random_point (double x[], coord bin[], double *bin_vol,
                           const coord box[], 
                           const double xl[], const double xu[],
@@ -105,6 +113,60 @@ static void print_res (gsl_monte_vegas_state * state,
 static void print_dist (gsl_monte_vegas_state * state, unsigned long dim);
 static void print_grid (gsl_monte_vegas_state * state, unsigned long dim);
 
+/* Workspace for sampling a range of boxes */
+
+typedef struct
+{
+  size_t nmax;                  /* number of points evaluated at a time */
+  double *x;                    /* coordinates of nmax points */
+  coord *bin;                   /* bins of nmax points */
+  double *vol;                  /* bin volumes of nmax points */
+  double *y;                    /* function values of nmax points */
+  coord *box;
+  double *d;                    /* distribution */
+  double intgrl;                /* integral over complete boxes */
+  double tss;                   /* sum of squares over complete boxes */
+  double *stats;                /* calls, mean, sum of squares of partial boxes */
+  coord *lastbin;               /* bins of the last point of partial boxes */
+}
+vegas_work;
+
+/* Data for the tasks of one iteration of the parallel version */
+
+typedef struct
+{
+  gsl_monte_function *f;
+  const double *xl;
+  const double *xu;
+  gsl_monte_vegas_state *state;
+  gsl_rng **r;
+  size_t ntasks;
+  size_t tot_boxes;
+  vegas_work *work;
+}
+vegas_tasks;
+
+static void sample_boxes (gsl_monte_function * f,
+                          const gsl_monte_function_batch * fb,
+                          const double xl[], const double xu[],
+                          gsl_monte_vegas_state * s, gsl_rng * r,
+                          vegas_work * w, size_t first, size_t nbox,
+                          size_t k0, size_t k1);
+static vegas_work *alloc_work (const gsl_monte_vegas_state * s,
+                               size_t ntasks, size_t tot_boxes);
+static void free_work (vegas_work * work, size_t ntasks);
+static void vegas_task (size_t t, void *data);
+static void merge_tasks (vegas_tasks * p, double *intgrl, double *tss);
+
+static int vegas_integrate (gsl_monte_function * f,
+                            const gsl_monte_function_batch * fb,
+                            double xl[], double xu[],
+                            size_t dim, size_t calls,
+                            gsl_rng * r[], size_t ntasks,
+                            const gsl_executor * exec, int parallel,
+                            gsl_monte_vegas_state * state,
+                            double *result, double *abserr);
+
 int
 gsl_monte_vegas_integrate (gsl_monte_function * f,
                            double xl[], double xu[],
@@ -112,9 +174,56 @@ gsl_monte_vegas_integrate (gsl_monte_function * f,
                            gsl_rng * r,
                            gsl_monte_vegas_state * state,
                            double *result, double *abserr)
+{
+  return vegas_integrate (f, 0, xl, xu, dim, calls, &r, 1, 0, 0,
+                          state, result, abserr);
+}
+
+int
+gsl_monte_vegas_integrate_batch (const gsl_monte_function_batch * f,
+                                 double xl[], double xu[],
+                                 size_t dim, size_t calls,
+                                 gsl_rng * r,
+                                 gsl_monte_vegas_state * state,
+                                 double *result, double *abserr)
+{
+  return vegas_integrate (0, f, xl, xu, dim, calls, &r, 1, 0, 0,
+                          state, result, abserr);
+}
+
+int
+gsl_monte_vegas_integrate_parallel (gsl_monte_function * f,
+                                    double xl[], double xu[],
+                                    size_t dim, size_t calls,
+                                    gsl_rng * r[], size_t ntasks,
+                                    const gsl_executor * exec,
+                                    gsl_monte_vegas_state * state,
+                                    double *result, double *abserr)
+{
+  if (ntasks == 0)
+    {
+      GSL_ERROR ("number of tasks must be positive", GSL_EINVAL);
+    }
+
+  return vegas_integrate (f, 0, xl, xu, dim, calls, r, ntasks, exec, 1,
+                          state, result, abserr);
+}
+
+static int
+vegas_integrate (gsl_monte_function * f,
+                 const gsl_monte_function_batch * fb,
+                 double xl[], double xu[],
+                 size_t dim, size_t calls,
+                 gsl_rng * r[], size_t ntasks,
+                 const gsl_executor * exec, int parallel,
+                 gsl_monte_vegas_state * state,
+                 double *result, double *abserr)
 {
   double cum_int, cum_sig;
-  size_t i, k, it;
+  size_t i, it, tot_boxes;
+  vegas_tasks tasks;
+  vegas_work serial;
+  double y1, vol1;
 
   if (dim != state->dim)
     {
@@ -213,6 +322,51 @@ gsl_monte_vegas_integrate (gsl_monte_function * f,
 
   state->it_start = state->it_num;
 
+  tot_boxes = (size_t) gsl_pow_int ((double) state->boxes, dim);
+
+  if (parallel)
+    {
+      tasks.f = f;
+      tasks.xl = xl;
+      tasks.xu = xu;
+      tasks.state = state;
+      tasks.r = r;
+      tasks.ntasks = ntasks;
+      tasks.tot_boxes = tot_boxes;
+      tasks.work = alloc_work (state, ntasks, tot_boxes);
+
+      if (tasks.work == 0)
+        {
+          GSL_ERROR ("failed to allocate space for tasks", GSL_ENOMEM);
+        }
+    }
+  else if (fb != 0)
+    {
+      serial.nmax = GSL_MONTE_BATCH_SIZE;
+      serial.x = (double *) malloc (serial.nmax * dim * sizeof (double));
+      serial.bin = (coord *) malloc (serial.nmax * dim * sizeof (coord));
+      serial.vol = (double *) malloc (serial.nmax * sizeof (double));
+      serial.y = (double *) malloc (serial.nmax * sizeof (double));
+
+      if (serial.x == 0 || serial.bin == 0 || serial.vol == 0
+          || serial.y == 0)
+        {
+          free (serial.x);
+          free (serial.bin);
+          free (serial.vol);
+          free (serial.y);
+          GSL_ERROR ("failed to allocate space for points", GSL_ENOMEM);
+        }
+    }
+  else
+    {
+      serial.nmax = 1;
+      serial.x = state->x;
+      serial.bin = state->bin;
+      serial.vol = &vol1;
+      serial.y = &y1;
+    }
+
   cum_int = 0.0;
   cum_sig = 0.0;
 
@@ -222,56 +376,31 @@ gsl_monte_vegas_integrate (gsl_monte_function * f,
       double tss = 0.0;
       double wgt, var, sig;
       size_t calls_per_box = state->calls_per_box;
-      double jacbin = state->jac;
-      double *x = state->x;
-      coord *bin = state->bin;
 
       state->it_num = state->it_start + it;
 
-      reset_grid_values (state);
-      init_box_coord (state, state->box);
-      
-      do
+      if (!parallel)
         {
-          volatile double m = 0, q = 0;
-          double f_sq_sum = 0.0;
-
-          for (k = 0; k < calls_per_box; k++)
-            {
-              volatile double fval;
-              double bin_vol;
-
-              random_point (x, bin, &bin_vol, state->box, xl, xu, state, r);
-
-              fval = jacbin * bin_vol * GSL_MONTE_FN_EVAL (f, x);
-
-              /* recurrence for mean and variance (sum of squares) */
-
-              {
-                double d = fval - m;
-                m += d / (k + 1.0);
-                q += d * d * (k / (k + 1.0));
-              }
-
-              if (state->mode != GSL_VEGAS_MODE_STRATIFIED)
-                {
-                  double f_sq = fval * fval;
-                  accumulate_distribution (state, bin, f_sq);
-                }
-            }
-
-          intgrl += m * calls_per_box;
-
-          f_sq_sum = q * calls_per_box;
-
-          tss += f_sq_sum;
+          serial.box = state->box;
+          serial.d = state->d;
+          serial.intgrl = 0.0;
+          serial.tss = 0.0;
+          serial.stats = 0;
+          serial.lastbin = 0;
+
+          reset_grid_values (state);
+          sample_boxes (f, fb, xl, xu, state, r[0], &serial, 0, tot_boxes,
+                        0, calls_per_box);
+
+          intgrl = serial.intgrl;
+          tss = serial.tss;
+        }
+      else
+        {
+          gsl_executor_run (exec, ntasks, &vegas_task, &tasks);
 
-          if (state->mode == GSL_VEGAS_MODE_STRATIFIED)
-            {
-              accumulate_distribution (state, bin, f_sq_sum);
-            }
+          merge_tasks (&tasks, &intgrl, &tss);
         }
-      while (change_box_coord (state, state->box));
 
       /* Compute final results for this iteration   */
 
@@ -365,6 +494,18 @@ gsl_monte_vegas_integrate (gsl_monte_function * f,
 
     }
 
+  if (parallel)
+    {
+      free_work (tasks.work, ntasks);
+    }
+  else if (fb != 0)
+    {
+      free (serial.x);
+      free (serial.bin);
+      free (serial.vol);
+      free (serial.y);
+    }
+
   /* By setting stage to 1 further calls will generate independent
      estimates based on the same grid, although it may be rebinned. */
 
@@ -556,16 +697,19 @@ gsl_monte_vegas_params_set (gsl_monte_vegas_state * s, const gsl_monte_vegas_par
   s->ostream = p->ostream;
 }
 
+/* set_box_coord sets the coordinates of the box with the given index
+   in the order of change_box_coord */
 static void
-init_box_coord (gsl_monte_vegas_state * s, coord box[])
+set_box_coord (gsl_monte_vegas_state * s, coord box[], size_t index)
 {
   size_t i;
 
   size_t dim = s->dim;
 
-  for (i = 0; i < dim; i++)
+  for (i = dim; i-- > 0;)
     {
-      box[i] = 0;
+      box[i] = index % s->boxes;
+      index /= s->boxes;
     }
 }
 
@@ -635,7 +779,8 @@ reset_grid_values (gsl_monte_vegas_state * s)
 }
 
 static void
-accumulate_distribution (gsl_monte_vegas_state * s, coord bin[], double y)
+accumulate_distribution (gsl_monte_vegas_state * s, double d[],
+                         const coord bin[], double y)
 {
   size_t j;
   size_t dim = s->dim;
@@ -643,7 +788,308 @@ accumulate_distribution (gsl_monte_vegas_state * s, coord bin[], double y)
   for (j = 0; j < dim; j++)
     {
       int i = bin[j];
-      VALUE (s, i, j) += y;
+      d[i * dim + j] += y;
+    }
+}
+
+/* Sample the calls k0, ..., k1-1 in each of the nbox boxes starting
+   from the box with index first, using the generator r.  The points
+   are evaluated w->nmax at a time with the batch function fb, or one
+   at a time with the scalar function f if fb is null.  For complete
+   boxes the integral and sum of squares are added to w->intgrl and
+   w->tss.  For partial boxes the number of calls, mean and sum of
+   squares are stored in w->stats, and the bins of the last point in
+   w->lastbin.  The distribution is accumulated in w->d. */
+
+static void
+sample_boxes (gsl_monte_function * f, const gsl_monte_function_batch * fb,
+              const double xl[], const double xu[],
+              gsl_monte_vegas_state * s, gsl_rng * r, vegas_work * w,
+              size_t first, size_t nbox, size_t k0, size_t k1)
+{
+  const size_t calls_per_box = s->calls_per_box;
+  const double jacbin = s->jac;
+  const size_t dim = s->dim;
+  const size_t ncalls = nbox * (k1 - k0);
+  size_t b = first, k = k0, kgen = k0;
+  size_t n, nb, l, j;
+  volatile double m = 0, q = 0;
+
+  if (w->stats != 0)
+    {
+      for (l = 0; l < nbox; l++)
+        {
+          w->stats[3 * (first + l)] = 0.0;
+        }
+    }
+
+  set_box_coord (s, w->box, first);
+
+  for (n = 0; n < ncalls; n += nb)
+    {
+      nb = GSL_MIN (w->nmax, ncalls - n);
+
+      /* choose the points, moving to the next box after k1 calls */
+
+      for (l = 0; l < nb; l++)
+        {
+          random_point (w->x + l * dim, w->bin + l * dim, w->vol + l,
+                        w->box, xl, xu, s, r);
+
+          if (++kgen == k1)
+            {
+              kgen = k0;
+              change_box_coord (s, w->box);
+            }
+        }
+
+      if (fb != 0)
+        {
+          GSL_MONTE_FN_BATCH_EVAL (fb, nb, w->x, w->y);
+        }
+      else
+        {
+          w->y[0] = GSL_MONTE_FN_EVAL (f, w->x);
+        }
+
+      for (l = 0; l < nb; l++)
+        {
+          const coord *bin = w->bin + l * dim;
+          volatile double fval = jacbin * w->vol[l] * w->y[l];
+
+          /* recurrence for mean and variance (sum of squares) */
+
+          {
+            double d = fval - m;
+            m += d / (k - k0 + 1.0);
+            q += d * d * ((k - k0) / (k - k0 + 1.0));
+          }
+
+          if (s->mode != GSL_VEGAS_MODE_STRATIFIED)
+            {
+              double f_sq = fval * fval;
+              accumulate_distribution (s, w->d, bin, f_sq);
+            }
+
+          if (++k < k1)
+            {
+              continue;
+            }
+
+          /* the box is complete */
+
+          if (w->stats == 0)
+            {
+              double f_sq_sum = q * calls_per_box;
+
+              w->intgrl += m * calls_per_box;
+              w->tss += f_sq_sum;
+
+              if (s->mode == GSL_VEGAS_MODE_STRATIFIED)
+                {
+                  accumulate_distribution (s, w->d, bin, f_sq_sum);
+                }
+            }
+          else
+            {
+              double *st = w->stats + 3 * b;
+
+              st[0] = k1 - k0;
+              st[1] = m;
+              st[2] = q;
+
+              for (j = 0; j < dim; j++)
+                {
+                  w->lastbin[b * dim + j] = bin[j];
+                }
+            }
+
+          m = 0;
+          q = 0;
+          k = k0;
+          b++;
+        }
+    }
+}
+
+static vegas_work *
+alloc_work (const gsl_monte_vegas_state * s, size_t ntasks, size_t tot_boxes)
+{
+  const size_t dim = s->dim;
+  vegas_work *work = (vegas_work *) calloc (ntasks, sizeof (vegas_work));
+  size_t t;
+
+  if (work == 0)
+    {
+      return 0;
+    }
+
+  for (t = 0; t < ntasks; t++)
+    {
+      vegas_work *w = work + t;
+
+      w->nmax = 1;
+      w->x = (double *) malloc (dim * sizeof (double));
+      w->bin = (coord *) malloc (dim * sizeof (coord));
+      w->vol = (double *) malloc (sizeof (double));
+      w->y = (double *) malloc (sizeof (double));
+      w->box = (coord *) malloc (dim * sizeof (coord));
+      w->d = (double *) malloc (s->bins_max * dim * sizeof (double));
+
+      if (w->x == 0 || w->bin == 0 || w->vol == 0 || w->y == 0
+          || w->box == 0 || w->d == 0)
+        {
+          free_work (work, ntasks);
+          return 0;
+        }
+
+      if (tot_boxes < ntasks)
+        {
+          w->stats = (double *) malloc (3 * tot_boxes * sizeof (double));
+          w->lastbin = (coord *) malloc (tot_boxes * dim * sizeof (coord));
+
+          if (w->stats == 0 || w->lastbin == 0)
+            {
+              free_work (work, ntasks);
+              return 0;
+            }
+        }
+    }
+
+  return work;
+}
+
+static void
+free_work (vegas_work * work, size_t ntasks)
+{
+  size_t t;
+
+  for (t = 0; t < ntasks; t++)
+    {
+      free (work[t].x);
+      free (work[t].bin);
+      free (work[t].vol);
+      free (work[t].y);
+      free (work[t].box);
+      free (work[t].d);
+      free (work[t].stats);
+      free (work[t].lastbin);
+    }
+
+  free (work);
+}
+
+/* Task t samples a contiguous range of boxes, or when there are fewer
+   boxes than tasks a contiguous range of the calls in every box */
+
+static void
+vegas_task (size_t t, void *data)
+{
+  vegas_tasks *p = (vegas_tasks *) data;
+  gsl_monte_vegas_state *s = p->state;
+  vegas_work *w = p->work + t;
+  const size_t ntasks = p->ntasks;
+  const size_t tot_boxes = p->tot_boxes;
+  const size_t calls_per_box = s->calls_per_box;
+  const size_t n = s->bins * s->dim;
+  size_t i;
+
+  for (i = 0; i < n; i++)
+    {
+      w->d[i] = 0.0;
+    }
+
+  w->intgrl = 0.0;
+  w->tss = 0.0;
+
+  if (tot_boxes >= ntasks)
+    {
+      const size_t b0 = gsl_executor_block (tot_boxes, ntasks, t);
+      const size_t b1 = gsl_executor_block (tot_boxes, ntasks, t + 1);
+
+      sample_boxes (p->f, 0, p->xl, p->xu, s, p->r[t], w, b0, b1 - b0,
+                    0, calls_per_box);
+    }
+  else
+    {
+      const size_t k0 = gsl_executor_block (calls_per_box, ntasks, t);
+      const size_t k1 = gsl_executor_block (calls_per_box, ntasks, t + 1);
+
+      sample_boxes (p->f, 0, p->xl, p->xu, s, p->r[t], w, 0, tot_boxes,
+                    k0, k1);
+    }
+}
+
+/* Combine the results of the tasks in order */
+
+static void
+merge_tasks (vegas_tasks * p, double *intgrl, double *tss)
+{
+  gsl_monte_vegas_state *s = p->state;
+  const size_t dim = s->dim;
+  const size_t ntasks = p->ntasks;
+  const size_t calls_per_box = s->calls_per_box;
+  const size_t n = s->bins * dim;
+  size_t t, b, i;
+
+  reset_grid_values (s);
+
+  for (t = 0; t < ntasks; t++)
+    {
+      for (i = 0; i < n; i++)
+        {
+          s->d[i] += p->work[t].d[i];
+        }
+    }
+
+  *intgrl = 0.0;
+  *tss = 0.0;
+
+  if (p->tot_boxes >= ntasks)
+    {
+      for (t = 0; t < ntasks; t++)
+        {
+          *intgrl += p->work[t].intgrl;
+          *tss += p->work[t].tss;
+        }
+
+      return;
+    }
+
+  for (b = 0; b < p->tot_boxes; b++)
+    {
+      /* combine the means and sums of squares of the parts of the box
+         using the pairwise formulas of Chan, Golub and LeVeque */
+
+      double nc = 0.0, m = 0.0, q = 0.0, f_sq_sum;
+      const coord *lastbin = 0;
+
+      for (t = 0; t < ntasks; t++)
+        {
+          const double *st = p->work[t].stats + 3 * b;
+          const double nb = st[0];
+
+          if (nb > 0)
+            {
+              const double nt = nc + nb;
+              const double delta = st[1] - m;
+
+              m += delta * nb / nt;
+              q += st[2] + delta * delta * nc * nb / nt;
+              nc = nt;
+              lastbin = p->work[t].lastbin + b * dim;
+            }
+        }
+
+      f_sq_sum = q * calls_per_box;
+
+      *intgrl += m * calls_per_box;
+      *tss += f_sq_sum;
+
+      if (s->mode == GSL_VEGAS_MODE_STRATIFIED)
+        {
+          accumulate_distribution (s, s->d, lastbin, f_sq_sum);
+        }
     }
 }
 
@@ -0,0 +1,151 @@
+/* ntuple/benchmark.c
+ *
+ * Copyright (C) 2026 Patrick Alken
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* timings of projecting 3 values of an ntuple of 4 doubles per row:
+ * three gsl_ntuple_project calls, one gsl_ntuple_project_n call, and
+ * gsl_ntuple_col_project with and without a cut selecting the last 10%
+ * of the rows; usage: benchmark [n] */
+
+#include <config.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_ntuple.h>
+#include <gsl/gsl_rng.h>
+
+struct data
+{
+  double t;
+  double x[3];
+};
+
+static double
+seconds (clock_t start)
+{
+  return (clock () - start) / (double) CLOCKS_PER_SEC;
+}
+
+static int
+sel_func (void *ntuple_data, void *params)
+{
+  (void) ntuple_data;
+  (void) params;
+  return 1;
+}
+
+static double
+val_func (void *ntuple_data, void *params)
+{
+  return ((struct data *) ntuple_data)->x[*(int *) params];
+}
+
+int
+main (int argc, char *argv[])
+{
+  const size_t n = (argc > 1) ? (size_t) atol (argv[1]) : 10000000;
+  gsl_rng *r = gsl_rng_alloc (gsl_rng_default);
+  int k[3] = { 0, 1, 2 };
+  const size_t col[3] = { 1, 2, 3 };
+  gsl_ntuple_value_fn V[3], *Vp[3];
+  gsl_ntuple_select_fn S;
+  gsl_histogram *h[3];
+  gsl_ntuple_col_cut cut;
+  struct data row;
+  double crow[4];
+  gsl_ntuple *nt;
+  gsl_ntuple_col *ntc;
+  clock_t start;
+  size_t i, j, nskip;
+
+  S.function = &sel_func;
+  S.params = 0;
+
+  for (j = 0; j < 3; ++j)
+    {
+      V[j].function = &val_func;
+      V[j].params = &k[j];
+      Vp[j] = &V[j];
+      h[j] = gsl_histogram_calloc_uniform (100, 0.0, 1.0);
+    }
+
+  nt = gsl_ntuple_create ("bench.dat", &row, sizeof (row));
+  ntc = gsl_ntuple_col_create ("bench_col.dat", 4, 4096);
+
+  for (i = 0; i < n; ++i)
+    {
+      row.t = (double) i / (double) n;
+      for (j = 0; j < 3; ++j)
+        row.x[j] = gsl_rng_uniform (r);
+
+      crow[0] = row.t;
+      for (j = 0; j < 3; ++j)
+        crow[j + 1] = row.x[j];
+
+      gsl_ntuple_write (nt);
+      gsl_ntuple_col_write (ntc, crow);
+    }
+
+  gsl_ntuple_close (nt);
+  gsl_ntuple_col_close (ntc);
+
+  printf ("n = %zu rows\n", n);
+
+  start = clock ();
+  for (j = 0; j < 3; ++j)
+    {
+      nt = gsl_ntuple_open ("bench.dat", &row, sizeof (row));
+      gsl_ntuple_project (h[j], nt, &V[j], &S);
+      gsl_ntuple_close (nt);
+    }
+  printf ("%-40s %8.3f s\n", "3 x gsl_ntuple_project", seconds (start));
+
+  start = clock ();
+  nt = gsl_ntuple_open ("bench.dat", &row, sizeof (row));
+  gsl_ntuple_project_n (3, h, nt, Vp, &S);
+  gsl_ntuple_close (nt);
+  printf ("%-40s %8.3f s\n", "gsl_ntuple_project_n", seconds (start));
+
+  start = clock ();
+  ntc = gsl_ntuple_col_open ("bench_col.dat");
+  gsl_ntuple_col_project (3, h, col, ntc, 0, &cut, &nskip);
+  gsl_ntuple_col_close (ntc);
+  printf ("%-40s %8.3f s\n", "gsl_ntuple_col_project", seconds (start));
+
+  cut.col = 0;
+  cut.lower = 0.9;
+  cut.upper = GSL_POSINF;
+
+  start = clock ();
+  ntc = gsl_ntuple_col_open ("bench_col.dat");
+  gsl_ntuple_col_project (3, h, col, ntc, 1, &cut, &nskip);
+  gsl_ntuple_col_close (ntc);
+  printf ("%-40s %8.3f s (%zu blocks skipped)\n", "gsl_ntuple_col_project, t >= 0.9",
+          seconds (start), nskip);
+
+  remove ("bench.dat");
+  remove ("bench_col.dat");
+
+  for (j = 0; j < 3; ++j)
+    gsl_histogram_free (h[j]);
+
+  gsl_rng_free (r);
+
+  return 0;
+}
@@ -0,0 +1,784 @@
+/* ntuple/column.c
+ *
+ * Copyright (C) 2026 Patrick Alken
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/*
+ * Columnar ntuples. The file starts with a header
+ *
+ *   char magic[8]; size_t ncol; size_t block_size;
+ *
+ * followed by blocks of at most block_size rows, each stored as
+ *
+ *   size_t nrow; double zmin[ncol]; double zmax[ncol];
+ *   double column_0[nrow]; ... double column_{ncol-1}[nrow];
+ *
+ * in the native binary format of the machine. zmin and zmax are the
+ * ranges of the columns in the block (ignoring NaNs), which lets a
+ * projection with range cuts seek past blocks that cannot contain a
+ * selected row without reading their data.
+ */
+
+#include <config.h>
+#include <stdlib.h>
+#include <string.h>
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_executor.h>
+#include <gsl/gsl_ntuple.h>
+
+static const char col_magic[8] = { 'G', 'S', 'L', 'N', 'T', 'C', 'O', 'L' };
+
+static gsl_ntuple_col *col_alloc (const size_t ncol, const size_t block_size);
+static void col_free (gsl_ntuple_col * ntuple);
+static int col_write_block (gsl_ntuple_col * ntuple);
+static int col_read_header (gsl_ntuple_col * ntuple);
+static int col_read_data (gsl_ntuple_col * ntuple);
+static int col_read_columns (gsl_ntuple_col * ntuple, double * data);
+static int col_check_project (const size_t n, const size_t col[],
+                              gsl_ntuple_col * ntuple, const size_t ncut,
+                              const gsl_ntuple_col_cut cut[]);
+static int col_skip_block (gsl_ntuple_col * ntuple, const size_t ncut,
+                           const gsl_ntuple_col_cut cut[], int * skip);
+static int col_project_block (const size_t n, gsl_histogram * h[],
+                              const size_t col[], gsl_ntuple_col * ntuple,
+                              const size_t ncut, const gsl_ntuple_col_cut cut[]);
+static void col_project_rows (const size_t n, gsl_histogram * h[],
+                              const size_t col[], const double * data,
+                              const size_t bs, const size_t first,
+                              const size_t nrow, size_t * index, double * work,
+                              const size_t ncut, const gsl_ntuple_col_cut cut[]);
+
+/*
+ * gsl_ntuple_col_create:
+ * allocate a columnar ntuple with ncol columns and create its file
+ */
+
+gsl_ntuple_col *
+gsl_ntuple_col_create (char *filename, const size_t ncol, const size_t block_size)
+{
+  gsl_ntuple_col *ntuple;
+
+  if (ncol == 0)
+    {
+      GSL_ERROR_VAL ("number of columns must be positive", GSL_EINVAL, 0);
+    }
+  else if (block_size == 0)
+    {
+      GSL_ERROR_VAL ("block size must be positive", GSL_EINVAL, 0);
+    }
+
+  ntuple = col_alloc (ncol, block_size);
+
+  if (ntuple == 0)
+    {
+      GSL_ERROR_VAL ("failed to allocate space for ntuple struct",
+                     GSL_ENOMEM, 0);
+    }
+
+  ntuple->file = fopen (filename, "wb");
+
+  if (ntuple->file == 0)
+    {
+      col_free (ntuple);
+      GSL_ERROR_VAL ("unable to create ntuple file", GSL_EFAILED, 0);
+    }
+
+  ntuple->writing = 1;
+
+  if (fwrite (col_magic, sizeof (col_magic), 1, ntuple->file) != 1
+      || fwrite (&(ntuple->ncol), sizeof (size_t), 1, ntuple->file) != 1
+      || fwrite (&(ntuple->block_size), sizeof (size_t), 1, ntuple->file) != 1)
+    {
+      fclose (ntuple->file);
+      col_free (ntuple);
+      GSL_ERROR_VAL ("failed to write ntuple header", GSL_EFAILED, 0);
+    }
+
+  return ntuple;
+}
+
+/*
+ * gsl_ntuple_col_open:
+ * open an existing columnar ntuple file for reading
+ */
+
+gsl_ntuple_col *
+gsl_ntuple_col_open (char *filename)
+{
+  gsl_ntuple_col *ntuple;
+  char magic[8];
+  size_t ncol, block_size;
+  FILE *file = fopen (filename, "rb");
+
+  if (file == 0)
+    {
+      GSL_ERROR_VAL ("unable to open ntuple file for reading",
+                     GSL_EFAILED, 0);
+    }
+
+  if (fread (magic, sizeof (magic), 1, file) != 1
+      || fread (&ncol, sizeof (size_t), 1, file) != 1
+      || fread (&block_size, sizeof (size_t), 1, file) != 1)
+    {
+      fclose (file);
+      GSL_ERROR_VAL ("failed to read ntuple header", GSL_EFAILED, 0);
+    }
+
+  if (memcmp (magic, col_magic, sizeof (magic)) != 0
+      || ncol == 0 || block_size == 0)
+    {
+      fclose (file);
+      GSL_ERROR_VAL ("file is not a columnar ntuple", GSL_EFAILED, 0);
+    }
+
+  ntuple = col_alloc (ncol, block_size);
+
+  if (ntuple == 0)
+    {
+      fclose (file);
+      GSL_ERROR_VAL ("failed to allocate space for ntuple struct",
+                     GSL_ENOMEM, 0);
+    }
+
+  ntuple->file = file;
+  ntuple->writing = 0;
+
+  return ntuple;
+}
+
+/*
+ * gsl_ntuple_col_write:
+ * append the row row[0..ncol-1], writing the current block
+ * to the file when it is full
+ */
+
+int
+gsl_ntuple_col_write (gsl_ntuple_col * ntuple, const double row[])
+{
+  const size_t bs = ntuple->block_size;
+  size_t j;
+
+  if (!ntuple->writing)
+    {
+      GSL_ERROR ("ntuple is not open for writing", GSL_EINVAL);
+    }
+
+  for (j = 0; j < ntuple->ncol; j++)
+    ntuple->data[j * bs + ntuple->nrow] = row[j];
+
+  if (++(ntuple->nrow) == bs)
+    return col_write_block (ntuple);
+
+  return GSL_SUCCESS;
+}
+
+/*
+ * gsl_ntuple_col_read:
+ * read the next row into row[0..ncol-1], returning GSL_EOF
+ * at the end of the file
+ */
+
+int
+gsl_ntuple_col_read (gsl_ntuple_col * ntuple, double row[])
+{
+  const size_t bs = ntuple->block_size;
+  size_t j;
+
+  if (ntuple->writing)
+    {
+      GSL_ERROR ("ntuple is not open for reading", GSL_EINVAL);
+    }
+
+  if (ntuple->irow == ntuple->nrow)
+    {
+      int status = col_read_header (ntuple);
+
+      if (status == GSL_EOF)
+        return GSL_EOF;
+      else if (status)
+        return status;
+
+      status = col_read_data (ntuple);
+      if (status)
+        return status;
+    }
+
+  for (j = 0; j < ntuple->ncol; j++)
+    row[j] = ntuple->data[j * bs + ntuple->irow];
+
+  ntuple->irow++;
+
+  return GSL_SUCCESS;
+}
+
+/*
+ * gsl_ntuple_col_project:
+ * fill the histograms h[0..n-1] with the columns col[0..n-1] of the
+ * rows satisfying all of the cuts cut[0..ncut-1], reading from the
+ * current position to the end of the file. Blocks whose column ranges
+ * exclude a cut are skipped; if nskip is not NULL it is set to their
+ * number.
+ */
+
+int
+gsl_ntuple_col_project (const size_t n, gsl_histogram * h[],
+                        const size_t col[], gsl_ntuple_col * ntuple,
+                        const size_t ncut, const gsl_ntuple_col_cut cut[],
+                        size_t * nskip)
+{
+  size_t nskipped = 0;
+  int status = col_check_project (n, col, ntuple, ncut, cut);
+
+  if (status)
+    return status;
+
+  /* rows of the current block which have not been read yet */
+  col_project_block (n, h, col, ntuple, ncut, cut);
+
+  while (1)
+    {
+      int skip;
+
+      status = col_read_header (ntuple);
+
+      if (status == GSL_EOF)
+        break;
+      else if (status)
+        return status;
+
+      status = col_skip_block (ntuple, ncut, cut, &skip);
+      if (status)
+        return status;
+
+      if (skip)
+        {
+          ++nskipped;
+        }
+      else
+        {
+          status = col_read_data (ntuple);
+          if (status)
+            return status;
+
+          col_project_block (n, h, col, ntuple, ncut, cut);
+        }
+    }
+
+  if (nskip)
+    *nskip = nskipped;
+
+  return GSL_SUCCESS;
+}
+
+typedef struct
+{
+  size_t n;
+  size_t ntasks;
+  gsl_histogram **h;            /* n histograms for each task, those
+                                   of task 0 being the caller's */
+  const size_t *col;
+  size_t ncut;
+  const gsl_ntuple_col_cut *cut;
+  size_t ncol;
+  size_t block_size;
+  double *data;                 /* one block for each task */
+  size_t *nrow;                 /* rows in the block of each task */
+  size_t *index;                /* selected rows, block_size per task */
+  double *work;                 /* selected values, block_size per task */
+} col_project_workspace;
+
+static void col_project_task (size_t t, void *vw);
+static void col_project_free (col_project_workspace * w);
+
+/*
+ * gsl_ntuple_col_project_parallel:
+ * as gsl_ntuple_col_project, with the selected blocks projected by
+ * ntasks tasks run by exec. The blocks are read by the calling thread
+ * ntasks at a time, and task t projects the t-th of each group. Task 0
+ * fills h[] and the others private copies which are added to h[] in
+ * task order at the end.
+ */
+
+int
+gsl_ntuple_col_project_parallel (const size_t n, gsl_histogram * h[],
+                                 const size_t col[], gsl_ntuple_col * ntuple,
+                                 const size_t ncut, const gsl_ntuple_col_cut cut[],
+                                 size_t * nskip, const size_t ntasks,
+                                 const gsl_executor * exec)
+{
+  const size_t ncol = ntuple->ncol;
+  const size_t bs = ntuple->block_size;
+  col_project_workspace w;
+  size_t nskipped = 0;
+  int eof = 0;
+  int status;
+  size_t j, t;
+
+  if (ntasks == 0)
+    {
+      GSL_ERROR ("number of tasks must be positive", GSL_EINVAL);
+    }
+
+  status = col_check_project (n, col, ntuple, ncut, cut);
+
+  if (status)
+    return status;
+
+  w.n = n;
+  w.ntasks = ntasks;
+  w.h = (gsl_histogram **) calloc (ntasks * n + 1, sizeof (gsl_histogram *));
+  w.data = (double *) malloc (ntasks * ncol * bs * sizeof (double));
+  w.nrow = (size_t *) malloc (ntasks * sizeof (size_t));
+  w.index = (size_t *) malloc (ntasks * bs * sizeof (size_t));
+  w.work = (double *) malloc (ntasks * bs * sizeof (double));
+
+  if (w.h == 0 || w.data == 0 || w.nrow == 0 || w.index == 0 || w.work == 0)
+    {
+      col_project_free (&w);
+      GSL_ERROR ("failed to allocate space for ntuple blocks", GSL_ENOMEM);
+    }
+
+  for (j = 0; j < n; j++)
+    w.h[j] = h[j];
+
+  for (t = 1; t < ntasks && status == GSL_SUCCESS; t++)
+    {
+      for (j = 0; j < n; j++)
+        {
+          gsl_histogram *ht = gsl_histogram_clone (h[j]);
+
+          if (ht == 0)
+            {
+              status = GSL_ENOMEM;
+              break;
+            }
+
+          gsl_histogram_reset (ht);
+          w.h[t * n + j] = ht;
+        }
+    }
+
+  if (status)
+    {
+      col_project_free (&w);
+      GSL_ERROR ("failed to allocate space for task histograms", GSL_ENOMEM);
+    }
+
+  w.col = col;
+  w.ncut = ncut;
+  w.cut = cut;
+  w.ncol = ncol;
+  w.block_size = bs;
+
+  /* rows of the current block which have not been read yet */
+  col_project_block (n, h, col, ntuple, ncut, cut);
+
+  while (!eof)
+    {
+      size_t nblock = 0;
+
+      while (nblock < ntasks)
+        {
+          int skip = 0;
+
+          status = col_read_header (ntuple);
+
+          if (status == GSL_EOF)
+            {
+              eof = 1;
+              break;
+            }
+
+          if (status == GSL_SUCCESS)
+            status = col_skip_block (ntuple, ncut, cut, &skip);
+
+          if (status == GSL_SUCCESS && !skip)
+            status = col_read_columns (ntuple, w.data + nblock * ncol * bs);
+
+          if (status)
+            {
+              col_project_free (&w);
+              return status;
+            }
+
+          if (skip)
+            {
+              ++nskipped;
+            }
+          else
+            {
+              w.nrow[nblock++] = ntuple->nrow;
+              ntuple->nrow = 0;
+            }
+        }
+
+      for (t = nblock; t < ntasks; t++)
+        w.nrow[t] = 0;
+
+      if (nblock > 0)
+        gsl_executor_run (exec, ntasks, &col_project_task, &w);
+    }
+
+  for (t = 1; t < ntasks; t++)
+    {
+      for (j = 0; j < n; j++)
+        gsl_histogram_add (h[j], w.h[t * n + j]);
+    }
+
+  col_project_free (&w);
+
+  if (nskip)
+    *nskip = nskipped;
+
+  return GSL_SUCCESS;
+}
+
+/* project the block of task t */
+static void
+col_project_task (size_t t, void *vw)
+{
+  col_project_workspace *w = (col_project_workspace *) vw;
+  const size_t bs = w->block_size;
+
+  col_project_rows (w->n, w->h + t * w->n, w->col, w->data + t * w->ncol * bs,
+                    bs, 0, w->nrow[t], w->index + t * bs, w->work + t * bs,
+                    w->ncut, w->cut);
+}
+
+/* free the workspace and the histograms of tasks 1 .. ntasks-1 */
+static void
+col_project_free (col_project_workspace * w)
+{
+  size_t t, j;
+
+  if (w->h != 0)
+    {
+      for (t = 1; t < w->ntasks; t++)
+        {
+          for (j = 0; j < w->n; j++)
+            gsl_histogram_free (w->h[t * w->n + j]);
+        }
+    }
+
+  free (w->h);
+  free (w->data);
+  free (w->nrow);
+  free (w->index);
+  free (w->work);
+}
+
+/*
+ * gsl_ntuple_col_close:
+ * write any pending rows, close the file and free the memory
+ */
+
+int
+gsl_ntuple_col_close (gsl_ntuple_col * ntuple)
+{
+  int status = GSL_SUCCESS;
+
+  if (ntuple->writing && ntuple->nrow > 0)
+    status = col_write_block (ntuple);
+
+  if (fclose (ntuple->file) != 0 && status == GSL_SUCCESS)
+    {
+      col_free (ntuple);
+      GSL_ERROR ("failed to close ntuple file", GSL_EFAILED);
+    }
+
+  col_free (ntuple);
+
+  return status;
+}
+
+static gsl_ntuple_col *
+col_alloc (const size_t ncol, const size_t block_size)
+{
+  gsl_ntuple_col *ntuple = (gsl_ntuple_col *) calloc (1, sizeof (gsl_ntuple_col));
+
+  if (ntuple == 0)
+    return 0;
+
+  ntuple->ncol = ncol;
+  ntuple->block_size = block_size;
+  ntuple->data = malloc (ncol * block_size * sizeof (double));
+  ntuple->zmin = malloc (ncol * sizeof (double));
+  ntuple->zmax = malloc (ncol * sizeof (double));
+  ntuple->index = malloc (block_size * sizeof (size_t));
+  ntuple->work = malloc (block_size * sizeof (double));
+
+  if (ntuple->data == 0 || ntuple->zmin == 0 || ntuple->zmax == 0
+      || ntuple->index == 0 || ntuple->work == 0)
+    {
+      col_free (ntuple);
+      return 0;
+    }
+
+  return ntuple;
+}
+
+static void
+col_free (gsl_ntuple_col * ntuple)
+{
+  free (ntuple->data);
+  free (ntuple->zmin);
+  free (ntuple->zmax);
+  free (ntuple->index);
+  free (ntuple->work);
+  free (ntuple);
+}
+
+/* compute the column ranges of the current block and write it */
+static int
+col_write_block (gsl_ntuple_col * ntuple)
+{
+  const size_t ncol = ntuple->ncol;
+  const size_t nrow = ntuple->nrow;
+  size_t i, j;
+
+  for (j = 0; j < ncol; j++)
+    {
+      const double *x = ntuple->data + j * ntuple->block_size;
+      double zmin = GSL_POSINF, zmax = GSL_NEGINF;
+
+      for (i = 0; i < nrow; i++)
+        {
+          if (x[i] < zmin)
+            zmin = x[i];
+          if (x[i] > zmax)
+            zmax = x[i];
+        }
+
+      ntuple->zmin[j] = zmin;
+      ntuple->zmax[j] = zmax;
+    }
+
+  if (fwrite (&nrow, sizeof (size_t), 1, ntuple->file) != 1
+      || fwrite (ntuple->zmin, sizeof (double), ncol, ntuple->file) != ncol
+      || fwrite (ntuple->zmax, sizeof (double), ncol, ntuple->file) != ncol)
+    {
+      GSL_ERROR ("failed to write ntuple block to file", GSL_EFAILED);
+    }
+
+  for (j = 0; j < ncol; j++)
+    {
+      if (fwrite (ntuple->data + j * ntuple->block_size, sizeof (double),
+                  nrow, ntuple->file) != nrow)
+        {
+          GSL_ERROR ("failed to write ntuple block to file", GSL_EFAILED);
+        }
+    }
+
+  ntuple->nrow = 0;
+
+  return GSL_SUCCESS;
+}
+
+/* read the row count and column ranges of the next block */
+static int
+col_read_header (gsl_ntuple_col * ntuple)
+{
+  const size_t ncol = ntuple->ncol;
+  size_t nrow;
+
+  ntuple->nrow = ntuple->irow = 0;
+
+  if (fread (&nrow, sizeof (size_t), 1, ntuple->file) != 1)
+    {
+      if (feof (ntuple->file))
+        return GSL_EOF;
+
+      GSL_ERROR ("failed to read ntuple block from file", GSL_EFAILED);
+    }
+
+  if (nrow == 0 || nrow > ntuple->block_size)
+    {
+      GSL_ERROR ("invalid ntuple block size in file", GSL_EFAILED);
+    }
+
+  if (fread (ntuple->zmin, sizeof (double), ncol, ntuple->file) != ncol
+      || fread (ntuple->zmax, sizeof (double), ncol, ntuple->file) != ncol)
+    {
+      GSL_ERROR ("failed to read ntuple block from file", GSL_EFAILED);
+    }
+
+  ntuple->nrow = nrow;
+
+  return GSL_SUCCESS;
+}
+
+/* read the columns of a block whose header has just been read */
+static int
+col_read_data (gsl_ntuple_col * ntuple)
+{
+  int status = col_read_columns (ntuple, ntuple->data);
+
+  ntuple->irow = 0;
+
+  return status;
+}
+
+/* read the columns of the current block into data, with column j
+   at data[j*block_size..] */
+static int
+col_read_columns (gsl_ntuple_col * ntuple, double * data)
+{
+  const size_t nrow = ntuple->nrow;
+  size_t j;
+
+  for (j = 0; j < ntuple->ncol; j++)
+    {
+      if (fread (data + j * ntuple->block_size, sizeof (double),
+                 nrow, ntuple->file) != nrow)
+        {
+          ntuple->nrow = 0;
+          GSL_ERROR ("failed to read ntuple block from file", GSL_EFAILED);
+        }
+    }
+
+  return GSL_SUCCESS;
+}
+
+/* check the arguments of a projection */
+static int
+col_check_project (const size_t n, const size_t col[],
+                   gsl_ntuple_col * ntuple, const size_t ncut,
+                   const gsl_ntuple_col_cut cut[])
+{
+  const size_t ncol = ntuple->ncol;
+  size_t i;
+
+  if (ntuple->writing)
+    {
+      GSL_ERROR ("ntuple is not open for reading", GSL_EINVAL);
+    }
+
+  for (i = 0; i < n; i++)
+    {
+      if (col[i] >= ncol)
+        {
+          GSL_ERROR ("column index out of range", GSL_EINVAL);
+        }
+    }
+
+  for (i = 0; i < ncut; i++)
+    {
+      if (cut[i].col >= ncol)
+        {
+          GSL_ERROR ("cut column index out of range", GSL_EINVAL);
+        }
+    }
+
+  return GSL_SUCCESS;
+}
+
+/* decide from the column ranges of a block whose header has just been
+   read whether a cut excludes all of its rows, and if so seek past
+   its data */
+static int
+col_skip_block (gsl_ntuple_col * ntuple, const size_t ncut,
+                const gsl_ntuple_col_cut cut[], int * skip)
+{
+  size_t i;
+
+  *skip = 0;
+
+  for (i = 0; i < ncut && !*skip; i++)
+    {
+      const size_t c = cut[i].col;
+
+      /* an all-NaN column has zmin > zmax and is always skipped */
+      *skip = !(ntuple->zmax[c] >= cut[i].lower && ntuple->zmin[c] < cut[i].upper);
+    }
+
+  if (*skip)
+    {
+      const long offset = (long) (ntuple->nrow * ntuple->ncol * sizeof (double));
+
+      if (fseek (ntuple->file, offset, SEEK_CUR) != 0)
+        {
+          GSL_ERROR ("failed to seek in ntuple file", GSL_EFAILED);
+        }
+
+      ntuple->nrow = ntuple->irow = 0;
+    }
+
+  return GSL_SUCCESS;
+}
+
+/* project the unread rows of the current block */
+static int
+col_project_block (const size_t n, gsl_histogram * h[],
+                   const size_t col[], gsl_ntuple_col * ntuple,
+                   const size_t ncut, const gsl_ntuple_col_cut cut[])
+{
+  col_project_rows (n, h, col, ntuple->data, ntuple->block_size,
+                    ntuple->irow, ntuple->nrow, ntuple->index, ntuple->work,
+                    ncut, cut);
+
+  ntuple->irow = ntuple->nrow;
+
+  return GSL_SUCCESS;
+}
+
+/* project the rows first .. nrow-1 of the block in data, applying each
+   cut to a list of selected rows one column at a time */
+static void
+col_project_rows (const size_t n, gsl_histogram * h[],
+                  const size_t col[], const double * data,
+                  const size_t bs, const size_t first,
+                  const size_t nrow, size_t * index, double * work,
+                  const size_t ncut, const gsl_ntuple_col_cut cut[])
+{
+  size_t nsel = 0;
+  size_t i, k;
+
+  if (first == nrow)
+    return;
+
+  for (i = first; i < nrow; i++)
+    index[nsel++] = i;
+
+  for (k = 0; k < ncut && nsel > 0; k++)
+    {
+      const double *x = data + cut[k].col * bs;
+      const double lower = cut[k].lower;
+      const double upper = cut[k].upper;
+      size_t m = 0;
+
+      for (i = 0; i < nsel; i++)
+        {
+          const double xi = x[index[i]];
+          index[m] = index[i];
+          m += (xi >= lower && xi < upper);
+        }
+
+      nsel = m;
+    }
+
+  for (k = 0; k < n && nsel > 0; k++)
+    {
+      const double *x = data + col[k] * bs;
+
+      for (i = 0; i < nsel; i++)
+        work[i] = x[index[i]];
+
+      /* values outside the histogram range are ignored */
+      gsl_histogram_increment_array (h[k], work, 1, nsel);
+    }
+}
@@ -26,6 +26,7 @@
 #include <stdlib.h>
 #include <stdio.h>
 #include <gsl/gsl_errno.h>
+#include <gsl/gsl_executor.h>
 #include <gsl/gsl_histogram.h>
 
 #undef __BEGIN_DECLS
@@ -71,8 +72,66 @@ int gsl_ntuple_project (gsl_histogram * h, gsl_ntuple * ntuple,
                         gsl_ntuple_value_fn *value_func,
                         gsl_ntuple_select_fn *select_func);
 
+int gsl_ntuple_project_n (const size_t n, gsl_histogram * h[],
+                          gsl_ntuple * ntuple,
+                          gsl_ntuple_value_fn * value_func[],
+                          gsl_ntuple_select_fn * select_func);
+
+int gsl_ntuple_project_n_parallel (const size_t n, gsl_histogram * h[],
+                                   gsl_ntuple * ntuple,
+                                   gsl_ntuple_value_fn * value_func[],
+                                   gsl_ntuple_select_fn * select_func,
+                                   const size_t ntasks,
+                                   const gsl_executor * exec);
+
 int gsl_ntuple_close (gsl_ntuple * ntuple);
 
+/* columnar ntuples of doubles, stored in blocks with per-block
+   column ranges so that projections can skip unselected blocks */
+
+typedef struct {
+    FILE * file;
+    int writing;        /* 1 if created for writing, 0 if opened */
+    size_t ncol;        /* number of columns */
+    size_t block_size;  /* maximum number of rows per block */
+    size_t nrow;        /* number of rows in the current block */
+    size_t irow;        /* next row of the current block to be read */
+    double * data;      /* current block, column j in data[j*block_size..] */
+    double * zmin;      /* minimum of each column in the current block */
+    double * zmax;      /* maximum of each column in the current block */
+    size_t * index;     /* selected rows of the current block */
+    double * work;      /* selected values of one column */
+} gsl_ntuple_col;
+
+typedef struct {
+    size_t col;         /* column index */
+    double lower;       /* select rows with lower <= x < upper */
+    double upper;
+} gsl_ntuple_col_cut;
+
+gsl_ntuple_col * 
+gsl_ntuple_col_create (char * filename, const size_t ncol, const size_t block_size);
+
+gsl_ntuple_col * 
+gsl_ntuple_col_open (char * filename);
+
+int gsl_ntuple_col_write (gsl_ntuple_col * ntuple, const double row[]);
+int gsl_ntuple_col_read (gsl_ntuple_col * ntuple, double row[]);
+
+int gsl_ntuple_col_project (const size_t n, gsl_histogram * h[],
+                            const size_t col[], gsl_ntuple_col * ntuple,
+                            const size_t ncut, const gsl_ntuple_col_cut cut[],
+                            size_t * nskip);
+
+int gsl_ntuple_col_project_parallel (const size_t n, gsl_histogram * h[],
+                                     const size_t col[], gsl_ntuple_col * ntuple,
+                                     const size_t ncut,
+                                     const gsl_ntuple_col_cut cut[],
+                                     size_t * nskip, const size_t ntasks,
+                                     const gsl_executor * exec);
+
+int gsl_ntuple_col_close (gsl_ntuple_col * ntuple);
+
 __END_DECLS
 
 #endif /* __GSL_NTUPLE_H__ */
@@ -21,7 +21,9 @@
 
 #include <config.h>
 #include <errno.h>
+#include <string.h>
 #include <gsl/gsl_errno.h>
+#include <gsl/gsl_executor.h>
 #include <gsl/gsl_ntuple.h>
 
 /* 
@@ -148,38 +150,260 @@ gsl_ntuple_read (gsl_ntuple * ntuple)
 
 #define EVAL(f,x) ((*((f)->function))(x,(f)->params))
 
+/* rows are read from the file in blocks of about this many bytes */
+#define NTUPLE_BLOCK_BYTES 65536
+
+/* 
+ * ntuple_project:
+ * fill n histograms in a single pass over the file. The rows are
+ * read in blocks and each one is copied into ntuple_data before the
+ * user functions are called, so the functions see exactly what they
+ * saw with one fread per row. A NULL select_func selects every row.
+ */
+
+static int
+ntuple_project (const size_t n, gsl_histogram * h[], gsl_ntuple * ntuple,
+                gsl_ntuple_value_fn * value_func[],
+                gsl_ntuple_select_fn * select_func)
+{
+  const size_t size = ntuple->size;
+  const size_t nblock = (size < NTUPLE_BLOCK_BYTES) ? NTUPLE_BLOCK_BYTES / size : 1;
+  char *buf = (char *) malloc (nblock * size);
+  size_t nread;
+
+  if (buf == 0)
+    {
+      GSL_ERROR ("failed to allocate space for ntuple block", GSL_ENOMEM);
+    }
+
+  do
+    {
+      size_t i, j;
+
+      nread = fread (buf, size, nblock, ntuple->file);
+
+      if (nread < nblock && ferror (ntuple->file))
+        {
+          free (buf);
+          GSL_ERROR ("failed to read ntuple for projection", GSL_EFAILED);
+        }
+
+      for (i = 0; i < nread; i++)
+        {
+          memcpy (ntuple->ntuple_data, buf + i * size, size);
+
+          if (select_func == 0 || EVAL(select_func, ntuple->ntuple_data))
+            {
+              for (j = 0; j < n; j++)
+                {
+                  gsl_histogram_increment (h[j], EVAL(value_func[j], ntuple->ntuple_data));
+                }
+            }
+        }
+    }
+  while (nread == nblock);
+
+  free (buf);
+
+  return GSL_SUCCESS;
+}
+
 int
 gsl_ntuple_project (gsl_histogram * h, gsl_ntuple * ntuple,
                     gsl_ntuple_value_fn * value_func, 
                     gsl_ntuple_select_fn * select_func)
 {
+  return ntuple_project (1, &h, ntuple, &value_func, select_func);
+}
+
+/* 
+ * gsl_ntuple_project_n:
+ * as gsl_ntuple_project, but fill the histograms h[0..n-1] with
+ * the values value_func[0..n-1] in a single scan of the file
+ */
+
+int
+gsl_ntuple_project_n (const size_t n, gsl_histogram * h[], gsl_ntuple * ntuple,
+                      gsl_ntuple_value_fn * value_func[],
+                      gsl_ntuple_select_fn * select_func)
+{
+  return ntuple_project (n, h, ntuple, value_func, select_func);
+}
+
+typedef struct
+{
+  size_t n;
+  size_t ntasks;
+  gsl_histogram **h;            /* n histograms for each task, those
+                                   of task 0 being the caller's */
+  void **row;                   /* copy of the current row in each task */
+  gsl_ntuple_value_fn **value_func;
+  gsl_ntuple_select_fn *select_func;
+  const char *buf;
+  size_t size;
   size_t nread;
+} project_workspace;
 
-  do
+static void project_task (size_t t, void *vw);
+static void project_free (project_workspace * w);
+
+/* 
+ * gsl_ntuple_project_n_parallel:
+ * as gsl_ntuple_project_n, with the value and selection functions
+ * called from ntasks tasks run by exec. The rows are read in blocks by
+ * the calling thread, and each task takes a contiguous range of rows
+ * of every block. Task 0 fills h[] and the others private copies which
+ * are added to h[] in task order at the end.
+ */
+
+int
+gsl_ntuple_project_n_parallel (const size_t n, gsl_histogram * h[],
+                               gsl_ntuple * ntuple,
+                               gsl_ntuple_value_fn * value_func[],
+                               gsl_ntuple_select_fn * select_func,
+                               const size_t ntasks, const gsl_executor * exec)
+{
+  const size_t size = ntuple->size;
+  const size_t nblock = ntasks * ((size < NTUPLE_BLOCK_BYTES) ? NTUPLE_BLOCK_BYTES / size : 1);
+  project_workspace w;
+  char *buf;
+  int status = GSL_SUCCESS;
+  size_t j, t;
+
+  if (ntasks == 0)
+    {
+      GSL_ERROR ("number of tasks must be positive", GSL_EINVAL);
+    }
+
+  w.n = n;
+  w.ntasks = ntasks;
+  w.h = (gsl_histogram **) calloc (ntasks * n + 1, sizeof (gsl_histogram *));
+  w.row = (void **) calloc (ntasks, sizeof (void *));
+  buf = (char *) malloc (nblock * size);
+
+  if (w.h == 0 || w.row == 0 || buf == 0)
+    {
+      free (buf);
+      project_free (&w);
+      GSL_ERROR ("failed to allocate space for ntuple block", GSL_ENOMEM);
+    }
+
+  w.row[0] = ntuple->ntuple_data;
+
+  for (j = 0; j < n; j++)
+    w.h[j] = h[j];
+
+  for (t = 1; t < ntasks && status == GSL_SUCCESS; t++)
     {
-      nread = fread (ntuple->ntuple_data, ntuple->size,
-                     1, ntuple->file);
+      w.row[t] = malloc (size);
+
+      if (w.row[t] == 0)
+        status = GSL_ENOMEM;
 
-      if (nread == 0 && feof(ntuple->file))
+      for (j = 0; j < n && status == GSL_SUCCESS; j++)
         {
-          break ;
+          gsl_histogram *ht = gsl_histogram_clone (h[j]);
+
+          if (ht == 0)
+            {
+              status = GSL_ENOMEM;
+              break;
+            }
+
+          gsl_histogram_reset (ht);
+          w.h[t * n + j] = ht;
         }
-      
-      if (nread != 1) 
+    }
+
+  if (status)
+    {
+      free (buf);
+      project_free (&w);
+      GSL_ERROR ("failed to allocate space for task histograms", GSL_ENOMEM);
+    }
+
+  w.value_func = value_func;
+  w.select_func = select_func;
+  w.buf = buf;
+  w.size = size;
+
+  do
+    {
+      w.nread = fread (buf, size, nblock, ntuple->file);
+
+      if (w.nread < nblock && ferror (ntuple->file))
         {
+          free (buf);
+          project_free (&w);
           GSL_ERROR ("failed to read ntuple for projection", GSL_EFAILED);
         }
 
-      if (EVAL(select_func, ntuple->ntuple_data))
-        {
-          gsl_histogram_increment (h, EVAL(value_func, ntuple->ntuple_data));
-        }
+      if (w.nread > 0)
+        gsl_executor_run (exec, ntasks, &project_task, &w);
     }
-  while (1);
+  while (w.nread == nblock);
+
+  for (t = 1; t < ntasks; t++)
+    {
+      for (j = 0; j < n; j++)
+        gsl_histogram_add (h[j], w.h[t * n + j]);
+    }
+
+  free (buf);
+  project_free (&w);
 
   return GSL_SUCCESS;
 }
 
+/* project task t's range of the rows in the current block */
+static void
+project_task (size_t t, void *vw)
+{
+  project_workspace *w = (project_workspace *) vw;
+  const size_t n = w->n;
+  const size_t i1 = gsl_executor_block (w->nread, w->ntasks, t + 1);
+  gsl_histogram **h = w->h + t * n;
+  void *row = w->row[t];
+  size_t i, j;
+
+  for (i = gsl_executor_block (w->nread, w->ntasks, t); i < i1; i++)
+    {
+      memcpy (row, w->buf + i * w->size, w->size);
+
+      if (w->select_func == 0 || EVAL(w->select_func, row))
+        {
+          for (j = 0; j < n; j++)
+            {
+              gsl_histogram_increment (h[j], EVAL(w->value_func[j], row));
+            }
+        }
+    }
+}
+
+/* free the histograms and rows of tasks 1 .. ntasks-1 */
+static void
+project_free (project_workspace * w)
+{
+  size_t t, j;
+
+  if (w->h != 0)
+    {
+      for (t = 1; t < w->ntasks; t++)
+        {
+          for (j = 0; j < w->n; j++)
+            gsl_histogram_free (w->h[t * w->n + j]);
+        }
+    }
+
+  if (w->row != 0)
+    {
+      for (t = 1; t < w->ntasks; t++)
+        free (w->row[t]);
+    }
+
+  free (w->h);
+  free (w->row);
+}
 
 /* 
  * gsl_ntuple_close:
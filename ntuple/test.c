@@ -1,6 +1,8 @@
 #include <config.h>
 #include <stdlib.h>
 #include <string.h>
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_executor.h>
 #include <gsl/gsl_ntuple.h>
 #include <gsl/gsl_test.h>
 #include <gsl/gsl_ieee_utils.h>
@@ -14,6 +16,29 @@ struct data
 };
 int sel_func (void *ntuple_data, void * params);
 double val_func (void *ntuple_data, void * params);
+double val2_func (void *ntuple_data, void * params);
+
+#define NTASKS 3
+
+/* An executor which runs the tasks in reverse order, to check that
+   the results of the parallel functions do not depend on the order in
+   which the tasks are run */
+
+static void
+reverse_run (size_t ntasks, void (*task) (size_t i, void * data),
+             void * data, void * params)
+{
+  size_t i;
+
+  (void) params;
+
+  for (i = ntasks; i-- > 0;)
+    {
+      task (i, data);
+    }
+}
+
+static const gsl_executor reverse_exec = { &reverse_run, 0 };
 
 int
 main (void)
@@ -136,6 +161,285 @@ main (void)
     gsl_histogram_free (h);
   }
 
+  {
+    int status = 0;
+    gsl_ntuple_value_fn V2;
+    gsl_ntuple_value_fn *Vn[2];
+    gsl_histogram *hn[2];
+    gsl_histogram *h2 = gsl_histogram_calloc_uniform (50, 0., 0.5);
+    gsl_ntuple *ntuple;
+
+    V2.function = &val2_func;
+    V2.params = &scale;
+
+    Vn[0] = &V;
+    Vn[1] = &V2;
+    hn[0] = gsl_histogram_calloc_uniform (100, 0., 1.);
+    hn[1] = gsl_histogram_calloc_uniform (50, 0., 0.5);
+
+    ntuple = gsl_ntuple_open ("test.dat", &ntuple_row, sizeof (ntuple_row));
+    gsl_ntuple_project (h2, ntuple, &V2, &S);
+    gsl_ntuple_close (ntuple);
+
+    ntuple = gsl_ntuple_open ("test.dat", &ntuple_row, sizeof (ntuple_row));
+    gsl_ntuple_project_n (2, hn, ntuple, Vn, &S);
+    gsl_ntuple_close (ntuple);
+
+    for (i = 0; i < 100; i++)
+      status |= (hn[0]->bin[i] != f[i]);
+
+    status |= !gsl_histogram_equal_bins_p (hn[1], h2);
+
+    for (i = 0; i < 50; i++)
+      status |= (hn[1]->bin[i] != h2->bin[i]);
+
+    gsl_test (status, "histogramming ntuples with several value functions");
+
+    /* parallel projection, with one task and with several tasks run
+       in reverse order */
+    {
+      gsl_histogram *hp[2];
+      size_t ntasks;
+
+      hp[0] = gsl_histogram_calloc_uniform (100, 0., 1.);
+      hp[1] = gsl_histogram_calloc_uniform (50, 0., 0.5);
+
+      for (ntasks = 1; ntasks <= NTASKS; ntasks += NTASKS - 1)
+        {
+          gsl_histogram_reset (hp[0]);
+          gsl_histogram_reset (hp[1]);
+          status = 0;
+
+          ntuple = gsl_ntuple_open ("test.dat", &ntuple_row, sizeof (ntuple_row));
+          status |= gsl_ntuple_project_n_parallel (2, hp, ntuple, Vn, &S, ntasks,
+                                                   (ntasks == 1) ? NULL : &reverse_exec);
+          gsl_ntuple_close (ntuple);
+
+          for (i = 0; i < 100; i++)
+            status |= (hp[0]->bin[i] != hn[0]->bin[i]);
+
+          for (i = 0; i < 50; i++)
+            status |= (hp[1]->bin[i] != hn[1]->bin[i]);
+
+          gsl_test (status, "histogramming ntuples in parallel, %d tasks",
+                    (int) ntasks);
+        }
+
+      gsl_histogram_free (hp[0]);
+      gsl_histogram_free (hp[1]);
+    }
+
+    gsl_histogram_free (h2);
+    gsl_histogram_free (hn[0]);
+    gsl_histogram_free (hn[1]);
+  }
+
+  {
+    const size_t block_size = 64;
+    double row[4];
+    gsl_ntuple_col *ntuple = gsl_ntuple_col_create ("test_col.dat", 4, block_size);
+    int status = 0;
+
+    for (i = 0; i < 1000; i++)
+      {
+        row[0] = i;
+        row[1] = x[i];
+        row[2] = y[i];
+        row[3] = z[i];
+
+        status |= gsl_ntuple_col_write (ntuple, row);
+      }
+
+    status |= gsl_ntuple_col_close (ntuple);
+
+    gsl_test (status, "writing columnar ntuples");
+
+    ntuple = gsl_ntuple_col_open ("test_col.dat");
+    status = (ntuple == 0);
+
+    for (i = 0; i < 1000 && !status; i++)
+      {
+        status |= gsl_ntuple_col_read (ntuple, row);
+        status |= (row[0] != i);
+        status |= (row[1] != x[i]);
+        status |= (row[2] != y[i]);
+        status |= (row[3] != z[i]);
+      }
+
+    status |= (gsl_ntuple_col_read (ntuple, row) != GSL_EOF);
+
+    gsl_ntuple_col_close (ntuple);
+
+    gsl_test (status, "reading columnar ntuples");
+  }
+
+  {
+    /* x decreases with the row number, so a cut on x skips
+       all blocks before the first selected row */
+    const size_t col[3] = { 1, 2, 0 };
+    gsl_ntuple_col_cut cut[1];
+    gsl_histogram *hc[3];
+    gsl_ntuple_col *ntuple;
+    double row[4];
+    size_t nskip = 0;
+    int status = 0;
+
+    cut[0].col = 1;
+    cut[0].lower = -1.0;
+    cut[0].upper = 0.1 / scale;
+
+    hc[0] = gsl_histogram_calloc_uniform (100, 0., 0.1);
+    hc[1] = gsl_histogram_calloc_uniform (100, 0., 0.01);
+    hc[2] = gsl_histogram_calloc_uniform (10, 0., 1000.);
+
+    /* read a few rows first, projection continues from there */
+    ntuple = gsl_ntuple_col_open ("test_col.dat");
+    for (i = 0; i < 10; i++)
+      gsl_ntuple_col_read (ntuple, row);
+
+    cut[0].lower = GSL_NEGINF;
+    cut[0].upper = GSL_POSINF;
+    gsl_ntuple_col_project (1, &hc[2], &col[2], ntuple, 1, cut, &nskip);
+    gsl_ntuple_col_close (ntuple);
+
+    status |= (nskip != 0);
+    status |= (gsl_histogram_sum (hc[2]) != 990);
+    status |= (gsl_histogram_get (hc[2], 0) != 90);
+    gsl_test (status, "projecting columnar ntuples from the current row");
+
+    gsl_histogram_reset (hc[2]);
+    cut[0].lower = -1.0;
+    cut[0].upper = 0.1 / scale;
+    status = 0;
+
+    ntuple = gsl_ntuple_col_open ("test_col.dat");
+    gsl_ntuple_col_project (3, hc, col, ntuple, 1, cut, &nskip);
+    gsl_ntuple_col_close (ntuple);
+
+    {
+      gsl_histogram *hx = gsl_histogram_calloc_uniform (100, 0., 0.1);
+      gsl_histogram *hy = gsl_histogram_calloc_uniform (100, 0., 0.01);
+      size_t nsel = 0;
+
+      for (i = 0; i < 1000; i++)
+        {
+          if (x[i] * scale < 0.1)
+            {
+              gsl_histogram_increment (hx, x[i]);
+              gsl_histogram_increment (hy, y[i]);
+              ++nsel;
+            }
+        }
+
+      for (i = 0; i < 100; i++)
+        {
+          status |= (hc[0]->bin[i] != hx->bin[i]);
+          status |= (hc[1]->bin[i] != hy->bin[i]);
+        }
+
+      status |= (gsl_histogram_sum (hc[2]) != nsel);
+
+      /* the selected rows start in the first block, none is skipped */
+      status |= (nskip != 0);
+
+      gsl_histogram_free (hx);
+      gsl_histogram_free (hy);
+    }
+
+    gsl_test (status, "projecting columnar ntuples with cuts");
+
+    /* a cut which only selects the first rows skips all later blocks */
+    gsl_histogram_reset (hc[2]);
+    cut[0].lower = 0.1;
+    cut[0].upper = 1.0;
+    status = 0;
+
+    ntuple = gsl_ntuple_col_open ("test_col.dat");
+    gsl_ntuple_col_project (1, &hc[2], &col[2], ntuple, 1, cut, &nskip);
+    gsl_ntuple_col_close (ntuple);
+
+    /* x >= 0.1 for rows 0..8 */
+    status |= (gsl_histogram_sum (hc[2]) != 9);
+    status |= (nskip != 15);
+
+    gsl_test (status, "skipping blocks of columnar ntuples");
+
+    /* parallel projections give the same histograms and skipped
+       blocks, starting from the current row */
+    {
+      gsl_histogram *hp[3];
+      size_t ntasks, nskip_p = 0;
+
+      cut[0].lower = -1.0;
+      cut[0].upper = 0.1 / scale;
+
+      ntuple = gsl_ntuple_col_open ("test_col.dat");
+      for (i = 0; i < 10; i++)
+        gsl_ntuple_col_read (ntuple, row);
+      gsl_histogram_reset (hc[0]);
+      gsl_histogram_reset (hc[1]);
+      gsl_histogram_reset (hc[2]);
+      gsl_ntuple_col_project (3, hc, col, ntuple, 1, cut, &nskip);
+      gsl_ntuple_col_close (ntuple);
+
+      for (i = 0; i < 3; i++)
+        hp[i] = gsl_histogram_clone (hc[i]);
+
+      for (ntasks = 1; ntasks <= NTASKS; ntasks += NTASKS - 1)
+        {
+          status = 0;
+
+          for (i = 0; i < 3; i++)
+            gsl_histogram_reset (hp[i]);
+
+          ntuple = gsl_ntuple_col_open ("test_col.dat");
+          for (i = 0; i < 10; i++)
+            gsl_ntuple_col_read (ntuple, row);
+          status |= gsl_ntuple_col_project_parallel (3, hp, col, ntuple, 1, cut,
+                                                     &nskip_p, ntasks,
+                                                     (ntasks == 1) ? NULL : &reverse_exec);
+          status |= (gsl_ntuple_col_read (ntuple, row) != GSL_EOF);
+          gsl_ntuple_col_close (ntuple);
+
+          for (i = 0; i < 3; i++)
+            {
+              size_t k;
+
+              for (k = 0; k < hc[i]->n; k++)
+                status |= (hp[i]->bin[k] != hc[i]->bin[k]);
+            }
+
+          status |= (nskip_p != nskip);
+
+          gsl_test (status, "projecting columnar ntuples in parallel, %d tasks",
+                    (int) ntasks);
+        }
+
+      /* a cut which skips most of the blocks */
+      cut[0].lower = 0.1;
+      cut[0].upper = 1.0;
+      status = 0;
+      gsl_histogram_reset (hp[2]);
+
+      ntuple = gsl_ntuple_col_open ("test_col.dat");
+      gsl_ntuple_col_project_parallel (1, &hp[2], &col[2], ntuple, 1, cut,
+                                       &nskip_p, NTASKS, &reverse_exec);
+      gsl_ntuple_col_close (ntuple);
+
+      status |= (gsl_histogram_sum (hp[2]) != 9);
+      status |= (nskip_p != 15);
+
+      gsl_test (status, "skipping blocks of columnar ntuples in parallel");
+
+      for (i = 0; i < 3; i++)
+        gsl_histogram_free (hp[i]);
+    }
+
+    gsl_histogram_free (hc[0]);
+    gsl_histogram_free (hc[1]);
+    gsl_histogram_free (hc[2]);
+  }
+
   exit (gsl_test_summary());
 }
 
@@ -164,3 +468,14 @@ val_func (void *ntuple_data, void * params)
 
   return (x + y + z) * scale;
 }
+
+double
+val2_func (void *ntuple_data, void * params)
+{
+  double x, scale;
+  scale = *(double *)params;
+
+  x = ((struct data *) ntuple_data)->x;
+
+  return x * x * scale;
+}
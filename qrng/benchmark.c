@@ -0,0 +1,131 @@
+/* qrng/benchmark.c
+ *
+ * Copyright (C) 2026 Patrick Alken
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* timings of the extended Sobol generator in 1000 dimensions: setup,
+ * reading the direction numbers, scrambling, n points from gsl_qrng_get
+ * and gsl_qrng_get_array, and skipping to the start of 8 blocks of n
+ * points.  The direction numbers are written to a temporary file with
+ * distinct polynomials of degree 18 and initial direction numbers from
+ * an xorshift generator, in the format of Joe and Kuo; usage:
+ * benchmark [n] */
+
+#include <config.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <gsl/gsl_qrng.h>
+#include <gsl/gsl_rng.h>
+
+#define DIM 1000
+
+static void
+write_directions (FILE * f, unsigned int dim)
+{
+  unsigned long int seed = 2463534242UL;
+  unsigned int d, k;
+
+  for (d = 2; d <= dim; d++)
+    {
+      fprintf (f, "%u 18 %u", d, d - 2);
+
+      for (k = 0; k < 18; k++)
+        {
+          seed ^= (seed << 13) & 0xFFFFFFFFUL;
+          seed ^= seed >> 17;
+          seed ^= (seed << 5) & 0xFFFFFFFFUL;
+          fprintf (f, " %lu", (seed & ((2UL << k) - 1)) | 1);
+        }
+
+      fputc ('\n', f);
+    }
+
+  rewind (f);
+}
+
+static double
+seconds (clock_t start)
+{
+  return (clock () - start) / (double) CLOCKS_PER_SEC;
+}
+
+int
+main (int argc, char *argv[])
+{
+  const size_t n = (argc > 1) ? (size_t) atol (argv[1]) : 100000;
+  double *x = malloc (n * DIM * sizeof (double));
+  gsl_rng *r = gsl_rng_alloc (gsl_rng_default);
+  FILE *f = tmpfile ();
+  gsl_qrng *q;
+  clock_t start;
+  size_t i;
+
+  start = clock ();
+  q = gsl_qrng_alloc (gsl_qrng_sobol_ext, 21201);
+  printf ("%-32s %8.3f s\n", "alloc, d = 21201", seconds (start));
+  gsl_qrng_free (q);
+
+  write_directions (f, 21201);
+
+  start = clock ();
+  q = gsl_qrng_alloc (gsl_qrng_sobol_ext, 21201);
+  gsl_qrng_sobol_ext_fscanf (f, q);
+  printf ("%-32s %8.3f s\n", "fscanf, d = 21201", seconds (start));
+  gsl_qrng_free (q);
+
+  rewind (f);
+
+  start = clock ();
+  q = gsl_qrng_alloc (gsl_qrng_sobol_ext, DIM);
+  gsl_qrng_sobol_ext_fscanf (f, q);
+  printf ("%-32s %8.3f s\n", "alloc and fscanf", seconds (start));
+
+  start = clock ();
+  gsl_qrng_sobol_ext_scramble (q, r);
+  printf ("%-32s %8.3f s\n", "scramble", seconds (start));
+
+  printf ("n = %zu points, d = %d\n", n, DIM);
+
+  for (i = 0; i < n * DIM; i++)
+    x[i] = 0.0;
+
+  start = clock ();
+  for (i = 0; i < n; i++)
+    gsl_qrng_get (q, x + i * DIM);
+  printf ("%-32s %8.3f s\n", "gsl_qrng_get", seconds (start));
+
+  start = clock ();
+  gsl_qrng_get_array (q, x, n);
+  printf ("%-32s %8.3f s\n", "gsl_qrng_get_array", seconds (start));
+
+  start = clock ();
+  for (i = 0; i < 8; i++)
+    {
+      gsl_qrng *b = gsl_qrng_clone (q);
+      gsl_qrng_skip (b, i * n);
+      gsl_qrng_free (b);
+    }
+  printf ("%-32s %8.3f s\n", "clone and skip, 8 blocks", seconds (start));
+
+  gsl_qrng_free (q);
+  gsl_rng_free (r);
+  fclose (f);
+  free (x);
+
+  return 0;
+}
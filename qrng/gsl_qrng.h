@@ -4,9 +4,11 @@
 #define __GSL_QRNG_H__
 
 #include <stdlib.h>
+#include <stdio.h>
 #include <gsl/gsl_types.h>
 #include <gsl/gsl_errno.h>
 #include <gsl/gsl_inline.h>
+#include <gsl/gsl_rng.h>
 
 #undef __BEGIN_DECLS
 #undef __END_DECLS
@@ -32,6 +34,7 @@ typedef struct
   size_t (*state_size) (unsigned int dimension);
   int (*init_state) (void * state, unsigned int dimension);
   int (*get) (void * state, unsigned int dimension, double x[]);
+  int (*skip) (void * state, unsigned int dimension, unsigned long int n); /* optional, may be NULL */
 }
 gsl_qrng_type;
 
@@ -55,6 +58,7 @@ GSL_VAR const gsl_qrng_type * gsl_qrng_niederreiter_2;
 GSL_VAR const gsl_qrng_type * gsl_qrng_sobol;
 GSL_VAR const gsl_qrng_type * gsl_qrng_halton;
 GSL_VAR const gsl_qrng_type * gsl_qrng_reversehalton;
+GSL_VAR const gsl_qrng_type * gsl_qrng_sobol_ext;
 
 
 /* Allocate and initialize a generator
@@ -93,6 +97,19 @@ size_t gsl_qrng_size (const gsl_qrng * q);
 void * gsl_qrng_state (const gsl_qrng * q);
 
 
+/* Skip the next n points of the sequence. */
+int gsl_qrng_skip (const gsl_qrng * q, unsigned long int n);
+
+
+/* Retrieve the next n vectors in sequence, stored row by row. */
+int gsl_qrng_get_array (const gsl_qrng * q, double x[], size_t n);
+
+
+/* Direction numbers and scrambling for the extended Sobol generator. */
+int gsl_qrng_sobol_ext_fscanf (FILE * stream, gsl_qrng * q);
+int gsl_qrng_sobol_ext_scramble (gsl_qrng * q, const gsl_rng * r);
+
+
 /* Retrieve next vector in sequence. */
 INLINE_DECL int gsl_qrng_get (const gsl_qrng * q, double x[]);
 
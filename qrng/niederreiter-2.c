@@ -29,6 +29,7 @@
 static size_t nied2_state_size(unsigned int dimension);
 static int nied2_init(void * state, unsigned int dimension);
 static int nied2_get(void * state, unsigned int dimension, double * v);
+static int nied2_skip(void * state, unsigned int dimension, unsigned long int n);
 
 
 static const gsl_qrng_type nied2_type = 
@@ -37,7 +38,8 @@ static const gsl_qrng_type nied2_type =
   NIED2_MAX_DIMENSION,
   nied2_state_size,
   nied2_init,
-  nied2_get
+  nied2_get,
+  nied2_skip
 };
 
 const gsl_qrng_type * gsl_qrng_niederreiter_2 = &nied2_type;
@@ -351,3 +353,34 @@ static int nied2_get(void * state, unsigned int dimension, double * v)
 
   return GSL_SUCCESS;
 }
+
+
+/* After k calls the state holds the sum of the columns cj[r] for the
+ * bits r set in the Gray code k ^ (k >> 1), so the count can be
+ * advanced directly.
+ */
+static int nied2_skip(void * state, unsigned int dimension, unsigned long int n)
+{
+  nied2_state_t * n_state = (nied2_state_t *) state;
+  const unsigned long int count_max = (1UL << NIED2_BIT_COUNT) * 2 - 1;
+  unsigned long int count, gray;
+  unsigned int i_dim;
+  int r;
+
+  if(n >= count_max - n_state->sequence_count) return GSL_EINVAL;
+
+  count = n_state->sequence_count + n;
+  gray = count ^ (count >> 1);
+
+  for(i_dim=0; i_dim<dimension; i_dim++) {
+    int q = 0;
+    for(r=0; r<NIED2_NBITS; r++) {
+      if(gray & (1UL << r)) q ^= n_state->cj[r][i_dim];
+    }
+    n_state->nextq[i_dim] = q;
+  }
+
+  n_state->sequence_count = count;
+
+  return GSL_SUCCESS;
+}
@@ -21,7 +21,7 @@ gsl_qrng_alloc (const gsl_qrng_type * T, unsigned int dimension)
 
   q->dimension = dimension;
   q->state_size = T->state_size(dimension);
-  q->state = malloc (q->state_size);
+  q->state = calloc (1, q->state_size);
 
   if (q->state == 0)
     {
@@ -109,6 +109,48 @@ gsl_qrng_state (const gsl_qrng * q)
 }
 
 
+int
+gsl_qrng_skip (const gsl_qrng * q, unsigned long int n)
+{
+  if (q->type->skip == 0)
+    {
+      GSL_ERROR ("generator does not support skipping", GSL_EUNIMPL);
+    }
+  else
+    {
+      int status = (q->type->skip) (q->state, q->dimension, n);
+
+      if (status)
+        {
+          GSL_ERROR ("cannot skip beyond the end of the sequence", status);
+        }
+
+      return GSL_SUCCESS;
+    }
+}
+
+
+/* Store the next n points in the rows of the n-by-dimension array x,
+   giving the same points as repeated calls to gsl_qrng_get. */
+
+int
+gsl_qrng_get_array (const gsl_qrng * q, double x[], size_t n)
+{
+  const unsigned int d = q->dimension;
+  size_t i;
+
+  for (i = 0; i < n; i++)
+    {
+      int status = (q->type->get) (q->state, d, x + i * d);
+
+      if (status)
+        return status;
+    }
+
+  return GSL_SUCCESS;
+}
+
+
 void
 gsl_qrng_free (gsl_qrng * q)
 {
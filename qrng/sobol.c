@@ -4,8 +4,15 @@
  * See
  *   [Bratley+Fox, TOMS 14, 88 (1988)]
  *   [Antonov+Saleev, USSR Comput. Maths. Math. Phys. 19, 252 (1980)]
+ *   [Joe+Kuo, SIAM J. Sci. Comput. 30, 2635 (2008)]
+ *   [Matousek, J. Complexity 14, 527 (1998)]
  */
 #include <config.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_rng.h>
 #include <gsl/gsl_qrng.h>
 
 
@@ -19,6 +26,7 @@
 static size_t sobol_state_size(unsigned int dimension);
 static int sobol_init(void * state, unsigned int dimension);
 static int sobol_get(void * state, unsigned int dimension, double * v);
+static int sobol_skip(void * state, unsigned int dimension, unsigned long int n);
 
 /* global Sobol generator type object */
 static const gsl_qrng_type sobol_type = 
@@ -27,7 +35,8 @@ static const gsl_qrng_type sobol_type =
   SOBOL_MAX_DIMENSION,
   sobol_state_size,
   sobol_init,
-  sobol_get
+  sobol_get,
+  sobol_skip
 };
 const gsl_qrng_type * gsl_qrng_sobol = &sobol_type;
 
@@ -229,3 +238,413 @@ static int sobol_get(void * state, unsigned int dimension, double * v)
 
   return GSL_SUCCESS;
 }
+
+
+/* After k calls the numerators are the sums of the direction numbers
+ * v_direction[j] for the bits j set in the Gray code k ^ (k >> 1)
+ * [Antonov+Saleev], so the count can be advanced directly.
+ */
+static int sobol_skip(void * state, unsigned int dimension, unsigned long int n)
+{
+  sobol_state_t * s_state = (sobol_state_t *) state;
+  const unsigned long int count_max = (1UL << SOBOL_BIT_COUNT) - 1;
+  unsigned long int count, gray;
+  unsigned int i_dimension;
+  int j;
+
+  if(n >= count_max - s_state->sequence_count) return GSL_EINVAL;
+
+  count = s_state->sequence_count + n;
+  gray = count ^ (count >> 1);
+
+  for(i_dimension=0; i_dimension<dimension; i_dimension++) {
+    int numerator = 0;
+    for(j=0; j<SOBOL_BIT_COUNT; j++) {
+      if(gray & (1UL << j)) numerator ^= s_state->v_direction[j][i_dimension];
+    }
+    s_state->last_numerator_vec[i_dimension] = numerator;
+  }
+
+  s_state->sequence_count = count;
+
+  return GSL_SUCCESS;
+}
+
+
+/* Extended Sobol generator.
+ *
+ * The direction numbers have 32 bits and the state is sized for the
+ * dimension. In the first SOBOL_MAX_DIMENSION dimensions the
+ * primitive polynomials and initial direction numbers are those of
+ * the Sobol generator above, so the points agree with it. For more
+ * dimensions the direction numbers must be read from a file in the
+ * format of Joe+Kuo, and until then the generator returns an error.
+ * Direction numbers read from a file are kept when the generator is
+ * initialized again.
+ *
+ * The points are x_k = M (sum of v_j over the bits j of the Gray code
+ * of k) + e, with the bit matrix M and the shift e the identity and
+ * zero unless the generator has been scrambled. M is lower triangular
+ * with unit diagonal in the ordering of bits from the most significant,
+ * a linear matrix scrambling [Matousek], so the scrambled points are
+ * still a digital net and can be computed by the Gray code recurrence
+ * with the scrambled direction numbers.
+ */
+
+#define SOBOL_EXT_MAX_DIMENSION 21201
+#define SOBOL_EXT_BIT_COUNT 32
+
+static size_t sobol_ext_state_size(unsigned int dimension);
+static int sobol_ext_init(void * state, unsigned int dimension);
+static int sobol_ext_get(void * state, unsigned int dimension, double * v);
+static int sobol_ext_skip(void * state, unsigned int dimension, unsigned long int n);
+
+static const gsl_qrng_type sobol_ext_type = 
+{
+  "sobol-ext",
+  SOBOL_EXT_MAX_DIMENSION,
+  sobol_ext_state_size,
+  sobol_ext_init,
+  sobol_ext_get,
+  sobol_ext_skip
+};
+const gsl_qrng_type * gsl_qrng_sobol_ext = &sobol_ext_type;
+
+
+/* Extended Sobol generator state.
+ *   sequence_count = index of the next point
+ *   directions_read = whether direction numbers have been read from
+ *                     a file
+ *
+ * The header is followed by the direction numbers v[j][i] for bit j
+ * and dimension i, the numerators x[i] of the next point, the digital
+ * shift e[i] and the direction numbers v0[j][i] read from a file,
+ * before any scrambling. The state holds no pointers so that it can be
+ * copied with gsl_qrng_memcpy, and is zero when allocated.
+ */
+typedef struct
+{
+  uint32_t sequence_count;
+  int directions_read;
+} sobol_ext_state_t;
+
+#define SOBOL_EXT_V(state) \
+  ((uint32_t *) ((char *) (state) + sizeof(sobol_ext_state_t)))
+
+#define SOBOL_EXT_V0(state, dimension) \
+  (SOBOL_EXT_V(state) + (SOBOL_EXT_BIT_COUNT + 2) * (size_t) (dimension))
+
+static size_t sobol_ext_state_size(unsigned int dimension)
+{
+  return sizeof(sobol_ext_state_t)
+    + (2 * SOBOL_EXT_BIT_COUNT + 2) * (size_t) dimension * sizeof(uint32_t);
+}
+
+
+/* Fill the direction numbers of dimension i_dim from the primitive
+ * polynomial of degree s with inner coefficients a (coefficient of
+ * x^(s-1) in the highest bit) and initial direction numbers m[0..s-1].
+ */
+static void sobol_ext_directions(uint32_t * v, unsigned int dimension,
+                                 unsigned int i_dim, unsigned int s,
+                                 uint32_t a, const uint32_t * m)
+{
+  uint32_t mm[SOBOL_EXT_BIT_COUNT];
+  unsigned int j, k;
+
+  for(j=0; j<SOBOL_EXT_BIT_COUNT; j++) {
+    if(s == 0) {
+      mm[j] = 1;
+    }
+    else if(j < s) {
+      mm[j] = m[j];
+    }
+    else {
+      uint32_t newm = mm[j-s] ^ (mm[j-s] << s);
+      for(k=1; k<s; k++) {
+        if((a >> (s-1-k)) & 1) newm ^= mm[j-k] << k;
+      }
+      mm[j] = newm;
+    }
+    v[j * dimension + i_dim] = mm[j] << (SOBOL_EXT_BIT_COUNT-1-j);
+  }
+}
+
+
+static int sobol_ext_init(void * state, unsigned int dimension)
+{
+  sobol_ext_state_t * s_state = (sobol_ext_state_t *) state;
+  uint32_t * v = SOBOL_EXT_V(state);
+  uint32_t * x = v + SOBOL_EXT_BIT_COUNT * dimension;
+  uint32_t * e = x + dimension;
+  uint32_t m[SOBOL_EXT_BIT_COUNT];
+  uint32_t p;
+  unsigned int i_dim, s, k;
+
+  if(dimension < 1 || dimension > SOBOL_EXT_MAX_DIMENSION) {
+    return GSL_EINVAL;
+  }
+
+  if(s_state->directions_read) {
+    /* the direction numbers of gsl_qrng_sobol_ext_fscanf */
+    memcpy(v, SOBOL_EXT_V0(state, dimension),
+           SOBOL_EXT_BIT_COUNT * (size_t) dimension * sizeof(uint32_t));
+  }
+  else {
+    /* dimensions of the Sobol generator */
+    for(i_dim=0; i_dim<dimension && i_dim<SOBOL_MAX_DIMENSION; i_dim++) {
+      s = degree_table[i_dim];
+      for(k=0; k<s; k++) m[k] = v_init[k][i_dim];
+      p = primitive_polynomials[i_dim];
+      sobol_ext_directions(v, dimension, i_dim, s, (p >> 1) & ((1UL << s) / 2 - 1), m);
+    }
+
+    /* the remaining dimensions are set by gsl_qrng_sobol_ext_fscanf */
+    for(i_dim=SOBOL_MAX_DIMENSION; i_dim<dimension; i_dim++) {
+      for(k=0; k<SOBOL_EXT_BIT_COUNT; k++) v[k * dimension + i_dim] = 0;
+    }
+  }
+
+  /* start at the point with index 1, as the Sobol generator does */
+  for(i_dim=0; i_dim<dimension; i_dim++) {
+    e[i_dim] = 0;
+    x[i_dim] = v[i_dim];
+  }
+
+  s_state->sequence_count = 1;
+
+  return GSL_SUCCESS;
+}
+
+
+static int sobol_ext_get(void * state, unsigned int dimension, double * v)
+{
+  static const double recip = 1.0 / 4294967296.0; /* 2^(-32) */
+  sobol_ext_state_t * s_state = (sobol_ext_state_t *) state;
+  const uint32_t * vd = SOBOL_EXT_V(state);
+  uint32_t * x = SOBOL_EXT_V(state) + SOBOL_EXT_BIT_COUNT * dimension;
+  uint32_t c;
+  unsigned int i_dim;
+  int ell;
+
+  if(dimension > SOBOL_MAX_DIMENSION && !s_state->directions_read) {
+    GSL_ERROR("direction numbers must be read with gsl_qrng_sobol_ext_fscanf", GSL_EINVAL);
+  }
+
+  /* Check for exhaustion. */
+  if(s_state->sequence_count == 0xFFFFFFFFUL) return GSL_EFAILED;
+
+  /* The bit which changes in the Gray code of the next index is the
+   * least-significant set bit of the index.
+   */
+  c = ++s_state->sequence_count;
+  for(ell=0; (c & 1) == 0; ell++) c >>= 1;
+
+  vd += ell * dimension;
+
+  for(i_dim=0; i_dim<dimension; i_dim++) {
+    v[i_dim] = x[i_dim] * recip;
+    x[i_dim] ^= vd[i_dim];
+  }
+
+  return GSL_SUCCESS;
+}
+
+
+static int sobol_ext_skip(void * state, unsigned int dimension, unsigned long int n)
+{
+  sobol_ext_state_t * s_state = (sobol_ext_state_t *) state;
+  const uint32_t * vd = SOBOL_EXT_V(state);
+  uint32_t * x = SOBOL_EXT_V(state) + SOBOL_EXT_BIT_COUNT * dimension;
+  const uint32_t * e = x + dimension;
+  uint32_t count, gray;
+  unsigned int i_dim;
+  int j;
+
+  if(dimension > SOBOL_MAX_DIMENSION && !s_state->directions_read) {
+    GSL_ERROR("direction numbers must be read with gsl_qrng_sobol_ext_fscanf", GSL_EINVAL);
+  }
+
+  if(n > 0xFFFFFFFFUL - s_state->sequence_count) return GSL_EINVAL;
+
+  count = s_state->sequence_count + (uint32_t) n;
+  gray = count ^ (count >> 1);
+
+  for(i_dim=0; i_dim<dimension; i_dim++) x[i_dim] = e[i_dim];
+
+  for(j=0; j<SOBOL_EXT_BIT_COUNT; j++) {
+    if(gray & (1UL << j)) {
+      for(i_dim=0; i_dim<dimension; i_dim++) x[i_dim] ^= vd[j * dimension + i_dim];
+    }
+  }
+
+  s_state->sequence_count = count;
+
+  return GSL_SUCCESS;
+}
+
+
+/* Read direction numbers in the format of Joe+Kuo: an optional header
+ * line, followed by a line "d s a m_1 ... m_s" for each dimension
+ * d = 2, 3, ... of the generator, with the primitive polynomial of
+ * degree s and inner coefficients a, and the initial direction numbers
+ * m_k, which must be odd and less than 2^k.
+ */
+static int sobol_ext_read(FILE * stream, unsigned int dimension, uint32_t * v)
+{
+  uint32_t m[SOBOL_EXT_BIT_COUNT];
+  unsigned int i_dim, k;
+  int c;
+
+  /* skip a header line */
+  do {
+    c = getc(stream);
+  } while(c == ' ' || c == '\t' || c == '\n' || c == '\r');
+
+  if(c != EOF && (c < '0' || c > '9')) {
+    while(c != EOF && c != '\n') c = getc(stream);
+  }
+  else if(c != EOF) {
+    ungetc(c, stream);
+  }
+
+  for(i_dim=1; i_dim<dimension; i_dim++) {
+    unsigned long int d, s, a;
+
+    if(fscanf(stream, "%lu %lu %lu", &d, &s, &a) != 3) {
+      GSL_ERROR("fscanf failed", GSL_EFAILED);
+    }
+
+    if(d != i_dim + 1 || s < 1 || s >= SOBOL_EXT_BIT_COUNT || a >= (1UL << (s-1))) {
+      GSL_ERROR("invalid primitive polynomial", GSL_EINVAL);
+    }
+
+    for(k=0; k<s; k++) {
+      unsigned long int mk;
+
+      if(fscanf(stream, "%lu", &mk) != 1) {
+        GSL_ERROR("fscanf failed", GSL_EFAILED);
+      }
+
+      if((mk & 1) == 0 || mk >= (2UL << k)) {
+        GSL_ERROR("invalid initial direction number", GSL_EINVAL);
+      }
+
+      m[k] = mk;
+    }
+
+    sobol_ext_directions(v, dimension, i_dim, s, a, m);
+  }
+
+  return GSL_SUCCESS;
+}
+
+
+int
+gsl_qrng_sobol_ext_fscanf (FILE * stream, gsl_qrng * q)
+{
+  if (q->type != gsl_qrng_sobol_ext)
+    {
+      GSL_ERROR ("generator must be of type sobol-ext", GSL_EINVAL);
+    }
+  else
+    {
+      const unsigned int dimension = q->dimension;
+      sobol_ext_state_t *s_state = (sobol_ext_state_t *) q->state;
+      uint32_t *v = SOBOL_EXT_V (q->state);
+      int status;
+
+      status = sobol_ext_read (stream, dimension, v);
+
+      if (status)
+        {
+          /* restore the previous direction numbers */
+          sobol_ext_init (q->state, dimension);
+          return status;
+        }
+
+      /* the first dimension is the van der Corput sequence */
+      sobol_ext_directions (v, dimension, 0, 0, 0, NULL);
+
+      memcpy (SOBOL_EXT_V0 (q->state, dimension), v,
+              SOBOL_EXT_BIT_COUNT * (size_t) dimension * sizeof (uint32_t));
+      s_state->directions_read = 1;
+
+      return sobol_ext_init (q->state, dimension);
+    }
+}
+
+
+/* return 32 random bits */
+static uint32_t
+sobol_ext_random_bits (const gsl_rng * r)
+{
+  const uint32_t hi = gsl_rng_uniform_int (r, 65536);
+  const uint32_t lo = gsl_rng_uniform_int (r, 65536);
+
+  return (hi << 16) | lo;
+}
+
+
+/* Apply a random linear matrix scrambling and digital shift to the
+ * direction numbers, and restart the sequence at the point with index
+ * 0, which is the random shift. */
+
+int
+gsl_qrng_sobol_ext_scramble (gsl_qrng * q, const gsl_rng * r)
+{
+  if (q->type != gsl_qrng_sobol_ext)
+    {
+      GSL_ERROR ("generator must be of type sobol-ext", GSL_EINVAL);
+    }
+  else
+    {
+      const unsigned int dimension = q->dimension;
+      sobol_ext_state_t *s_state = (sobol_ext_state_t *) q->state;
+      uint32_t *v = SOBOL_EXT_V (q->state);
+      uint32_t *x = v + SOBOL_EXT_BIT_COUNT * dimension;
+      uint32_t *e = x + dimension;
+      uint32_t col[SOBOL_EXT_BIT_COUNT];
+      unsigned int i_dim;
+      int j, k;
+
+      if (dimension > SOBOL_MAX_DIMENSION && !s_state->directions_read)
+        {
+          GSL_ERROR ("direction numbers must be read with gsl_qrng_sobol_ext_fscanf",
+                     GSL_EINVAL);
+        }
+
+      for (i_dim = 0; i_dim < dimension; i_dim++)
+        {
+          /* col[k] is the column of M for bit k from the most
+             significant, with a unit diagonal and random bits below */
+          for (k = 0; k < SOBOL_EXT_BIT_COUNT; k++)
+            {
+              const uint32_t diag = 0x80000000UL >> k;
+              col[k] = diag | (sobol_ext_random_bits (r) & (diag - 1));
+            }
+
+          for (j = 0; j <= SOBOL_EXT_BIT_COUNT; j++)
+            {
+              /* scramble the direction numbers and the previous shift */
+              uint32_t *w = (j < SOBOL_EXT_BIT_COUNT) ? &v[j * dimension + i_dim] : &e[i_dim];
+              uint32_t y = 0;
+
+              for (k = 0; k < SOBOL_EXT_BIT_COUNT; k++)
+                {
+                  if (*w & (0x80000000UL >> k))
+                    y ^= col[k];
+                }
+
+              *w = y;
+            }
+
+          e[i_dim] ^= sobol_ext_random_bits (r);
+          x[i_dim] = e[i_dim];
+        }
+
+      s_state->sequence_count = 0;
+
+      return GSL_SUCCESS;
+    }
+}
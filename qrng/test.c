@@ -5,6 +5,7 @@
 #include <gsl/gsl_ieee_utils.h>
 
 #include <gsl/gsl_qrng.h>
+#include <gsl/gsl_rng.h>
 #include <gsl/gsl_test.h>
 #include <math.h>
 
@@ -233,6 +234,304 @@ void test_nied2(void)
 }
 
 
+/* compare the point after skipping n points with the point after n
+   calls to gsl_qrng_get */
+void test_skip(const gsl_qrng_type * T, unsigned int dim, unsigned long n)
+{
+  gsl_qrng * g = gsl_qrng_alloc(T, dim);
+  gsl_qrng * h = gsl_qrng_alloc(T, dim);
+  double x[40], y[40];
+  unsigned long i;
+  unsigned int j;
+  int status = 0;
+
+  for (i = 0; i < 5; i++)
+    {
+      gsl_qrng_get(g, x);
+      gsl_qrng_get(h, y);
+    }
+
+  for (i = 0; i < n; i++)
+    gsl_qrng_get(g, x);
+
+  status += gsl_qrng_skip(h, n);
+
+  gsl_qrng_get(g, x);
+  gsl_qrng_get(h, y);
+
+  for (j = 0; j < dim; j++)
+    status += (x[j] != y[j]);
+
+  gsl_test (status, "%s d=%u skip %lu", gsl_qrng_name(g), dim, n);
+
+  gsl_qrng_free(g);
+  gsl_qrng_free(h);
+}
+
+void test_sobol_ext(void)
+{
+  const unsigned int dim = 40;
+  double x[40 * 16], y[40];
+  gsl_qrng * g = gsl_qrng_alloc(gsl_qrng_sobol, dim);
+  gsl_qrng * h = gsl_qrng_alloc(gsl_qrng_sobol_ext, dim);
+  unsigned int i, j;
+  int status = 0;
+
+  /* the first 40 dimensions agree with the Sobol generator */
+  for (i = 0; i < 2000; i++)
+    {
+      gsl_qrng_get(g, x);
+      gsl_qrng_get(h, y);
+
+      for (j = 0; j < dim; j++)
+        status += (x[j] != y[j]);
+    }
+
+  gsl_test (status, "Sobol extended d=40 agrees with Sobol");
+
+  /* points from gsl_qrng_get_array */
+  status = 0;
+  gsl_qrng_init(g);
+  gsl_qrng_get_array(g, x, 16);
+  gsl_qrng_init(h);
+
+  for (i = 0; i < 16; i++)
+    {
+      gsl_qrng_get(h, y);
+
+      for (j = 0; j < dim; j++)
+        status += (x[i * dim + j] != y[j]);
+    }
+
+  gsl_test (status, "Sobol get_array");
+
+  gsl_qrng_free(g);
+  gsl_qrng_free(h);
+}
+
+/* check that each coordinate of the first 2^m points of a generator
+   takes each value floor(2^m x) once, and that the points differ from
+   those of the previous coordinate */
+int check_strata(gsl_qrng * g, unsigned int m)
+{
+  const unsigned int dim = g->dimension;
+  const unsigned int n = 1U << m;
+  double * x = malloc(n * dim * sizeof(double));
+  char * seen = malloc(n);
+  unsigned int i, j;
+  int status = 0;
+
+  gsl_qrng_get_array(g, x, n);
+
+  for (j = 0; j < dim; j++)
+    {
+      int same = 1;
+
+      for (i = 0; i < n; i++)
+        seen[i] = 0;
+
+      for (i = 0; i < n; i++)
+        {
+          const double xij = x[i * dim + j];
+          const unsigned int k = (unsigned int) (xij * n);
+
+          status += (xij < 0.0 || xij >= 1.0 || seen[k]);
+          seen[k] = 1;
+
+          if (j > 0 && xij != x[i * dim + j - 1])
+            same = 0;
+        }
+
+      if (j > 0)
+        status += same;
+    }
+
+  free(x);
+  free(seen);
+
+  return status;
+}
+
+/* write direction numbers in the format of Joe and Kuo for dimensions
+   2 to dim, with distinct polynomials of degree 18 and odd initial
+   direction numbers m_k < 2^k from an xorshift generator; these are
+   not optimized but give a valid Sobol sequence in each dimension */
+void write_directions(FILE * f, unsigned int dim)
+{
+  unsigned long int seed = 2463534242UL;
+  unsigned int d, k;
+
+  fputs("d       s       a       m_i\n", f);
+
+  for (d = 2; d <= dim; d++)
+    {
+      fprintf(f, "%u 18 %u", d, d - 2);
+
+      for (k = 0; k < 18; k++)
+        {
+          seed ^= (seed << 13) & 0xFFFFFFFFUL;
+          seed ^= seed >> 17;
+          seed ^= (seed << 5) & 0xFFFFFFFFUL;
+          fprintf(f, " %lu", (seed & ((2UL << k) - 1)) | 1);
+        }
+
+      fputc('\n', f);
+    }
+
+  rewind(f);
+}
+
+void test_sobol_ext_large(void)
+{
+  const unsigned int dim = 21201;
+  gsl_qrng * g = gsl_qrng_alloc(gsl_qrng_sobol_ext, dim);
+  gsl_qrng * h;
+  gsl_rng * r = gsl_rng_alloc(gsl_rng_default);
+  double * x = malloc(dim * sizeof(double));
+  double * y = malloc(dim * sizeof(double));
+  FILE * f = tmpfile();
+  unsigned int j;
+  int status;
+
+  /* beyond 40 dimensions the direction numbers must be read first */
+  {
+    gsl_error_handler_t * old_handler = gsl_set_error_handler_off();
+    status = (gsl_qrng_get(g, x) != GSL_EINVAL);
+    status += (gsl_qrng_skip(g, 1) != GSL_EINVAL);
+    status += (gsl_qrng_sobol_ext_scramble(g, r) != GSL_EINVAL);
+    gsl_set_error_handler(old_handler);
+  }
+
+  gsl_test (status, "Sobol extended d=%u requires direction numbers", dim);
+
+  write_directions(f, dim);
+  status = gsl_qrng_sobol_ext_fscanf(f, g);
+  h = gsl_qrng_clone(g);
+
+  /* the point with index 0 is the origin */
+  status += gsl_qrng_skip(g, 1023);
+  status += check_strata(g, 9);
+  gsl_test (status, "Sobol extended d=%u strata", dim);
+
+  gsl_qrng_sobol_ext_scramble(g, r);
+  status = check_strata(g, 10);
+  gsl_test (status, "Sobol extended d=%u scrambled strata", dim);
+
+  /* gsl_qrng_init keeps the direction numbers and removes the scrambling */
+  gsl_qrng_init(g);
+  status = gsl_qrng_get(g, x);
+  status += gsl_qrng_get(h, y);
+
+  for (j = 0; j < dim; j++)
+    status += (x[j] != y[j]);
+
+  gsl_test (status, "Sobol extended d=%u init", dim);
+
+  fclose(f);
+  free(x);
+  free(y);
+  gsl_qrng_free(g);
+  gsl_qrng_free(h);
+  gsl_rng_free(r);
+}
+
+void test_sobol_ext_scramble(void)
+{
+  const unsigned int dim = 5;
+  gsl_qrng * g = gsl_qrng_alloc(gsl_qrng_sobol_ext, dim);
+  gsl_qrng * h;
+  gsl_rng * r = gsl_rng_alloc(gsl_rng_default);
+  double x[5], y[5];
+  unsigned int i, j;
+  int status = 0;
+
+  gsl_qrng_sobol_ext_scramble(g, r);
+  h = gsl_qrng_clone(g);
+
+  /* skipping from the scrambled point with index 0 */
+  for (i = 0; i < 1000; i++)
+    gsl_qrng_get(g, x);
+
+  gsl_qrng_skip(h, 999);
+  gsl_qrng_get(h, y);
+
+  for (j = 0; j < dim; j++)
+    status += (x[j] != y[j]);
+
+  gsl_test (status, "Sobol extended scrambled skip");
+
+  /* the points with index 4096 to 8191 */
+  status = gsl_qrng_skip(h, 4096 - 1000);
+  status += check_strata(h, 12);
+  gsl_test (status, "Sobol extended scrambled strata");
+
+  gsl_qrng_free(g);
+  gsl_qrng_free(h);
+  gsl_rng_free(r);
+}
+
+void test_sobol_ext_fscanf(void)
+{
+  /* the first lines of the direction numbers of Joe and Kuo */
+  static const char * data =
+    "d       s       a       m_i\n"
+    "2       1       0       1\n"
+    "3       2       1       1 3\n"
+    "4       3       1       1 3 1\n"
+    "5       3       2       1 1 1\n";
+  FILE * f = tmpfile();
+  gsl_qrng * g = gsl_qrng_alloc(gsl_qrng_sobol_ext, 5);
+  double v[5];
+  int status = 0;
+
+  fputs(data, f);
+  rewind(f);
+
+  status += gsl_qrng_sobol_ext_fscanf(f, g);
+
+  /* with m = (1, 3) and x^2 + x + 1 the third coordinates of the points
+     with index 1, 2, 3, 4 are 1/2, 1/4, 3/4, 5/8 */
+  gsl_qrng_get(g, v);
+  status += ( v[0] != 0.5 || v[1] != 0.5 || v[2] != 0.5 );
+  gsl_qrng_get(g, v);
+  status += ( v[0] != 0.75 || v[1] != 0.25 || v[2] != 0.25 );
+  gsl_qrng_get(g, v);
+  status += ( v[0] != 0.25 || v[1] != 0.75 || v[2] != 0.75 );
+  gsl_qrng_get(g, v);
+  status += ( v[0] != 0.375 || v[1] != 0.375 || v[2] != 0.625 );
+
+  gsl_test (status, "Sobol extended Joe-Kuo direction numbers");
+
+  /* the direction numbers are kept by gsl_qrng_init */
+  gsl_qrng_init(g);
+  gsl_qrng_get(g, v);
+  gsl_qrng_get(g, v);
+  gsl_qrng_get(g, v);
+  status = ( v[0] != 0.25 || v[1] != 0.75 || v[2] != 0.75 );
+  gsl_test (status, "Sobol extended Joe-Kuo direction numbers after init");
+
+  /* an even initial direction number is rejected */
+  rewind(f);
+  fputs("2 1 0 1\n3 2 1 1 2\n", f);
+  rewind(f);
+
+  {
+    gsl_error_handler_t * old_handler = gsl_set_error_handler_off();
+    status = (gsl_qrng_sobol_ext_fscanf(f, g) != GSL_EINVAL);
+    gsl_set_error_handler(old_handler);
+  }
+
+  /* and the previous direction numbers are restored */
+  gsl_qrng_get(g, v);
+  gsl_qrng_get(g, v);
+  status += ( v[0] != 0.75 || v[1] != 0.25 || v[2] != 0.25 );
+
+  gsl_test (status, "Sobol extended invalid direction numbers");
+
+  fclose(f);
+  gsl_qrng_free(g);
+}
+
 int main()
 {
 
@@ -242,6 +541,17 @@ int main()
 	test_halton();
 	test_reversehalton();
   test_nied2();
+  test_sobol_ext();
+  test_sobol_ext_scramble();
+  test_sobol_ext_fscanf();
+  test_sobol_ext_large();
+
+  test_skip(gsl_qrng_sobol, 40, 1000);
+  test_skip(gsl_qrng_sobol_ext, 40, 1000);
+  test_skip(gsl_qrng_sobol_ext, 40, 123456);
+  test_skip(gsl_qrng_niederreiter_2, 12, 1000);
+  test_skip(gsl_qrng_halton, 40, 1000);
+  test_skip(gsl_qrng_reversehalton, 40, 1000);
 
   exit (gsl_test_summary ());
 }
@@ -0,0 +1,174 @@
+/* randist/benchmark.c
+ *
+ * Copyright (C) 2026 Patrick Alken
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* timings of the array functions against a loop of single calls, in
+ * millions of samples per second, for the default generator (set with
+ * GSL_RNG_TYPE), of building, rebuilding and updating the tables
+ * of a discrete distribution with K = 10^6 events, and of sampling
+ * 4000 multivariate gaussian vectors of dimension 500 and estimating
+ * their variance-covariance matrix; usage: benchmark [n] */
+
+#include <config.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <gsl/gsl_rng.h>
+#include <gsl/gsl_randist.h>
+#include <gsl/gsl_blas.h>
+
+#define NBUF 4096
+#define K 1000000
+#define DIM 500
+#define NVEC 4000
+
+static double
+seconds (clock_t start)
+{
+  return (clock () - start) / (double) CLOCKS_PER_SEC;
+}
+
+int
+main (int argc, char *argv[])
+{
+  const size_t n = (argc > 1) ? (size_t) atol (argv[1]) : 50000000;
+  static double x[NBUF];
+  static unsigned int k[NBUF];
+  static size_t d[NBUF];
+  double *P = malloc (K * sizeof (double));
+  gsl_ran_discrete_t *g;
+  gsl_ran_discrete_tree_t *t;
+  gsl_matrix *L = gsl_matrix_calloc (DIM, DIM);
+  gsl_matrix *X = gsl_matrix_alloc (NVEC, DIM);
+  gsl_matrix *S = gsl_matrix_alloc (DIM, DIM);
+  gsl_vector *mu = gsl_vector_calloc (DIM);
+  const gsl_rng_type *T;
+  gsl_rng *r;
+  clock_t start;
+  double t_loop, t_array;
+  size_t i, j;
+
+  gsl_rng_env_setup ();
+  T = gsl_rng_default;
+  r = gsl_rng_alloc (T);
+
+  printf ("%s, n = %zu\n", gsl_rng_name (r), n);
+  printf ("%-28s %10s %10s\n", "", "loop", "array");
+
+#define BENCH(name, single, array)                                  \
+  do                                                                \
+    {                                                               \
+      start = clock ();                                             \
+      for (i = 0; i < n; i += NBUF)                                 \
+        for (j = 0; j < NBUF; j++)                                  \
+          single;                                                   \
+      t_loop = seconds (start);                                     \
+      start = clock ();                                             \
+      for (i = 0; i < n; i += NBUF)                                 \
+        array;                                                      \
+      t_array = seconds (start);                                    \
+      printf ("%-28s %10.1f %10.1f\n", name,                        \
+              n / t_loop / 1e6, n / t_array / 1e6);                 \
+    }                                                               \
+  while (0)
+
+  BENCH ("gaussian_ziggurat",
+         x[j] = gsl_ran_gaussian_ziggurat (r, 1.0),
+         gsl_ran_gaussian_ziggurat_array (r, NBUF, x, 1.0));
+  BENCH ("exponential",
+         x[j] = gsl_ran_exponential (r, 1.0),
+         gsl_ran_exponential_array (r, NBUF, x, 1.0));
+  BENCH ("gamma, a = 2.5",
+         x[j] = gsl_ran_gamma (r, 2.5, 1.0),
+         gsl_ran_gamma_array (r, NBUF, x, 2.5, 1.0));
+  BENCH ("gamma, a = 0.5",
+         x[j] = gsl_ran_gamma (r, 0.5, 1.0),
+         gsl_ran_gamma_array (r, NBUF, x, 0.5, 1.0));
+  BENCH ("poisson, mu = 5",
+         k[j] = gsl_ran_poisson (r, 5.0),
+         gsl_ran_poisson_array (r, NBUF, k, 5.0));
+
+  for (i = 0; i < K; i++)
+    P[i] = gsl_rng_uniform (r);
+
+  start = clock ();
+  g = gsl_ran_discrete_preproc (K, P);
+  printf ("%-28s %10.3f s\n", "discrete preproc", seconds (start));
+
+  start = clock ();
+  gsl_ran_discrete_init (g, P);
+  printf ("%-28s %10.3f s\n", "discrete init", seconds (start));
+
+  BENCH ("discrete",
+         d[j] = gsl_ran_discrete (r, g),
+         gsl_ran_discrete_array (r, NBUF, d, g));
+
+  t = gsl_ran_discrete_tree_alloc (K);
+
+  start = clock ();
+  gsl_ran_discrete_tree_init (t, P);
+  printf ("%-28s %10.3f s\n", "discrete tree init", seconds (start));
+
+  start = clock ();
+  for (i = 0; i < n; i++)
+    gsl_ran_discrete_tree_set (t, i % K, P[(7 * i) % K]);
+  t_loop = seconds (start);
+  printf ("%-28s %10.1f\n", "discrete tree set", n / t_loop / 1e6);
+
+  start = clock ();
+  for (i = 0; i < n; i++)
+    d[i % NBUF] = gsl_ran_discrete_tree (r, t);
+  t_loop = seconds (start);
+  printf ("%-28s %10.1f\n", "discrete tree", n / t_loop / 1e6);
+
+  for (i = 0; i < DIM; i++)
+    {
+      for (j = 0; j < i; j++)
+        gsl_matrix_set (L, i, j, 0.01);
+      gsl_matrix_set (L, i, i, 1.0);
+    }
+
+  start = clock ();
+  for (i = 0; i < NVEC; i++)
+    {
+      gsl_vector_view x = gsl_matrix_row (X, i);
+      gsl_ran_multivariate_gaussian (r, mu, L, &x.vector);
+    }
+  t_loop = seconds (start);
+
+  start = clock ();
+  gsl_ran_multivariate_gaussian_array (r, mu, L, X);
+  t_array = seconds (start);
+
+  printf ("%-28s %10.3f %10.3f s\n", "multivariate_gaussian", t_loop, t_array);
+
+  start = clock ();
+  gsl_ran_multivariate_gaussian_vcov (X, S);
+  printf ("%-28s %10.3f s\n", "multivariate_gaussian_vcov", seconds (start));
+
+  gsl_ran_discrete_free (g);
+  gsl_ran_discrete_tree_free (t);
+  gsl_matrix_free (L);
+  gsl_matrix_free (X);
+  gsl_matrix_free (S);
+  gsl_vector_free (mu);
+  gsl_rng_free (r);
+  free (P);
+
+  return 0;
+}
@@ -93,13 +93,17 @@
  * small, we are able to deal with it right then and there, and we
  * never have to pop more than K smalls, then the algorithm is O(K).
 
- * This implementation sets up two separate stacks, and allocates K
- * elements between them.  Since neither stack ever grows, we do an
- * extra O(K) pass through the data to determine how many smalls and
- * bigs there are to begin with and allocate appropriately.  In all
- * there are 2*K*sizeof(double) transient bytes of memory that are
- * used than returned, and K*(sizeof(int)+sizeof(double)) bytes used
- * in the lookup table.
+ * This implementation keeps the two stacks in a single workspace of
+ * K indices, the smalls growing up from the bottom and the bigs down
+ * from the top; since an index is on at most one stack at a time,
+ * they never collide.  The probabilities scaled by K are kept in the
+ * F's of the lookup table while the stacks are worked through, so
+ * no other memory is needed, and the workspace is kept with the
+ * table so that gsl_ran_discrete_init() can rebuild it for new
+ * probabilities without allocating.  The F's and A's are
+ * interleaved, so that a call to gsl_ran_discrete() reads a single
+ * entry of the table.  In all there are K*(2*sizeof(size_t) +
+ * sizeof(double)) bytes in the lookup table and workspace.
    
  * Walker spoke of using two random numbers (an integer 0..K-1, and a
  * floating point u in [0,1]), but Knuth points out that one can just
@@ -124,6 +128,11 @@
  * Note that several different randevent struct's can be
  * simultaneously active.
 
+ * When the probabilities change, the table can be rebuilt in place
+ * in O(K) steps with
+
+ *    gsl_ran_discrete_init(f,P);
+
  * Aside: A very clever alternative approach is described in
  * Abramowitz and Stegun, p 950, citing: Marsaglia, Random variables
  * and computers, Proc Third Prague Conference in Probability Theory,
@@ -152,74 +161,13 @@
                                  * in the call to gsl_ran_discrete()
                                  */
 
-/*** Begin Stack (this code is used just in this file) ***/
-
-/* Stack code converted to use unsigned indices (i.e. s->i == 0 now
-   means an empty stack, instead of -1), for consistency and to give a
-   bigger allowable range. BJG */
-
-typedef struct {
-    size_t N;                      /* max number of elts on stack */
-    size_t *v;                     /* array of values on the stack */
-    size_t i;                      /* index of top of stack */
-} gsl_stack_t;
-
-static gsl_stack_t *
-new_stack(size_t N) {
-    gsl_stack_t *s;
-    s = (gsl_stack_t *)malloc(sizeof(gsl_stack_t));
-    s->N = N;
-    s->i = 0;                  /* indicates stack is empty */
-    s->v = (size_t *)malloc(sizeof(size_t)*N);
-    return s;
-}
-
-static int
-push_stack(gsl_stack_t *s, size_t v)
-{
-    if ((s->i) >= (s->N)) {
-      return -1; /* stack overflow (shouldn't happen) */
-    }
-    (s->v)[s->i] = v;
-    s->i += 1;
-    return 0;
-}
-
-static size_t pop_stack(gsl_stack_t *s)
-{
-    if ((s->i) == 0) {
-      GSL_ERROR ("internal error - stack exhausted", GSL_ESANITY);
-    }
-    s->i -= 1;
-    return ((s->v)[s->i]);
-}
-
-static inline size_t size_stack(const gsl_stack_t *s)
-{
-    return s->i;
-}
-
-static void free_stack(gsl_stack_t *s)
-{
-    free((char *)(s->v));
-    free((char *)s);
-}
-
-/*** End Stack ***/
-
-
 /*** Begin Walker's Algorithm ***/
 
 gsl_ran_discrete_t *
 gsl_ran_discrete_preproc(size_t Kevents, const double *ProbArray)
 {
-    size_t k,b,s;
     gsl_ran_discrete_t *g;
-    size_t nBigs, nSmalls;
-    gsl_stack_t *Bigs;
-    gsl_stack_t *Smalls;
-    double *E;
-    double pTotal = 0.0, mean, d;
+    int status;
     
     if (Kevents < 1) {
       /* Could probably treat Kevents=1 as a special case */
@@ -228,100 +176,99 @@ gsl_ran_discrete_preproc(size_t Kevents, const double *ProbArray)
                         GSL_EINVAL, 0);
     }
 
-    /* Make sure elements of ProbArray[] are positive.
-     * Won't enforce that sum is unity; instead will just normalize
-     */
+    /* Begin setting up the main "object" (just a struct, no steroids) */
+    g = (gsl_ran_discrete_t *)malloc(sizeof(gsl_ran_discrete_t));
 
-    for (k=0; k<Kevents; ++k) {
-        if (ProbArray[k] < 0) {
-          GSL_ERROR_VAL ("probabilities must be non-negative",
-                            GSL_EINVAL, 0) ;
-        }
-        pTotal += ProbArray[k];
+    if (g==NULL) {
+      GSL_ERROR_VAL ("Cannot allocate memory for randevent", GSL_ENOMEM, 0);
     }
 
-    /* Begin setting up the main "object" (just a struct, no steroids) */
-    g = (gsl_ran_discrete_t *)malloc(sizeof(gsl_ran_discrete_t));
     g->K = Kevents;
-    g->F = (double *)malloc(sizeof(double)*Kevents);
-    g->A = (size_t *)malloc(sizeof(size_t)*Kevents);
-
-    E = (double *)malloc(sizeof(double)*Kevents);
+    g->T = (gsl_ran_discrete_entry_t *)malloc(sizeof(gsl_ran_discrete_entry_t)*Kevents);
+    g->work = (size_t *)malloc(sizeof(size_t)*Kevents);
 
-    if (E==NULL) {
+    if (g->T==NULL || g->work==NULL) {
+      gsl_ran_discrete_free(g);
       GSL_ERROR_VAL ("Cannot allocate memory for randevent", GSL_ENOMEM, 0);
     }
 
+    status = gsl_ran_discrete_init(g, ProbArray);
+
+    if (status) {
+      gsl_ran_discrete_free(g);
+      return 0;
+    }
+
+    return g;
+}
+
+int
+gsl_ran_discrete_init(gsl_ran_discrete_t *g, const double *ProbArray)
+{
+    const size_t Kevents = g->K;
+    gsl_ran_discrete_entry_t * const T = g->T;
+    size_t * const stack = g->work;
+    size_t k,b,s;
+    size_t nBigs, nSmalls;
+    double pTotal = 0.0, scale;
+
+    /* Make sure elements of ProbArray[] are positive.
+     * Won't enforce that sum is unity; instead will just normalize
+     */
+
     for (k=0; k<Kevents; ++k) {
-        E[k] = ProbArray[k]/pTotal;
+        if (ProbArray[k] < 0) {
+          GSL_ERROR ("probabilities must be non-negative", GSL_EINVAL);
+        }
+        pTotal += ProbArray[k];
     }
 
-    /* Now create the Bigs and the Smalls */
-    mean = 1.0/Kevents;
+    /* Store the probabilities scaled by K, so that their mean is 1,
+     * in the F's, and create the Smalls at the bottom of the
+     * workspace and the Bigs at the top.
+     */
+    scale = Kevents/pTotal;
     nSmalls=nBigs=0;
-    {
-      /* Temporarily use which[k] = g->A[k] to indicate small or large */
-      size_t * const which = g->A;
-
-      for (k=0; k<Kevents; ++k) {
-        if (E[k] < mean) { 
-          ++nSmalls; which[k] = 0;
-        } else { 
-          ++nBigs; which[k] = 1; 
+    for (k=0; k<Kevents; ++k) {
+        T[k].F = ProbArray[k]*scale;
+        T[k].A = k;
+        if (T[k].F < 1.0) {
+          stack[nSmalls++] = k;
+        } else {
+          stack[Kevents - ++nBigs] = k;
         }
-      }
-
-      Bigs   = new_stack(nBigs);
-      Smalls = new_stack(nSmalls);
-      for (k=0; k<Kevents; ++k) {
-        gsl_stack_t * Dest = which[k] ? Bigs : Smalls;
-        int status = push_stack(Dest,k);
-        if (status)
-          GSL_ERROR_VAL ("failed to build stacks", GSL_EFAILED, 0);
-      }
     }
 
     /* Now work through the smalls */
-    while (size_stack(Smalls) > 0) {
-        s = pop_stack(Smalls);
-        if (size_stack(Bigs) == 0) {
-            (g->A)[s]=s;
-            (g->F)[s]=1.0;
-            continue;
-        }
-        b = pop_stack(Bigs);
-        (g->A)[s]=b;
-        (g->F)[s]=Kevents*E[s];
+    while (nSmalls > 0 && nBigs > 0) {
+        s = stack[--nSmalls];
+        b = stack[Kevents - nBigs];
+        T[s].A = b;             /* T[s].F is final */
 #if DEBUG
-        fprintf(stderr,"s=%2d, A=%2d, F=%.4f\n",s,(g->A)[s],(g->F)[s]);
+        fprintf(stderr,"s=%2d, A=%2d, F=%.4f\n",s,T[s].A,T[s].F);
 #endif        
-        d = mean - E[s];
-        E[s] += d;              /* now E[s] == mean */
-        E[b] -= d;
-        if (E[b] < mean) {
-            push_stack(Smalls,b); /* no longer big, join ranks of the small */
-        }
-        else if (E[b] > mean) {
-            push_stack(Bigs,b); /* still big, put it back where you found it */
+        T[b].F -= 1.0 - T[s].F;
+        if (T[b].F < 1.0) {
+            /* no longer big, join ranks of the small */
+            --nBigs;
+            stack[nSmalls++] = b;
         }
-        else {
-            /* E[b]==mean implies it is finished too */
-            (g->A)[b]=b;
-            (g->F)[b]=1.0;
+        else if (T[b].F == 1.0) {
+            /* F[b]==1 implies it is finished too */
+            --nBigs;
         }
     }
-    while (size_stack(Bigs) > 0) {
-        b = pop_stack(Bigs);
-        (g->A)[b]=b;
-        (g->F)[b]=1.0;
-    }
-    /* Stacks have been emptied, and A and F have been filled */
 
-    if ( size_stack(Smalls) != 0) {
-      GSL_ERROR_VAL ("Smalls stack has not been emptied",
-                     GSL_ESANITY, 0 );
+    /* The remaining Smalls (left by rounding) and Bigs are finished */
+    while (nSmalls > 0) {
+        s = stack[--nSmalls];
+        T[s].F = 1.0;
     }
-    
+    while (nBigs > 0) {
+        b = stack[Kevents - nBigs--];
+        T[b].F = 1.0;
+    }
+
 #if 0
     /* if 1, then artificially set all F[k]'s to unity.  This will
      * give wrong answers, but you'll get them faster.  But, not
@@ -329,7 +276,7 @@ gsl_ran_discrete_preproc(size_t Kevents, const double *ProbArray)
      * on what the optimal preprocessing would give.
      */
     for (k=0; k<Kevents; ++k) {
-        (g->F)[k] = 1.0;
+        T[k].F = 1.0;
     }
 #endif
 
@@ -339,16 +286,12 @@ gsl_ran_discrete_preproc(size_t Kevents, const double *ProbArray)
      * it doesn't actually make much difference.
      */
     for (k=0; k<Kevents; ++k) {
-        (g->F)[k] += k;
-        (g->F)[k] /= Kevents;
+        T[k].F += k;
+        T[k].F /= Kevents;
     }
 #endif    
 
-    free_stack(Bigs);
-    free_stack(Smalls);
-    free((char *)E);
-
-    return g;
+    return GSL_SUCCESS;
 }
 
 size_t
@@ -364,7 +307,7 @@ gsl_ran_discrete(const gsl_rng *r, const gsl_ran_discrete_t *g)
     c = u;
     u -= c;
 #endif
-    f = (g->F)[c];
+    f = (g->T)[c].F;
     /* fprintf(stderr,"c,f,u: %d %.4f %f\n",c,f,u); */
     if (f == 1.0) return c;
 
@@ -372,15 +315,46 @@ gsl_ran_discrete(const gsl_rng *r, const gsl_ran_discrete_t *g)
         return c;
     }
     else {
-        return (g->A)[c];
+        return (g->T)[c].A;
+    }
+}
+
+#define DISCRETE_BLOCK 256
+
+void
+gsl_ran_discrete_array(const gsl_rng *r, size_t n, size_t array[],
+                       const gsl_ran_discrete_t *g)
+{
+    const gsl_ran_discrete_entry_t * const T = g->T;
+    double u[DISCRETE_BLOCK];
+    size_t i,l;
+
+    for (i=0; i<n; i+=DISCRETE_BLOCK) {
+        const size_t m = (n-i < DISCRETE_BLOCK) ? n-i : DISCRETE_BLOCK;
+        size_t *x = array + i;
+
+        gsl_rng_uniform_array(r, u, m);
+
+        for (l=0; l<m; ++l) {
+            size_t c;
+            double v = u[l];
+#if KNUTH_CONVENTION
+            c = (v*(g->K));
+#else
+            v *= g->K;
+            c = v;
+            v -= c;
+#endif
+            x[l] = (v < T[c].F) ? c : T[c].A;
+        }
     }
 }
 
 void gsl_ran_discrete_free(gsl_ran_discrete_t *g)
 {
     RETURN_IF_NULL (g);
-    free((char *)(g->A));
-    free((char *)(g->F));
+    free((char *)(g->T));
+    free((char *)(g->work));
     free((char *)g);
 }
 
@@ -392,13 +366,13 @@ gsl_ran_discrete_pdf(size_t k, const gsl_ran_discrete_t *g)
     K= g->K;
     if (k>K) return 0;
     for (i=0; i<K; ++i) {
-        f = (g->F)[i];
+        f = (g->T)[i].F;
 #if KNUTH_CONVENTION
         f = K*f-i;
 #endif        
         if (i==k) {
             p += f;
-        } else if (k == (g->A)[i]) {
+        } else if (k == (g->T)[i].A) {
             p += 1.0 - f;
         }
     }
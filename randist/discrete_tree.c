@@ -0,0 +1,239 @@
+/* randist/discrete_tree.c
+ *
+ * Copyright (C) 2026 Patrick Alken
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* Discrete distributions with weights which change between samples.
+
+   The weights are stored in a Fenwick (binary indexed) tree, in which
+   the element tree[i] of the 1-based array holds the sum of the
+   weights w[i - lowbit(i)], ..., w[i - 1], where lowbit(i) is the
+   lowest set bit of i. Changing a weight updates the O(log K) elements
+   of the tree which contain it, and a sample is drawn by descending
+   the tree to find the index k with
+
+     sum_{j<k} w[j] <= u W < sum_{j<=k} w[j]
+
+   for a uniform u and total weight W, also in O(log K) steps.
+
+   Each weight change adds the difference to the partial sums, so
+   their rounding errors accumulate over many changes;
+   gsl_ran_discrete_tree_init recomputes the tree from the weights in
+   O(K) steps.
+
+   Reference: P. M. Fenwick, "A new data structure for cumulative
+   frequency tables", Software: Practice and Experience 24, 327-336
+   (1994). */
+
+#include <config.h>
+#include <stdlib.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_rng.h>
+#include <gsl/gsl_randist.h>
+
+#define LOWBIT(i) ((i) & (~(i) + 1))
+
+gsl_ran_discrete_tree_t *
+gsl_ran_discrete_tree_alloc (size_t K)
+{
+  gsl_ran_discrete_tree_t *g;
+  size_t i;
+
+  if (K == 0)
+    {
+      GSL_ERROR_NULL ("number of events must be a positive integer", GSL_EINVAL);
+    }
+
+  g = calloc (1, sizeof (gsl_ran_discrete_tree_t));
+  if (g == 0)
+    {
+      GSL_ERROR_NULL ("failed to allocate space for tree struct", GSL_ENOMEM);
+    }
+
+  g->w = calloc (K, sizeof (double));
+  if (g->w == 0)
+    {
+      gsl_ran_discrete_tree_free (g);
+      GSL_ERROR_NULL ("failed to allocate space for weights", GSL_ENOMEM);
+    }
+
+  g->tree = calloc (K + 1, sizeof (double));
+  if (g->tree == 0)
+    {
+      gsl_ran_discrete_tree_free (g);
+      GSL_ERROR_NULL ("failed to allocate space for tree", GSL_ENOMEM);
+    }
+
+  g->K = K;
+
+  for (i = 1; 2 * i <= K; i *= 2)
+    ;
+
+  g->top = i;
+
+  return g;
+}
+
+void
+gsl_ran_discrete_tree_free (gsl_ran_discrete_tree_t * g)
+{
+  RETURN_IF_NULL (g);
+
+  if (g->w)
+    free (g->w);
+
+  if (g->tree)
+    free (g->tree);
+
+  free (g);
+}
+
+/*
+gsl_ran_discrete_tree_init()
+  Set all weights and build the tree in O(K) steps
+
+Inputs: g - tree
+        P - weights, length K
+*/
+
+int
+gsl_ran_discrete_tree_init (gsl_ran_discrete_tree_t * g, const double *P)
+{
+  const size_t K = g->K;
+  size_t i;
+
+  for (i = 0; i < K; ++i)
+    {
+      if (P[i] < 0.0)
+        {
+          GSL_ERROR ("weights must be non-negative", GSL_EINVAL);
+        }
+    }
+
+  for (i = 1; i <= K; ++i)
+    {
+      g->w[i - 1] = P[i - 1];
+      g->tree[i] = P[i - 1];
+    }
+
+  /* add each partial sum into its parent */
+  for (i = 1; i <= K; ++i)
+    {
+      const size_t j = i + LOWBIT (i);
+
+      if (j <= K)
+        g->tree[j] += g->tree[i];
+    }
+
+  return GSL_SUCCESS;
+}
+
+/*
+gsl_ran_discrete_tree_set()
+  Set the weight of event k in O(log K) steps
+
+Inputs: g - tree
+        k - event, 0 <= k < K
+        w - new weight, >= 0
+*/
+
+int
+gsl_ran_discrete_tree_set (gsl_ran_discrete_tree_t * g, const size_t k,
+                           const double w)
+{
+  if (k >= g->K)
+    {
+      GSL_ERROR ("index out of range", GSL_EINVAL);
+    }
+  else if (w < 0.0)
+    {
+      GSL_ERROR ("weights must be non-negative", GSL_EINVAL);
+    }
+  else
+    {
+      const double delta = w - g->w[k];
+      size_t i;
+
+      g->w[k] = w;
+
+      for (i = k + 1; i <= g->K; i += LOWBIT (i))
+        g->tree[i] += delta;
+
+      return GSL_SUCCESS;
+    }
+}
+
+/* return the sum of all weights */
+double
+gsl_ran_discrete_tree_sum (const gsl_ran_discrete_tree_t * g)
+{
+  double sum = 0.0;
+  size_t i;
+
+  for (i = g->K; i > 0; i -= LOWBIT (i))
+    sum += g->tree[i];
+
+  return sum;
+}
+
+size_t
+gsl_ran_discrete_tree (const gsl_rng * r, const gsl_ran_discrete_tree_t * g)
+{
+  const size_t K = g->K;
+  const double W = gsl_ran_discrete_tree_sum (g);
+
+  if (!(W > 0.0))
+    {
+      GSL_ERROR_VAL ("weights sum to zero", GSL_EINVAL, 0);
+    }
+
+  while (1)
+    {
+      double u = gsl_rng_uniform (r) * W;
+      size_t pos = 0, step;
+
+      /* find the largest pos with sum_{j<pos} w[j] <= u */
+      for (step = g->top; step > 0; step >>= 1)
+        {
+          const size_t next = pos + step;
+
+          if (next <= K && g->tree[next] <= u)
+            {
+              pos = next;
+              u -= g->tree[next];
+            }
+        }
+
+      /* rounding errors in the partial sums can give an index past the
+         end or with zero weight, in which case draw again */
+      if (pos < K && g->w[pos] > 0.0)
+        return pos;
+    }
+}
+
+double
+gsl_ran_discrete_tree_pdf (const size_t k, const gsl_ran_discrete_tree_t * g)
+{
+  if (k >= g->K)
+    {
+      return 0.0;
+    }
+  else
+    {
+      return g->w[k] / gsl_ran_discrete_tree_sum (g);
+    }
+}
@@ -227,3 +227,74 @@ gsl_ran_gamma (const gsl_rng * r, const double a, const double b)
     return b * d * v;
   }
 }
+
+/* The array version applies the Marsaglia-Tsang method to a block of
+   samples at a time, with the gaussian and uniform variates drawn by
+   gsl_ran_gaussian_ziggurat_array and gsl_rng_uniform_pos_array. The
+   candidates are computed for the whole block in a loop without
+   branches, and the few rejected ones are replaced by samples from
+   gsl_ran_gamma. */
+
+#define GAMMA_BLOCK 256
+
+void
+gsl_ran_gamma_array (const gsl_rng * r, size_t n, double array[],
+                     const double a, const double b)
+{
+  double x[GAMMA_BLOCK], u[GAMMA_BLOCK];
+  size_t i, l;
+
+  /* assume a > 0 */
+
+  if (a < 1)
+    {
+      const double ainv = 1.0 / a;
+
+      gsl_ran_gamma_array (r, n, array, 1.0 + a, b);
+
+      for (i = 0; i < n; i += GAMMA_BLOCK)
+        {
+          const size_t m = GSL_MIN (n - i, GAMMA_BLOCK);
+
+          gsl_rng_uniform_pos_array (r, u, m);
+
+          for (l = 0; l < m; l++)
+            array[i + l] *= pow (u[l], ainv);
+        }
+
+      return;
+    }
+
+  {
+    const double d = a - 1.0 / 3.0;
+    const double c = (1.0 / 3.0) / sqrt (d);
+
+    for (i = 0; i < n; i += GAMMA_BLOCK)
+      {
+        const size_t m = GSL_MIN (n - i, GAMMA_BLOCK);
+        double *y = array + i;
+
+        gsl_ran_gaussian_ziggurat_array (r, m, x, 1.0);
+        gsl_rng_uniform_pos_array (r, u, m);
+
+        for (l = 0; l < m; l++)
+          {
+            const double v = 1.0 + c * x[l];
+            y[l] = b * d * (v * v * v);
+          }
+
+        for (l = 0; l < m; l++)
+          {
+            const double x2 = x[l] * x[l];
+            const double v = 1.0 + c * x[l];
+            const double v3 = v * v * v;
+
+            if (v > 0 && (u[l] < 1 - 0.0331 * x2 * x2
+                          || log (u[l]) < 0.5 * x2 + d * (1 - v3 + log (v3))))
+              continue;
+
+            y[l] = gsl_ran_gamma (r, a, b);
+          }
+      }
+  }
+}
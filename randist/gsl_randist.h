@@ -19,6 +19,7 @@
 
 #ifndef __GSL_RANDIST_H__
 #define __GSL_RANDIST_H__
+#include <gsl/gsl_executor.h>
 #include <gsl/gsl_rng.h>
 #include <gsl/gsl_vector.h>
 #include <gsl/gsl_matrix.h>
@@ -47,6 +48,7 @@ unsigned int gsl_ran_binomial_tpe (const gsl_rng * r, double p, unsigned int n);
 double gsl_ran_binomial_pdf (const unsigned int k, const double p, const unsigned int n);
 
 double gsl_ran_exponential (const gsl_rng * r, const double mu);
+void gsl_ran_exponential_array (const gsl_rng * r, size_t n, double array[], const double mu);
 double gsl_ran_exponential_pdf (const double x, const double mu);
 
 double gsl_ran_exppow (const gsl_rng * r, const double a, const double b);
@@ -72,6 +74,7 @@ double gsl_ran_flat (const gsl_rng * r, const double a, const double b);
 double gsl_ran_flat_pdf (double x, const double a, const double b);
 
 double gsl_ran_gamma (const gsl_rng * r, const double a, const double b);
+void gsl_ran_gamma_array (const gsl_rng * r, size_t n, double array[], const double a, const double b);
 double gsl_ran_gamma_int (const gsl_rng * r, const unsigned int a);
 double gsl_ran_gamma_pdf (const double x, const double a, const double b);
 double gsl_ran_gamma_mt (const gsl_rng * r, const double a, const double b);
@@ -80,6 +83,7 @@ double gsl_ran_gamma_knuth (const gsl_rng * r, const double a, const double b);
 double gsl_ran_gaussian (const gsl_rng * r, const double sigma);
 double gsl_ran_gaussian_ratio_method (const gsl_rng * r, const double sigma);
 double gsl_ran_gaussian_ziggurat (const gsl_rng * r, const double sigma);
+void gsl_ran_gaussian_ziggurat_array (const gsl_rng * r, size_t n, double array[], const double sigma);
 double gsl_ran_gaussian_pdf (const double x, const double sigma);
 
 double gsl_ran_ugaussian (const gsl_rng * r);
@@ -96,6 +100,8 @@ void gsl_ran_bivariate_gaussian (const gsl_rng * r, double sigma_x, double sigma
 double gsl_ran_bivariate_gaussian_pdf (const double x, const double y, const double sigma_x, const double sigma_y, const double rho);
 
 int gsl_ran_multivariate_gaussian (const gsl_rng * r, const gsl_vector * mu, const gsl_matrix * L, gsl_vector * result);
+int gsl_ran_multivariate_gaussian_array (const gsl_rng * r, const gsl_vector * mu, const gsl_matrix * L, gsl_matrix * X);
+int gsl_ran_multivariate_gaussian_array_parallel (gsl_rng * r[], const size_t ntasks, const gsl_executor * exec, const gsl_vector * mu, const gsl_matrix * L, gsl_matrix * X);
 int gsl_ran_multivariate_gaussian_log_pdf (const gsl_vector * x,
                                            const gsl_vector * mu,
                                            const gsl_matrix * L,
@@ -114,6 +120,18 @@ int gsl_ran_wishart (const gsl_rng * r,
                      const gsl_matrix * L,
                      gsl_matrix * result,
                      gsl_matrix * work);
+int gsl_ran_wishart_array (const gsl_rng * r,
+                           const double df,
+                           const gsl_matrix * L,
+                           gsl_matrix * result,
+                           gsl_matrix * work);
+int gsl_ran_wishart_array_parallel (gsl_rng * r[],
+                                    const size_t ntasks,
+                                    const gsl_executor * exec,
+                                    const double df,
+                                    const gsl_matrix * L,
+                                    gsl_matrix * result,
+                                    gsl_matrix * work);
 int gsl_ran_wishart_log_pdf (const gsl_matrix * X,
                              const gsl_matrix * L_X,
                              const double df,
@@ -202,17 +220,39 @@ int gsl_ran_choose (const gsl_rng * r, void * dest, size_t k, void * src, size_t
 void gsl_ran_sample (const gsl_rng * r, void * dest, size_t k, void * src, size_t n, size_t size) ;
 
 
+typedef struct {                /* entry of the Walker lookup table */
+    double F;
+    size_t A;
+} gsl_ran_discrete_entry_t;
+
 typedef struct {                /* struct for Walker algorithm */
     size_t K;
-    size_t *A;
-    double *F;
+    gsl_ran_discrete_entry_t *T;
+    size_t *work;               /* workspace for rebuilding the table */
 } gsl_ran_discrete_t;
 
 gsl_ran_discrete_t * gsl_ran_discrete_preproc (size_t K, const double *P);
+int gsl_ran_discrete_init (gsl_ran_discrete_t *g, const double *P);
 void gsl_ran_discrete_free(gsl_ran_discrete_t *g);
 size_t gsl_ran_discrete (const gsl_rng *r, const gsl_ran_discrete_t *g);
+void gsl_ran_discrete_array (const gsl_rng *r, size_t n, size_t array[], const gsl_ran_discrete_t *g);
 double gsl_ran_discrete_pdf (size_t k, const gsl_ran_discrete_t *g);
 
+typedef struct {                /* struct for dynamic discrete distributions */
+    size_t K;
+    size_t top;                 /* largest power of 2 <= K */
+    double *w;                  /* weights */
+    double *tree;               /* Fenwick tree of partial sums of w, tree[1..K] */
+} gsl_ran_discrete_tree_t;
+
+gsl_ran_discrete_tree_t * gsl_ran_discrete_tree_alloc (size_t K);
+void gsl_ran_discrete_tree_free (gsl_ran_discrete_tree_t *g);
+int gsl_ran_discrete_tree_init (gsl_ran_discrete_tree_t *g, const double *P);
+int gsl_ran_discrete_tree_set (gsl_ran_discrete_tree_t *g, size_t k, double w);
+double gsl_ran_discrete_tree_sum (const gsl_ran_discrete_tree_t *g);
+size_t gsl_ran_discrete_tree (const gsl_rng *r, const gsl_ran_discrete_tree_t *g);
+double gsl_ran_discrete_tree_pdf (size_t k, const gsl_ran_discrete_tree_t *g);
+
 
 __END_DECLS
 
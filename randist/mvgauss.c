@@ -20,6 +20,7 @@
 #include <config.h>
 #include <math.h>
 #include <gsl/gsl_math.h>
+#include <gsl/gsl_executor.h>
 #include <gsl/gsl_rng.h>
 #include <gsl/gsl_randist.h>
 #include <gsl/gsl_vector.h>
@@ -28,8 +29,11 @@
 #include <gsl/gsl_linalg.h>
 #include <gsl/gsl_statistics.h>
 
-static int multivar_vcov (const double data[], size_t d, size_t tda, size_t n,
-                          double vcov[], size_t tda2);
+/* number of rows of the blocks in the computation of vcov */
+#define MULTIVAR_BLOCK 64
+
+static void multivar_mean (const gsl_matrix * X, gsl_vector * mu);
+static int multivar_vcov (const gsl_matrix * X, gsl_matrix * vcov);
 
 /* Generate a random vector from a multivariate Gaussian distribution using
  * the Cholesky decomposition of the variance-covariance matrix, following
@@ -75,6 +79,145 @@ gsl_ran_multivariate_gaussian (const gsl_rng * r,
     }
 }
 
+/* Generate a block of random vectors from a multivariate Gaussian
+ * distribution. The standard normal variates for all the vectors are
+ * drawn first, in the same order as repeated calls to
+ * gsl_ran_multivariate_gaussian, and the Cholesky factor is then
+ * applied to the whole block with a single matrix-matrix product.
+ *
+ * mu      mean vector (dimension d)
+ * L       matrix resulting from the Cholesky decomposition of
+ *         variance-covariance matrix Sigma = L L^T (dimension d x d)
+ * X       output matrix, one random vector per row (dimension n x d)
+ */
+int
+gsl_ran_multivariate_gaussian_array (const gsl_rng * r,
+                                     const gsl_vector * mu,
+                                     const gsl_matrix * L,
+                                     gsl_matrix * X)
+{
+  const size_t M = L->size1;
+  const size_t N = L->size2;
+
+  if (M != N)
+    {
+      GSL_ERROR("requires square matrix", GSL_ENOTSQR);
+    }
+  else if (mu->size != M)
+    {
+      GSL_ERROR("incompatible dimension of mean vector with variance-covariance matrix", GSL_EBADLEN);
+    }
+  else if (X->size2 != M)
+    {
+      GSL_ERROR("incompatible dimension of result matrix", GSL_EBADLEN);
+    }
+  else
+    {
+      const size_t n = X->size1;
+      size_t i, j;
+
+      for (i = 0; i < n; ++i)
+        {
+          double *xi = gsl_matrix_ptr(X, i, 0);
+
+          for (j = 0; j < M; ++j)
+            xi[j] = gsl_ran_ugaussian(r);
+        }
+
+      /* compute: X = Z L^T, so that row i is L z_i */
+      gsl_blas_dtrmm(CblasRight, CblasLower, CblasTrans, CblasNonUnit, 1.0,
+                     L, X);
+
+      for (i = 0; i < n; ++i)
+        {
+          gsl_vector_view xi = gsl_matrix_row(X, i);
+          gsl_vector_add(&xi.vector, mu);
+        }
+
+      return GSL_SUCCESS;
+    }
+}
+
+typedef struct
+{
+  gsl_rng **r;
+  size_t ntasks;
+  const gsl_vector *mu;
+  const gsl_matrix *L;
+  gsl_matrix *X;
+} multivar_array_workspace;
+
+/* draw the block of rows of task t with the generator r[t] */
+static void
+multivar_array_task (size_t t, void *vw)
+{
+  multivar_array_workspace *w = (multivar_array_workspace *) vw;
+  const size_t n = w->X->size1;
+  const size_t i0 = gsl_executor_block(n, w->ntasks, t);
+  const size_t i1 = gsl_executor_block(n, w->ntasks, t + 1);
+
+  if (i1 > i0)
+    {
+      gsl_matrix_view Xt = gsl_matrix_submatrix(w->X, i0, 0, i1 - i0, w->X->size2);
+      gsl_ran_multivariate_gaussian_array(w->r[t], w->mu, w->L, &Xt.matrix);
+    }
+}
+
+/* Generate a block of random vectors from a multivariate Gaussian
+ * distribution with ntasks tasks run by exec. The rows of X are split
+ * into ntasks contiguous blocks, and block t is filled by
+ * gsl_ran_multivariate_gaussian_array with the generator r[t], so the
+ * result does not depend on the order in which the tasks are run.
+ *
+ * r       generators, one for each task
+ * mu      mean vector (dimension d)
+ * L       matrix resulting from the Cholesky decomposition of
+ *         variance-covariance matrix Sigma = L L^T (dimension d x d)
+ * X       output matrix, one random vector per row (dimension n x d)
+ */
+int
+gsl_ran_multivariate_gaussian_array_parallel (gsl_rng * r[],
+                                              const size_t ntasks,
+                                              const gsl_executor * exec,
+                                              const gsl_vector * mu,
+                                              const gsl_matrix * L,
+                                              gsl_matrix * X)
+{
+  const size_t M = L->size1;
+  const size_t N = L->size2;
+
+  if (ntasks == 0)
+    {
+      GSL_ERROR("number of tasks must be positive", GSL_EINVAL);
+    }
+  else if (M != N)
+    {
+      GSL_ERROR("requires square matrix", GSL_ENOTSQR);
+    }
+  else if (mu->size != M)
+    {
+      GSL_ERROR("incompatible dimension of mean vector with variance-covariance matrix", GSL_EBADLEN);
+    }
+  else if (X->size2 != M)
+    {
+      GSL_ERROR("incompatible dimension of result matrix", GSL_EBADLEN);
+    }
+  else
+    {
+      multivar_array_workspace w;
+
+      w.r = r;
+      w.ntasks = ntasks;
+      w.mu = mu;
+      w.L = L;
+      w.X = X;
+
+      gsl_executor_run(exec, ntasks, &multivar_array_task, &w);
+
+      return GSL_SUCCESS;
+    }
+}
+
 /* Compute the log of the probability density function at a given quantile
  * vector for a multivariate Gaussian distribution using the Cholesky
  * decomposition of the variance-covariance matrix.
@@ -172,7 +315,6 @@ gsl_ran_multivariate_gaussian_pdf (const gsl_vector * x,
 int
 gsl_ran_multivariate_gaussian_mean (const gsl_matrix * X, gsl_vector * mu_hat)
 {
-  const size_t M = X->size1;
   const size_t N = X->size2;
 
   if (N != mu_hat->size)
@@ -181,15 +323,7 @@ gsl_ran_multivariate_gaussian_mean (const gsl_matrix * X, gsl_vector * mu_hat)
     }
   else
     {
-      size_t j;
-
-      for (j = 0; j < N; ++j)
-        {
-          gsl_vector_const_view c = gsl_matrix_const_column(X, j);
-          double mean = gsl_stats_mean(c.vector.data, c.vector.stride, M);
-          gsl_vector_set(mu_hat, j, mean);
-        }
-
+      multivar_mean (X, mu_hat);
       return GSL_SUCCESS;
     }
 }
@@ -200,7 +334,6 @@ gsl_ran_multivariate_gaussian_mean (const gsl_matrix * X, gsl_vector * mu_hat)
 int
 gsl_ran_multivariate_gaussian_vcov (const gsl_matrix * X, gsl_matrix * sigma_hat)
 {
-  const size_t M = X->size1;
   const size_t N = X->size2;
 
   if (sigma_hat->size1 != sigma_hat->size2)
@@ -213,30 +346,106 @@ gsl_ran_multivariate_gaussian_vcov (const gsl_matrix * X, gsl_matrix * sigma_hat
     }
   else
     {
-      return multivar_vcov (X->data, N, X->tda, M, sigma_hat->data, sigma_hat->tda);
+      return multivar_vcov (X, sigma_hat);
+    }
+}
+
+/* Compute the mean of the rows of X. The rows are added in turn to
+ * the running mean, with the same recurrence as gsl_stats_mean, so that
+ * X is read once in order of storage rather than by columns.
+ */
+static void
+multivar_mean (const gsl_matrix * X, gsl_vector * mu)
+{
+  const size_t M = X->size1;
+  const size_t N = X->size2;
+  const size_t stride = mu->stride;
+  double *m = mu->data;
+  size_t i, j;
+
+  gsl_vector_set_zero(mu);
+
+  for (i = 0; i < M; ++i)
+    {
+      const double *xi = gsl_matrix_const_ptr(X, i, 0);
+
+      for (j = 0; j < N; ++j)
+        m[j * stride] += (xi[j] - m[j * stride]) / (i + 1);
     }
 }
 
-/* Example from R (GPL): http://www.r-project.org/
+/* Compute the sample variance-covariance matrix of the rows of X with
+ * two passes: the mean is computed first, and then the sum of the outer
+ * products of the centered rows is accumulated over blocks of
+ * MULTIVAR_BLOCK rows with symmetric rank-k updates.
+ *
+ * Example from R (GPL): http://www.r-project.org/
  * (samples <- matrix(c(4.348817, 2.995049, -3.793431, 4.711934, 1.190864, -1.357363), nrow=3, ncol=2))
  * cov(samples) # 19.03539 11.91384 \n 11.91384  9.28796
  */
 static int
-multivar_vcov (const double data[], size_t d, size_t tda, size_t n,
-               double vcov[], size_t tda2)
+multivar_vcov (const gsl_matrix * X, gsl_matrix * vcov)
 {
-  size_t j1 = 0, j2 = 0;
+  const size_t M = X->size1;
+  const size_t N = X->size2;
+  const size_t nblock = GSL_MIN(M, MULTIVAR_BLOCK);
+  gsl_vector * mu;
+  gsl_matrix * work;
+  size_t i, j;
 
-  for (j1 = 0; j1 < d; ++j1)
+  if (M < 2)
     {
-      vcov[j1 * tda2 + j1] = gsl_stats_variance(&(data[j1]), tda, n);
-      for (j2 = j1 + 1; j2 < d; ++j2)
+      GSL_ERROR("at least two samples are required", GSL_EINVAL);
+    }
+
+  mu = gsl_vector_alloc(N);
+  work = gsl_matrix_alloc(nblock, N);
+
+  if (mu == NULL || work == NULL)
+    {
+      if (mu)
+        gsl_vector_free(mu);
+      if (work)
+        gsl_matrix_free(work);
+
+      GSL_ERROR("failed to allocate workspace", GSL_ENOMEM);
+    }
+
+  multivar_mean(X, mu);
+
+  gsl_matrix_set_zero(vcov);
+
+  for (i = 0; i < M; i += nblock)
+    {
+      const size_t m = GSL_MIN(nblock, M - i);
+      gsl_matrix_const_view Xb = gsl_matrix_const_submatrix(X, i, 0, m, N);
+      gsl_matrix_view Wb = gsl_matrix_submatrix(work, 0, 0, m, N);
+
+      /* center the rows of the block */
+      gsl_matrix_memcpy(&Wb.matrix, &Xb.matrix);
+      for (j = 0; j < m; ++j)
+        {
+          gsl_vector_view wj = gsl_matrix_row(&Wb.matrix, j);
+          gsl_vector_sub(&wj.vector, mu);
+        }
+
+      /* vcov += W^T W */
+      gsl_blas_dsyrk(CblasUpper, CblasTrans, 1.0, &Wb.matrix, 1.0, vcov);
+    }
+
+  /* scale and copy the upper triangle to the lower */
+  for (i = 0; i < N; ++i)
+    {
+      for (j = i; j < N; ++j)
         {
-          vcov[j1 * tda2 + j2] = gsl_stats_covariance(&(data[j1]), tda,
-                                                      &(data[j2]), tda, n);
-          vcov[j2 * tda2 + j1] = vcov[j1 * tda2 + j2];
+          double vij = gsl_matrix_get(vcov, i, j) / (M - 1.0);
+          gsl_matrix_set(vcov, i, j, vij);
+          gsl_matrix_set(vcov, j, i, vij);
         }
-      }
-  
+    }
+
+  gsl_vector_free(mu);
+  gsl_matrix_free(work);
+
   return GSL_SUCCESS;
 }
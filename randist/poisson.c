@@ -19,6 +19,7 @@
 
 #include <config.h>
 #include <math.h>
+#include <gsl/gsl_math.h>
 #include <gsl/gsl_sf_gamma.h>
 #include <gsl/gsl_rng.h>
 #include <gsl/gsl_randist.h>
@@ -68,18 +69,63 @@ gsl_ran_poisson (const gsl_rng * r, double mu)
 
 }
 
+/* For mu <= 10 the array version samples by inversion, with one
+   uniform variate per sample drawn by gsl_rng_uniform_array and a
+   table of the cumulative distribution computed once for the whole
+   array. The table covers the distribution to within the rounding
+   error of the uniform variates, and the rare variates beyond its
+   last entry use gsl_ran_poisson. Larger values of mu use
+   gsl_ran_poisson for each sample. */
+
+#define POISSON_TABLE 64
+#define POISSON_BLOCK 256
+
 void
 gsl_ran_poisson_array (const gsl_rng * r, size_t n, unsigned int array[],
                        double mu)
 {
-  size_t i;
+  double cdf[POISSON_TABLE], u[POISSON_BLOCK];
+  size_t i, l;
 
-  for (i = 0; i < n; i++)
+  if (mu > 10)
     {
-      array[i] = gsl_ran_poisson (r, mu);
+      for (i = 0; i < n; i++)
+        {
+          array[i] = gsl_ran_poisson (r, mu);
+        }
+
+      return;
     }
 
-  return;
+  {
+    double p = exp (-mu);
+    unsigned int k;
+
+    cdf[0] = p;
+
+    for (k = 1; k < POISSON_TABLE; k++)
+      {
+        p *= mu / k;
+        cdf[k] = cdf[k - 1] + p;
+      }
+  }
+
+  for (i = 0; i < n; i += POISSON_BLOCK)
+    {
+      const size_t m = GSL_MIN (n - i, POISSON_BLOCK);
+
+      gsl_rng_uniform_array (r, u, m);
+
+      for (l = 0; l < m; l++)
+        {
+          unsigned int k = 0;
+
+          while (k < POISSON_TABLE && u[l] >= cdf[k])
+            k++;
+
+          array[i + l] = (k < POISSON_TABLE) ? k : gsl_ran_poisson (r, mu);
+        }
+    }
 }
 
 double
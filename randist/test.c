@@ -36,6 +36,10 @@
 
 #define N 100000
 
+/* Size of the arrays filled by the array functions under test, not a
+   multiple of their internal block size */
+#define NARRAY 1000
+
 /* Convient test dimension for multivariant distributions */
 #define MULTI_DIM 10
 
@@ -92,10 +96,19 @@ double test_discrete2 (void);
 double test_discrete2_pdf (unsigned int n);
 double test_discrete3 (void);
 double test_discrete3_pdf (unsigned int n);
+double test_discrete_init (void);
+double test_discrete_init_pdf (unsigned int n);
+double test_discrete_array (void);
+double test_discrete_array_pdf (unsigned int n);
+double test_discrete_tree (void);
+double test_discrete_tree_pdf (unsigned int n);
+void test_discrete_tables (void);
 double test_erlang (void);
 double test_erlang_pdf (double x);
 double test_exponential (void);
 double test_exponential_pdf (double x);
+double test_exponential_array (void);
+double test_exponential_array_pdf (double x);
 double test_exppow0 (void);
 double test_exppow0_pdf (double x);
 double test_exppow1 (void);
@@ -126,6 +139,10 @@ double test_gamma_vlarge (void);
 double test_gamma_vlarge_pdf (double x);
 double test_gamma_small (void);
 double test_gamma_small_pdf (double x);
+double test_gamma_array (void);
+double test_gamma_array_pdf (double x);
+double test_gamma_small_array (void);
+double test_gamma_small_array_pdf (double x);
 double test_gamma_mt (void);
 double test_gamma_mt_pdf (double x);
 double test_gamma_mt1 (void);
@@ -144,6 +161,8 @@ double test_gaussian_ratio_method (void);
 double test_gaussian_ratio_method_pdf (double x);
 double test_gaussian_ziggurat (void);
 double test_gaussian_ziggurat_pdf (double x);
+double test_gaussian_ziggurat_array (void);
+double test_gaussian_ziggurat_array_pdf (double x);
 double test_gaussian_tail (void);
 double test_gaussian_tail_pdf (double x);
 double test_gaussian_tail1 (void);
@@ -170,6 +189,30 @@ void test_multivariate_gaussian (void);
 void test_wishart_log_pdf (void);
 void test_wishart_pdf (void);
 void test_wishart (void);
+void test_multivariate_gaussian_array (void);
+void test_wishart_array (void);
+
+#define NTASKS 3
+
+/* An executor which runs the tasks in reverse order, to check that
+   the results of the parallel functions do not depend on the order in
+   which the tasks are run */
+
+static void
+reverse_run (size_t ntasks, void (*task) (size_t i, void * data),
+             void * data, void * params)
+{
+  size_t i;
+
+  (void) params;
+
+  for (i = ntasks; i-- > 0;)
+    {
+      task (i, data);
+    }
+}
+
+static const gsl_executor reverse_exec = { &reverse_run, 0 };
 double test_gumbel1 (void);
 double test_gumbel1_pdf (double x);
 double test_gumbel2 (void);
@@ -233,6 +276,10 @@ double test_poisson (void);
 double test_poisson_pdf (unsigned int x);
 double test_poisson_large (void);
 double test_poisson_large_pdf (unsigned int x);
+double test_poisson_array (void);
+double test_poisson_array_pdf (unsigned int x);
+double test_poisson_array_large (void);
+double test_poisson_array_large_pdf (unsigned int x);
 double test_dir2d (void);
 double test_dir2d_pdf (double x);
 double test_dir2d_trig_method (void);
@@ -263,6 +310,8 @@ gsl_rng *r_global;
 static gsl_ran_discrete_t *g1 = NULL;
 static gsl_ran_discrete_t *g2 = NULL;
 static gsl_ran_discrete_t *g3 = NULL;
+static gsl_ran_discrete_t *g4 = NULL;
+static gsl_ran_discrete_tree_t *gt = NULL;
 
 int
 main (void)
@@ -412,10 +461,27 @@ main (void)
   testDiscretePDF (FUNC2 (negative_binomial));
   testDiscretePDF (FUNC2 (pascal));
 
+  testPDF (FUNC2 (exponential_array));
+  testPDF (FUNC2 (gamma_array));
+  testPDF (FUNC2 (gamma_small_array));
+  testPDF (FUNC2 (gaussian_ziggurat_array));
+  testDiscretePDF (FUNC2 (poisson_array));
+  testDiscretePDF (FUNC2 (poisson_array_large));
+
+  test_discrete_tables ();
+  testDiscretePDF (FUNC2 (discrete_init));
+  testDiscretePDF (FUNC2 (discrete_array));
+  testDiscretePDF (FUNC2 (discrete_tree));
+
+  test_multivariate_gaussian_array ();
+  test_wishart_array ();
+
   gsl_rng_free (r_global);
   gsl_ran_discrete_free (g1);
   gsl_ran_discrete_free (g2);
   gsl_ran_discrete_free (g3);
+  gsl_ran_discrete_free (g4);
+  gsl_ran_discrete_tree_free (gt);
 
   exit (gsl_test_summary ());
 }
@@ -1217,6 +1283,168 @@ test_discrete3_pdf (unsigned int n)
   return gsl_ran_discrete_pdf ((size_t) n, g3);
 }
 
+/* probabilities of the tests of the rebuilt and dynamic tables */
+static const double P_discrete[10] = { 1, 9, 3, 4, 5, 8, 6, 7, 2, 0 };
+
+double
+test_discrete_init (void)
+{
+  if (g4 == NULL)
+    {
+      /* build a uniform table and rebuild it in place */
+      double P[10];
+      size_t i;
+      for (i = 0; i < 10; ++i)
+        P[i] = 1.0;
+      g4 = gsl_ran_discrete_preproc (10, P);
+      gsl_ran_discrete_init (g4, P_discrete);
+    }
+  return gsl_ran_discrete (r_global, g4);
+}
+
+double
+test_discrete_init_pdf (unsigned int n)
+{
+  return (n < 10) ? P_discrete[n] / 45.0 : 0.0;
+}
+
+double
+test_discrete_array (void)
+{
+  static size_t k[NARRAY];
+  static size_t i = NARRAY;
+
+  if (i == NARRAY)
+    {
+      gsl_ran_discrete_array (r_global, NARRAY, k, g4);
+      i = 0;
+    }
+
+  return k[i++];
+}
+
+double
+test_discrete_array_pdf (unsigned int n)
+{
+  return (n < 10) ? P_discrete[n] / 45.0 : 0.0;
+}
+
+double
+test_discrete_tree (void)
+{
+  if (gt == NULL)
+    {
+      /* start from uniform weights and change them one at a time */
+      double P[10];
+      size_t i;
+      for (i = 0; i < 10; ++i)
+        P[i] = 1.0;
+      gt = gsl_ran_discrete_tree_alloc (10);
+      gsl_ran_discrete_tree_init (gt, P);
+      gsl_ran_discrete_tree_set (gt, 3, 100.0);
+      for (i = 0; i < 10; ++i)
+        gsl_ran_discrete_tree_set (gt, i, P_discrete[i]);
+    }
+  return gsl_ran_discrete_tree (r_global, gt);
+}
+
+double
+test_discrete_tree_pdf (unsigned int n)
+{
+  return (n < 10) ? P_discrete[n] / 45.0 : 0.0;
+}
+
+/* check the tables against the probabilities for a large number of
+   events, after building, rebuilding and updating them */
+void
+test_discrete_tables (void)
+{
+  const size_t K = 1000;
+  double *P = malloc (K * sizeof (double));
+  size_t *k1 = malloc (N * sizeof (size_t));
+  size_t *k2 = malloc (N * sizeof (size_t));
+  gsl_rng *r1 = gsl_rng_clone (r_global);
+  gsl_rng *r2 = gsl_rng_clone (r_global);
+  gsl_ran_discrete_t *g;
+  gsl_ran_discrete_tree_t *t;
+  double sum, err;
+  size_t i, j;
+  int status;
+
+  for (j = 0; j < 2; ++j)
+    {
+      sum = 0.0;
+      for (i = 0; i < K; ++i)
+        {
+          double u = gsl_rng_uniform (r_global);
+          P[i] = (u < 0.1) ? 0.0 : u;
+          sum += P[i];
+        }
+
+      if (j == 0)
+        g = gsl_ran_discrete_preproc (K, P);
+      else
+        gsl_ran_discrete_init (g, P);
+
+      err = 0.0;
+      for (i = 0; i < K; ++i)
+        err = GSL_MAX (err, fabs (gsl_ran_discrete_pdf (i, g) - P[i] / sum));
+
+      gsl_test (err > 1e-14, "test gsl_ran_discrete_%s, K=%zu, max error %g",
+                (j == 0) ? "preproc" : "init", K, err);
+    }
+
+  for (i = 0; i < N; ++i)
+    k1[i] = gsl_ran_discrete (r1, g);
+
+  gsl_ran_discrete_array (r2, N, k2, g);
+
+  status = 0;
+  for (i = 0; i < N; ++i)
+    status |= (k1[i] != k2[i]);
+
+  gsl_test (status, "test gsl_ran_discrete_array, same sequence as gsl_ran_discrete");
+
+  t = gsl_ran_discrete_tree_alloc (K);
+  gsl_ran_discrete_tree_init (t, P);
+
+  for (i = 0; i < 10 * K; ++i)
+    {
+      size_t m = gsl_rng_uniform_int (r_global, K);
+      double u = gsl_rng_uniform (r_global);
+      sum += u - P[m];
+      P[m] = u;
+      gsl_ran_discrete_tree_set (t, m, u);
+    }
+
+  err = 0.0;
+  for (i = 0; i < K; ++i)
+    err = GSL_MAX (err, fabs (gsl_ran_discrete_tree_pdf (i, t) - P[i] / sum));
+
+  gsl_test (err > 1e-14, "test gsl_ran_discrete_tree_set, K=%zu, max error %g",
+            K, err);
+
+  {
+    gsl_error_handler_t *old_handler = gsl_set_error_handler_off ();
+
+    status = gsl_ran_discrete_tree_set (t, K, 1.0) != GSL_EINVAL;
+    gsl_test (status, "test gsl_ran_discrete_tree_set, index out of range");
+
+    status = gsl_ran_discrete_tree_set (t, 0, -1.0) != GSL_EINVAL;
+    gsl_test (status, "test gsl_ran_discrete_tree_set, negative weight");
+
+    gsl_set_error_handler (old_handler);
+  }
+
+  gsl_ran_discrete_free (g);
+  gsl_ran_discrete_tree_free (t);
+  gsl_rng_free (r1);
+  gsl_rng_free (r2);
+  free (P);
+  free (k1);
+  free (k2);
+}
+
 
 double
 test_erlang (void)
@@ -1242,6 +1470,27 @@ test_exponential_pdf (double x)
   return gsl_ran_exponential_pdf (x, 2.0);
 }
 
+double
+test_exponential_array (void)
+{
+  static double x[NARRAY];
+  static size_t i = NARRAY;
+
+  if (i == NARRAY)
+    {
+      gsl_ran_exponential_array (r_global, NARRAY, x, 2.0);
+      i = 0;
+    }
+
+  return x[i++];
+}
+
+double
+test_exponential_array_pdf (double x)
+{
+  return gsl_ran_exponential_pdf (x, 2.0);
+}
+
 double
 test_exppow0 (void)
 {
@@ -1415,6 +1664,48 @@ test_gamma_small_pdf (double x)
   return gsl_ran_gamma_pdf (x, 0.92, 2.17);
 }
 
+double
+test_gamma_array (void)
+{
+  static double x[NARRAY];
+  static size_t i = NARRAY;
+
+  if (i == NARRAY)
+    {
+      gsl_ran_gamma_array (r_global, NARRAY, x, 2.5, 2.17);
+      i = 0;
+    }
+
+  return x[i++];
+}
+
+double
+test_gamma_array_pdf (double x)
+{
+  return gsl_ran_gamma_pdf (x, 2.5, 2.17);
+}
+
+double
+test_gamma_small_array (void)
+{
+  static double x[NARRAY];
+  static size_t i = NARRAY;
+
+  if (i == NARRAY)
+    {
+      gsl_ran_gamma_array (r_global, NARRAY, x, 0.92, 2.17);
+      i = 0;
+    }
+
+  return x[i++];
+}
+
+double
+test_gamma_small_array_pdf (double x)
+{
+  return gsl_ran_gamma_pdf (x, 0.92, 2.17);
+}
+
 double
 test_gamma_vlarge (void)
 {
@@ -1553,6 +1844,27 @@ test_gaussian_ziggurat_pdf (double x)
   return gsl_ran_gaussian_pdf (x, 3.12);
 }
 
+double
+test_gaussian_ziggurat_array (void)
+{
+  static double x[NARRAY];
+  static size_t i = NARRAY;
+
+  if (i == NARRAY)
+    {
+      gsl_ran_gaussian_ziggurat_array (r_global, NARRAY, x, 3.12);
+      i = 0;
+    }
+
+  return x[i++];
+}
+
+double
+test_gaussian_ziggurat_array_pdf (double x)
+{
+  return gsl_ran_gaussian_pdf (x, 3.12);
+}
+
 double
 test_gaussian_tail (void)
 {
@@ -2003,6 +2315,211 @@ test_wishart (void)
   gsl_vector_free(samples_wishart);
 }
 
+/* Check that the array versions of the multivariate gaussian and
+ * Wishart samplers give the same results as repeated calls to the
+ * single versions, and compare the mean and variance-covariance
+ * estimates with those of the statistics functions.
+ */
+void
+test_multivariate_gaussian_array (void)
+{
+  const size_t d = 7, n = 150;
+  gsl_rng *r1 = gsl_rng_clone (r_global);
+  gsl_rng *r2 = gsl_rng_clone (r_global);
+  gsl_rng *r3 = gsl_rng_clone (r_global);
+  gsl_vector * mu = gsl_vector_alloc(d);
+  gsl_matrix * L = gsl_matrix_alloc(d, d);
+  gsl_matrix * X1 = gsl_matrix_alloc(n, d);
+  gsl_matrix * X2 = gsl_matrix_alloc(n, d);
+  gsl_vector * mu_hat = gsl_vector_alloc(d);
+  gsl_matrix * Sigma_hat = gsl_matrix_alloc(d, d);
+  double err = 0.0;
+  size_t i, j;
+
+  /* random mean and lower triangular factor with positive diagonal */
+  gsl_matrix_set_zero(L);
+  for (i = 0; i < d; ++i)
+    {
+      gsl_vector_set(mu, i, gsl_rng_uniform(r_global) - 0.5);
+      for (j = 0; j < i; ++j)
+        gsl_matrix_set(L, i, j, gsl_rng_uniform(r_global) - 0.5);
+      gsl_matrix_set(L, i, i, 1.0 + gsl_rng_uniform(r_global));
+    }
+
+  for (i = 0; i < n; ++i)
+    {
+      gsl_vector_view x = gsl_matrix_row(X1, i);
+      gsl_ran_multivariate_gaussian(r1, mu, L, &x.vector);
+    }
+
+  gsl_ran_multivariate_gaussian_array(r2, mu, L, X2);
+
+  for (i = 0; i < n; ++i)
+    for (j = 0; j < d; ++j)
+      err = GSL_MAX(err, fabs(gsl_matrix_get(X1, i, j) - gsl_matrix_get(X2, i, j)));
+
+  gsl_test(err > 1.0e-12, "gsl_ran_multivariate_gaussian_array, max error %g", err);
+
+  /* one task gives the serial result, and block t of several tasks is
+     drawn from stream t whatever the order of the tasks */
+  {
+    gsl_rng *rp[NTASKS];
+    gsl_matrix *X3 = gsl_matrix_alloc(n, d);
+    int status = 0;
+    size_t t;
+
+    rp[0] = r3;
+    gsl_ran_multivariate_gaussian_array_parallel(rp, 1, NULL, mu, L, X1);
+
+    status |= !gsl_matrix_equal(X1, X2);
+    gsl_test(status, "gsl_ran_multivariate_gaussian_array_parallel, one task");
+
+    for (t = 0; t < NTASKS; t++)
+      rp[t] = gsl_rng_alloc_substream(gsl_rng_philox4x64, 1, t);
+
+    gsl_ran_multivariate_gaussian_array_parallel(rp, NTASKS, &reverse_exec, mu, L, X1);
+
+    status = 0;
+
+    for (t = 0; t < NTASKS; t++)
+      {
+        const size_t i0 = gsl_executor_block(n, NTASKS, t);
+        const size_t i1 = gsl_executor_block(n, NTASKS, t + 1);
+        gsl_matrix_view Xt = gsl_matrix_submatrix(X3, i0, 0, i1 - i0, d);
+
+        gsl_rng_free(rp[t]);
+        rp[t] = gsl_rng_alloc_substream(gsl_rng_philox4x64, 1, t);
+        gsl_ran_multivariate_gaussian_array(rp[t], mu, L, &Xt.matrix);
+        gsl_rng_free(rp[t]);
+      }
+
+    status |= !gsl_matrix_equal(X1, X3);
+    gsl_test(status, "gsl_ran_multivariate_gaussian_array_parallel, %d tasks", NTASKS);
+
+    gsl_matrix_free(X3);
+  }
+
+  gsl_ran_multivariate_gaussian_mean(X2, mu_hat);
+  gsl_ran_multivariate_gaussian_vcov(X2, Sigma_hat);
+
+  for (j = 0; j < d; ++j)
+    {
+      gsl_vector_view c1 = gsl_matrix_column(X2, j);
+      double mean = gsl_stats_mean(c1.vector.data, c1.vector.stride, n);
+
+      gsl_test_rel(gsl_vector_get(mu_hat, j), mean, 1.0e-14,
+                   "gsl_ran_multivariate_gaussian_mean, j=%zu", j);
+
+      for (i = 0; i < d; ++i)
+        {
+          gsl_vector_view c2 = gsl_matrix_column(X2, i);
+          double cov = gsl_stats_covariance(c1.vector.data, c1.vector.stride,
+                                            c2.vector.data, c2.vector.stride, n);
+
+          gsl_test_rel(gsl_matrix_get(Sigma_hat, i, j), cov, 1.0e-12,
+                       "gsl_ran_multivariate_gaussian_vcov, i=%zu j=%zu", i, j);
+        }
+    }
+
+  gsl_rng_free(r1);
+  gsl_rng_free(r2);
+  gsl_rng_free(r3);
+  gsl_vector_free(mu);
+  gsl_matrix_free(L);
+  gsl_matrix_free(X1);
+  gsl_matrix_free(X2);
+  gsl_vector_free(mu_hat);
+  gsl_matrix_free(Sigma_hat);
+}
+
+void
+test_wishart_array (void)
+{
+  const size_t d = 4, n = 20;
+  const double df = 6.5;
+  gsl_rng *r1 = gsl_rng_clone (r_global);
+  gsl_rng *r2 = gsl_rng_clone (r_global);
+  gsl_rng *r3 = gsl_rng_clone (r_global);
+  gsl_matrix * L = gsl_matrix_alloc(d, d);
+  gsl_matrix * X1 = gsl_matrix_alloc(d, d);
+  gsl_matrix * work1 = gsl_matrix_alloc(d, d);
+  gsl_matrix * X2 = gsl_matrix_alloc(d, n * d);
+  gsl_matrix * work2 = gsl_matrix_alloc(d, n * d);
+  double err = 0.0;
+  size_t i, j, k;
+
+  gsl_matrix_set_zero(L);
+  for (i = 0; i < d; ++i)
+    {
+      for (j = 0; j < i; ++j)
+        gsl_matrix_set(L, i, j, gsl_rng_uniform(r_global) - 0.5);
+      gsl_matrix_set(L, i, i, 1.0 + gsl_rng_uniform(r_global));
+    }
+
+  gsl_ran_wishart_array(r2, df, L, X2, work2);
+
+  for (k = 0; k < n; ++k)
+    {
+      gsl_ran_wishart(r1, df, L, X1, work1);
+
+      for (i = 0; i < d; ++i)
+        for (j = 0; j < d; ++j)
+          err = GSL_MAX(err, fabs(gsl_matrix_get(X1, i, j) -
+                                  gsl_matrix_get(X2, i, k * d + j)));
+    }
+
+  gsl_test(err > 1.0e-12, "gsl_ran_wishart_array, max error %g", err);
+
+  {
+    gsl_rng *rp[NTASKS];
+    gsl_matrix *X3 = gsl_matrix_alloc(d, n * d);
+    gsl_matrix *X4 = gsl_matrix_alloc(d, n * d);
+    int status = 0;
+    size_t t;
+
+    rp[0] = r3;
+    gsl_ran_wishart_array_parallel(rp, 1, NULL, df, L, X3, work2);
+
+    status |= !gsl_matrix_equal(X2, X3);
+    gsl_test(status, "gsl_ran_wishart_array_parallel, one task");
+
+    for (t = 0; t < NTASKS; t++)
+      rp[t] = gsl_rng_alloc_substream(gsl_rng_philox4x64, 1, t);
+
+    gsl_ran_wishart_array_parallel(rp, NTASKS, &reverse_exec, df, L, X3, work2);
+
+    status = 0;
+
+    for (t = 0; t < NTASKS; t++)
+      {
+        const size_t k0 = gsl_executor_block(n, NTASKS, t);
+        const size_t k1 = gsl_executor_block(n, NTASKS, t + 1);
+        gsl_matrix_view Xt = gsl_matrix_submatrix(X4, 0, k0 * d, d, (k1 - k0) * d);
+        gsl_matrix_view Wt = gsl_matrix_submatrix(work2, 0, k0 * d, d, (k1 - k0) * d);
+
+        gsl_rng_free(rp[t]);
+        rp[t] = gsl_rng_alloc_substream(gsl_rng_philox4x64, 1, t);
+        gsl_ran_wishart_array(rp[t], df, L, &Xt.matrix, &Wt.matrix);
+        gsl_rng_free(rp[t]);
+      }
+
+    status |= !gsl_matrix_equal(X3, X4);
+    gsl_test(status, "gsl_ran_wishart_array_parallel, %d tasks", NTASKS);
+
+    gsl_matrix_free(X3);
+    gsl_matrix_free(X4);
+  }
+
+  gsl_rng_free(r1);
+  gsl_rng_free(r2);
+  gsl_rng_free(r3);
+  gsl_matrix_free(L);
+  gsl_matrix_free(X1);
+  gsl_matrix_free(work1);
+  gsl_matrix_free(X2);
+  gsl_matrix_free(work2);
+}
+
 
 double
 test_geometric (void)
@@ -2436,6 +2953,48 @@ test_poisson_large_pdf (unsigned int n)
   return gsl_ran_poisson_pdf (n, 30.0);
 }
 
+double
+test_poisson_array (void)
+{
+  static unsigned int k[NARRAY];
+  static size_t i = NARRAY;
+
+  if (i == NARRAY)
+    {
+      gsl_ran_poisson_array (r_global, NARRAY, k, 5.0);
+      i = 0;
+    }
+
+  return k[i++];
+}
+
+double
+test_poisson_array_pdf (unsigned int n)
+{
+  return gsl_ran_poisson_pdf (n, 5.0);
+}
+
+double
+test_poisson_array_large (void)
+{
+  static unsigned int k[NARRAY];
+  static size_t i = NARRAY;
+
+  if (i == NARRAY)
+    {
+      gsl_ran_poisson_array (r_global, NARRAY, k, 30.0);
+      i = 0;
+    }
+
+  return k[i++];
+}
+
+double
+test_poisson_array_large_pdf (unsigned int n)
+{
+  return gsl_ran_poisson_pdf (n, 30.0);
+}
+
 
 double
 test_tdist1 (void)
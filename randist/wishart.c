@@ -20,6 +20,7 @@
 #include <config.h>
 #include <math.h>
 #include <gsl/gsl_math.h>
+#include <gsl/gsl_executor.h>
 #include <gsl/gsl_rng.h>
 #include <gsl/gsl_randist.h>
 #include <gsl/gsl_vector.h>
@@ -106,6 +107,176 @@ gsl_ran_wishart (const gsl_rng * r,
     }
 }
 
+/* Generate a block of n random matrices from a Wishart distribution.
+ * The Bartlett factors A_k of all the matrices are drawn first, in the
+ * same order as repeated calls to gsl_ran_wishart, and L is then
+ * applied to the whole block [A_1 ... A_n] with a single
+ * matrix-matrix product.
+ *
+ * df      degrees of freedom
+ * L       matrix resulting from the Cholesky decomposition of
+ *         the scale matrix V = L L^T (dimension d x d)
+ * result  output matrices, with the k-th matrix in columns
+ *         k*d to (k+1)*d - 1 (dimension d x n*d)
+ * work    matrix used for intermediate computations (dimension d x n*d)
+ */
+int
+gsl_ran_wishart_array (const gsl_rng * r,
+                       const double df,
+                       const gsl_matrix * L,
+                       gsl_matrix * result,
+                       gsl_matrix * work)
+{
+  if (L->size1 != L->size2)
+    {
+      GSL_ERROR("L should be a square matrix", GSL_ENOTSQR);
+    }
+  else if (result->size1 != L->size1 || result->size2 % L->size1 != 0)
+    {
+      GSL_ERROR("incompatible dimensions of result matrix", GSL_EBADLEN);
+    }
+  else if (work->size1 != result->size1 || work->size2 != result->size2)
+    {
+      GSL_ERROR("incompatible dimensions of work matrix", GSL_EBADLEN);
+    }
+  else if (df <= L->size1 - 1)
+    {
+      GSL_ERROR("incompatible degrees of freedom", GSL_EDOM);
+    }
+  else
+    {
+      const size_t d = L->size1;
+      const size_t n = result->size2 / d;
+      size_t i, j, k;
+
+      /* insure the upper parts of the A_k are zero before filling their
+         lower parts */
+      gsl_matrix_set_zero(work);
+      for (k = 0; k < n; ++k)
+        {
+          for (i = 0; i < d; ++i)
+            {
+              gsl_matrix_set(work, i, k * d + i, sqrt(gsl_ran_chisq(r, df - i)));
+
+              for (j = 0; j < i; ++j)
+                {
+                  gsl_matrix_set(work, i, k * d + j, gsl_ran_ugaussian(r));
+                }
+            }
+        }
+
+      /* compute L * [A_1 ... A_n] */
+      gsl_blas_dtrmm(CblasLeft, CblasLower, CblasNoTrans, CblasNonUnit, 1.0,
+                     L, work);
+
+      /* compute (L * A_k) * (L * A_k)^T */
+      for (k = 0; k < n; ++k)
+        {
+          gsl_matrix_view W = gsl_matrix_submatrix(work, 0, k * d, d, d);
+          gsl_matrix_view X = gsl_matrix_submatrix(result, 0, k * d, d, d);
+
+          gsl_blas_dsyrk(CblasUpper, CblasNoTrans, 1.0, &W.matrix, 0.0, &X.matrix);
+          for (i = 0; i < d; ++i)
+            {
+              for (j = 0; j < i; ++j)
+                {
+                  gsl_matrix_set(&X.matrix, i, j, gsl_matrix_get(&X.matrix, j, i));
+                }
+            }
+        }
+
+      return GSL_SUCCESS;
+    }
+}
+
+typedef struct
+{
+  gsl_rng **r;
+  size_t ntasks;
+  double df;
+  const gsl_matrix *L;
+  gsl_matrix *result;
+  gsl_matrix *work;
+} wishart_array_workspace;
+
+/* draw the block of matrices of task t with the generator r[t] */
+static void
+wishart_array_task (size_t t, void *vw)
+{
+  wishart_array_workspace *w = (wishart_array_workspace *) vw;
+  const size_t d = w->L->size1;
+  const size_t n = w->result->size2 / d;
+  const size_t k0 = gsl_executor_block(n, w->ntasks, t);
+  const size_t k1 = gsl_executor_block(n, w->ntasks, t + 1);
+
+  if (k1 > k0)
+    {
+      gsl_matrix_view R = gsl_matrix_submatrix(w->result, 0, k0 * d, d, (k1 - k0) * d);
+      gsl_matrix_view W = gsl_matrix_submatrix(w->work, 0, k0 * d, d, (k1 - k0) * d);
+      gsl_ran_wishart_array(w->r[t], w->df, w->L, &R.matrix, &W.matrix);
+    }
+}
+
+/* Generate a block of n random matrices from a Wishart distribution
+ * with ntasks tasks run by exec. The matrices are split into ntasks
+ * contiguous blocks, and block t is filled by gsl_ran_wishart_array
+ * with the generator r[t], so the result does not depend on the order
+ * in which the tasks are run.
+ *
+ * r       generators, one for each task
+ * df      degrees of freedom
+ * L       matrix resulting from the Cholesky decomposition of
+ *         the scale matrix V = L L^T (dimension d x d)
+ * result  output matrices, with the k-th matrix in columns
+ *         k*d to (k+1)*d - 1 (dimension d x n*d)
+ * work    matrix used for intermediate computations (dimension d x n*d)
+ */
+int
+gsl_ran_wishart_array_parallel (gsl_rng * r[],
+                                const size_t ntasks,
+                                const gsl_executor * exec,
+                                const double df,
+                                const gsl_matrix * L,
+                                gsl_matrix * result,
+                                gsl_matrix * work)
+{
+  if (ntasks == 0)
+    {
+      GSL_ERROR("number of tasks must be positive", GSL_EINVAL);
+    }
+  else if (L->size1 != L->size2)
+    {
+      GSL_ERROR("L should be a square matrix", GSL_ENOTSQR);
+    }
+  else if (result->size1 != L->size1 || result->size2 % L->size1 != 0)
+    {
+      GSL_ERROR("incompatible dimensions of result matrix", GSL_EBADLEN);
+    }
+  else if (work->size1 != result->size1 || work->size2 != result->size2)
+    {
+      GSL_ERROR("incompatible dimensions of work matrix", GSL_EBADLEN);
+    }
+  else if (df <= L->size1 - 1)
+    {
+      GSL_ERROR("incompatible degrees of freedom", GSL_EDOM);
+    }
+  else
+    {
+      wishart_array_workspace w;
+
+      w.r = r;
+      w.ntasks = ntasks;
+      w.df = df;
+      w.L = L;
+      w.result = result;
+      w.work = work;
+
+      gsl_executor_run(exec, ntasks, &wishart_array_task, &w);
+
+      return GSL_SUCCESS;
+    }
+}
+
 /* Compute the log of the probability density function at a given quantile
  * matrix for a Wishart distribution using the Cholesky decomposition of the
  * scale matrix.
@@ -26,6 +26,8 @@
 void benchmark (const gsl_rng_type * T);
 
 #define N  1000000
+#define NA 1000
+double buf[NA];
 int isum;
 double dsum;
 
@@ -46,6 +48,8 @@ main (void)
   benchmark(gsl_rng_minstd);
   benchmark(gsl_rng_mrg);
   benchmark(gsl_rng_mt19937);
+  benchmark(gsl_rng_philox4x32);
+  benchmark(gsl_rng_philox4x64);
   benchmark(gsl_rng_r250);
   benchmark(gsl_rng_ran0);
   benchmark(gsl_rng_ran1);
@@ -84,12 +88,15 @@ main (void)
   benchmark(gsl_rng_slatec);
   benchmark(gsl_rng_taus);
   benchmark(gsl_rng_taus113);
+  benchmark(gsl_rng_threefry4x64);
   benchmark(gsl_rng_transputer);
   benchmark(gsl_rng_tt800);
   benchmark(gsl_rng_uni);
   benchmark(gsl_rng_uni32);
   benchmark(gsl_rng_vax);
   benchmark(gsl_rng_waterman14);
+  benchmark(gsl_rng_xoshiro256pp);
+  benchmark(gsl_rng_xoshiro256ss);
   benchmark(gsl_rng_zuf);
 
   return 0;
@@ -99,8 +106,8 @@ void
 benchmark (const gsl_rng_type * T)
 {
   int start, end;
-  int i = 0, d = 0 ;
-  double t1, t2;
+  int i = 0, d = 0, a = 0 ;
+  double t1, t2, t3;
 
   gsl_rng *r = gsl_rng_alloc (T);
 
@@ -132,9 +139,28 @@ benchmark (const gsl_rng_type * T)
 
   t2 = (end - start) / (double) CLOCKS_PER_SEC;
 
+  /* doubles in blocks of NA with gsl_rng_uniform_array */
+  start = clock ();
+  do
+    {
+      int j;
+      for (j = 0; j < N; j += NA)
+        {
+          int k;
+          gsl_rng_uniform_array (r, buf, NA);
+          for (k = 0; k < NA; k++)
+            dsum += buf[k];
+        }
+
+      a += N;
+      end = clock ();
+    }
+  while (end < start + CLOCKS_PER_SEC/10);
+
+  t3 = (end - start) / (double) CLOCKS_PER_SEC;
 
-  printf ("%6.0f k ints/sec, %6.0f k doubles/sec, %s\n",
-          i / t1 / 1000.0, d / t2 / 1000.0, gsl_rng_name (r));
+  printf ("%6.0f k ints/sec, %6.0f k doubles/sec, %6.0f k array doubles/sec, %s\n",
+          i / t1 / 1000.0, d / t2 / 1000.0, a / t3 / 1000.0, gsl_rng_name (r));
 
   gsl_rng_free (r);
 }
@@ -192,6 +192,9 @@ static const gsl_rng_type cmrg_type =
  sizeof (cmrg_state_t),
  &cmrg_set,
  &cmrg_get,
- &cmrg_get_double};
+ &cmrg_get_double,
+ NULL, NULL, NULL,              /* no jumps or streams */
+ NULL, NULL                     /* no array functions */
+};
 
 const gsl_rng_type *gsl_rng_cmrg = &cmrg_type;
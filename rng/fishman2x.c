@@ -115,7 +115,9 @@ static const gsl_rng_type ran_type = {
   sizeof (ran_state_t),
   &ran_set,
   &ran_get,
-  &ran_get_double
+  &ran_get_double,
+  NULL, NULL, NULL,              /* no jumps or streams */
+  NULL, NULL                     /* no array functions */
 };
 
 const gsl_rng_type *gsl_rng_fishman2x = &ran_type;
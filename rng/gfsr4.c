@@ -155,7 +155,10 @@ static const gsl_rng_type gfsr4_type =
  sizeof (gfsr4_state_t),
  &gfsr4_set,
  &gfsr4_get,
- &gfsr4_get_double};
+ &gfsr4_get_double,
+ NULL, NULL, NULL,              /* no jumps or streams */
+ NULL, NULL                     /* no array functions */
+};
 
 const gsl_rng_type *gsl_rng_gfsr4 = &gfsr4_type;
 
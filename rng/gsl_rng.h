@@ -45,6 +45,11 @@ typedef struct
     void (*set) (void *state, unsigned long int seed);
     unsigned long int (*get) (void *state);
     double (*get_double) (void *state);
+    void (*jump) (void *state);        /* optional, may be NULL */
+    void (*long_jump) (void *state);   /* optional, may be NULL */
+    void (*set_stream) (void *state, unsigned long int seed, unsigned long int stream); /* optional */
+    void (*fill) (void *state, unsigned long int x[], size_t n);      /* optional */
+    void (*fill_double) (void *state, double x[], size_t n);          /* optional */
   }
 gsl_rng_type;
 
@@ -75,6 +80,8 @@ GSL_VAR const gsl_rng_type *gsl_rng_mrg;
 GSL_VAR const gsl_rng_type *gsl_rng_mt19937;
 GSL_VAR const gsl_rng_type *gsl_rng_mt19937_1999;
 GSL_VAR const gsl_rng_type *gsl_rng_mt19937_1998;
+GSL_VAR const gsl_rng_type *gsl_rng_philox4x32;
+GSL_VAR const gsl_rng_type *gsl_rng_philox4x64;
 GSL_VAR const gsl_rng_type *gsl_rng_r250;
 GSL_VAR const gsl_rng_type *gsl_rng_ran0;
 GSL_VAR const gsl_rng_type *gsl_rng_ran1;
@@ -114,12 +121,15 @@ GSL_VAR const gsl_rng_type *gsl_rng_slatec;
 GSL_VAR const gsl_rng_type *gsl_rng_taus;
 GSL_VAR const gsl_rng_type *gsl_rng_taus2;
 GSL_VAR const gsl_rng_type *gsl_rng_taus113;
+GSL_VAR const gsl_rng_type *gsl_rng_threefry4x64;
 GSL_VAR const gsl_rng_type *gsl_rng_transputer;
 GSL_VAR const gsl_rng_type *gsl_rng_tt800;
 GSL_VAR const gsl_rng_type *gsl_rng_uni;
 GSL_VAR const gsl_rng_type *gsl_rng_uni32;
 GSL_VAR const gsl_rng_type *gsl_rng_vax;
 GSL_VAR const gsl_rng_type *gsl_rng_waterman14;
+GSL_VAR const gsl_rng_type *gsl_rng_xoshiro256pp;
+GSL_VAR const gsl_rng_type *gsl_rng_xoshiro256ss;
 GSL_VAR const gsl_rng_type *gsl_rng_zuf;
 
 const gsl_rng_type ** gsl_rng_types_setup(void);
@@ -128,12 +138,16 @@ GSL_VAR const gsl_rng_type *gsl_rng_default;
 GSL_VAR unsigned long int gsl_rng_default_seed;
 
 gsl_rng *gsl_rng_alloc (const gsl_rng_type * T);
+gsl_rng *gsl_rng_alloc_substream (const gsl_rng_type * T, unsigned long int seed,
+                                  unsigned long int stream);
 int gsl_rng_memcpy (gsl_rng * dest, const gsl_rng * src);
 gsl_rng *gsl_rng_clone (const gsl_rng * r);
 
 void gsl_rng_free (gsl_rng * r);
 
 void gsl_rng_set (const gsl_rng * r, unsigned long int seed);
+int gsl_rng_jump (const gsl_rng * r);
+int gsl_rng_long_jump (const gsl_rng * r);
 unsigned long int gsl_rng_max (const gsl_rng * r);
 unsigned long int gsl_rng_min (const gsl_rng * r);
 const char *gsl_rng_name (const gsl_rng * r);
@@ -148,6 +162,12 @@ void gsl_rng_print_state (const gsl_rng * r);
 
 const gsl_rng_type * gsl_rng_env_setup (void);
 
+void gsl_rng_get_array (const gsl_rng * r, unsigned long int x[], const size_t n);
+void gsl_rng_uniform_array (const gsl_rng * r, double x[], const size_t n);
+void gsl_rng_uniform_pos_array (const gsl_rng * r, double x[], const size_t n);
+int gsl_rng_uniform_int_array (const gsl_rng * r, const unsigned long int n,
+                               unsigned long int x[], const size_t size);
+
 INLINE_DECL unsigned long int gsl_rng_get (const gsl_rng * r);
 INLINE_DECL double gsl_rng_uniform (const gsl_rng * r);
 INLINE_DECL double gsl_rng_uniform_pos (const gsl_rng * r);
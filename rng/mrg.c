@@ -144,6 +144,9 @@ static const gsl_rng_type mrg_type =
  sizeof (mrg_state_t),
  &mrg_set,
  &mrg_get,
- &mrg_get_double};
+ &mrg_get_double,
+ NULL, NULL, NULL,              /* no jumps or streams */
+ NULL, NULL                     /* no array functions */
+};
 
 const gsl_rng_type *gsl_rng_mrg = &mrg_type;
@@ -53,11 +53,14 @@
 
 #include <config.h>
 #include <stdlib.h>
+#include <gsl/gsl_math.h>
 #include <gsl/gsl_rng.h>
 
 static inline unsigned long int mt_get (void *vstate);
 static double mt_get_double (void *vstate);
 static void mt_set (void *state, unsigned long int s);
+static void mt_fill (void *vstate, unsigned long int x[], size_t n);
+static void mt_fill_double (void *vstate, double x[], size_t n);
 
 #define N 624   /* Period parameters */
 #define M 397
@@ -75,6 +78,43 @@ typedef struct
   }
 mt_state_t;
 
+/* regenerate the N words of the state at one time; the feedback
+   term is computed without a branch so that the loops vectorize */
+
+#define MAGIC(y) ((0UL - ((y) & 0x1UL)) & 0x9908b0dfUL)
+
+static void
+mt_generate (unsigned long int *const mt)
+{
+  int kk;
+
+  for (kk = 0; kk < N - M; kk++)
+    {
+      unsigned long y = (mt[kk] & UPPER_MASK) | (mt[kk + 1] & LOWER_MASK);
+      mt[kk] = mt[kk + M] ^ (y >> 1) ^ MAGIC(y);
+    }
+  for (; kk < N - 1; kk++)
+    {
+      unsigned long y = (mt[kk] & UPPER_MASK) | (mt[kk + 1] & LOWER_MASK);
+      mt[kk] = mt[kk + (M - N)] ^ (y >> 1) ^ MAGIC(y);
+    }
+
+  {
+    unsigned long y = (mt[N - 1] & UPPER_MASK) | (mt[0] & LOWER_MASK);
+    mt[N - 1] = mt[M - 1] ^ (y >> 1) ^ MAGIC(y);
+  }
+}
+
+/* Tempering */
+
+#define TEMPER(k) \
+  do { \
+    (k) ^= ((k) >> 11); \
+    (k) ^= ((k) << 7) & 0x9d2c5680UL; \
+    (k) ^= ((k) << 15) & 0xefc60000UL; \
+    (k) ^= ((k) >> 18); \
+  } while (0)
+
 static inline unsigned long
 mt_get (void *vstate)
 {
@@ -83,38 +123,14 @@ mt_get (void *vstate)
   unsigned long k ;
   unsigned long int *const mt = state->mt;
 
-#define MAGIC(y) (((y)&0x1) ? 0x9908b0dfUL : 0)
-
   if (state->mti >= N)
     {   /* generate N words at one time */
-      int kk;
-
-      for (kk = 0; kk < N - M; kk++)
-        {
-          unsigned long y = (mt[kk] & UPPER_MASK) | (mt[kk + 1] & LOWER_MASK);
-          mt[kk] = mt[kk + M] ^ (y >> 1) ^ MAGIC(y);
-        }
-      for (; kk < N - 1; kk++)
-        {
-          unsigned long y = (mt[kk] & UPPER_MASK) | (mt[kk + 1] & LOWER_MASK);
-          mt[kk] = mt[kk + (M - N)] ^ (y >> 1) ^ MAGIC(y);
-        }
-
-      {
-        unsigned long y = (mt[N - 1] & UPPER_MASK) | (mt[0] & LOWER_MASK);
-        mt[N - 1] = mt[M - 1] ^ (y >> 1) ^ MAGIC(y);
-      }
-
+      mt_generate (mt);
       state->mti = 0;
     }
 
-  /* Tempering */
-  
   k = mt[state->mti];
-  k ^= (k >> 11);
-  k ^= (k << 7) & 0x9d2c5680UL;
-  k ^= (k << 15) & 0xefc60000UL;
-  k ^= (k >> 18);
+  TEMPER(k);
 
   state->mti++;
 
@@ -127,6 +143,70 @@ mt_get_double (void * vstate)
   return mt_get (vstate) / 4294967296.0 ;
 }
 
+/* the array functions temper whole runs of the state at a time */
+
+static void
+mt_fill (void *vstate, unsigned long int x[], size_t n)
+{
+  mt_state_t *state = (mt_state_t *) vstate;
+  unsigned long int *const mt = state->mt;
+  size_t j = 0;
+
+  while (j < n)
+    {
+      size_t i, m;
+
+      if (state->mti >= N)
+        {
+          mt_generate (mt);
+          state->mti = 0;
+        }
+
+      m = GSL_MIN (n - j, (size_t) (N - state->mti));
+
+      for (i = 0; i < m; i++)
+        {
+          unsigned long k = mt[state->mti + i];
+          TEMPER(k);
+          x[j + i] = k;
+        }
+
+      state->mti += (int) m;
+      j += m;
+    }
+}
+
+static void
+mt_fill_double (void *vstate, double x[], size_t n)
+{
+  mt_state_t *state = (mt_state_t *) vstate;
+  unsigned long int *const mt = state->mt;
+  size_t j = 0;
+
+  while (j < n)
+    {
+      size_t i, m;
+
+      if (state->mti >= N)
+        {
+          mt_generate (mt);
+          state->mti = 0;
+        }
+
+      m = GSL_MIN (n - j, (size_t) (N - state->mti));
+
+      for (i = 0; i < m; i++)
+        {
+          unsigned long k = mt[state->mti + i];
+          TEMPER(k);
+          x[j + i] = k / 4294967296.0;
+        }
+
+      state->mti += (int) m;
+      j += m;
+    }
+}
+
 static void
 mt_set (void *vstate, unsigned long int s)
 {
@@ -211,7 +291,10 @@ static const gsl_rng_type mt_type =
  sizeof (mt_state_t),
  &mt_set,
  &mt_get,
- &mt_get_double};
+ &mt_get_double,
+ 0, 0, 0,                       /* no jumps or streams */
+ &mt_fill,
+ &mt_fill_double};
 
 static const gsl_rng_type mt_1999_type =
 {"mt19937_1999",                /* name */
@@ -220,7 +303,10 @@ static const gsl_rng_type mt_1999_type =
  sizeof (mt_state_t),
  &mt_1999_set,
  &mt_get,
- &mt_get_double};
+ &mt_get_double,
+ 0, 0, 0,
+ &mt_fill,
+ &mt_fill_double};
 
 static const gsl_rng_type mt_1998_type =
 {"mt19937_1998",                /* name */
@@ -229,7 +315,10 @@ static const gsl_rng_type mt_1998_type =
  sizeof (mt_state_t),
  &mt_1998_set,
  &mt_get,
- &mt_get_double};
+ &mt_get_double,
+ 0, 0, 0,
+ &mt_fill,
+ &mt_fill_double};
 
 const gsl_rng_type *gsl_rng_mt19937 = &mt_type;
 const gsl_rng_type *gsl_rng_mt19937_1999 = &mt_1999_type;
@@ -0,0 +1,453 @@
+/* rng/philox.c
+ *
+ * Copyright (C) 2026 Patrick Alken
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* These are the counter-based generators Philox4x32-10 and
+   Philox4x64-10. The output block for a counter c and key k is a
+   bijection of c computed by 10 rounds of
+
+     (c0, c1, c2, c3) -> (hi(M1 c2) ^ c1 ^ k0, lo(M1 c2),
+                          hi(M0 c0) ^ c3 ^ k1, lo(M0 c0))
+
+   with the key incremented by the Weyl constants (W0, W1) after each
+   round. The 4 words of each block are returned in turn, and the
+   counter is incremented when the block is exhausted.
+
+   The seed sets the key and the counter starts at zero. The low half
+   of the counter counts blocks, while the high half holds the stream
+   number set by gsl_rng_alloc_substream, so different streams with
+   the same seed never overlap. The jump functions advance the block
+   counter,
+
+     philox4x32   jump 2^32 blocks, long jump 2^48 blocks
+     philox4x64   jump 2^64 blocks, long jump 2^96 blocks
+
+   The 4x64 generator returns the upper 32 bits of each 64-bit word
+   from gsl_rng_get and 53 bits from gsl_rng_uniform.
+
+   With seed 0 the first block of each generator is the known answer
+   vector for zero counter and key.
+
+   Reference: J. K. Salmon, M. A. Moraes, R. O. Dror, D. E. Shaw,
+   "Parallel random numbers: as easy as 1, 2, 3", Proceedings of the
+   International Conference for High Performance Computing, Networking,
+   Storage and Analysis (SC11), 2011. */
+
+#include <config.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_rng.h>
+
+#define PHILOX_ROUNDS 10
+
+#define PHILOX_M4x32_0 0xD2511F53UL
+#define PHILOX_M4x32_1 0xCD9E8D57UL
+#define PHILOX_W32_0 0x9E3779B9UL
+#define PHILOX_W32_1 0xBB67AE85UL
+
+#define PHILOX_M4x64_0 0xD2E7470EE14C6C93ULL
+#define PHILOX_M4x64_1 0xCA5A826395121157ULL
+#define PHILOX_W64_0 0x9E3779B97F4A7C15ULL
+#define PHILOX_W64_1 0xBB67AE8584CAA73BULL
+
+typedef struct
+{
+  uint32_t ctr[4];
+  uint32_t key[2];
+  uint32_t out[4];
+  unsigned int i;               /* next word of out, 4 if exhausted */
+}
+philox4x32_state_t;
+
+typedef struct
+{
+  uint64_t ctr[4];
+  uint64_t key[2];
+  uint64_t out[4];
+  unsigned int i;
+}
+philox4x64_state_t;
+
+static void
+philox4x32_block (const uint32_t ctr[4], const uint32_t key[2], uint32_t out[4])
+{
+  uint32_t c0 = ctr[0], c1 = ctr[1], c2 = ctr[2], c3 = ctr[3];
+  uint32_t k0 = key[0], k1 = key[1];
+  int r;
+
+  for (r = 0; r < PHILOX_ROUNDS; r++)
+    {
+      const uint64_t p0 = (uint64_t) PHILOX_M4x32_0 * c0;
+      const uint64_t p1 = (uint64_t) PHILOX_M4x32_1 * c2;
+
+      c0 = (uint32_t) (p1 >> 32) ^ c1 ^ k0;
+      c2 = (uint32_t) (p0 >> 32) ^ c3 ^ k1;
+      c1 = (uint32_t) p1;
+      c3 = (uint32_t) p0;
+
+      k0 += (uint32_t) PHILOX_W32_0;
+      k1 += (uint32_t) PHILOX_W32_1;
+    }
+
+  out[0] = c0;
+  out[1] = c1;
+  out[2] = c2;
+  out[3] = c3;
+}
+
+/* 64 x 64 -> 128 bit product, using a 128-bit type where the
+   compiler provides one and 32-bit halves otherwise */
+static inline uint64_t
+mulhilo64 (const uint64_t a, const uint64_t b, uint64_t * hi)
+{
+#ifdef __SIZEOF_INT128__
+  const unsigned __int128 p = (unsigned __int128) a * b;
+
+  *hi = (uint64_t) (p >> 64);
+
+  return (uint64_t) p;
+#else
+  const uint64_t a0 = a & 0xffffffffULL, a1 = a >> 32;
+  const uint64_t b0 = b & 0xffffffffULL, b1 = b >> 32;
+  const uint64_t p00 = a0 * b0, p01 = a0 * b1, p10 = a1 * b0, p11 = a1 * b1;
+  const uint64_t mid = (p00 >> 32) + (p01 & 0xffffffffULL) + (p10 & 0xffffffffULL);
+
+  *hi = p11 + (p01 >> 32) + (p10 >> 32) + (mid >> 32);
+
+  return a * b;
+#endif
+}
+
+static void
+philox4x64_block (const uint64_t ctr[4], const uint64_t key[2], uint64_t out[4])
+{
+  uint64_t c0 = ctr[0], c1 = ctr[1], c2 = ctr[2], c3 = ctr[3];
+  uint64_t k0 = key[0], k1 = key[1];
+  int r;
+
+  for (r = 0; r < PHILOX_ROUNDS; r++)
+    {
+      uint64_t hi0, hi1;
+      const uint64_t lo0 = mulhilo64 (PHILOX_M4x64_0, c0, &hi0);
+      const uint64_t lo1 = mulhilo64 (PHILOX_M4x64_1, c2, &hi1);
+
+      c0 = hi1 ^ c1 ^ k0;
+      c2 = hi0 ^ c3 ^ k1;
+      c1 = lo1;
+      c3 = lo0;
+
+      k0 += PHILOX_W64_0;
+      k1 += PHILOX_W64_1;
+    }
+
+  out[0] = c0;
+  out[1] = c1;
+  out[2] = c2;
+  out[3] = c3;
+}
+
+static inline uint32_t
+philox4x32_next (philox4x32_state_t * state)
+{
+  if (state->i == 4)
+    {
+      philox4x32_block (state->ctr, state->key, state->out);
+
+      /* the block counter is the low 64 bits of ctr */
+      if (++state->ctr[0] == 0)
+        ++state->ctr[1];
+
+      state->i = 0;
+    }
+
+  return state->out[state->i++];
+}
+
+static inline uint64_t
+philox4x64_next (philox4x64_state_t * state)
+{
+  if (state->i == 4)
+    {
+      philox4x64_block (state->ctr, state->key, state->out);
+
+      /* the block counter is the low 128 bits of ctr */
+      if (++state->ctr[0] == 0)
+        ++state->ctr[1];
+
+      state->i = 0;
+    }
+
+  return state->out[state->i++];
+}
+
+static unsigned long int
+philox4x32_get (void *vstate)
+{
+  return philox4x32_next ((philox4x32_state_t *) vstate);
+}
+
+static double
+philox4x32_get_double (void *vstate)
+{
+  return philox4x32_next ((philox4x32_state_t *) vstate) / 4294967296.0;
+}
+
+static void
+philox4x32_set_stream (void *vstate, unsigned long int s, unsigned long int stream)
+{
+  philox4x32_state_t *state = (philox4x32_state_t *) vstate;
+
+  state->key[0] = (uint32_t) (s & 0xffffffffUL);
+  state->key[1] = (uint32_t) (((uint64_t) s) >> 32);
+
+  state->ctr[0] = 0;
+  state->ctr[1] = 0;
+  state->ctr[2] = (uint32_t) (stream & 0xffffffffUL);
+  state->ctr[3] = (uint32_t) (((uint64_t) stream) >> 32);
+
+  state->i = 4;
+}
+
+static void
+philox4x32_set (void *vstate, unsigned long int s)
+{
+  philox4x32_set_stream (vstate, s, 0);
+}
+
+static void
+philox4x32_jump (void *vstate)
+{
+  philox4x32_state_t *state = (philox4x32_state_t *) vstate;
+
+  ++state->ctr[1];
+  state->i = 4;
+}
+
+static void
+philox4x32_long_jump (void *vstate)
+{
+  philox4x32_state_t *state = (philox4x32_state_t *) vstate;
+
+  state->ctr[1] += 0x10000UL;
+  state->i = 4;
+}
+
+static unsigned long int
+philox4x64_get (void *vstate)
+{
+  return (unsigned long int) (philox4x64_next ((philox4x64_state_t *) vstate) >> 32);
+}
+
+static double
+philox4x64_get_double (void *vstate)
+{
+  return (philox4x64_next ((philox4x64_state_t *) vstate) >> 11) / 9007199254740992.0;
+}
+
+static void
+philox4x64_set_stream (void *vstate, unsigned long int s, unsigned long int stream)
+{
+  philox4x64_state_t *state = (philox4x64_state_t *) vstate;
+
+  state->key[0] = s;
+  state->key[1] = 0;
+
+  state->ctr[0] = 0;
+  state->ctr[1] = 0;
+  state->ctr[2] = stream;
+  state->ctr[3] = 0;
+
+  state->i = 4;
+}
+
+static void
+philox4x64_set (void *vstate, unsigned long int s)
+{
+  philox4x64_set_stream (vstate, s, 0);
+}
+
+static void
+philox4x64_jump (void *vstate)
+{
+  philox4x64_state_t *state = (philox4x64_state_t *) vstate;
+
+  ++state->ctr[1];
+  state->i = 4;
+}
+
+static void
+philox4x64_long_jump (void *vstate)
+{
+  philox4x64_state_t *state = (philox4x64_state_t *) vstate;
+
+  state->ctr[1] += 0x100000000ULL;
+  state->i = 4;
+}
+
+/* The array functions compute PHILOX_LANES consecutive blocks at a
+   time, with the rounds applied to all lanes in an inner loop which
+   the compiler can vectorize. They give the same sequence as repeated
+   calls to the get functions. */
+
+#define PHILOX_LANES 8
+
+/* compute the blocks for counters ctr, ctr+1, ..., ctr+PHILOX_LANES-1
+   into out[4*l + w], and advance the counter by nblock */
+static void
+philox4x32_lanes (philox4x32_state_t * state, uint32_t out[], const size_t nblock)
+{
+  uint32_t c0[PHILOX_LANES], c1[PHILOX_LANES], c2[PHILOX_LANES], c3[PHILOX_LANES];
+  uint32_t k0 = state->key[0], k1 = state->key[1];
+  const uint64_t base = (uint64_t) state->ctr[0] | ((uint64_t) state->ctr[1] << 32);
+  size_t l;
+  int r;
+
+  for (l = 0; l < PHILOX_LANES; l++)
+    {
+      const uint64_t c = base + l;
+      c0[l] = (uint32_t) c;
+      c1[l] = (uint32_t) (c >> 32);
+      c2[l] = state->ctr[2];
+      c3[l] = state->ctr[3];
+    }
+
+  for (r = 0; r < PHILOX_ROUNDS; r++)
+    {
+      for (l = 0; l < PHILOX_LANES; l++)
+        {
+          const uint64_t p0 = (uint64_t) PHILOX_M4x32_0 * c0[l];
+          const uint64_t p1 = (uint64_t) PHILOX_M4x32_1 * c2[l];
+
+          c0[l] = (uint32_t) (p1 >> 32) ^ c1[l] ^ k0;
+          c2[l] = (uint32_t) (p0 >> 32) ^ c3[l] ^ k1;
+          c1[l] = (uint32_t) p1;
+          c3[l] = (uint32_t) p0;
+        }
+
+      k0 += (uint32_t) PHILOX_W32_0;
+      k1 += (uint32_t) PHILOX_W32_1;
+    }
+
+  for (l = 0; l < PHILOX_LANES; l++)
+    {
+      out[4 * l] = c0[l];
+      out[4 * l + 1] = c1[l];
+      out[4 * l + 2] = c2[l];
+      out[4 * l + 3] = c3[l];
+    }
+
+  {
+    const uint64_t c = base + nblock;
+    state->ctr[0] = (uint32_t) c;
+    state->ctr[1] = (uint32_t) (c >> 32);
+  }
+}
+
+#define PHILOX_FILL(name, type, state_t, word_t, next, lanes, convert) \
+static void \
+name (void *vstate, type x[], size_t n) \
+{ \
+  state_t *state = (state_t *) vstate; \
+  word_t buf[4 * PHILOX_LANES]; \
+  size_t j = 0; \
+  while (j < n && state->i < 4) \
+    { \
+      const word_t w = state->out[state->i++]; \
+      x[j++] = convert (w); \
+    } \
+  while (n - j >= 4) \
+    { \
+      const size_t nblock = GSL_MIN ((n - j) / 4, PHILOX_LANES); \
+      size_t i; \
+      lanes (state, buf, nblock); \
+      for (i = 0; i < 4 * nblock; i++) \
+        x[j + i] = convert (buf[i]); \
+      j += 4 * nblock; \
+    } \
+  while (j < n) \
+    { \
+      const word_t w = next (state); \
+      x[j++] = convert (w); \
+    } \
+}
+
+#define TO_INT32(w) ((unsigned long int) (w))
+#define TO_DOUBLE32(w) ((w) / 4294967296.0)
+
+PHILOX_FILL (philox4x32_fill, unsigned long int, philox4x32_state_t,
+             uint32_t, philox4x32_next, philox4x32_lanes, TO_INT32)
+PHILOX_FILL (philox4x32_fill_double, double, philox4x32_state_t,
+             uint32_t, philox4x32_next, philox4x32_lanes, TO_DOUBLE32)
+
+/* the 64-bit products do not vectorize, so the lanes are computed
+   one block at a time */
+static void
+philox4x64_lanes (philox4x64_state_t * state, uint64_t out[], const size_t nblock)
+{
+  size_t l;
+
+  for (l = 0; l < nblock; l++)
+    {
+      philox4x64_block (state->ctr, state->key, out + 4 * l);
+
+      if (++state->ctr[0] == 0)
+        ++state->ctr[1];
+    }
+}
+
+#define TO_INT64(w) ((unsigned long int) ((w) >> 32))
+#define TO_DOUBLE64(w) (((w) >> 11) / 9007199254740992.0)
+
+PHILOX_FILL (philox4x64_fill, unsigned long int, philox4x64_state_t,
+             uint64_t, philox4x64_next, philox4x64_lanes, TO_INT64)
+PHILOX_FILL (philox4x64_fill_double, double, philox4x64_state_t,
+             uint64_t, philox4x64_next, philox4x64_lanes, TO_DOUBLE64)
+
+static const gsl_rng_type philox4x32_type = {
+  "philox4x32",                 /* name */
+  0xffffffffUL,                 /* RAND_MAX */
+  0,                            /* RAND_MIN */
+  sizeof (philox4x32_state_t),
+  &philox4x32_set,
+  &philox4x32_get,
+  &philox4x32_get_double,
+  &philox4x32_jump,
+  &philox4x32_long_jump,
+  &philox4x32_set_stream,
+  &philox4x32_fill,
+  &philox4x32_fill_double
+};
+
+static const gsl_rng_type philox4x64_type = {
+  "philox4x64",                 /* name */
+  0xffffffffUL,                 /* RAND_MAX */
+  0,                            /* RAND_MIN */
+  sizeof (philox4x64_state_t),
+  &philox4x64_set,
+  &philox4x64_get,
+  &philox4x64_get_double,
+  &philox4x64_jump,
+  &philox4x64_long_jump,
+  &philox4x64_set_stream,
+  &philox4x64_fill,
+  &philox4x64_fill_double
+};
+
+const gsl_rng_type *gsl_rng_philox4x32 = &philox4x32_type;
+const gsl_rng_type *gsl_rng_philox4x64 = &philox4x64_type;
@@ -167,6 +167,9 @@ static const gsl_rng_type r250_type =
  sizeof (r250_state_t),
  &r250_set,
  &r250_get,
- &r250_get_double};
+ &r250_get_double,
+ NULL, NULL, NULL,              /* no jumps or streams */
+ NULL, NULL                     /* no array functions */
+};
 
 const gsl_rng_type *gsl_rng_r250 = &r250_type;
@@ -80,6 +80,9 @@ static const gsl_rng_type rand_type =
  sizeof (rand_state_t),
  &rand_set,
  &rand_get,
- &rand_get_double};
+ &rand_get_double,
+ NULL, NULL, NULL,              /* no jumps or streams */
+ NULL, NULL                     /* no array functions */
+};
 
 const gsl_rng_type *gsl_rng_rand = &rand_type;
@@ -207,7 +207,10 @@ static const gsl_rng_type ranlux_type =
  sizeof (ranlux_state_t),
  &ranlux_set,
  &ranlux_get,
- &ranlux_get_double};
+ &ranlux_get_double,
+ NULL, NULL, NULL,              /* no jumps or streams */
+ NULL, NULL                     /* no array functions */
+};
 
 static const gsl_rng_type ranlux389_type =
 {"ranlux389",                   /* name */
@@ -216,7 +219,10 @@ static const gsl_rng_type ranlux389_type =
  sizeof (ranlux_state_t),
  &ranlux389_set,
  &ranlux_get,
- &ranlux_get_double};
+ &ranlux_get_double,
+ NULL, NULL, NULL,              /* no jumps or streams */
+ NULL, NULL                     /* no array functions */
+};
 
 const gsl_rng_type *gsl_rng_ranlux = &ranlux_type;
 const gsl_rng_type *gsl_rng_ranlux389 = &ranlux389_type;
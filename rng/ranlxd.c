@@ -234,7 +234,10 @@ static const gsl_rng_type ranlxd1_type =
  sizeof (ranlxd_state_t),
  &ranlxd1_set,
  &ranlxd_get,
- &ranlxd_get_double};
+ &ranlxd_get_double,
+ NULL, NULL, NULL,              /* no jumps or streams */
+ NULL, NULL                     /* no array functions */
+};
 
 static const gsl_rng_type ranlxd2_type =
 {"ranlxd2",                     /* name */
@@ -243,7 +246,10 @@ static const gsl_rng_type ranlxd2_type =
  sizeof (ranlxd_state_t),
  &ranlxd2_set,
  &ranlxd_get,
- &ranlxd_get_double};
+ &ranlxd_get_double,
+ NULL, NULL, NULL,              /* no jumps or streams */
+ NULL, NULL                     /* no array functions */
+};
 
 const gsl_rng_type *gsl_rng_ranlxd1 = &ranlxd1_type;
 const gsl_rng_type *gsl_rng_ranlxd2 = &ranlxd2_type;
@@ -277,7 +277,10 @@ static const gsl_rng_type ranlxs0_type =
  sizeof (ranlxs_state_t),
  &ranlxs0_set,
  &ranlxs_get,
- &ranlxs_get_double};
+ &ranlxs_get_double,
+ NULL, NULL, NULL,              /* no jumps or streams */
+ NULL, NULL                     /* no array functions */
+};
 
 static const gsl_rng_type ranlxs1_type =
 {"ranlxs1",                     /* name */
@@ -286,7 +289,10 @@ static const gsl_rng_type ranlxs1_type =
  sizeof (ranlxs_state_t),
  &ranlxs1_set,
  &ranlxs_get,
- &ranlxs_get_double};
+ &ranlxs_get_double,
+ NULL, NULL, NULL,              /* no jumps or streams */
+ NULL, NULL                     /* no array functions */
+};
 
 static const gsl_rng_type ranlxs2_type =
 {"ranlxs2",                     /* name */
@@ -295,7 +301,10 @@ static const gsl_rng_type ranlxs2_type =
  sizeof (ranlxs_state_t),
  &ranlxs2_set,
  &ranlxs_get,
- &ranlxs_get_double};
+ &ranlxs_get_double,
+ NULL, NULL, NULL,              /* no jumps or streams */
+ NULL, NULL                     /* no array functions */
+};
 
 const gsl_rng_type *gsl_rng_ranlxs0 = &ranlxs0_type;
 const gsl_rng_type *gsl_rng_ranlxs1 = &ranlxs1_type;
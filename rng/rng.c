@@ -53,6 +53,45 @@ gsl_rng_alloc (const gsl_rng_type * T)
   return r;
 }
 
+/* allocate a generator for substream number stream of the sequence
+   with the given seed. Generators with a set_stream function place the
+   stream in the high part of their counter; the others are seeded and
+   then advanced by stream jumps. */
+
+gsl_rng *
+gsl_rng_alloc_substream (const gsl_rng_type * T, unsigned long int seed,
+                         unsigned long int stream)
+{
+  gsl_rng *r;
+
+  if (T->set_stream == 0 && T->jump == 0)
+    {
+      GSL_ERROR_VAL ("generator does not support substreams",
+                     GSL_EUNIMPL, 0);
+    }
+
+  r = gsl_rng_alloc (T);
+
+  if (r == 0)
+    return 0;
+
+  if (T->set_stream)
+    {
+      (T->set_stream) (r->state, seed, stream);
+    }
+  else
+    {
+      unsigned long int i;
+
+      gsl_rng_set (r, seed);
+
+      for (i = 0; i < stream; i++)
+        (T->jump) (r->state);
+    }
+
+  return r;
+}
+
 int
 gsl_rng_memcpy (gsl_rng * dest, const gsl_rng * src)
 {
@@ -100,6 +139,136 @@ gsl_rng_set (const gsl_rng * r, unsigned long int seed)
   (r->type->set) (r->state, seed);
 }
 
+int
+gsl_rng_jump (const gsl_rng * r)
+{
+  if (r->type->jump == 0)
+    {
+      GSL_ERROR ("generator does not support jump", GSL_EUNIMPL);
+    }
+
+  (r->type->jump) (r->state);
+
+  return GSL_SUCCESS;
+}
+
+int
+gsl_rng_long_jump (const gsl_rng * r)
+{
+  if (r->type->long_jump == 0)
+    {
+      GSL_ERROR ("generator does not support long jump", GSL_EUNIMPL);
+    }
+
+  (r->type->long_jump) (r->state);
+
+  return GSL_SUCCESS;
+}
+
+/* The array functions give the same numbers as the corresponding
+   sequence of single calls. Generators with fill functions produce
+   whole arrays without an indirect call per number. */
+
+void
+gsl_rng_get_array (const gsl_rng * r, unsigned long int x[], const size_t n)
+{
+  const gsl_rng_type *T = r->type;
+
+  if (T->fill)
+    {
+      (T->fill) (r->state, x, n);
+    }
+  else
+    {
+      size_t i;
+
+      for (i = 0; i < n; i++)
+        x[i] = (T->get) (r->state);
+    }
+}
+
+void
+gsl_rng_uniform_array (const gsl_rng * r, double x[], const size_t n)
+{
+  const gsl_rng_type *T = r->type;
+
+  if (T->fill_double)
+    {
+      (T->fill_double) (r->state, x, n);
+    }
+  else
+    {
+      size_t i;
+
+      for (i = 0; i < n; i++)
+        x[i] = (T->get_double) (r->state);
+    }
+}
+
+void
+gsl_rng_uniform_pos_array (const gsl_rng * r, double x[], const size_t n)
+{
+  size_t i = 0;
+
+  gsl_rng_uniform_array (r, x, n);
+
+  /* zeros are rejected; shifting the rest of the array down keeps
+     the sequence of gsl_rng_uniform_pos */
+  while (i < n)
+    {
+      if (x[i] == 0.0)
+        {
+          memmove (x + i, x + i + 1, (n - i - 1) * sizeof (double));
+          x[n - 1] = (r->type->get_double) (r->state);
+        }
+      else
+        {
+          ++i;
+        }
+    }
+}
+
+#define RNG_ARRAY_BLOCK 256
+
+int
+gsl_rng_uniform_int_array (const gsl_rng * r, const unsigned long int n,
+                           unsigned long int x[], const size_t size)
+{
+  const unsigned long int offset = r->type->min;
+  const unsigned long int range = r->type->max - offset;
+  unsigned long int scale;
+  unsigned long int buf[RNG_ARRAY_BLOCK];
+  size_t j = 0;
+
+  if (n > range || n == 0) 
+    {
+      GSL_ERROR ("invalid n, either 0 or exceeds maximum value of generator",
+                 GSL_EINVAL);
+    }
+
+  scale = range / n;
+
+  /* draw exactly as many numbers as are still needed, so that
+     rejections are replaced as in gsl_rng_uniform_int */
+  while (j < size)
+    {
+      const size_t m = (size - j < RNG_ARRAY_BLOCK) ? size - j : RNG_ARRAY_BLOCK;
+      size_t i;
+
+      gsl_rng_get_array (r, buf, m);
+
+      for (i = 0; i < m; i++)
+        {
+          const unsigned long int k = (buf[i] - offset) / scale;
+
+          if (k < n)
+            x[j++] = k;
+        }
+    }
+
+  return GSL_SUCCESS;
+}
+
 unsigned long int
 gsl_rng_max (const gsl_rng * r)
 {
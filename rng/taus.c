@@ -168,7 +168,10 @@ static const gsl_rng_type taus_type =
  sizeof (taus_state_t),
  &taus_set,
  &taus_get,
- &taus_get_double};
+ &taus_get_double,
+ NULL, NULL, NULL,              /* no jumps or streams */
+ NULL, NULL                     /* no array functions */
+};
 
 const gsl_rng_type *gsl_rng_taus = &taus_type;
 
@@ -179,6 +182,9 @@ static const gsl_rng_type taus2_type =
  sizeof (taus_state_t),
  &taus2_set,
  &taus_get,
- &taus_get_double};
+ &taus_get_double,
+ NULL, NULL, NULL,              /* no jumps or streams */
+ NULL, NULL                     /* no array functions */
+};
 
 const gsl_rng_type *gsl_rng_taus2 = &taus2_type;
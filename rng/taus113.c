@@ -100,6 +100,59 @@ taus113_get_double (void *vstate)
   return taus113_get (vstate) / 4294967296.0;
 }
 
+/* the array functions keep the four components in local variables */
+
+#define TAUS113_STEP(z1, z2, z3, z4) \
+  do { \
+    unsigned long b; \
+    b = ((((z1 << 6UL) & MASK) ^ z1) >> 13UL); \
+    z1 = ((((z1 & 4294967294UL) << 18UL) & MASK) ^ b); \
+    b = ((((z2 << 2UL) & MASK) ^ z2) >> 27UL); \
+    z2 = ((((z2 & 4294967288UL) << 2UL) & MASK) ^ b); \
+    b = ((((z3 << 13UL) & MASK) ^ z3) >> 21UL); \
+    z3 = ((((z3 & 4294967280UL) << 7UL) & MASK) ^ b); \
+    b = ((((z4 << 3UL) & MASK) ^ z4) >> 12UL); \
+    z4 = ((((z4 & 4294967168UL) << 13UL) & MASK) ^ b); \
+  } while (0)
+
+static void
+taus113_fill (void *vstate, unsigned long int x[], size_t n)
+{
+  taus113_state_t *state = (taus113_state_t *) vstate;
+  unsigned long z1 = state->z1, z2 = state->z2, z3 = state->z3, z4 = state->z4;
+  size_t i;
+
+  for (i = 0; i < n; i++)
+    {
+      TAUS113_STEP (z1, z2, z3, z4);
+      x[i] = z1 ^ z2 ^ z3 ^ z4;
+    }
+
+  state->z1 = z1;
+  state->z2 = z2;
+  state->z3 = z3;
+  state->z4 = z4;
+}
+
+static void
+taus113_fill_double (void *vstate, double x[], size_t n)
+{
+  taus113_state_t *state = (taus113_state_t *) vstate;
+  unsigned long z1 = state->z1, z2 = state->z2, z3 = state->z3, z4 = state->z4;
+  size_t i;
+
+  for (i = 0; i < n; i++)
+    {
+      TAUS113_STEP (z1, z2, z3, z4);
+      x[i] = (z1 ^ z2 ^ z3 ^ z4) / 4294967296.0;
+    }
+
+  state->z1 = z1;
+  state->z2 = z2;
+  state->z3 = z3;
+  state->z4 = z4;
+}
+
 static void
 taus113_set (void *vstate, unsigned long int s)
 {
@@ -143,7 +196,10 @@ static const gsl_rng_type taus113_type = {
   sizeof (taus113_state_t),
   &taus113_set,
   &taus113_get,
-  &taus113_get_double
+  &taus113_get_double,
+  0, 0, 0,                      /* no jumps or streams */
+  &taus113_fill,
+  &taus113_fill_double
 };
 
 const gsl_rng_type *gsl_rng_taus113 = &taus113_type;
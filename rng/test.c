@@ -37,6 +37,8 @@ int rng_min_test (gsl_rng * r, unsigned long int *kmin, unsigned long int ran_mi
 int rng_sum_test (gsl_rng * r, double *sigma);
 int rng_bin_test (gsl_rng * r, double *sigma);
 void rng_seed_test (const gsl_rng_type * T);
+void rng_jump_test (const gsl_rng_type * T);
+void rng_array_test (const gsl_rng_type * T);
 
 #define N  10000
 #define N2 200000
@@ -181,6 +183,29 @@ main (void)
   rng_test (gsl_rng_ranf, 0, 10000, 2152890433UL);
   rng_test (gsl_rng_ranf, 2, 10000, 339327233);
 
+  /* Philox and Threefry known answer vectors for zero counter and key
+     from the Random123 distribution (kat_vectors); the 64-bit words
+     are checked through their upper halves */
+
+  rng_test (gsl_rng_philox4x32, 0, 1, 0x6627e8d5UL);
+  rng_test (gsl_rng_philox4x32, 0, 4, 0x9b00dbd8UL);
+  rng_test (gsl_rng_philox4x64, 0, 1, 0x16554d9eUL);
+  rng_test (gsl_rng_philox4x64, 0, 4, 0x7e68b68aUL);
+  rng_test (gsl_rng_threefry4x64, 0, 1, 0x09218ebdUL);
+  rng_test (gsl_rng_threefry4x64, 0, 4, 0xee29ec84UL);
+
+  /* The tests below were computed with independent implementations
+     of the algorithms in Python */
+
+  rng_test (gsl_rng_philox4x32, 1, 10000, 4025433304UL);
+  rng_test (gsl_rng_xoshiro256pp, 1, 10000, 3325891211UL);
+  rng_test (gsl_rng_xoshiro256ss, 1, 10000, 1363609523UL);
+
+  /* The tests below are regression values */
+
+  rng_test (gsl_rng_philox4x64, 1, 10000, 1936283175UL);
+  rng_test (gsl_rng_threefry4x64, 1, 10000, 1416176523UL);
+
   /* Test constant relationship between int and double functions */
 
   for (r = rngs ; *r != 0; r++)
@@ -197,6 +222,17 @@ main (void)
   for (r = rngs ; *r != 0; r++)
     rng_read_write_test (*r);
 
+  /* array functions against sequences of single calls */
+
+  for (r = rngs ; *r != 0; r++)
+    rng_array_test (*r);
+
+  /* jumps and substreams, for the generators which support them */
+
+  for (r = rngs ; *r != 0; r++)
+    if ((*r)->jump != 0)
+      rng_jump_test (*r);
+
   /* generic statistical tests (these are just to make sure that we
      don't get any crazy results back from the generator, i.e. they
      aren't a test of the algorithm, just the implementation) */
@@ -673,3 +709,126 @@ rng_seed_test (const gsl_rng_type * T)
     }
   }
 }
+
+/* jumps commute with steps which consume whole blocks of the
+   counter-based generators, and substream k of a generator without
+   set_stream is the seeded generator advanced by k jumps */
+
+void
+rng_jump_test (const gsl_rng_type * T)
+{
+  gsl_rng *r1 = gsl_rng_alloc (T);
+  gsl_rng *r2 = gsl_rng_alloc (T);
+  gsl_rng *r3 = gsl_rng_alloc_substream (T, 17, 3);
+  gsl_rng *r4 = gsl_rng_alloc_substream (T, 17, 4);
+  int status_jump = 0, status_long = 0, status_stream = 0;
+  int ndiff = 0;
+  int i;
+
+  for (i = 0; i < N; ++i)
+    gsl_rng_get (r1);
+  gsl_rng_jump (r1);
+
+  gsl_rng_jump (r2);
+  for (i = 0; i < N; ++i)
+    gsl_rng_get (r2);
+
+  for (i = 0; i < N; ++i)
+    status_jump |= (gsl_rng_get (r1) != gsl_rng_get (r2));
+
+  gsl_rng_long_jump (r1);
+  gsl_rng_long_jump (r2);
+
+  for (i = 0; i < N; ++i)
+    status_long |= (gsl_rng_get (r1) != gsl_rng_get (r2));
+
+  if (T->set_stream == 0)
+    {
+      gsl_rng_set (r1, 17);
+      for (i = 0; i < 3; ++i)
+        gsl_rng_jump (r1);
+
+      for (i = 0; i < N; ++i)
+        status_stream |= (gsl_rng_get (r1) != gsl_rng_get (r3));
+    }
+  else
+    {
+      gsl_rng *r0 = gsl_rng_alloc_substream (T, 17, 0);
+
+      gsl_rng_set (r1, 17);
+
+      for (i = 0; i < N; ++i)
+        status_stream |= (gsl_rng_get (r1) != gsl_rng_get (r0));
+
+      gsl_rng_free (r0);
+    }
+
+  /* neighbouring substreams must differ */
+  for (i = 0; i < N; ++i)
+    ndiff += (gsl_rng_get (r3) != gsl_rng_get (r4));
+
+  status_stream |= (ndiff < N / 2);
+
+  gsl_test (status_jump, "%s, jump commutes with generation", gsl_rng_name (r1));
+  gsl_test (status_long, "%s, long jump", gsl_rng_name (r1));
+  gsl_test (status_stream, "%s, substreams", gsl_rng_name (r1));
+
+  gsl_rng_free (r1);
+  gsl_rng_free (r2);
+  gsl_rng_free (r3);
+  gsl_rng_free (r4);
+}
+
+/* the array functions must reproduce the sequences of single calls,
+   for arrays of various lengths which start at various offsets into
+   the blocks of the generators */
+
+void
+rng_array_test (const gsl_rng_type * T)
+{
+  const size_t len[] = { 1, 3, 5, 37, 1000, 4999 };
+  const size_t nlen = sizeof (len) / sizeof (len[0]);
+  gsl_rng *r1 = gsl_rng_alloc (T);
+  gsl_rng *r2 = gsl_rng_alloc (T);
+  unsigned long int *k = malloc (N * sizeof (unsigned long int));
+  double *u = malloc (N * sizeof (double));
+  const unsigned long int nbig = 3 * ((T->max - T->min) / 4);
+  int status_get = 0, status_uniform = 0, status_pos = 0, status_int = 0;
+  size_t i, j;
+
+  for (j = 0; j < nlen; ++j)
+    {
+      gsl_rng_get_array (r1, k, len[j]);
+      for (i = 0; i < len[j]; ++i)
+        status_get |= (k[i] != gsl_rng_get (r2));
+
+      gsl_rng_uniform_array (r1, u, len[j]);
+      for (i = 0; i < len[j]; ++i)
+        status_uniform |= (u[i] != gsl_rng_uniform (r2));
+
+      gsl_rng_uniform_pos_array (r1, u, len[j]);
+      for (i = 0; i < len[j]; ++i)
+        status_pos |= (u[i] != gsl_rng_uniform_pos (r2));
+
+      /* a range which gives frequent rejections */
+      gsl_rng_uniform_int_array (r1, nbig, k, len[j]);
+      for (i = 0; i < len[j]; ++i)
+        status_int |= (k[i] != gsl_rng_uniform_int (r2, nbig));
+
+      gsl_rng_uniform_int_array (r1, 7, k, len[j]);
+      for (i = 0; i < len[j]; ++i)
+        status_int |= (k[i] != gsl_rng_uniform_int (r2, 7));
+    }
+
+  status_get |= (gsl_rng_get (r1) != gsl_rng_get (r2));
+
+  gsl_test (status_get, "%s, get_array", gsl_rng_name (r1));
+  gsl_test (status_uniform, "%s, uniform_array", gsl_rng_name (r1));
+  gsl_test (status_pos, "%s, uniform_pos_array", gsl_rng_name (r1));
+  gsl_test (status_int, "%s, uniform_int_array", gsl_rng_name (r1));
+
+  free (k);
+  free (u);
+  gsl_rng_free (r1);
+  gsl_rng_free (r2);
+}
@@ -0,0 +1,320 @@
+/* rng/threefry.c
+ *
+ * Copyright (C) 2026 Patrick Alken
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* This is the counter-based generator Threefry4x64-20, a variant of
+   the Threefish block cipher with 20 rounds of add-rotate-xor mixing
+   of a 256-bit counter under a 256-bit key, with the key schedule
+   injected every 4 rounds. The 4 words of each block are returned in
+   turn, and the counter is incremented when the block is exhausted.
+
+   The seed sets the first key word and the counter starts at zero.
+   The low half of the counter counts blocks and the high half holds
+   the stream number set by gsl_rng_alloc_substream. The jump function
+   advances the block counter by 2^64 and the long jump by 2^96.
+
+   gsl_rng_get returns the upper 32 bits of each 64-bit word and
+   gsl_rng_uniform uses 53 bits. With seed 0 the first block is the
+   known answer vector for zero counter and key.
+
+   Reference: J. K. Salmon, M. A. Moraes, R. O. Dror, D. E. Shaw,
+   "Parallel random numbers: as easy as 1, 2, 3", Proceedings of the
+   International Conference for High Performance Computing, Networking,
+   Storage and Analysis (SC11), 2011. */
+
+#include <config.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_rng.h>
+
+#define THREEFRY_ROUNDS 20
+#define THREEFRY_PARITY 0x1BD11BDAA9FC1A22ULL
+
+#define ROTL64(x, r) (((x) << (r)) | ((x) >> (64 - (r))))
+
+/* rotation constants for the 8 rounds of a cycle */
+static const unsigned int threefry_rot[8][2] = {
+  {14, 16}, {52, 57}, {23, 40}, {5, 37},
+  {25, 33}, {46, 12}, {58, 22}, {32, 32}
+};
+
+typedef struct
+{
+  uint64_t ctr[4];
+  uint64_t key[4];
+  uint64_t out[4];
+  unsigned int i;               /* next word of out, 4 if exhausted */
+}
+threefry4x64_state_t;
+
+static void
+threefry4x64_block (const uint64_t ctr[4], const uint64_t key[4], uint64_t out[4])
+{
+  uint64_t ks[5];
+  uint64_t x0, x1, x2, x3;
+  unsigned int r, j;
+
+  ks[4] = THREEFRY_PARITY;
+  for (j = 0; j < 4; j++)
+    {
+      ks[j] = key[j];
+      ks[4] ^= key[j];
+    }
+
+  x0 = ctr[0] + ks[0];
+  x1 = ctr[1] + ks[1];
+  x2 = ctr[2] + ks[2];
+  x3 = ctr[3] + ks[3];
+
+  for (r = 0; r < THREEFRY_ROUNDS; r++)
+    {
+      const unsigned int *rot = threefry_rot[r % 8];
+
+      if (r % 2 == 0)
+        {
+          x0 += x1; x1 = ROTL64 (x1, rot[0]); x1 ^= x0;
+          x2 += x3; x3 = ROTL64 (x3, rot[1]); x3 ^= x2;
+        }
+      else
+        {
+          x0 += x3; x3 = ROTL64 (x3, rot[0]); x3 ^= x0;
+          x2 += x1; x1 = ROTL64 (x1, rot[1]); x1 ^= x2;
+        }
+
+      /* key injection after every 4 rounds */
+      if (r % 4 == 3)
+        {
+          const unsigned int s = (r + 1) / 4;
+
+          x0 += ks[s % 5];
+          x1 += ks[(s + 1) % 5];
+          x2 += ks[(s + 2) % 5];
+          x3 += ks[(s + 3) % 5] + s;
+        }
+    }
+
+  out[0] = x0;
+  out[1] = x1;
+  out[2] = x2;
+  out[3] = x3;
+}
+
+static inline uint64_t
+threefry4x64_next (threefry4x64_state_t * state)
+{
+  if (state->i == 4)
+    {
+      threefry4x64_block (state->ctr, state->key, state->out);
+
+      if (++state->ctr[0] == 0)
+        ++state->ctr[1];
+
+      state->i = 0;
+    }
+
+  return state->out[state->i++];
+}
+
+static unsigned long int
+threefry4x64_get (void *vstate)
+{
+  return (unsigned long int) (threefry4x64_next ((threefry4x64_state_t *) vstate) >> 32);
+}
+
+static double
+threefry4x64_get_double (void *vstate)
+{
+  return (threefry4x64_next ((threefry4x64_state_t *) vstate) >> 11) / 9007199254740992.0;
+}
+
+static void
+threefry4x64_set_stream (void *vstate, unsigned long int s, unsigned long int stream)
+{
+  threefry4x64_state_t *state = (threefry4x64_state_t *) vstate;
+
+  state->key[0] = s;
+  state->key[1] = 0;
+  state->key[2] = 0;
+  state->key[3] = 0;
+
+  state->ctr[0] = 0;
+  state->ctr[1] = 0;
+  state->ctr[2] = stream;
+  state->ctr[3] = 0;
+
+  state->i = 4;
+}
+
+static void
+threefry4x64_set (void *vstate, unsigned long int s)
+{
+  threefry4x64_set_stream (vstate, s, 0);
+}
+
+static void
+threefry4x64_jump (void *vstate)
+{
+  threefry4x64_state_t *state = (threefry4x64_state_t *) vstate;
+
+  ++state->ctr[1];
+  state->i = 4;
+}
+
+static void
+threefry4x64_long_jump (void *vstate)
+{
+  threefry4x64_state_t *state = (threefry4x64_state_t *) vstate;
+
+  state->ctr[1] += 0x100000000ULL;
+  state->i = 4;
+}
+
+/* The array functions compute THREEFRY_LANES consecutive blocks at a
+   time, with the rounds applied to all lanes in an inner loop which
+   the compiler can vectorize. They give the same sequence as repeated
+   calls to the get functions. */
+
+#define THREEFRY_LANES 8
+
+static void
+threefry4x64_lanes (threefry4x64_state_t * state, uint64_t out[], const size_t nblock)
+{
+  uint64_t x0[THREEFRY_LANES], x1[THREEFRY_LANES], x2[THREEFRY_LANES], x3[THREEFRY_LANES];
+  uint64_t ks[5];
+  unsigned int r, j;
+  size_t l;
+
+  ks[4] = THREEFRY_PARITY;
+  for (j = 0; j < 4; j++)
+    {
+      ks[j] = state->key[j];
+      ks[4] ^= state->key[j];
+    }
+
+  for (l = 0; l < THREEFRY_LANES; l++)
+    {
+      const uint64_t c0 = state->ctr[0] + l;
+
+      x0[l] = c0 + ks[0];
+      x1[l] = state->ctr[1] + (c0 < l) + ks[1];
+      x2[l] = state->ctr[2] + ks[2];
+      x3[l] = state->ctr[3] + ks[3];
+    }
+
+  for (r = 0; r < THREEFRY_ROUNDS; r++)
+    {
+      const unsigned int ra = threefry_rot[r % 8][0];
+      const unsigned int rb = threefry_rot[r % 8][1];
+
+      if (r % 2 == 0)
+        {
+          for (l = 0; l < THREEFRY_LANES; l++)
+            {
+              x0[l] += x1[l]; x1[l] = ROTL64 (x1[l], ra); x1[l] ^= x0[l];
+              x2[l] += x3[l]; x3[l] = ROTL64 (x3[l], rb); x3[l] ^= x2[l];
+            }
+        }
+      else
+        {
+          for (l = 0; l < THREEFRY_LANES; l++)
+            {
+              x0[l] += x3[l]; x3[l] = ROTL64 (x3[l], ra); x3[l] ^= x0[l];
+              x2[l] += x1[l]; x1[l] = ROTL64 (x1[l], rb); x1[l] ^= x2[l];
+            }
+        }
+
+      if (r % 4 == 3)
+        {
+          const unsigned int s = (r + 1) / 4;
+
+          for (l = 0; l < THREEFRY_LANES; l++)
+            {
+              x0[l] += ks[s % 5];
+              x1[l] += ks[(s + 1) % 5];
+              x2[l] += ks[(s + 2) % 5];
+              x3[l] += ks[(s + 3) % 5] + s;
+            }
+        }
+    }
+
+  for (l = 0; l < THREEFRY_LANES; l++)
+    {
+      out[4 * l] = x0[l];
+      out[4 * l + 1] = x1[l];
+      out[4 * l + 2] = x2[l];
+      out[4 * l + 3] = x3[l];
+    }
+
+  {
+    const uint64_t c0 = state->ctr[0] + nblock;
+    state->ctr[1] += (c0 < nblock);
+    state->ctr[0] = c0;
+  }
+}
+
+#define THREEFRY_FILL(name, type, convert) \
+static void \
+name (void *vstate, type x[], size_t n) \
+{ \
+  threefry4x64_state_t *state = (threefry4x64_state_t *) vstate; \
+  uint64_t buf[4 * THREEFRY_LANES]; \
+  size_t j = 0; \
+  while (j < n && state->i < 4) \
+    { \
+      const uint64_t w = state->out[state->i++]; \
+      x[j++] = convert (w); \
+    } \
+  while (n - j >= 4) \
+    { \
+      const size_t nblock = GSL_MIN ((n - j) / 4, THREEFRY_LANES); \
+      size_t i; \
+      threefry4x64_lanes (state, buf, nblock); \
+      for (i = 0; i < 4 * nblock; i++) \
+        x[j + i] = convert (buf[i]); \
+      j += 4 * nblock; \
+    } \
+  while (j < n) \
+    { \
+      const uint64_t w = threefry4x64_next (state); \
+      x[j++] = convert (w); \
+    } \
+}
+
+#define TO_INT(w) ((unsigned long int) ((w) >> 32))
+#define TO_DOUBLE(w) (((w) >> 11) / 9007199254740992.0)
+
+THREEFRY_FILL (threefry4x64_fill, unsigned long int, TO_INT)
+THREEFRY_FILL (threefry4x64_fill_double, double, TO_DOUBLE)
+
+static const gsl_rng_type threefry4x64_type = {
+  "threefry4x64",               /* name */
+  0xffffffffUL,                 /* RAND_MAX */
+  0,                            /* RAND_MIN */
+  sizeof (threefry4x64_state_t),
+  &threefry4x64_set,
+  &threefry4x64_get,
+  &threefry4x64_get_double,
+  &threefry4x64_jump,
+  &threefry4x64_long_jump,
+  &threefry4x64_set_stream,
+  &threefry4x64_fill,
+  &threefry4x64_fill_double
+};
+
+const gsl_rng_type *gsl_rng_threefry4x64 = &threefry4x64_type;
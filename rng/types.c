@@ -48,6 +48,8 @@ gsl_rng_types_setup (void)
   ADD(gsl_rng_mt19937);
   ADD(gsl_rng_mt19937_1999);
   ADD(gsl_rng_mt19937_1998);
+  ADD(gsl_rng_philox4x32);
+  ADD(gsl_rng_philox4x64);
   ADD(gsl_rng_r250);
   ADD(gsl_rng_ran0);
   ADD(gsl_rng_ran1);
@@ -87,12 +89,15 @@ gsl_rng_types_setup (void)
   ADD(gsl_rng_taus);
   ADD(gsl_rng_taus2);
   ADD(gsl_rng_taus113);
+  ADD(gsl_rng_threefry4x64);
   ADD(gsl_rng_transputer);
   ADD(gsl_rng_tt800);
   ADD(gsl_rng_uni);
   ADD(gsl_rng_uni32);
   ADD(gsl_rng_vax);
   ADD(gsl_rng_waterman14);
+  ADD(gsl_rng_xoshiro256pp);
+  ADD(gsl_rng_xoshiro256ss);
   ADD(gsl_rng_zuf);
   ADD(0);
 
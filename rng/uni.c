@@ -196,6 +196,9 @@ static const gsl_rng_type uni_type =
  sizeof (uni_state_t),
  &uni_set,
  &uni_get,
- &uni_get_double};
+ &uni_get_double,
+ NULL, NULL, NULL,              /* no jumps or streams */
+ NULL, NULL                     /* no array functions */
+};
 
 const gsl_rng_type *gsl_rng_uni = &uni_type;
@@ -0,0 +1,247 @@
+/* rng/xoshiro.c
+ *
+ * Copyright (C) 2026 Patrick Alken
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* These are the xoshiro256++ and xoshiro256** generators of Blackman
+   and Vigna, with a 256-bit xor/shift/rotate linear engine of period
+   2^256 - 1 and the scramblers
+
+     xoshiro256++   rotl(s0 + s3, 23) + s0
+     xoshiro256**   rotl(5 s1, 7) * 9
+
+   The state is initialized from the seed with the splitmix64
+   generator, as recommended by the authors. The jump function is
+   equivalent to 2^128 calls to the generator and the long jump to
+   2^192 calls; they are computed with the jump polynomials of the
+   reference implementation.
+
+   gsl_rng_get returns the upper 32 bits of each 64-bit output and
+   gsl_rng_uniform uses 53 bits.
+
+   Reference: D. Blackman, S. Vigna, "Scrambled linear pseudorandom
+   number generators", ACM Transactions on Mathematical Software 47,
+   36 (2021). */
+
+#include <config.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <gsl/gsl_rng.h>
+
+#define ROTL64(x, r) (((x) << (r)) | ((x) >> (64 - (r))))
+
+typedef struct
+{
+  uint64_t s[4];
+}
+xoshiro256_state_t;
+
+static const uint64_t xoshiro256_jump_poly[4] = {
+  0x180ec6d33cfd0abaULL, 0xd5a61266f0c9392cULL,
+  0xa9582618e03fc9aaULL, 0x39abdc4529b1661cULL
+};
+
+static const uint64_t xoshiro256_long_jump_poly[4] = {
+  0x76e15d3efefdcbbfULL, 0xc5004e441c522fb3ULL,
+  0x77710069854ee241ULL, 0x39109bb02acbe635ULL
+};
+
+/* advance the linear engine by one step */
+static inline void
+xoshiro256_step (uint64_t s[4])
+{
+  const uint64_t t = s[1] << 17;
+
+  s[2] ^= s[0];
+  s[3] ^= s[1];
+  s[1] ^= s[2];
+  s[0] ^= s[3];
+
+  s[2] ^= t;
+  s[3] = ROTL64 (s[3], 45);
+}
+
+static inline uint64_t
+xoshiro256pp_next (xoshiro256_state_t * state)
+{
+  uint64_t *s = state->s;
+  const uint64_t result = ROTL64 (s[0] + s[3], 23) + s[0];
+
+  xoshiro256_step (s);
+
+  return result;
+}
+
+static inline uint64_t
+xoshiro256ss_next (xoshiro256_state_t * state)
+{
+  uint64_t *s = state->s;
+  const uint64_t result = ROTL64 (s[1] * 5, 7) * 9;
+
+  xoshiro256_step (s);
+
+  return result;
+}
+
+static unsigned long int
+xoshiro256pp_get (void *vstate)
+{
+  return (unsigned long int) (xoshiro256pp_next ((xoshiro256_state_t *) vstate) >> 32);
+}
+
+static double
+xoshiro256pp_get_double (void *vstate)
+{
+  return (xoshiro256pp_next ((xoshiro256_state_t *) vstate) >> 11) / 9007199254740992.0;
+}
+
+static unsigned long int
+xoshiro256ss_get (void *vstate)
+{
+  return (unsigned long int) (xoshiro256ss_next ((xoshiro256_state_t *) vstate) >> 32);
+}
+
+static double
+xoshiro256ss_get_double (void *vstate)
+{
+  return (xoshiro256ss_next ((xoshiro256_state_t *) vstate) >> 11) / 9007199254740992.0;
+}
+
+/* the array functions keep the state in local variables */
+
+#define XOSHIRO256_FILL(name, type, scramble, convert) \
+static void \
+name (void *vstate, type x[], size_t n) \
+{ \
+  xoshiro256_state_t *state = (xoshiro256_state_t *) vstate; \
+  uint64_t s[4]; \
+  size_t i; \
+  s[0] = state->s[0]; s[1] = state->s[1]; \
+  s[2] = state->s[2]; s[3] = state->s[3]; \
+  for (i = 0; i < n; i++) \
+    { \
+      const uint64_t result = scramble; \
+      xoshiro256_step (s); \
+      x[i] = convert (result); \
+    } \
+  state->s[0] = s[0]; state->s[1] = s[1]; \
+  state->s[2] = s[2]; state->s[3] = s[3]; \
+}
+
+#define XOSHIRO256PP(s) (ROTL64 (s[0] + s[3], 23) + s[0])
+#define XOSHIRO256SS(s) (ROTL64 (s[1] * 5, 7) * 9)
+#define TO_INT(r) ((unsigned long int) ((r) >> 32))
+#define TO_DOUBLE(r) (((r) >> 11) / 9007199254740992.0)
+
+XOSHIRO256_FILL (xoshiro256pp_fill, unsigned long int, XOSHIRO256PP (s), TO_INT)
+XOSHIRO256_FILL (xoshiro256pp_fill_double, double, XOSHIRO256PP (s), TO_DOUBLE)
+XOSHIRO256_FILL (xoshiro256ss_fill, unsigned long int, XOSHIRO256SS (s), TO_INT)
+XOSHIRO256_FILL (xoshiro256ss_fill_double, double, XOSHIRO256SS (s), TO_DOUBLE)
+
+static void
+xoshiro256_set (void *vstate, unsigned long int seed)
+{
+  xoshiro256_state_t *state = (xoshiro256_state_t *) vstate;
+  uint64_t x = seed;
+  int i;
+
+  /* splitmix64, which never gives an all-zero state */
+  for (i = 0; i < 4; i++)
+    {
+      uint64_t z = (x += 0x9e3779b97f4a7c15ULL);
+      z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+      z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+      state->s[i] = z ^ (z >> 31);
+    }
+}
+
+/* replace the state by its image under the polynomial poly in the
+   transition matrix */
+static void
+xoshiro256_jump_poly_apply (uint64_t s[4], const uint64_t poly[4])
+{
+  uint64_t t[4] = { 0, 0, 0, 0 };
+  int i, b;
+
+  for (i = 0; i < 4; i++)
+    {
+      for (b = 0; b < 64; b++)
+        {
+          if (poly[i] & (1ULL << b))
+            {
+              t[0] ^= s[0];
+              t[1] ^= s[1];
+              t[2] ^= s[2];
+              t[3] ^= s[3];
+            }
+
+          xoshiro256_step (s);
+        }
+    }
+
+  s[0] = t[0];
+  s[1] = t[1];
+  s[2] = t[2];
+  s[3] = t[3];
+}
+
+static void
+xoshiro256_jump (void *vstate)
+{
+  xoshiro256_state_t *state = (xoshiro256_state_t *) vstate;
+  xoshiro256_jump_poly_apply (state->s, xoshiro256_jump_poly);
+}
+
+static void
+xoshiro256_long_jump (void *vstate)
+{
+  xoshiro256_state_t *state = (xoshiro256_state_t *) vstate;
+  xoshiro256_jump_poly_apply (state->s, xoshiro256_long_jump_poly);
+}
+
+static const gsl_rng_type xoshiro256pp_type = {
+  "xoshiro256pp",               /* name */
+  0xffffffffUL,                 /* RAND_MAX */
+  0,                            /* RAND_MIN */
+  sizeof (xoshiro256_state_t),
+  &xoshiro256_set,
+  &xoshiro256pp_get,
+  &xoshiro256pp_get_double,
+  &xoshiro256_jump,
+  &xoshiro256_long_jump,
+  0,                            /* streams are spaced by jumps */
+  &xoshiro256pp_fill,
+  &xoshiro256pp_fill_double
+};
+
+static const gsl_rng_type xoshiro256ss_type = {
+  "xoshiro256ss",               /* name */
+  0xffffffffUL,                 /* RAND_MAX */
+  0,                            /* RAND_MIN */
+  sizeof (xoshiro256_state_t),
+  &xoshiro256_set,
+  &xoshiro256ss_get,
+  &xoshiro256ss_get_double,
+  &xoshiro256_jump,
+  &xoshiro256_long_jump,
+  0,
+  &xoshiro256ss_fill,
+  &xoshiro256ss_fill_double
+};
+
+const gsl_rng_type *gsl_rng_xoshiro256pp = &xoshiro256pp_type;
+const gsl_rng_type *gsl_rng_xoshiro256ss = &xoshiro256ss_type;
@@ -0,0 +1,116 @@
+/* rstat/benchmark.c
+ *
+ * Copyright (C) 2026 Patrick Alken
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* compare throughput and accuracy of the P^2 quantile estimator
+ * with the t-digest sketch */
+
+#include <config.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <math.h>
+#include <gsl/gsl_rstat.h>
+#include <gsl/gsl_sort.h>
+#include <gsl/gsl_statistics.h>
+#include <gsl/gsl_rng.h>
+#include <gsl/gsl_randist.h>
+
+#define N 10000000
+
+static double
+rank_error(const double sorted_data[], const size_t n, const double p, const double q)
+{
+  size_t lo = 0, hi = n;
+
+  while (lo < hi)
+    {
+      size_t mid = (lo + hi) / 2;
+
+      if (sorted_data[mid] <= q)
+        lo = mid + 1;
+      else
+        hi = mid;
+    }
+
+  return fabs((double) lo / (double) n - p);
+}
+
+int
+main (void)
+{
+  const double p[] = { 0.5, 0.9, 0.99, 0.999 };
+  const size_t np = sizeof(p) / sizeof(double);
+  gsl_rng *r = gsl_rng_alloc(gsl_rng_default);
+  double *data = malloc(N * sizeof(double));
+  double *sorted_data = malloc(N * sizeof(double));
+  gsl_rstat_tdigest_workspace *tdigest_p = gsl_rstat_tdigest_alloc(200.0);
+  clock_t start;
+  double t;
+  size_t i, j;
+
+  for (i = 0; i < N; ++i)
+    data[i] = gsl_ran_lognormal(r, 0.0, 1.0);
+
+  memcpy(sorted_data, data, N * sizeof(double));
+  gsl_sort(sorted_data, 1, N);
+
+  printf("%d lognormal samples\n", N);
+
+  /* P^2 requires one workspace per quantile */
+  for (j = 0; j < np; ++j)
+    {
+      gsl_rstat_quantile_workspace *w = gsl_rstat_quantile_alloc(p[j]);
+      double q;
+
+      start = clock();
+      for (i = 0; i < N; ++i)
+        gsl_rstat_quantile_add(data[i], w);
+      t = (clock() - start) / (double) CLOCKS_PER_SEC;
+
+      q = gsl_rstat_quantile_get(w);
+      printf("P^2      p = %-6g %8.1f M adds/sec  rank error = %.2e\n",
+             p[j], N / t * 1.0e-6, rank_error(sorted_data, N, p[j], q));
+
+      gsl_rstat_quantile_free(w);
+    }
+
+  /* a single t-digest answers all quantiles */
+  start = clock();
+  for (i = 0; i < N; ++i)
+    gsl_rstat_tdigest_add(data[i], tdigest_p);
+  t = (clock() - start) / (double) CLOCKS_PER_SEC;
+
+  printf("t-digest (delta = %g, %zu centroids) %8.1f M adds/sec\n",
+         tdigest_p->delta, tdigest_p->ncentroid, N / t * 1.0e-6);
+
+  for (j = 0; j < np; ++j)
+    {
+      double q = gsl_rstat_tdigest_quantile(p[j], tdigest_p);
+      printf("t-digest p = %-6g rank error = %.2e\n",
+             p[j], rank_error(sorted_data, N, p[j], q));
+    }
+
+  free(data);
+  free(sorted_data);
+  gsl_rstat_tdigest_free(tdigest_p);
+  gsl_rng_free(r);
+
+  return 0;
+}
@@ -21,6 +21,7 @@
 #define __GSL_RSTAT_H__
 
 #include <stdlib.h>
+#include <stdio.h>
 
 #undef __BEGIN_DECLS
 #undef __END_DECLS
@@ -50,6 +51,35 @@ int gsl_rstat_quantile_reset(gsl_rstat_quantile_workspace *w);
 int gsl_rstat_quantile_add(const double x, gsl_rstat_quantile_workspace *w);
 double gsl_rstat_quantile_get(gsl_rstat_quantile_workspace *w);
 
+typedef struct
+{
+  double delta;           /* compression parameter */
+  size_t size;            /* maximum number of centroids */
+  size_t ncentroid;       /* number of merged centroids */
+  double *mean;           /* centroid means, size size */
+  double *weight;         /* centroid weights, size size */
+  size_t buffer_size;     /* maximum number of unmerged points */
+  size_t nbuffer;         /* number of unmerged points */
+  double *buffer_mean;    /* unmerged points, size buffer_size + size */
+  double *buffer_weight;  /* unmerged weights, size buffer_size + size */
+  double total_weight;    /* total weight of merged centroids */
+  double min;             /* minimum value added */
+  double max;             /* maximum value added */
+  size_t n;               /* number of data added */
+} gsl_rstat_tdigest_workspace;
+
+gsl_rstat_tdigest_workspace *gsl_rstat_tdigest_alloc(const double delta);
+void gsl_rstat_tdigest_free(gsl_rstat_tdigest_workspace *w);
+int gsl_rstat_tdigest_reset(gsl_rstat_tdigest_workspace *w);
+size_t gsl_rstat_tdigest_n(const gsl_rstat_tdigest_workspace *w);
+int gsl_rstat_tdigest_add(const double x, gsl_rstat_tdigest_workspace *w);
+int gsl_rstat_tdigest_merge(gsl_rstat_tdigest_workspace *dest,
+                            const gsl_rstat_tdigest_workspace *src);
+double gsl_rstat_tdigest_quantile(const double p, gsl_rstat_tdigest_workspace *w);
+double gsl_rstat_tdigest_cdf(const double x, gsl_rstat_tdigest_workspace *w);
+int gsl_rstat_tdigest_fwrite(FILE *stream, gsl_rstat_tdigest_workspace *w);
+int gsl_rstat_tdigest_fread(FILE *stream, gsl_rstat_tdigest_workspace *w);
+
 typedef struct
 {
   double min;      /* minimum value added */
@@ -66,6 +96,8 @@ gsl_rstat_workspace *gsl_rstat_alloc(void);
 void gsl_rstat_free(gsl_rstat_workspace *w);
 size_t gsl_rstat_n(const gsl_rstat_workspace *w);
 int gsl_rstat_add(const double x, gsl_rstat_workspace *w);
+int gsl_rstat_add_array(const double x[], const size_t stride, const size_t n,
+                        const int update_median, gsl_rstat_workspace *w);
 double gsl_rstat_min(const gsl_rstat_workspace *w);
 double gsl_rstat_max(const gsl_rstat_workspace *w);
 double gsl_rstat_mean(const gsl_rstat_workspace *w);
@@ -102,6 +102,133 @@ gsl_rstat_add(const double x, gsl_rstat_workspace *w)
   return GSL_SUCCESS;
 } /* gsl_rstat_add() */
 
+/*
+gsl_rstat_add_array()
+  Add an array of data to the running totals. The data are processed
+in blocks of RSTAT_BLOCK_SIZE points: the moments of each block are
+computed with two passes over the block, which is small enough to stay
+in cache and whose inner loops are free of divisions, and then merged
+into the accumulator with the pairwise update formulas of
+
+[1] T. F. Chan, G. H. Golub and R. J. LeVeque, "Updating formulae and a
+    pairwise algorithm for computing sample variances", Stanford
+    CS Technical Report STAN-CS-79-773, 1979
+
+[2] P. Pebay, "Formulas for robust, one-pass parallel computation of
+    covariances and arbitrary-order statistical moments", Sandia
+    Report SAND2008-6212, 2008
+
+The results agree with repeated calls to gsl_rstat_add() up to
+rounding error.
+
+Inputs: x            - data array
+        stride       - stride of x
+        n            - number of data points in x
+        update_median - if nonzero, also feed the data to the running
+                        median estimate; if zero, the median estimate
+                        is not updated
+        w            - workspace
+*/
+
+#define RSTAT_BLOCK_SIZE 256
+
+int
+gsl_rstat_add_array(const double x[], const size_t stride, const size_t n,
+                    const int update_median, gsl_rstat_workspace *w)
+{
+  size_t i;
+
+  for (i = 0; i < n; i += RSTAT_BLOCK_SIZE)
+    {
+      const double *xb = &x[i * stride];
+      const size_t nb = GSL_MIN(RSTAT_BLOCK_SIZE, n - i);
+      const double nB = (double) nb;
+      double minB = xb[0], maxB = xb[0];
+      double meanB = 0.0, M2B = 0.0, M3B = 0.0, M4B = 0.0;
+      double corr = 0.0;
+      size_t j;
+
+      /* first pass: block mean, min and max */
+      for (j = 0; j < nb; ++j)
+        {
+          const double xj = xb[j * stride];
+
+          meanB += xj;
+          if (xj < minB)
+            minB = xj;
+          if (xj > maxB)
+            maxB = xj;
+        }
+
+      meanB /= nB;
+
+      /* second pass: central moments of the block */
+      for (j = 0; j < nb; ++j)
+        {
+          const double d = xb[j * stride] - meanB;
+          const double d2 = d * d;
+
+          corr += d;
+          M2B += d2;
+          M3B += d2 * d;
+          M4B += d2 * d2;
+        }
+
+      /* correct for rounding error in the block mean */
+      corr /= nB;
+      meanB += corr;
+      M4B += corr * (-4.0 * M3B + corr * (6.0 * M2B - 3.0 * nB * corr * corr));
+      M3B += corr * (-3.0 * M2B + 2.0 * nB * corr * corr);
+      M2B -= nB * corr * corr;
+
+      /* merge block (B) into accumulator (A) */
+      if (w->n == 0)
+        {
+          w->min = minB;
+          w->max = maxB;
+          w->mean = meanB;
+          w->M2 = M2B;
+          w->M3 = M3B;
+          w->M4 = M4B;
+        }
+      else
+        {
+          const double nA = (double) w->n;
+          const double nAB = nA + nB;
+          const double delta = meanB - w->mean;
+          const double delta_n = delta / nAB;
+          const double delta_nsq = delta_n * delta_n;
+          const double term1 = delta * delta_n * nA * nB;
+          const double M2A = w->M2;
+          const double M3A = w->M3;
+
+          if (minB < w->min)
+            w->min = minB;
+          if (maxB > w->max)
+            w->max = maxB;
+
+          w->mean += nB * delta_n;
+          w->M4 += M4B + term1 * delta_nsq * (nA * nA - nA * nB + nB * nB) +
+                   6.0 * delta_nsq * (nA * nA * M2B + nB * nB * M2A) +
+                   4.0 * delta_n * (nA * M3B - nB * M3A);
+          w->M3 += M3B + term1 * delta_n * (nA - nB) +
+                   3.0 * delta_n * (nA * M2B - nB * M2A);
+          w->M2 += M2B + term1;
+        }
+
+      w->n += nb;
+    }
+
+  /* update median */
+  if (update_median)
+    {
+      for (i = 0; i < n; ++i)
+        gsl_rstat_quantile_add(x[i * stride], w->median_workspace_p);
+    }
+
+  return GSL_SUCCESS;
+} /* gsl_rstat_add_array() */
+
 double
 gsl_rstat_min(const gsl_rstat_workspace *w)
 {
@@ -0,0 +1,450 @@
+/* rstat/tdigest.c
+ *
+ * Copyright (C) 2026 Patrick Alken
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#include <config.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_block.h>
+#include <gsl/gsl_sort.h>
+#include <gsl/gsl_rstat.h>
+
+/*
+ * Mergeable quantile sketch based on the merging t-digest of
+ *
+ * [1] T. Dunning and O. Ertl, "Computing extremely accurate quantiles
+ *     using t-digests", arXiv:1902.04023, 2019
+ *
+ * New data are appended to an unsorted buffer. When the buffer is full,
+ * it is sorted together with the existing centroids and adjacent
+ * centroids are merged greedily, subject to the constraint that each
+ * centroid spans at most one unit of the scale function
+ *
+ * k(q) = delta / (2 pi) * asin(2q - 1)
+ *
+ * which keeps centroids small near the tails q = 0 and q = 1. The number
+ * of centroids is then bounded by delta + 1.
+ */
+
+static int tdigest_compress(gsl_rstat_tdigest_workspace *w);
+static int tdigest_add(const double x, const double weight,
+                       gsl_rstat_tdigest_workspace *w);
+static double tdigest_k(const double q, const double delta);
+static double tdigest_kinv(const double k, const double delta);
+
+gsl_rstat_tdigest_workspace *
+gsl_rstat_tdigest_alloc(const double delta)
+{
+  gsl_rstat_tdigest_workspace *w;
+
+  if (delta < 10.0)
+    {
+      GSL_ERROR_NULL ("compression parameter delta must be at least 10", GSL_EDOM);
+    }
+
+  w = calloc(1, sizeof(gsl_rstat_tdigest_workspace));
+  if (w == 0)
+    {
+      GSL_ERROR_NULL ("failed to allocate space for workspace", GSL_ENOMEM);
+    }
+
+  w->delta = delta;
+  w->size = (size_t) ceil(delta) + 2;
+  w->buffer_size = 5 * w->size;
+
+  w->mean = malloc(w->size * sizeof(double));
+  w->weight = malloc(w->size * sizeof(double));
+  w->buffer_mean = malloc((w->size + w->buffer_size) * sizeof(double));
+  w->buffer_weight = malloc((w->size + w->buffer_size) * sizeof(double));
+
+  if (w->mean == 0 || w->weight == 0 ||
+      w->buffer_mean == 0 || w->buffer_weight == 0)
+    {
+      gsl_rstat_tdigest_free(w);
+      GSL_ERROR_NULL ("failed to allocate space for centroids", GSL_ENOMEM);
+    }
+
+  gsl_rstat_tdigest_reset(w);
+
+  return w;
+} /* gsl_rstat_tdigest_alloc() */
+
+void
+gsl_rstat_tdigest_free(gsl_rstat_tdigest_workspace *w)
+{
+  if (w->mean)
+    free(w->mean);
+
+  if (w->weight)
+    free(w->weight);
+
+  if (w->buffer_mean)
+    free(w->buffer_mean);
+
+  if (w->buffer_weight)
+    free(w->buffer_weight);
+
+  free(w);
+} /* gsl_rstat_tdigest_free() */
+
+int
+gsl_rstat_tdigest_reset(gsl_rstat_tdigest_workspace *w)
+{
+  w->ncentroid = 0;
+  w->nbuffer = 0;
+  w->total_weight = 0.0;
+  w->min = 0.0;
+  w->max = 0.0;
+  w->n = 0;
+
+  return GSL_SUCCESS;
+} /* gsl_rstat_tdigest_reset() */
+
+size_t
+gsl_rstat_tdigest_n(const gsl_rstat_tdigest_workspace *w)
+{
+  return w->n;
+} /* gsl_rstat_tdigest_n() */
+
+int
+gsl_rstat_tdigest_add(const double x, gsl_rstat_tdigest_workspace *w)
+{
+  int status;
+
+  if (gsl_isnan(x))
+    {
+      GSL_ERROR ("invalid input argument x", GSL_EINVAL);
+    }
+
+  if (w->n == 0)
+    {
+      w->min = x;
+      w->max = x;
+    }
+  else
+    {
+      if (x < w->min)
+        w->min = x;
+      if (x > w->max)
+        w->max = x;
+    }
+
+  status = tdigest_add(x, 1.0, w);
+  ++(w->n);
+
+  return status;
+} /* gsl_rstat_tdigest_add() */
+
+/*
+gsl_rstat_tdigest_merge()
+  Merge the data summarized by src into dest. Both workspaces may
+have different compression parameters; the result has the compression
+of dest.
+*/
+
+int
+gsl_rstat_tdigest_merge(gsl_rstat_tdigest_workspace *dest,
+                        const gsl_rstat_tdigest_workspace *src)
+{
+  size_t i;
+
+  if (src->n == 0)
+    return GSL_SUCCESS;
+
+  for (i = 0; i < src->ncentroid; ++i)
+    tdigest_add(src->mean[i], src->weight[i], dest);
+
+  for (i = 0; i < src->nbuffer; ++i)
+    tdigest_add(src->buffer_mean[i], src->buffer_weight[i], dest);
+
+  /* min/max are tracked exactly, independently of the centroids */
+  if (dest->n == 0 || src->min < dest->min)
+    dest->min = src->min;
+  if (dest->n == 0 || src->max > dest->max)
+    dest->max = src->max;
+
+  dest->n += src->n;
+
+  return GSL_SUCCESS;
+} /* gsl_rstat_tdigest_merge() */
+
+double
+gsl_rstat_tdigest_quantile(const double p, gsl_rstat_tdigest_workspace *w)
+{
+  const double *mean, *weight;
+  double index, wsum;
+  size_t nc, i;
+
+  if (p < 0.0 || p > 1.0)
+    {
+      GSL_ERROR_VAL ("p must be in [0,1]", GSL_EDOM, GSL_NAN);
+    }
+
+  if (w->n == 0)
+    return GSL_NAN;
+
+  tdigest_compress(w);
+
+  mean = w->mean;
+  weight = w->weight;
+  nc = w->ncentroid;
+
+  if (p == 0.0)
+    return w->min;
+  else if (p == 1.0)
+    return w->max;
+  else if (nc == 1)
+    return mean[0];
+
+  index = p * w->total_weight;
+
+  /* left tail: interpolate between min and the first centroid */
+  if (index < 0.5 * weight[0])
+    return w->min + (mean[0] - w->min) * index / (0.5 * weight[0]);
+
+  wsum = 0.5 * weight[0];
+
+  for (i = 0; i < nc - 1; ++i)
+    {
+      const double dw = 0.5 * (weight[i] + weight[i + 1]);
+
+      if (wsum + dw > index)
+        {
+          const double z = (index - wsum) / dw;
+          return mean[i] + z * (mean[i + 1] - mean[i]);
+        }
+
+      wsum += dw;
+    }
+
+  /* right tail: interpolate between the last centroid and max */
+  {
+    const double z = (index - wsum) / (0.5 * weight[nc - 1]);
+    return mean[nc - 1] + GSL_MIN(z, 1.0) * (w->max - mean[nc - 1]);
+  }
+} /* gsl_rstat_tdigest_quantile() */
+
+double
+gsl_rstat_tdigest_cdf(const double x, gsl_rstat_tdigest_workspace *w)
+{
+  const double *mean, *weight;
+  double wsum;
+  size_t nc, i;
+
+  if (w->n == 0)
+    return GSL_NAN;
+
+  if (x < w->min)
+    return 0.0;
+  else if (x >= w->max)
+    return 1.0;
+
+  tdigest_compress(w);
+
+  mean = w->mean;
+  weight = w->weight;
+  nc = w->ncentroid;
+
+  if (nc == 1)
+    return (x - w->min) / (w->max - w->min);
+
+  if (x < mean[0])
+    return 0.5 * weight[0] * (x - w->min) / (mean[0] - w->min) / w->total_weight;
+
+  wsum = 0.5 * weight[0];
+
+  for (i = 0; i < nc - 1; ++i)
+    {
+      const double dw = 0.5 * (weight[i] + weight[i + 1]);
+
+      if (x < mean[i + 1])
+        {
+          const double z = (x - mean[i]) / (mean[i + 1] - mean[i]);
+          return (wsum + z * dw) / w->total_weight;
+        }
+
+      wsum += dw;
+    }
+
+  wsum += 0.5 * weight[nc - 1] * (x - mean[nc - 1]) / (w->max - mean[nc - 1]);
+
+  return wsum / w->total_weight;
+} /* gsl_rstat_tdigest_cdf() */
+
+/*
+gsl_rstat_tdigest_fwrite()
+  Write the digest to a binary stream. The buffer is first merged into
+the centroids so that only ncentroid (mean,weight) pairs are written,
+preceded by a header of (n, min, max, ncentroid).
+*/
+
+int
+gsl_rstat_tdigest_fwrite(FILE *stream, gsl_rstat_tdigest_workspace *w)
+{
+  double header[4];
+  int status;
+
+  tdigest_compress(w);
+
+  header[0] = (double) w->n;
+  header[1] = w->min;
+  header[2] = w->max;
+  header[3] = (double) w->ncentroid;
+
+  status = gsl_block_raw_fwrite(stream, header, 4, 1);
+  if (status)
+    return status;
+
+  status = gsl_block_raw_fwrite(stream, w->mean, w->ncentroid, 1);
+  if (status)
+    return status;
+
+  status = gsl_block_raw_fwrite(stream, w->weight, w->ncentroid, 1);
+
+  return status;
+} /* gsl_rstat_tdigest_fwrite() */
+
+int
+gsl_rstat_tdigest_fread(FILE *stream, gsl_rstat_tdigest_workspace *w)
+{
+  double header[4];
+  size_t nc, i;
+  int status;
+
+  status = gsl_block_raw_fread(stream, header, 4, 1);
+  if (status)
+    return status;
+
+  nc = (size_t) header[3];
+  if (nc > w->size)
+    {
+      GSL_ERROR ("stored digest has more centroids than workspace", GSL_EBADLEN);
+    }
+
+  status = gsl_block_raw_fread(stream, w->mean, nc, 1);
+  if (status)
+    return status;
+
+  status = gsl_block_raw_fread(stream, w->weight, nc, 1);
+  if (status)
+    return status;
+
+  w->n = (size_t) header[0];
+  w->min = header[1];
+  w->max = header[2];
+  w->ncentroid = nc;
+  w->nbuffer = 0;
+  w->total_weight = 0.0;
+
+  for (i = 0; i < nc; ++i)
+    w->total_weight += w->weight[i];
+
+  return GSL_SUCCESS;
+} /* gsl_rstat_tdigest_fread() */
+
+/* append a weighted point to the buffer, compressing when full */
+static int
+tdigest_add(const double x, const double weight, gsl_rstat_tdigest_workspace *w)
+{
+  if (w->nbuffer >= w->buffer_size)
+    tdigest_compress(w);
+
+  w->buffer_mean[w->nbuffer] = x;
+  w->buffer_weight[w->nbuffer] = weight;
+  ++(w->nbuffer);
+
+  return GSL_SUCCESS;
+}
+
+/* merge the buffer and existing centroids into a new set of centroids */
+static int
+tdigest_compress(gsl_rstat_tdigest_workspace *w)
+{
+  double *bmean = w->buffer_mean;
+  double *bweight = w->buffer_weight;
+  size_t ntot, i, nc;
+  double total = 0.0, wsofar, qlimit;
+
+  if (w->nbuffer == 0)
+    return GSL_SUCCESS;
+
+  /* the buffer has room for the current centroids after its data */
+  ntot = w->nbuffer + w->ncentroid;
+  memcpy(&bmean[w->nbuffer], w->mean, w->ncentroid * sizeof(double));
+  memcpy(&bweight[w->nbuffer], w->weight, w->ncentroid * sizeof(double));
+
+  gsl_sort2(bmean, 1, bweight, 1, ntot);
+
+  for (i = 0; i < ntot; ++i)
+    total += bweight[i];
+
+  nc = 0;
+  w->mean[0] = bmean[0];
+  w->weight[0] = bweight[0];
+  wsofar = 0.0;
+  qlimit = tdigest_kinv(tdigest_k(0.0, w->delta) + 1.0, w->delta);
+
+  for (i = 1; i < ntot; ++i)
+    {
+      const double proposed = w->weight[nc] + bweight[i];
+      const double q = (wsofar + proposed) / total;
+
+      if (q <= qlimit || nc + 1 >= w->size)
+        {
+          /* absorb point into current centroid */
+          w->weight[nc] = proposed;
+          w->mean[nc] += (bmean[i] - w->mean[nc]) * bweight[i] / proposed;
+        }
+      else
+        {
+          /* start a new centroid */
+          wsofar += w->weight[nc];
+          qlimit = tdigest_kinv(tdigest_k(wsofar / total, w->delta) + 1.0, w->delta);
+          ++nc;
+          w->mean[nc] = bmean[i];
+          w->weight[nc] = bweight[i];
+        }
+    }
+
+  w->ncentroid = nc + 1;
+  w->nbuffer = 0;
+  w->total_weight = total;
+
+  return GSL_SUCCESS;
+}
+
+static double
+tdigest_k(const double q, const double delta)
+{
+  return delta / (2.0 * M_PI) * asin(2.0 * q - 1.0);
+}
+
+static double
+tdigest_kinv(const double k, const double delta)
+{
+  double z = 2.0 * M_PI * k / delta;
+
+  if (z >= M_PI_2)
+    return 1.0;
+
+  return 0.5 * (sin(z) + 1.0);
+}
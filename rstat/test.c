@@ -94,6 +94,42 @@ test_basic(const size_t n, const double data[], const double tol)
   gsl_rstat_free(rstat_workspace_p);
 }
 
+void
+test_array(const size_t n, const size_t stride, const double data[], const double tol)
+{
+  gsl_rstat_workspace *w1 = gsl_rstat_alloc();
+  gsl_rstat_workspace *w2 = gsl_rstat_alloc();
+  gsl_rstat_workspace *w3 = gsl_rstat_alloc();
+  const size_t n1 = n / 3;
+  size_t i;
+
+  for (i = 0; i < n; ++i)
+    gsl_rstat_add(data[i * stride], w1);
+
+  /* add in two pieces to exercise merging with existing state */
+  gsl_rstat_add_array(data, stride, n1, 1, w2);
+  gsl_rstat_add_array(&data[n1 * stride], stride, n - n1, 1, w2);
+
+  gsl_rstat_add_array(data, stride, n, 0, w3);
+
+  gsl_test_int(gsl_rstat_n(w2), n, "array n n=%zu stride=%zu", n, stride);
+  gsl_test_rel(gsl_rstat_min(w2), gsl_rstat_min(w1), 0.0, "array min n=%zu stride=%zu", n, stride);
+  gsl_test_rel(gsl_rstat_max(w2), gsl_rstat_max(w1), 0.0, "array max n=%zu stride=%zu", n, stride);
+  gsl_test_rel(gsl_rstat_mean(w2), gsl_rstat_mean(w1), tol, "array mean n=%zu stride=%zu", n, stride);
+  gsl_test_rel(gsl_rstat_variance(w2), gsl_rstat_variance(w1), tol, "array variance n=%zu stride=%zu", n, stride);
+  gsl_test_rel(gsl_rstat_skew(w2), gsl_rstat_skew(w1), tol, "array skew n=%zu stride=%zu", n, stride);
+  gsl_test_rel(gsl_rstat_kurtosis(w2), gsl_rstat_kurtosis(w1), tol, "array kurtosis n=%zu stride=%zu", n, stride);
+  gsl_test_rel(gsl_rstat_median(w2), gsl_rstat_median(w1), 0.0, "array median n=%zu stride=%zu", n, stride);
+
+  gsl_test_int(gsl_rstat_n(w3), n, "array no median n n=%zu stride=%zu", n, stride);
+  gsl_test_rel(gsl_rstat_variance(w3), gsl_rstat_variance(w1), tol, "array no median variance n=%zu stride=%zu", n, stride);
+  gsl_test_rel(gsl_rstat_kurtosis(w3), gsl_rstat_kurtosis(w1), tol, "array no median kurtosis n=%zu stride=%zu", n, stride);
+
+  gsl_rstat_free(w1);
+  gsl_rstat_free(w2);
+  gsl_rstat_free(w3);
+}
+
 void
 test_quantile(const double p, const double data[], const size_t n,
               const double expected, const double tol, const char *desc)
@@ -115,6 +151,94 @@ test_quantile(const double p, const double data[], const size_t n,
   gsl_rstat_quantile_free(w);
 }
 
+/* fraction of sorted data which are <= x */
+static double
+empirical_cdf(const double sorted_data[], const size_t n, const double x)
+{
+  size_t lo = 0, hi = n;
+
+  while (lo < hi)
+    {
+      size_t mid = (lo + hi) / 2;
+
+      if (sorted_data[mid] <= x)
+        lo = mid + 1;
+      else
+        hi = mid;
+    }
+
+  return (double) lo / (double) n;
+}
+
+void
+test_tdigest(const double data[], const size_t n, const double tol, const char *desc)
+{
+  const double delta = 200.0;
+  const double p[] = { 0.001, 0.01, 0.1, 0.25, 0.5, 0.75, 0.9, 0.99, 0.999 };
+  const size_t np = sizeof(p) / sizeof(double);
+  const size_t n1 = n / 3;
+  gsl_rstat_tdigest_workspace *w = gsl_rstat_tdigest_alloc(delta);
+  gsl_rstat_tdigest_workspace *w1 = gsl_rstat_tdigest_alloc(delta);
+  gsl_rstat_tdigest_workspace *w2 = gsl_rstat_tdigest_alloc(delta);
+  gsl_rstat_tdigest_workspace *w3 = gsl_rstat_tdigest_alloc(delta);
+  double *sorted_data = malloc(n * sizeof(double));
+  FILE *f;
+  size_t i;
+
+  memcpy(sorted_data, data, n * sizeof(double));
+  gsl_sort(sorted_data, 1, n);
+
+  for (i = 0; i < n; ++i)
+    gsl_rstat_tdigest_add(data[i], w);
+
+  /* build two partial digests and merge them */
+  for (i = 0; i < n1; ++i)
+    gsl_rstat_tdigest_add(data[i], w1);
+
+  for (i = n1; i < n; ++i)
+    gsl_rstat_tdigest_add(data[i], w2);
+
+  gsl_rstat_tdigest_merge(w1, w2);
+
+  /* serialize and restore the merged digest */
+  f = tmpfile();
+  gsl_rstat_tdigest_fwrite(f, w1);
+  rewind(f);
+  gsl_rstat_tdigest_fread(f, w3);
+  fclose(f);
+
+  gsl_test_int(gsl_rstat_tdigest_n(w), n, "%s tdigest n", desc);
+  gsl_test_int(gsl_rstat_tdigest_n(w1), n, "%s tdigest merge n", desc);
+  gsl_test_int(gsl_rstat_tdigest_n(w3), n, "%s tdigest fread n", desc);
+  gsl_test(w->ncentroid > delta + 1, "%s tdigest ncentroid=%zu", desc, w->ncentroid);
+
+  gsl_test_rel(gsl_rstat_tdigest_quantile(0.0, w), sorted_data[0], 0.0, "%s tdigest min", desc);
+  gsl_test_rel(gsl_rstat_tdigest_quantile(1.0, w), sorted_data[n - 1], 0.0, "%s tdigest max", desc);
+
+  for (i = 0; i < np; ++i)
+    {
+      /* compare quantile ranks, which is how the sketch error is bounded */
+      double expected = gsl_stats_quantile_from_sorted_data(sorted_data, 1, n, p[i]);
+      double q = gsl_rstat_tdigest_quantile(p[i], w);
+      double q1 = gsl_rstat_tdigest_quantile(p[i], w1);
+      double q3 = gsl_rstat_tdigest_quantile(p[i], w3);
+      double cdf = gsl_rstat_tdigest_cdf(expected, w);
+
+      gsl_test_abs(empirical_cdf(sorted_data, n, q), p[i], tol,
+                   "%s tdigest quantile p=%g", desc, p[i]);
+      gsl_test_abs(empirical_cdf(sorted_data, n, q1), p[i], tol,
+                   "%s tdigest merged quantile p=%g", desc, p[i]);
+      gsl_test_rel(q3, q1, 1.0e-12, "%s tdigest fread quantile p=%g", desc, p[i]);
+      gsl_test_abs(cdf, p[i], tol, "%s tdigest cdf p=%g", desc, p[i]);
+    }
+
+  free(sorted_data);
+  gsl_rstat_tdigest_free(w);
+  gsl_rstat_tdigest_free(w1);
+  gsl_rstat_tdigest_free(w2);
+  gsl_rstat_tdigest_free(w3);
+}
+
 int
 main()
 {
@@ -144,6 +268,12 @@ main()
 
     test_basic(5, data2, tol1);
 
+    test_array(3, 1, data, tol1);
+    test_array(1000, 1, data, tol1);
+    test_array(1000, 3, data, tol1);
+    test_array(100000, 1, data, tol1);
+    test_array(5, 1, data2, tol1);
+
     free(data);
   }
 
@@ -212,6 +342,24 @@ main()
     gsl_rstat_free(rstat_workspace_p);
   }
 
+  {
+    const size_t n = 200000;
+    double *data = malloc(n * sizeof(double));
+    size_t i;
+
+    for (i = 0; i < n; ++i)
+      data[i] = gsl_rng_uniform(r);
+
+    test_tdigest(data, n, 2.0e-3, "uniform");
+
+    for (i = 0; i < n; ++i)
+      data[i] = gsl_ran_lognormal(r, 0.0, 2.0);
+
+    test_tdigest(data, n, 2.0e-3, "lognormal");
+
+    free(data);
+  }
+
   gsl_rng_free(r);
 
   exit (gsl_test_summary());
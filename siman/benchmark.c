@@ -0,0 +1,206 @@
+/* siman/benchmark.c
+ *
+ * Copyright (C) 2026 Patrick Alken
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* time to reach a target energy for a travelling salesman problem with
+ * n random cities in the unit square, using the moves of siman_tsp.c,
+ * for gsl_siman_solve and for gsl_siman_solve_parallel with 2, 4 and 8
+ * chains; each method is run with iters_fixed_T = 100, 200, 400, ...
+ * until the route is no longer than the target, and the total time is
+ * reported.  The default target is 1% above the best route found by 8
+ * chains with the longest schedule.  The chains are run by an OpenMP
+ * executor when compiled with -fopenmp, and serially otherwise; usage:
+ * benchmark [n] [target] */
+
+#include <config.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <math.h>
+#include <gsl/gsl_rng.h>
+#include <gsl/gsl_siman.h>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#define MAX_CITIES 1000
+#define MAX_CHAINS 8
+#define MIN_ITERS 100
+#define MAX_ITERS 6400
+
+static size_t n_cities;
+static double city_x[MAX_CITIES], city_y[MAX_CITIES];
+
+static double
+seconds (void)
+{
+#ifdef _OPENMP
+  return omp_get_wtime ();
+#else
+  return clock () / (double) CLOCKS_PER_SEC;
+#endif
+}
+
+static double
+Etsp (void *xp)
+{
+  const int *route = (const int *) xp;
+  double E = 0.0;
+  size_t i;
+
+  for (i = 0; i < n_cities; i++)
+    {
+      const int a = route[i], b = route[(i + 1) % n_cities];
+      E += hypot (city_x[a] - city_x[b], city_y[a] - city_y[b]);
+    }
+
+  return E;
+}
+
+/* swap two cities, leaving the first fixed */
+static void
+Stsp (const gsl_rng * r, void *xp, double step_size)
+{
+  int *route = (int *) xp;
+  size_t x1, x2;
+  int tmp;
+
+  (void) step_size;
+
+  x1 = gsl_rng_uniform_int (r, n_cities - 1) + 1;
+  do
+    {
+      x2 = gsl_rng_uniform_int (r, n_cities - 1) + 1;
+    }
+  while (x2 == x1);
+
+  tmp = route[x1];
+  route[x1] = route[x2];
+  route[x2] = tmp;
+}
+
+static void
+run_omp (size_t ntasks, void (*task) (size_t i, void *data),
+         void *data, void *params)
+{
+  int i;
+
+  (void) params;
+
+#pragma omp parallel for schedule(static)
+  for (i = 0; i < (int) ntasks; i++)
+    task (i, data);
+}
+
+/* run one annealing from the trivial route and return its energy */
+static double
+anneal (gsl_rng * r[], size_t n_chains, const gsl_executor * exec,
+        int iters, int route[])
+{
+  gsl_siman_params_t params = { 0, 0, 1.0, 1.0, 1.0, 1.005, 1.0e-3 };
+  size_t i;
+
+  params.iters_fixed_T = iters;
+
+  for (i = 0; i < n_cities; i++)
+    route[i] = i;
+
+  if (n_chains == 0)
+    gsl_siman_solve (r[0], route, Etsp, Stsp, NULL, NULL, NULL, NULL, NULL,
+                     n_cities * sizeof (int), params);
+  else
+    gsl_siman_solve_parallel (r, n_chains, 1.5, exec, route, Etsp, Stsp,
+                              NULL, NULL, NULL, NULL, NULL,
+                              n_cities * sizeof (int), params);
+
+  return Etsp (route);
+}
+
+int
+main (int argc, char *argv[])
+{
+  gsl_executor exec;
+  gsl_rng *r[MAX_CHAINS];
+  static int route[MAX_CITIES];
+  double target;
+  size_t n_chains, i;
+
+  n_cities = (argc > 1) ? (size_t) atol (argv[1]) : 50;
+
+  if (n_cities < 3 || n_cities > MAX_CITIES)
+    {
+      fprintf (stderr, "number of cities must be between 3 and %d\n",
+               MAX_CITIES);
+      return 1;
+    }
+
+  exec.run = &run_omp;
+  exec.params = 0;
+
+  for (i = 0; i < MAX_CHAINS; i++)
+    r[i] = gsl_rng_alloc_substream (gsl_rng_philox4x64, 1, i);
+
+  for (i = 0; i < n_cities; i++)
+    {
+      city_x[i] = gsl_rng_uniform (r[0]);
+      city_y[i] = gsl_rng_uniform (r[0]);
+    }
+
+  if (argc > 2)
+    {
+      target = atof (argv[2]);
+    }
+  else
+    {
+      target = 1.01 * anneal (r, MAX_CHAINS, &exec, MAX_ITERS, route);
+    }
+
+  printf ("cities = %zu, target energy = %g\n", n_cities, target);
+
+  for (n_chains = 0; n_chains <= MAX_CHAINS; n_chains = (n_chains ? 2 * n_chains : 2))
+    {
+      double start = seconds (), E = 0.0;
+      int iters;
+
+      for (iters = MIN_ITERS; iters <= MAX_ITERS; iters *= 2)
+        {
+          E = anneal (r, n_chains, &exec, iters, route);
+
+          if (E <= target)
+            break;
+        }
+
+      if (n_chains == 0)
+        printf ("%-26s          ", "gsl_siman_solve");
+      else
+        printf ("%-26s %2zu chains", "gsl_siman_solve_parallel", n_chains);
+
+      if (E <= target)
+        printf ("  %8.3f s  iters_fixed_T = %5d  E = %g\n",
+                seconds () - start, iters, E);
+      else
+        printf ("  %8.3f s  target not reached, E = %g\n",
+                seconds () - start, E);
+    }
+
+  for (i = 0; i < MAX_CHAINS; i++)
+    gsl_rng_free (r[i]);
+
+  return 0;
+}
@@ -21,6 +21,7 @@
 #define __GSL_SIMAN_H__
 #include <stdlib.h>
 #include <gsl/gsl_rng.h>
+#include <gsl/gsl_executor.h>
 
 #undef __BEGIN_DECLS
 #undef __END_DECLS
@@ -77,6 +78,21 @@ gsl_siman_solve_many (const gsl_rng * r, void *x0_p, gsl_siman_Efunc_t Ef,
                       size_t element_size,
                       gsl_siman_params_t params);
 
+/* replica exchange with n_chains chains at temperatures T, T t_ratio,
+   T t_ratio^2, ..., with the generators r[0], ..., r[n_chains-1] */
+
+int gsl_siman_solve_parallel (gsl_rng * r[], size_t n_chains, double t_ratio,
+                              const gsl_executor * exec,
+                              void *x0_p, gsl_siman_Efunc_t Ef,
+                              gsl_siman_step_t take_step,
+                              gsl_siman_metric_t distance,
+                              gsl_siman_print_t print_position,
+                              gsl_siman_copy_t copyfunc,
+                              gsl_siman_copy_construct_t copy_constructor,
+                              gsl_siman_destroy_t destructor,
+                              size_t element_size,
+                              gsl_siman_params_t params);
+
 __END_DECLS
 
 #endif /* __GSL_SIMAN_H__ */
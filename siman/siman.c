@@ -26,6 +26,7 @@
 #include <assert.h>
 
 #include <gsl/gsl_machine.h>
+#include <gsl/gsl_errno.h>
 #include <gsl/gsl_rng.h>
 #include <gsl/gsl_siman.h>
 
@@ -47,6 +48,92 @@ copy_state(void *src, void *dst, size_t size, gsl_siman_copy_t copyfunc)
   }
 }
       
+/* a Markov chain of configurations at temperature T, with the best
+   configuration it has visited */
+
+typedef struct
+{
+  const gsl_rng *r;
+  void *x, *new_x, *best_x;
+  double E, best_E, T;
+}
+siman_chain;
+
+/* configurations are created with copy_constructor and destroyed with
+   destructor if copyfunc is given (the variable-size mode), and with
+   malloc and free otherwise */
+
+static void *
+alloc_state (void *x0_p, gsl_siman_copy_t copyfunc,
+             gsl_siman_copy_construct_t copy_constructor,
+             size_t element_size)
+{
+  void *x;
+
+  if (copyfunc) {
+    return copy_constructor (x0_p);
+  }
+
+  x = malloc (element_size);
+
+  if (x) {
+    memcpy (x, x0_p, element_size);
+  }
+
+  return x;
+}
+
+static void
+free_state (void *x, gsl_siman_copy_t copyfunc, gsl_siman_destroy_t destructor)
+{
+  if (x == NULL) {
+    return;
+  }
+
+  if (copyfunc) {
+    destructor (x);
+  } else {
+    free (x);
+  }
+}
+
+/* take params->iters_fixed_T Metropolis steps of the chain c at its
+   temperature */
+
+static void
+metropolis (siman_chain * c, gsl_siman_Efunc_t Ef,
+            gsl_siman_step_t take_step, gsl_siman_copy_t copyfunc,
+            size_t element_size, gsl_siman_params_t * params)
+{
+  double new_E;
+  int i;
+
+  for (i = 0; i < params->iters_fixed_T; ++i) {
+
+    copy_state(c->x, c->new_x, element_size, copyfunc);
+
+    take_step (c->r, c->new_x, params->step_size);
+    new_E = Ef (c->new_x);
+
+    if (new_E <= c->best_E) {
+      copy_state(c->new_x, c->best_x, element_size, copyfunc);
+      c->best_E = new_E;
+    }
+
+    /* now take the crucial step: see if the new point is accepted
+       or not, as determined by the boltzmann probability */
+    if (new_E < c->E) {
+      /* yay! take a step */
+      copy_state(c->new_x, c->x, element_size, copyfunc);
+      c->E = new_E;
+    } else if (gsl_rng_uniform(c->r) < boltzmann(c->E, new_E, c->T, params)) {
+      /* yay! take a step */
+      copy_state(c->new_x, c->x, element_size, copyfunc);
+      c->E = new_E;
+    }
+  }
+}
+
 /* implementation of a basic simulated annealing algorithm */
 
 void 
@@ -60,11 +147,9 @@ gsl_siman_solve (const gsl_rng * r, void *x0_p, gsl_siman_Efunc_t Ef,
                  size_t element_size,
                  gsl_siman_params_t params)
 {
-  void *x, *new_x, *best_x;
-  double E, new_E, best_E;
-  int i;
-  double T, T_factor;
-  int n_evals = 1, n_iter = 0, n_accepts, n_rejects, n_eless;
+  siman_chain c;
+  double T_factor;
+  int n_evals = 1, n_iter = 0;
 
   /* this function requires that either the dynamic functions (copy,
      copy_constructor and destrcutor) are passed, or that an element
@@ -73,89 +158,224 @@ gsl_siman_solve (const gsl_rng * r, void *x0_p, gsl_siman_Efunc_t Ef,
          || (element_size != 0));
 
   distance = 0 ; /* This parameter is not currently used */
-  E = Ef(x0_p);
 
-  if (copyfunc) {
-    x = copy_constructor(x0_p);
-    new_x = copy_constructor(x0_p);
-    best_x = copy_constructor(x0_p);
-  } else {
-    x = (void *) malloc (element_size);
-    memcpy (x, x0_p, element_size);
-    new_x = (void *) malloc (element_size);
-    best_x =  (void *) malloc (element_size);
-    memcpy (best_x, x0_p, element_size);
+  c.r = r;
+  c.E = Ef(x0_p);
+  c.x = alloc_state (x0_p, copyfunc, copy_constructor, element_size);
+  c.new_x = alloc_state (x0_p, copyfunc, copy_constructor, element_size);
+  c.best_x = alloc_state (x0_p, copyfunc, copy_constructor, element_size);
+  c.best_E = c.E;
+  c.T = params.t_initial;
+
+  T_factor = 1.0 / params.mu_t;
+
+  if (print_position) {
+    printf ("#-iter  #-evals   temperature     position   energy\n");
   }
 
-  best_E = E;
+  while (1) {
+
+    metropolis (&c, Ef, take_step, copyfunc, element_size, &params);
+    n_evals += params.iters_fixed_T; /* keep track of Ef() evaluations */
+
+    if (print_position) {
+      /* see if we need to print stuff as we go */
+      printf ("%5d   %7d  %12g", n_iter, n_evals, c.T);
+      print_position (c.x);
+      printf ("  %12g  %12g\n", c.E, c.best_E);
+    }
+
+    /* apply the cooling schedule to the temperature */
+    /* FIXME: I should also introduce a cooling schedule for the iters */
+    c.T *= T_factor;
+    ++n_iter;
+    if (c.T < params.t_min) {
+      break;
+    }
+  }
+
+  /* at the end, copy the result onto the initial point, so we pass it
+     back to the caller */
+  copy_state(c.best_x, x0_p, element_size, copyfunc);
+
+  free_state (c.x, copyfunc, destructor);
+  free_state (c.new_x, copyfunc, destructor);
+  free_state (c.best_x, copyfunc, destructor);
+}
+
+/* Replica exchange (parallel tempering). The chains run at the
+   temperatures T, T t_ratio, T t_ratio^2, ..., where T follows the
+   cooling schedule of gsl_siman_solve. After each block of
+   iters_fixed_T steps, which the chains take as independent tasks,
+   the configurations of adjacent chains i, i+1 are exchanged with
+   probability
+
+     min(1, exp((E_i - E_{i+1}) (1/(k T_i) - 1/(k T_{i+1}))))
+
+   for the even pairs after even blocks and the odd pairs after odd
+   blocks, using the generator r[0]. The exchanges are made serially,
+   so the result does not depend on how the tasks are scheduled. */
+
+typedef struct
+{
+  siman_chain *chain;
+  gsl_siman_Efunc_t Ef;
+  gsl_siman_step_t take_step;
+  gsl_siman_copy_t copyfunc;
+  size_t element_size;
+  gsl_siman_params_t *params;
+}
+siman_replicas;
+
+static void
+replica_task (size_t i, void *data)
+{
+  siman_replicas *w = (siman_replicas *) data;
+
+  metropolis (&w->chain[i], w->Ef, w->take_step, w->copyfunc,
+              w->element_size, w->params);
+}
+
+static void
+exchange_replicas (siman_chain * chain, size_t n_chains, int parity,
+                   const gsl_rng * r, double k)
+{
+  size_t i;
+
+  for (i = parity; i + 1 < n_chains; i += 2) {
+    siman_chain *a = &chain[i], *b = &chain[i + 1];
+    double x = (a->E - b->E) * (1.0 / (k * a->T) - 1.0 / (k * b->T));
+
+    if (x >= 0.0 || (x >= GSL_LOG_DBL_MIN && gsl_rng_uniform (r) < exp (x))) {
+      void *tmp = a->x;
+      double E = a->E;
+
+      a->x = b->x;
+      a->E = b->E;
+      b->x = tmp;
+      b->E = E;
+    }
+  }
+}
+
+static void
+free_chains (siman_chain * chain, size_t n_chains, gsl_siman_copy_t copyfunc,
+             gsl_siman_destroy_t destructor)
+{
+  size_t i;
+
+  for (i = 0; i < n_chains; ++i) {
+    free_state (chain[i].x, copyfunc, destructor);
+    free_state (chain[i].new_x, copyfunc, destructor);
+    free_state (chain[i].best_x, copyfunc, destructor);
+  }
+
+  free (chain);
+}
+
+int
+gsl_siman_solve_parallel (gsl_rng * r[], size_t n_chains, double t_ratio,
+                          const gsl_executor * exec,
+                          void *x0_p, gsl_siman_Efunc_t Ef,
+                          gsl_siman_step_t take_step,
+                          gsl_siman_metric_t distance,
+                          gsl_siman_print_t print_position,
+                          gsl_siman_copy_t copyfunc,
+                          gsl_siman_copy_construct_t copy_constructor,
+                          gsl_siman_destroy_t destructor,
+                          size_t element_size,
+                          gsl_siman_params_t params)
+{
+  siman_chain *chain;
+  siman_replicas w;
+  double T, T_factor, best_E;
+  size_t i, best;
+  int n_evals = 1, n_iter = 0;
+
+  if (n_chains == 0) {
+    GSL_ERROR ("number of chains must be positive", GSL_EINVAL);
+  }
+
+  if (!(t_ratio >= 1.0)) {
+    GSL_ERROR ("temperature ratio must be at least 1", GSL_EINVAL);
+  }
+
+  if (copyfunc != NULL && (copy_constructor == NULL || destructor == NULL)) {
+    GSL_ERROR ("copy constructor and destructor must be given with copyfunc",
+               GSL_EINVAL);
+  }
+
+  if (copyfunc == NULL && element_size == 0) {
+    GSL_ERROR ("copy functions or element size must be given", GSL_EINVAL);
+  }
+
+  (void) distance; /* This parameter is not currently used */
+
+  chain = calloc (n_chains, sizeof (siman_chain));
+
+  if (chain == 0) {
+    GSL_ERROR ("failed to allocate space for chains", GSL_ENOMEM);
+  }
 
   T = params.t_initial;
   T_factor = 1.0 / params.mu_t;
 
+  for (i = 0; i < n_chains; ++i) {
+    siman_chain *c = &chain[i];
+
+    c->r = r[i];
+    c->x = alloc_state (x0_p, copyfunc, copy_constructor, element_size);
+    c->new_x = alloc_state (x0_p, copyfunc, copy_constructor, element_size);
+    c->best_x = alloc_state (x0_p, copyfunc, copy_constructor, element_size);
+
+    if (c->x == 0 || c->new_x == 0 || c->best_x == 0) {
+      free_chains (chain, n_chains, copyfunc, destructor);
+      GSL_ERROR ("failed to allocate space for configurations", GSL_ENOMEM);
+    }
+
+    c->E = (i == 0) ? Ef (x0_p) : chain[0].E;
+    c->best_E = c->E;
+  }
+
+  w.chain = chain;
+  w.Ef = Ef;
+  w.take_step = take_step;
+  w.copyfunc = copyfunc;
+  w.element_size = element_size;
+  w.params = &params;
+
   if (print_position) {
     printf ("#-iter  #-evals   temperature     position   energy\n");
   }
 
   while (1) {
 
-    n_accepts = 0;
-    n_rejects = 0;
-    n_eless = 0;
+    chain[0].T = T;
 
-    for (i = 0; i < params.iters_fixed_T; ++i) {
+    for (i = 1; i < n_chains; ++i) {
+      chain[i].T = chain[i - 1].T * t_ratio;
+    }
 
-      copy_state(x, new_x, element_size, copyfunc);
+    gsl_executor_run (exec, n_chains, &replica_task, &w);
 
-      take_step (r, new_x, params.step_size);
-      new_E = Ef (new_x);
+    n_evals += params.iters_fixed_T * (int) n_chains;
 
-      if(new_E <= best_E){
-        if (copyfunc) {
-          copyfunc(new_x,best_x);
-        } else {
-          memcpy (best_x, new_x, element_size);
-        }
-        best_E=new_E;
-      }
+    exchange_replicas (chain, n_chains, n_iter % 2, r[0], params.k);
+
+    if (print_position) {
+      best_E = chain[0].best_E;
 
-      ++n_evals;                /* keep track of Ef() evaluations */
-      /* now take the crucial step: see if the new point is accepted
-         or not, as determined by the boltzmann probability */
-      if (new_E < E) {
-
-	if (new_E < best_E) {
-	  copy_state(new_x, best_x, element_size, copyfunc);
-	  best_E = new_E;
-	}
-
-        /* yay! take a step */
-	copy_state(new_x, x, element_size, copyfunc);
-        E = new_E;
-        ++n_eless;
-
-      } else if (gsl_rng_uniform(r) < boltzmann(E, new_E, T, &params)) {
-        /* yay! take a step */
-	copy_state(new_x, x, element_size, copyfunc);
-        E = new_E;
-        ++n_accepts;
-
-      } else {
-        ++n_rejects;
+      for (i = 1; i < n_chains; ++i) {
+        if (chain[i].best_E < best_E) {
+          best_E = chain[i].best_E;
+        }
       }
-    }
 
-    if (print_position) {
-      /* see if we need to print stuff as we go */
-      /*       printf("%5d %12g %5d %3d %3d %3d", n_iter, T, n_evals, */
-      /*           100*n_eless/n_steps, 100*n_accepts/n_steps, */
-      /*           100*n_rejects/n_steps); */
       printf ("%5d   %7d  %12g", n_iter, n_evals, T);
-      print_position (x);
-      printf ("  %12g  %12g\n", E, best_E);
+      print_position (chain[0].x);
+      printf ("  %12g  %12g\n", chain[0].E, best_E);
     }
 
-    /* apply the cooling schedule to the temperature */
-    /* FIXME: I should also introduce a cooling schedule for the iters */
     T *= T_factor;
     ++n_iter;
     if (T < params.t_min) {
@@ -163,19 +383,20 @@ gsl_siman_solve (const gsl_rng * r, void *x0_p, gsl_siman_Efunc_t Ef,
     }
   }
 
-  /* at the end, copy the result onto the initial point, so we pass it
-     back to the caller */
-  copy_state(best_x, x0_p, element_size, copyfunc);
+  /* return the best configuration found by any chain */
+  best = 0;
 
-  if (copyfunc) {
-    destructor(x);
-    destructor(new_x);
-    destructor(best_x);
-  } else {
-    free (x);
-    free (new_x);
-    free (best_x);
+  for (i = 1; i < n_chains; ++i) {
+    if (chain[i].best_E < chain[best].best_E) {
+      best = i;
+    }
   }
+
+  copy_state(chain[best].best_x, x0_p, element_size, copyfunc);
+
+  free_chains (chain, n_chains, copyfunc, destructor);
+
+  return GSL_SUCCESS;
 }
 
 /* implementation of a simulated annealing algorithm with many tries */
@@ -78,6 +78,89 @@ void P1(void *xp)
   printf(" %12g ", *((double *) xp));
 }
 
+/* copy functions for the variable-size mode */
+
+void C1(void *source, void *dest)
+{
+  memcpy(dest, source, sizeof(double));
+}
+
+void *CC1(void *xp)
+{
+  double *x = malloc(sizeof(double));
+  memcpy(x, xp, sizeof(double));
+  return x;
+}
+
+void D1(void *xp)
+{
+  free(xp);
+}
+
+#define N_CHAINS 4
+
+/* an executor which runs the tasks in reverse order */
+static void
+reverse_run (size_t ntasks, void (*task) (size_t i, void *data),
+             void *data, void *p)
+{
+  size_t i;
+
+  (void) p;
+
+  for (i = ntasks; i-- > 0;)
+    task (i, data);
+}
+
+const gsl_executor reverse_exec = { &reverse_run, 0 };
+
+void test_parallel (double x0, double x_min);
+
+void test_parallel (double x0, double x_min)
+{
+  gsl_rng * r1[N_CHAINS], * r2[N_CHAINS];
+  double x1, x2;
+  size_t i;
+  int status;
+
+  for (i = 0; i < N_CHAINS; i++)
+    {
+      r1[i] = gsl_rng_alloc_substream (gsl_rng_philox4x64, 1, i);
+      r2[i] = gsl_rng_alloc_substream (gsl_rng_philox4x64, 1, i);
+    }
+
+  /* a single chain is the same as gsl_siman_solve */
+
+  x1 = x0;
+  gsl_siman_solve(r1[0], &x1, E1, S1, M1, NULL, NULL, NULL, NULL,
+                  sizeof(double), params);
+
+  x2 = x0;
+  status = gsl_siman_solve_parallel(r2, 1, 2.0, NULL, &x2, E1, S1, M1, NULL,
+                                    NULL, NULL, NULL, sizeof(double), params);
+  gsl_test(status, "siman_solve_parallel, 1 chain, x0=%g, status", x0);
+  gsl_test(x1 != x2, "siman_solve_parallel, 1 chain, x0=%g, same as siman_solve", x0);
+
+  /* the result does not depend on the order of the tasks */
+
+  x1 = x0;
+  gsl_siman_solve_parallel(r1, N_CHAINS, 2.0, NULL, &x1, E1, S1, M1, NULL,
+                           NULL, NULL, NULL, sizeof(double), params);
+  gsl_test_rel(x1, x_min, 1e-3, "siman_solve_parallel, %d chains, x0=%g",
+               N_CHAINS, x0);
+
+  x2 = x0;
+  gsl_siman_solve_parallel(r2, N_CHAINS, 2.0, &reverse_exec, &x2, E1, S1, M1,
+                           NULL, C1, CC1, D1, 0, params);
+  gsl_test(x1 != x2, "siman_solve_parallel, %d chains, x0=%g, reproducible in reverse order", N_CHAINS, x0);
+
+  for (i = 0; i < N_CHAINS; i++)
+    {
+      gsl_rng_free (r1[i]);
+      gsl_rng_free (r2[i]);
+    }
+}
+
 int main(void)
 {
   double x_min = 1.36312999455315182 ;
@@ -118,6 +201,9 @@ int main(void)
                   sizeof(double), params);
   gsl_test_rel(x, x_min, 1e-3, "f(x)= exp(-(x-1)^2) sin(8x), x0=0.4") ;
 
+  test_parallel (-10.0, x_min);
+  test_parallel (+0.6, x_min);
+
   gsl_rng_free(r);
   exit (gsl_test_summary ());
 
@@ -0,0 +1,188 @@
+/* sort/benchmark.c
+ *
+ * Copyright (C) 2026 Patrick Alken
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* timings of gsl_sort, gsl_sort (stride 2, comparison sort only),
+ * gsl_sort2, gsl_sort_index and qsort on random, sorted, reversed and few-unique inputs,
+ * followed by the wall clock times of gsl_sort_parallel and
+ * gsl_sort_index_parallel on random input for 1, 2, 4, ... tasks up to
+ * max_tasks.  The tasks are run by an OpenMP executor when compiled with
+ * -fopenmp, and serially otherwise; usage: benchmark [n] [max_tasks] */
+
+#include <config.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <gsl/gsl_sort.h>
+#include <gsl/gsl_rng.h>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+enum { RANDOM, SORTED, REVERSED, FEW_UNIQUE };
+
+static const char *input_names[] = { "random", "sorted", "reversed", "few-unique" };
+
+static int
+compare_doubles (const void *a, const void *b)
+{
+  const double x = *(const double *) a, y = *(const double *) b;
+  return (x > y) - (x < y);
+}
+
+static double
+seconds (clock_t start)
+{
+  return (clock () - start) / (double) CLOCKS_PER_SEC;
+}
+
+static double
+wall_seconds (void)
+{
+#ifdef _OPENMP
+  return omp_get_wtime ();
+#else
+  return clock () / (double) CLOCKS_PER_SEC;
+#endif
+}
+
+static void
+run_omp (size_t ntasks, void (*task) (size_t i, void *data),
+         void *data, void *params)
+{
+  int i;
+
+  (void) params;
+
+#pragma omp parallel for schedule(static)
+  for (i = 0; i < (int) ntasks; i++)
+    task (i, data);
+}
+
+static void
+fill (const int input, double *x, const size_t n, const gsl_rng * r)
+{
+  size_t i;
+
+  for (i = 0; i < n; ++i)
+    {
+      switch (input)
+        {
+          case RANDOM:
+            x[i] = gsl_rng_uniform (r) - 0.5;
+            break;
+
+          case SORTED:
+            x[i] = (double) i;
+            break;
+
+          case REVERSED:
+            x[i] = (double) (n - i);
+            break;
+
+          case FEW_UNIQUE:
+            x[i] = (double) gsl_rng_uniform_int (r, 16);
+            break;
+        }
+    }
+}
+
+int
+main (int argc, char *argv[])
+{
+  const size_t n = (argc > 1) ? (size_t) atol (argv[1]) : 10000000;
+  const size_t max_tasks = (argc > 2) ? (size_t) atol (argv[2]) : 8;
+  gsl_executor exec;
+  size_t ntasks;
+  gsl_rng *r = gsl_rng_alloc (gsl_rng_default);
+  double *x = malloc (2 * n * sizeof (double));
+  double *y = malloc (n * sizeof (double));
+  size_t *p = malloc (n * sizeof (size_t));
+  int input;
+
+  printf ("n = %zu\n", n);
+  printf ("%12s %10s %10s %10s %10s %10s\n", "input", "sort", "sort_s2", "sort2", "index", "qsort");
+
+  for (input = RANDOM; input <= FEW_UNIQUE; ++input)
+    {
+      double t_sort, t_stride, t_sort2, t_index, t_qsort;
+      size_t i;
+      clock_t start;
+
+      fill (input, x, n, r);
+      start = clock ();
+      gsl_sort (x, 1, n);
+      t_sort = seconds (start);
+
+      fill (input, y, n, r);
+      for (i = 0; i < n; ++i)
+        x[2 * i] = y[i];
+      start = clock ();
+      gsl_sort (x, 2, n);
+      t_stride = seconds (start);
+
+      fill (input, x, n, r);
+      fill (input, y, n, r);
+      start = clock ();
+      gsl_sort2 (x, 1, y, 1, n);
+      t_sort2 = seconds (start);
+
+      fill (input, x, n, r);
+      start = clock ();
+      gsl_sort_index (p, x, 1, n);
+      t_index = seconds (start);
+
+      fill (input, x, n, r);
+      start = clock ();
+      qsort (x, n, sizeof (double), compare_doubles);
+      t_qsort = seconds (start);
+
+      printf ("%12s %10.3f %10.3f %10.3f %10.3f %10.3f\n",
+              input_names[input], t_sort, t_stride, t_sort2, t_index, t_qsort);
+    }
+
+  exec.run = &run_omp;
+  exec.params = 0;
+
+  printf ("\n%12s %10s %10s\n", "ntasks", "parallel", "index");
+
+  for (ntasks = 1; ntasks <= max_tasks; ntasks *= 2)
+    {
+      double t_sort, t_index, start;
+
+      fill (RANDOM, x, n, r);
+      start = wall_seconds ();
+      gsl_sort_parallel (x, 1, n, ntasks, &exec);
+      t_sort = wall_seconds () - start;
+
+      fill (RANDOM, x, n, r);
+      start = wall_seconds ();
+      gsl_sort_index_parallel (p, x, 1, n, ntasks, &exec);
+      t_index = wall_seconds () - start;
+
+      printf ("%12zu %10.3f %10.3f\n", ntasks, t_sort, t_index);
+    }
+
+  free (x);
+  free (y);
+  free (p);
+  gsl_rng_free (r);
+
+  return 0;
+}
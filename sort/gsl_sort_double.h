@@ -23,6 +23,7 @@
 #include <stdlib.h>
 #include <gsl/gsl_errno.h>
 #include <gsl/gsl_permutation.h>
+#include <gsl/gsl_executor.h>
 
 #undef __BEGIN_DECLS
 #undef __END_DECLS
@@ -40,6 +41,9 @@ void gsl_sort (double * data, const size_t stride, const size_t n);
 void gsl_sort2 (double * data1, const size_t stride1, double * data2, const size_t stride2, const size_t n);
 void gsl_sort_index (size_t * p, const double * data, const size_t stride, const size_t n);
 
+int gsl_sort_parallel (double * data, const size_t stride, const size_t n, const size_t ntasks, const gsl_executor * exec);
+int gsl_sort_index_parallel (size_t * p, const double * data, const size_t stride, const size_t n, const size_t ntasks, const gsl_executor * exec);
+
 int gsl_sort_smallest (double * dest, const size_t k, const double * src, const size_t stride, const size_t n);
 int gsl_sort_smallest_index (size_t * p, const size_t k, const double * src, const size_t stride, const size_t n);
 
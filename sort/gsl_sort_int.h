@@ -23,6 +23,7 @@
 #include <stdlib.h>
 #include <gsl/gsl_errno.h>
 #include <gsl/gsl_permutation.h>
+#include <gsl/gsl_executor.h>
 
 #undef __BEGIN_DECLS
 #undef __END_DECLS
@@ -40,6 +41,9 @@ void gsl_sort_int (int * data, const size_t stride, const size_t n);
 void gsl_sort2_int (int * data1, const size_t stride1, int * data2, const size_t stride2, const size_t n);
 void gsl_sort_int_index (size_t * p, const int * data, const size_t stride, const size_t n);
 
+int gsl_sort_int_parallel (int * data, const size_t stride, const size_t n, const size_t ntasks, const gsl_executor * exec);
+int gsl_sort_int_index_parallel (size_t * p, const int * data, const size_t stride, const size_t n, const size_t ntasks, const gsl_executor * exec);
+
 int gsl_sort_int_smallest (int * dest, const size_t k, const int * src, const size_t stride, const size_t n);
 int gsl_sort_int_smallest_index (size_t * p, const size_t k, const int * src, const size_t stride, const size_t n);
 
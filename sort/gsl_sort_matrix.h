@@ -0,0 +1,20 @@
+#ifndef __GSL_SORT_MATRIX_H__
+#define __GSL_SORT_MATRIX_H__
+
+#include <gsl/gsl_sort_matrix_long_double.h>
+#include <gsl/gsl_sort_matrix_double.h>
+#include <gsl/gsl_sort_matrix_float.h>
+
+#include <gsl/gsl_sort_matrix_ulong.h>
+#include <gsl/gsl_sort_matrix_long.h>
+
+#include <gsl/gsl_sort_matrix_uint.h>
+#include <gsl/gsl_sort_matrix_int.h>
+
+#include <gsl/gsl_sort_matrix_ushort.h>
+#include <gsl/gsl_sort_matrix_short.h>
+
+#include <gsl/gsl_sort_matrix_uchar.h>
+#include <gsl/gsl_sort_matrix_char.h>
+
+#endif /* __GSL_SORT_MATRIX_H__ */
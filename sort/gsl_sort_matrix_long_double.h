@@ -0,0 +1,47 @@
+/* sort/gsl_sort_matrix_long_double.h
+ * 
+ * Copyright (C) 2026 Patrick Alken
+ * 
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#ifndef __GSL_SORT_MATRIX_LONG_DOUBLE_H__
+#define __GSL_SORT_MATRIX_LONG_DOUBLE_H__
+
+#include <stdlib.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_matrix_long_double.h>
+
+#undef __BEGIN_DECLS
+#undef __END_DECLS
+#ifdef __cplusplus
+# define __BEGIN_DECLS extern "C" {
+# define __END_DECLS }
+#else
+# define __BEGIN_DECLS /* empty */
+# define __END_DECLS /* empty */
+#endif
+
+__BEGIN_DECLS
+
+int gsl_sort_matrix_long_double_rows_smallest (gsl_matrix_long_double * dest, const size_t k, const gsl_matrix_long_double * A);
+int gsl_sort_matrix_long_double_rows_largest (gsl_matrix_long_double * dest, const size_t k, const gsl_matrix_long_double * A);
+
+int gsl_sort_matrix_long_double_rows_smallest_index (size_t * p, const size_t k, const gsl_matrix_long_double * A);
+int gsl_sort_matrix_long_double_rows_largest_index (size_t * p, const size_t k, const gsl_matrix_long_double * A);
+
+__END_DECLS
+
+#endif /* __GSL_SORT_MATRIX_LONG_DOUBLE_H__ */
@@ -23,6 +23,7 @@
 #include <stdlib.h>
 #include <gsl/gsl_errno.h>
 #include <gsl/gsl_permutation.h>
+#include <gsl/gsl_executor.h>
 
 #undef __BEGIN_DECLS
 #undef __END_DECLS
@@ -40,6 +41,9 @@ void gsl_sort_short (short * data, const size_t stride, const size_t n);
 void gsl_sort2_short (short * data1, const size_t stride1, short * data2, const size_t stride2, const size_t n);
 void gsl_sort_short_index (size_t * p, const short * data, const size_t stride, const size_t n);
 
+int gsl_sort_short_parallel (short * data, const size_t stride, const size_t n, const size_t ntasks, const gsl_executor * exec);
+int gsl_sort_short_index_parallel (size_t * p, const short * data, const size_t stride, const size_t n, const size_t ntasks, const gsl_executor * exec);
+
 int gsl_sort_short_smallest (short * dest, const size_t k, const short * src, const size_t stride, const size_t n);
 int gsl_sort_short_smallest_index (size_t * p, const size_t k, const short * src, const size_t stride, const size_t n);
 
@@ -0,0 +1,169 @@
+/* sort/parallel_source.c
+ *
+ * Copyright (C) 2026 Patrick Alken
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* helpers for gsl_sort_parallel and gsl_sort_index_parallel in
+ * sortvec_source.c and sortvecind_source.c.  The keys are split into
+ * ntasks blocks which are gathered and sorted by one task each.  The
+ * sorted runs are then merged pairwise in rounds; each round is divided
+ * into ntasks equal output ranges, and the task for a range finds where
+ * it starts in the two runs by a binary search, so that every round
+ * keeps all the tasks busy.  Ties are taken from the left run, so the
+ * merge is stable, and the result does not depend on the order in
+ * which the tasks are run. */
+
+typedef struct
+{
+  BASE *x[2];                   /* keys and workspace, length n */
+  size_t *p[2];                 /* index and workspace, or NULL */
+  int src;                      /* which of x[], p[] holds the runs */
+  size_t width;                 /* number of blocks in each run */
+  size_t n;
+  size_t ntasks;
+  BASE *data;                   /* array to sort, or NULL */
+  const BASE *cdata;            /* keys of the index sort, or NULL */
+  size_t stride;
+  int *nan;                     /* set for blocks containing NaNs */
+} FUNCTION (parallel, workspace);
+
+/*
+FUNCTION (parallel, split)
+  Find how many of the first k elements of the stable merge of the
+sorted runs a[0..na-1] and b[0..nb-1] come from a
+
+Return: the smallest i such that b[k-i-1] < a[i], or min(k, na)
+*/
+
+static size_t
+FUNCTION (parallel, split) (const BASE * a, const size_t na,
+                            const BASE * b, const size_t nb, const size_t k)
+{
+  size_t lo = (k > nb) ? k - nb : 0;
+  size_t hi = (k < na) ? k : na;
+
+  while (lo < hi)
+    {
+      const size_t i = lo + (hi - lo) / 2;
+
+      if (b[k - i - 1] < a[i])
+        hi = i;
+      else
+        lo = i + 1;
+    }
+
+  return lo;
+}
+
+/* merge the part of a pair of runs which lands in block t */
+static void
+FUNCTION (parallel, merge_task) (size_t t, void *vw)
+{
+  FUNCTION (parallel, workspace) * w = (FUNCTION (parallel, workspace) *) vw;
+  const size_t n = w->n, ntasks = w->ntasks;
+  const size_t first = t - t % (2 * w->width);
+  const size_t mblock = (first + w->width < ntasks) ? first + w->width : ntasks;
+  const size_t hblock = (first + 2 * w->width < ntasks) ? first + 2 * w->width : ntasks;
+  const size_t lo = gsl_executor_block (n, ntasks, first);
+  const size_t mid = gsl_executor_block (n, ntasks, mblock);
+  const size_t hi = gsl_executor_block (n, ntasks, hblock);
+  const size_t k0 = gsl_executor_block (n, ntasks, t) - lo;
+  const size_t k1 = gsl_executor_block (n, ntasks, t + 1) - lo;
+  const BASE *a = w->x[w->src] + lo, *b = w->x[w->src] + mid;
+  const size_t na = mid - lo, nb = hi - mid;
+  const size_t iend = FUNCTION (parallel, split) (a, na, b, nb, k1);
+  const size_t jend = k1 - iend;
+  size_t i = FUNCTION (parallel, split) (a, na, b, nb, k0);
+  size_t j = k0 - i;
+  size_t k = lo + k0;
+  BASE *xd = w->x[1 - w->src];
+
+  if (w->p[0] != NULL)
+    {
+      const size_t *pa = w->p[w->src] + lo, *pb = w->p[w->src] + mid;
+      size_t *pd = w->p[1 - w->src];
+
+      while (i < iend && j < jend)
+        {
+          if (b[j] < a[i])
+            {
+              xd[k] = b[j];
+              pd[k++] = pb[j++];
+            }
+          else
+            {
+              xd[k] = a[i];
+              pd[k++] = pa[i++];
+            }
+        }
+
+      while (i < iend)
+        {
+          xd[k] = a[i];
+          pd[k++] = pa[i++];
+        }
+
+      while (j < jend)
+        {
+          xd[k] = b[j];
+          pd[k++] = pb[j++];
+        }
+    }
+  else
+    {
+      while (i < iend && j < jend)
+        xd[k++] = (b[j] < a[i]) ? b[j++] : a[i++];
+
+      while (i < iend)
+        xd[k++] = a[i++];
+
+      while (j < jend)
+        xd[k++] = b[j++];
+    }
+}
+
+/* merge the sorted blocks in x[src], p[src] into a single run */
+static void
+FUNCTION (parallel, merge) (FUNCTION (parallel, workspace) * w, const gsl_executor * exec)
+{
+  for (w->width = 1; w->width < w->ntasks; w->width *= 2)
+    {
+      gsl_executor_run (exec, w->ntasks, &FUNCTION (parallel, merge_task), w);
+      w->src = 1 - w->src;
+    }
+}
+
+/* record whether x[0..n-1] contains NaNs, for which the merge is not
+ * well defined */
+static int
+FUNCTION (parallel, hasnan) (const BASE * x, const size_t n)
+{
+#if defined(FP)
+  size_t i;
+
+  for (i = 0; i < n; i++)
+    {
+      if (x[i] != x[i])
+        return 1;
+    }
+#else
+  (void) x;
+  (void) n;
+#endif
+
+  return 0;
+}
@@ -0,0 +1,147 @@
+/* sort/radix_source.c
+ *
+ * Copyright (C) 2026 Patrick Alken
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* helpers for the LSD radix sorts in sortvec_source.c and
+ * sortvecind_source.c; RADIX_UTYPE is left undefined for types (long
+ * double) which are not radix sorted */
+
+#ifndef RADIX_UNSORTED
+#define RADIX_UNSORTED  0
+#define RADIX_SORTED    1
+#define RADIX_REVERSED  2
+#define RADIX_NAN       3
+#endif
+
+#if defined(BASE_DOUBLE)
+#define RADIX_UTYPE uint64_t
+#elif defined(BASE_FLOAT)
+#define RADIX_UTYPE uint32_t
+#elif defined(BASE_ULONG) || defined(BASE_LONG)
+#define RADIX_UTYPE unsigned long
+#elif defined(BASE_UINT) || defined(BASE_INT)
+#define RADIX_UTYPE unsigned int
+#elif defined(BASE_USHORT) || defined(BASE_SHORT)
+#define RADIX_UTYPE unsigned short
+#elif defined(BASE_UCHAR) || defined(BASE_CHAR)
+#define RADIX_UTYPE unsigned char
+#endif
+
+#ifdef RADIX_UTYPE
+
+/* map x to an unsigned key with the same ordering: for IEEE values
+ * negative numbers have all bits flipped and positive numbers the sign
+ * bit set, with -0.0 given the key of +0.0 since the two compare equal;
+ * for signed integers the sign bit is flipped */
+static inline RADIX_UTYPE
+FUNCTION (my, radix_key) (const BASE x)
+{
+  const RADIX_UTYPE signbit = (RADIX_UTYPE) 1 << (8 * sizeof (RADIX_UTYPE) - 1);
+  RADIX_UTYPE u;
+
+#if defined(BASE_DOUBLE) || defined(BASE_FLOAT)
+  if (x == 0)
+    return signbit;
+
+  memcpy (&u, &x, sizeof (u));
+  return (u & signbit) ? (RADIX_UTYPE) ~u : (RADIX_UTYPE) (u | signbit);
+#elif defined(UNSIGNED)
+  u = (RADIX_UTYPE) x;
+  (void) signbit;
+  return u;
+#else
+  u = (RADIX_UTYPE) x;
+  return (RADIX_UTYPE) (u ^ signbit);
+#endif
+}
+
+static inline size_t
+FUNCTION (my, radix_digit) (const BASE x, const size_t b)
+{
+  return (FUNCTION (my, radix_key) (x) >> (8 * b)) & 0xff;
+}
+
+/*
+FUNCTION (my, radix_count)
+  Compute the histograms of all 8 bit digits of the keys of
+data[0..n-1] in a single pass, and check whether the data are
+already in order
+
+Return: RADIX_NAN if the data contain NaNs, RADIX_SORTED if they are
+        nondecreasing, RADIX_REVERSED if they are strictly decreasing,
+        RADIX_UNSORTED otherwise
+*/
+
+static int
+FUNCTION (my, radix_count) (const BASE * data, const size_t n,
+                            size_t count[][256])
+{
+  const size_t nbytes = sizeof (RADIX_UTYPE);
+  size_t ndescent = 0;
+  size_t i, b;
+
+  memset (count, 0, nbytes * sizeof (count[0]));
+
+  for (i = 0; i < n; ++i)
+    {
+      RADIX_UTYPE key;
+
+#if defined(BASE_DOUBLE) || defined(BASE_FLOAT)
+      if (data[i] != data[i])
+        return RADIX_NAN;
+#endif
+
+      if (i > 0 && data[i] < data[i - 1])
+        ++ndescent;
+
+      key = FUNCTION (my, radix_key) (data[i]);
+
+      for (b = 0; b < nbytes; ++b)
+        count[b][(key >> (8 * b)) & 0xff]++;
+    }
+
+  if (ndescent == 0)
+    return RADIX_SORTED;
+  else if (ndescent == n - 1)
+    return RADIX_REVERSED;
+  else
+    return RADIX_UNSORTED;
+}
+
+/* convert a digit histogram into starting offsets; returns 0 if every
+ * key has the same digit, so that the pass can be skipped */
+static int
+FUNCTION (my, radix_offsets) (size_t * c, const size_t n)
+{
+  size_t sum = 0, k;
+
+  for (k = 0; k < 256; ++k)
+    {
+      size_t ck = c[k];
+
+      if (ck == n)
+        return 0;
+
+      c[k] = sum;
+      sum += ck;
+    }
+
+  return 1;
+}
+
+#endif /* RADIX_UTYPE */
@@ -18,11 +18,26 @@
  */
 
 #include <config.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
 #include <gsl/gsl_errno.h>
 #include <gsl/gsl_vector.h>
 #include <gsl/gsl_sort.h>
 #include <gsl/gsl_sort_vector.h>
 
+/* partitions of at most this size are finished by insertion sort */
+#define SORT_INSERTION_THRESHOLD 16
+
+/* use a pseudomedian of 9 instead of a median of 3 as pivot above this size */
+#define SORT_NINTHER_THRESHOLD 128
+
+/* maximum number of moves when trying to finish a partition which looks sorted */
+#define SORT_PARTIAL_INSERTION_LIMIT 8
+
+/* minimum length of a unit stride array for radix sorting */
+#define SORT_RADIX_THRESHOLD 512
+
 #define BASE_LONG_DOUBLE
 #include "templates_on.h"
 #include "sortvec_source.c"
@@ -17,6 +17,14 @@
  * for more details.
  */
 
+/*
+ * 2026: gsl_sort and gsl_sort2 now use an introsort with pattern
+ * detection (after Peters, "Pattern-defeating quicksort"), falling back
+ * to the heapsort below when partitions become unbalanced. Long unit
+ * stride arrays of non long double type are sorted with an LSD radix
+ * sort (radix_source.c) when temporary storage is available.
+ */
+
 static inline void FUNCTION (my, downheap) (BASE * data, const size_t stride, const size_t N, size_t k);
 static inline void FUNCTION (my, downheap2) (BASE * data1, const size_t stride1, BASE * data2, const size_t stride2, const size_t N, size_t k);
 
@@ -77,8 +85,8 @@ FUNCTION (my, downheap2) (BASE * data1, const size_t stride1, BASE * data2, cons
   data2[k * stride2] = v2;
 }
 
-void
-TYPE (gsl_sort) (BASE * data, const size_t stride, const size_t n)
+static void
+FUNCTION (my, heapsort) (BASE * data, const size_t stride, const size_t n)
 {
   size_t N;
   size_t k;
@@ -116,14 +124,8 @@ TYPE (gsl_sort) (BASE * data, const size_t stride, const size_t n)
     }
 }
 
-void
-TYPE (gsl_sort_vector) (TYPE (gsl_vector) * v)
-{
-  TYPE (gsl_sort) (v->data, v->stride, v->size) ;
-}
-
-void
-TYPE (gsl_sort2) (BASE * data1, const size_t stride1, BASE * data2, const size_t stride2, const size_t n)
+static void
+FUNCTION (my, heapsort2) (BASE * data1, const size_t stride1, BASE * data2, const size_t stride2, const size_t n)
 {
   size_t N;
   size_t k;
@@ -167,8 +169,583 @@ TYPE (gsl_sort2) (BASE * data1, const size_t stride1, BASE * data2, const size_t
     }
 }
 
+static inline void
+FUNCTION (my, swap) (BASE * data, const size_t stride, const size_t i, const size_t j)
+{
+  BASE tmp = data[i * stride];
+  data[i * stride] = data[j * stride];
+  data[j * stride] = tmp;
+}
+
+static inline void
+FUNCTION (my, swap2) (BASE * data1, const size_t stride1, BASE * data2, const size_t stride2,
+                      const size_t i, const size_t j)
+{
+  FUNCTION (my, swap) (data1, stride1, i, j);
+  FUNCTION (my, swap) (data2, stride2, i, j);
+}
+
+/* order data[a] <= data[b] <= data[c] */
+static inline void
+FUNCTION (my, sort3) (BASE * data, const size_t stride, const size_t a, const size_t b, const size_t c)
+{
+  if (data[b * stride] < data[a * stride])
+    FUNCTION (my, swap) (data, stride, a, b);
+  if (data[c * stride] < data[b * stride])
+    {
+      FUNCTION (my, swap) (data, stride, b, c);
+      if (data[b * stride] < data[a * stride])
+        FUNCTION (my, swap) (data, stride, a, b);
+    }
+}
+
+static inline void
+FUNCTION (my, sort3_2) (BASE * data1, const size_t stride1, BASE * data2, const size_t stride2,
+                        const size_t a, const size_t b, const size_t c)
+{
+  if (data1[b * stride1] < data1[a * stride1])
+    FUNCTION (my, swap2) (data1, stride1, data2, stride2, a, b);
+  if (data1[c * stride1] < data1[b * stride1])
+    {
+      FUNCTION (my, swap2) (data1, stride1, data2, stride2, b, c);
+      if (data1[b * stride1] < data1[a * stride1])
+        FUNCTION (my, swap2) (data1, stride1, data2, stride2, a, b);
+    }
+}
+
+/*
+FUNCTION (my, insertion)
+  Insertion sort of data[0..n-1]. If limit > 0, give up after more
+than limit elements have been moved (used to finish nearly sorted
+partitions cheaply)
+
+Return: 1 if the data are sorted, 0 if the move limit was reached
+*/
+
+static int
+FUNCTION (my, insertion) (BASE * data, const size_t stride, const size_t n, const size_t limit)
+{
+  size_t nmoved = 0;
+  size_t i;
+
+  for (i = 1; i < n; ++i)
+    {
+      BASE v = data[i * stride];
+      size_t j = i;
+
+      if (!(v < data[(j - 1) * stride]))
+        continue;
+
+      do
+        {
+          data[j * stride] = data[(j - 1) * stride];
+          --j;
+        }
+      while (j > 0 && v < data[(j - 1) * stride]);
+
+      data[j * stride] = v;
+
+      nmoved += i - j;
+      if (limit > 0 && nmoved > limit && i + 1 < n)
+        return 0;
+    }
+
+  return 1;
+}
+
+static int
+FUNCTION (my, insertion2) (BASE * data1, const size_t stride1, BASE * data2, const size_t stride2,
+                           const size_t n, const size_t limit)
+{
+  size_t nmoved = 0;
+  size_t i;
+
+  for (i = 1; i < n; ++i)
+    {
+      BASE v1 = data1[i * stride1];
+      BASE v2 = data2[i * stride2];
+      size_t j = i;
+
+      if (!(v1 < data1[(j - 1) * stride1]))
+        continue;
+
+      do
+        {
+          data1[j * stride1] = data1[(j - 1) * stride1];
+          data2[j * stride2] = data2[(j - 1) * stride2];
+          --j;
+        }
+      while (j > 0 && v1 < data1[(j - 1) * stride1]);
+
+      data1[j * stride1] = v1;
+      data2[j * stride2] = v2;
+
+      nmoved += i - j;
+      if (limit > 0 && nmoved > limit && i + 1 < n)
+        return 0;
+    }
+
+  return 1;
+}
+
+/*
+FUNCTION (my, introsort)
+  Sort data[0..n-1] by quicksort with a median of 3 (ninther for
+large n) pivot and a Hoare partition which stops on keys equal to
+the pivot, so runs of equal keys split evenly. Scans are bounds
+checked so that NaNs cannot cause out of range accesses.
+
+Inputs: data     - data to sort
+        stride   - stride
+        n        - number of elements
+        nbad     - number of unbalanced partitions allowed before
+                   switching to heapsort, which bounds the worst case
+                   at O(n log n)
+*/
+
+static void
+FUNCTION (my, introsort) (BASE * data, const size_t stride, size_t n, int nbad)
+{
+  while (n > SORT_INSERTION_THRESHOLD)
+    {
+      const size_t mid = n / 2;
+      size_t i = 1, j = n - 1, nswap = 0;
+      size_t nleft, nright;
+      BASE pivot;
+
+      /* move pivot to data[0] */
+      if (n > SORT_NINTHER_THRESHOLD)
+        {
+          FUNCTION (my, sort3) (data, stride, 0, mid, n - 1);
+          FUNCTION (my, sort3) (data, stride, 1, mid - 1, n - 2);
+          FUNCTION (my, sort3) (data, stride, 2, mid + 1, n - 3);
+          FUNCTION (my, sort3) (data, stride, mid - 1, mid, mid + 1);
+        }
+      else
+        {
+          FUNCTION (my, sort3) (data, stride, 0, mid, n - 1);
+        }
+
+      FUNCTION (my, swap) (data, stride, 0, mid);
+      pivot = data[0];
+
+      /* partition data[1..n-1] so that data[0..j-1] <= pivot <= data[j+1..n-1] */
+      while (1)
+        {
+          while (i <= j && data[i * stride] < pivot)
+            ++i;
+          while (i <= j && pivot < data[j * stride])
+            --j;
+
+          if (i >= j)
+            break;
+
+          FUNCTION (my, swap) (data, stride, i, j);
+          ++i;
+          --j;
+          ++nswap;
+        }
+
+      FUNCTION (my, swap) (data, stride, 0, j);
+
+      nleft = j;
+      nright = n - j - 1;
+
+      if (nleft < n / 8 || nright < n / 8)
+        {
+          if (--nbad <= 0)
+            {
+              FUNCTION (my, heapsort) (data, stride, nleft);
+              FUNCTION (my, heapsort) (data + (j + 1) * stride, stride, nright);
+              return;
+            }
+        }
+      else if (nswap == 0)
+        {
+          /* input looked already partitioned, so it may be (nearly) sorted */
+          if (FUNCTION (my, insertion) (data, stride, nleft, SORT_PARTIAL_INSERTION_LIMIT) &&
+              FUNCTION (my, insertion) (data + (j + 1) * stride, stride, nright, SORT_PARTIAL_INSERTION_LIMIT))
+            return;
+        }
+
+      /* recurse into the smaller part, iterate on the larger */
+      if (nleft < nright)
+        {
+          FUNCTION (my, introsort) (data, stride, nleft, nbad);
+          data += (j + 1) * stride;
+          n = nright;
+        }
+      else
+        {
+          FUNCTION (my, introsort) (data + (j + 1) * stride, stride, nright, nbad);
+          n = nleft;
+        }
+    }
+
+  FUNCTION (my, insertion) (data, stride, n, 0);
+}
+
+static void
+FUNCTION (my, introsort2) (BASE * data1, const size_t stride1, BASE * data2, const size_t stride2,
+                           size_t n, int nbad)
+{
+  while (n > SORT_INSERTION_THRESHOLD)
+    {
+      const size_t mid = n / 2;
+      size_t i = 1, j = n - 1, nswap = 0;
+      size_t nleft, nright;
+      BASE pivot;
+
+      if (n > SORT_NINTHER_THRESHOLD)
+        {
+          FUNCTION (my, sort3_2) (data1, stride1, data2, stride2, 0, mid, n - 1);
+          FUNCTION (my, sort3_2) (data1, stride1, data2, stride2, 1, mid - 1, n - 2);
+          FUNCTION (my, sort3_2) (data1, stride1, data2, stride2, 2, mid + 1, n - 3);
+          FUNCTION (my, sort3_2) (data1, stride1, data2, stride2, mid - 1, mid, mid + 1);
+        }
+      else
+        {
+          FUNCTION (my, sort3_2) (data1, stride1, data2, stride2, 0, mid, n - 1);
+        }
+
+      FUNCTION (my, swap2) (data1, stride1, data2, stride2, 0, mid);
+      pivot = data1[0];
+
+      while (1)
+        {
+          while (i <= j && data1[i * stride1] < pivot)
+            ++i;
+          while (i <= j && pivot < data1[j * stride1])
+            --j;
+
+          if (i >= j)
+            break;
+
+          FUNCTION (my, swap2) (data1, stride1, data2, stride2, i, j);
+          ++i;
+          --j;
+          ++nswap;
+        }
+
+      FUNCTION (my, swap2) (data1, stride1, data2, stride2, 0, j);
+
+      nleft = j;
+      nright = n - j - 1;
+
+      if (nleft < n / 8 || nright < n / 8)
+        {
+          if (--nbad <= 0)
+            {
+              FUNCTION (my, heapsort2) (data1, stride1, data2, stride2, nleft);
+              FUNCTION (my, heapsort2) (data1 + (j + 1) * stride1, stride1,
+                                        data2 + (j + 1) * stride2, stride2, nright);
+              return;
+            }
+        }
+      else if (nswap == 0)
+        {
+          if (FUNCTION (my, insertion2) (data1, stride1, data2, stride2, nleft, SORT_PARTIAL_INSERTION_LIMIT) &&
+              FUNCTION (my, insertion2) (data1 + (j + 1) * stride1, stride1,
+                                         data2 + (j + 1) * stride2, stride2, nright, SORT_PARTIAL_INSERTION_LIMIT))
+            return;
+        }
+
+      if (nleft < nright)
+        {
+          FUNCTION (my, introsort2) (data1, stride1, data2, stride2, nleft, nbad);
+          data1 += (j + 1) * stride1;
+          data2 += (j + 1) * stride2;
+          n = nright;
+        }
+      else
+        {
+          FUNCTION (my, introsort2) (data1 + (j + 1) * stride1, stride1,
+                                     data2 + (j + 1) * stride2, stride2, nright, nbad);
+          n = nleft;
+        }
+    }
+
+  FUNCTION (my, insertion2) (data1, stride1, data2, stride2, n, 0);
+}
+
+/* number of unbalanced partitions tolerated: floor(log2(n)) */
+static inline int
+FUNCTION (my, nbad) (size_t n)
+{
+  int nbad = 0;
+
+  while (n >>= 1)
+    ++nbad;
+
+  return nbad;
+}
+
+#include "radix_source.c"
+
+#ifdef RADIX_UTYPE
+
+/*
+FUNCTION (my, radixsort)
+  LSD radix sort of data[0..n-1] on 8 bit digits, skipping passes in
+which every key has the same digit. If data2 is not NULL, it is
+rearranged in the same way as data
+
+Inputs: data  - data to sort, unit stride
+        data2 - second array to rearrange, unit stride, or NULL
+        n     - number of elements
+        work  - workspace, length n (2n if data2 is not NULL)
+
+Return: 1 on success, 0 if the data contain NaNs, in which case data
+        are left untouched for the comparison sort
+*/
+
+static int
+FUNCTION (my, radixsort) (BASE * data, BASE * data2, const size_t n, BASE * work)
+{
+  size_t count[sizeof (RADIX_UTYPE)][256];
+  BASE *src = data, *dest = work;
+  BASE *src2 = data2, *dest2 = work + n;
+  size_t i, b;
+
+  switch (FUNCTION (my, radix_count) (data, n, count))
+    {
+      case RADIX_NAN:
+        return 0;
+
+      case RADIX_SORTED:
+        return 1;
+
+      case RADIX_REVERSED:
+        for (i = 0; i < n / 2; ++i)
+          {
+            FUNCTION (my, swap) (data, 1, i, n - 1 - i);
+            if (data2)
+              FUNCTION (my, swap) (data2, 1, i, n - 1 - i);
+          }
+        return 1;
+    }
+
+  for (b = 0; b < sizeof (RADIX_UTYPE); ++b)
+    {
+      size_t *c = count[b];
+
+      if (!FUNCTION (my, radix_offsets) (c, n))
+        continue;
+
+      if (data2)
+        {
+          for (i = 0; i < n; ++i)
+            {
+              const size_t j = c[FUNCTION (my, radix_digit) (src[i], b)]++;
+              dest[j] = src[i];
+              dest2[j] = src2[i];
+            }
+
+          {
+            BASE *tmp = src2;
+            src2 = dest2;
+            dest2 = tmp;
+          }
+        }
+      else
+        {
+          for (i = 0; i < n; ++i)
+            {
+              const BASE x = src[i];
+              dest[c[FUNCTION (my, radix_digit) (x, b)]++] = x;
+            }
+        }
+
+      /* swap source and destination buffers */
+      {
+        BASE *tmp = src;
+        src = dest;
+        dest = tmp;
+      }
+    }
+
+  if (src != data)
+    {
+      memcpy (data, src, n * sizeof (BASE));
+      if (data2)
+        memcpy (data2, src2, n * sizeof (BASE));
+    }
+
+  return 1;
+}
+
+#endif /* RADIX_UTYPE */
+
+#include "parallel_source.c"
+
+/* gather and sort block t for gsl_sort_parallel */
+static void
+FUNCTION (my, parallel_block) (size_t t, void *vw)
+{
+  FUNCTION (parallel, workspace) * w = (FUNCTION (parallel, workspace) *) vw;
+  const size_t lo = gsl_executor_block (w->n, w->ntasks, t);
+  const size_t hi = gsl_executor_block (w->n, w->ntasks, t + 1);
+  const size_t len = hi - lo;
+  BASE *x = w->x[0] + lo;
+  size_t i;
+
+  for (i = 0; i < len; ++i)
+    x[i] = w->data[(lo + i) * w->stride];
+
+  if (FUNCTION (parallel, hasnan) (x, len))
+    {
+      w->nan[t] = 1;
+      return;
+    }
+
+#ifdef RADIX_UTYPE
+  if (len >= SORT_RADIX_THRESHOLD && FUNCTION (my, radixsort) (x, NULL, len, w->x[1] + lo))
+    return;
+#endif
+
+  FUNCTION (my, introsort) (x, 1, len, FUNCTION (my, nbad) (len));
+}
+
+/* copy block t of the sorted keys back for gsl_sort_parallel */
+static void
+FUNCTION (my, parallel_scatter) (size_t t, void *vw)
+{
+  FUNCTION (parallel, workspace) * w = (FUNCTION (parallel, workspace) *) vw;
+  const size_t lo = gsl_executor_block (w->n, w->ntasks, t);
+  const size_t hi = gsl_executor_block (w->n, w->ntasks, t + 1);
+  const BASE *x = w->x[w->src];
+  size_t i;
+
+  for (i = lo; i < hi; ++i)
+    w->data[i * w->stride] = x[i];
+}
+
+void
+TYPE (gsl_sort) (BASE * data, const size_t stride, const size_t n)
+{
+  if (n < 2)
+    {
+      return;                   /* No data to sort */
+    }
+
+#ifdef RADIX_UTYPE
+  if (stride == 1 && n >= SORT_RADIX_THRESHOLD)
+    {
+      BASE *work = malloc (n * sizeof (BASE));
+
+      if (work != NULL)
+        {
+          int status = FUNCTION (my, radixsort) (data, NULL, n, work);
+
+          free (work);
+
+          if (status)
+            return;
+        }
+    }
+#endif
+
+  FUNCTION (my, introsort) (data, stride, n, FUNCTION (my, nbad) (n));
+}
+
+void
+TYPE (gsl_sort_vector) (TYPE (gsl_vector) * v)
+{
+  TYPE (gsl_sort) (v->data, v->stride, v->size) ;
+}
+
+void
+TYPE (gsl_sort2) (BASE * data1, const size_t stride1, BASE * data2, const size_t stride2, const size_t n)
+{
+  if (n < 2)
+    {
+      return;                   /* No data to sort */
+    }
+
+#ifdef RADIX_UTYPE
+  if (stride1 == 1 && stride2 == 1 && n >= SORT_RADIX_THRESHOLD)
+    {
+      BASE *work = malloc (2 * n * sizeof (BASE));
+
+      if (work != NULL)
+        {
+          int status = FUNCTION (my, radixsort) (data1, data2, n, work);
+
+          free (work);
+
+          if (status)
+            return;
+        }
+    }
+#endif
+
+  FUNCTION (my, introsort2) (data1, stride1, data2, stride2, n, FUNCTION (my, nbad) (n));
+}
+
 void
 TYPE (gsl_sort_vector2) (TYPE (gsl_vector) * v1, TYPE (gsl_vector) * v2)
 {
   TYPE (gsl_sort2) (v1->data, v1->stride, v2->data, v2->stride, v1->size) ;
 }
+
+int
+FUNCTION (gsl_sort, parallel) (BASE * data, const size_t stride, const size_t n,
+                               const size_t ntasks, const gsl_executor * exec)
+{
+  FUNCTION (parallel, workspace) w;
+  int nan = 0;
+  size_t t;
+
+  if (ntasks == 0)
+    {
+      GSL_ERROR ("number of tasks must be positive", GSL_EINVAL);
+    }
+
+  if (n < 2)
+    {
+      return GSL_SUCCESS;       /* No data to sort */
+    }
+
+  w.ntasks = (ntasks < n) ? ntasks : n;
+  w.x[0] = malloc (2 * n * sizeof (BASE));
+  w.nan = calloc (w.ntasks, sizeof (int));
+
+  if (w.x[0] == NULL || w.nan == NULL)
+    {
+      free (w.x[0]);
+      free (w.nan);
+      GSL_ERROR ("failed to allocate space for workspace", GSL_ENOMEM);
+    }
+
+  w.x[1] = w.x[0] + n;
+  w.p[0] = NULL;
+  w.p[1] = NULL;
+  w.src = 0;
+  w.n = n;
+  w.data = data;
+  w.cdata = NULL;
+  w.stride = stride;
+
+  gsl_executor_run (exec, w.ntasks, &FUNCTION (my, parallel_block), &w);
+
+  for (t = 0; t < w.ntasks; ++t)
+    nan |= w.nan[t];
+
+  if (nan)
+    {
+      /* the data have not been changed */
+      TYPE (gsl_sort) (data, stride, n);
+    }
+  else
+    {
+      FUNCTION (parallel, merge) (&w, exec);
+      gsl_executor_run (exec, w.ntasks, &FUNCTION (my, parallel_scatter), &w);
+    }
+
+  free (w.x[0]);
+  free (w.nan);
+
+  return GSL_SUCCESS;
+}
+
+#undef RADIX_UTYPE
@@ -18,11 +18,21 @@
  */
 
 #include <config.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <gsl/gsl_math.h>
 #include <gsl/gsl_errno.h>
 #include <gsl/gsl_vector.h>
 #include <gsl/gsl_sort.h>
 #include <gsl/gsl_sort_vector.h>
 
+/* length of the insertion sorted runs in the merge sort */
+#define SORT_INSERTION_THRESHOLD 16
+
+/* minimum length of an array for radix sorting */
+#define SORT_RADIX_THRESHOLD 512
+
 #define BASE_LONG_DOUBLE
 #include "templates_on.h"
 #include "sortvecind_source.c"
@@ -17,40 +17,354 @@
  * for more details.
  */
 
-static inline void FUNCTION (index, downheap) (size_t * p, const BASE * data, const size_t stride, const size_t N, size_t k);
+/*
+ * 2026: gsl_sort_index is now stable. The keys are gathered once into
+ * a contiguous array and sorted together with the index, by LSD radix
+ * sort (radix_source.c) or a merge sort, so that no comparisons go
+ * through the permutation. When the workspace cannot be allocated, the
+ * permutation is sorted in place by the stable merge sort below.
+ */
+
+#include "radix_source.c"
+
+static inline int FUNCTION (index, less) (const BASE * data, const size_t stride, const size_t i, const size_t j);
+static void FUNCTION (index, symmerge) (size_t * p, const BASE * data, const size_t stride, const size_t a, const size_t m, const size_t b);
+
+static inline int
+FUNCTION (index, less) (const BASE * data, const size_t stride, const size_t i, const size_t j)
+{
+  return data[i * stride] < data[j * stride];
+}
 
+/* reverse p[a..b-1] */
 static inline void
-FUNCTION (index, downheap) (size_t * p, const BASE * data, const size_t stride, const size_t N, size_t k)
+FUNCTION (index, reverse) (size_t * p, size_t a, size_t b)
 {
-  const size_t pki = p[k];
+  while (a + 1 < b)
+    {
+      size_t tmp = p[a];
+      p[a++] = p[--b];
+      p[b] = tmp;
+    }
+}
 
-  while (k <= N / 2)
+/* exchange the blocks p[a..m-1] and p[m..b-1] */
+static inline void
+FUNCTION (index, rotate) (size_t * p, const size_t a, const size_t m, const size_t b)
+{
+  FUNCTION (index, reverse) (p, a, m);
+  FUNCTION (index, reverse) (p, m, b);
+  FUNCTION (index, reverse) (p, a, b);
+}
+
+/*
+FUNCTION (index, symmerge)
+  Stable in-place merge of the sorted runs p[a..m-1] and p[m..b-1],
+a < m < b, by the SymMerge algorithm of Kim and Kutzner, "Stable
+minimum storage merging by symmetric comparisons", LNCS 3221 (2004)
+*/
+
+static void
+FUNCTION (index, symmerge) (size_t * p, const BASE * data, const size_t stride,
+                            const size_t a, const size_t m, const size_t b)
+{
+  size_t mid, n, start, r, end;
+
+  if (m - a == 1)
     {
-      size_t j = 2 * k;
+      /* insert p[a] before the first element of the right run which
+         is not less than it */
+      size_t i = m, j = b;
 
-      if (j < N && data[p[j] * stride] < data[p[j + 1] * stride])
+      while (i < j)
         {
-          j++;
+          const size_t h = i + (j - i) / 2;
+
+          if (FUNCTION (index, less) (data, stride, p[h], p[a]))
+            i = h + 1;
+          else
+            j = h;
         }
 
-      if (!(data[pki * stride] < data[p[j] * stride])) /* avoid infinite loop if nan */
+      FUNCTION (index, rotate) (p, a, a + 1, i);
+      return;
+    }
+
+  if (b - m == 1)
+    {
+      /* insert p[m] after the last element of the left run which is
+         not greater than it */
+      size_t i = a, j = m;
+
+      while (i < j)
         {
-          break;
+          const size_t h = i + (j - i) / 2;
+
+          if (!FUNCTION (index, less) (data, stride, p[m], p[h]))
+            i = h + 1;
+          else
+            j = h;
         }
 
-      p[k] = p[j];
+      FUNCTION (index, rotate) (p, i, m, m + 1);
+      return;
+    }
+
+  mid = a + (b - a) / 2;
+  n = mid + m;
+
+  if (m > mid)
+    {
+      start = n - b;
+      r = mid;
+    }
+  else
+    {
+      start = a;
+      r = m;
+    }
+
+  while (start < r)
+    {
+      const size_t c = start + (r - start) / 2;
+
+      if (!FUNCTION (index, less) (data, stride, p[n - 1 - c], p[c]))
+        start = c + 1;
+      else
+        r = c;
+    }
+
+  end = n - start;
+
+  if (start < m && m < end)
+    FUNCTION (index, rotate) (p, start, m, end);
 
-      k = j;
+  if (a < start && start < mid)
+    FUNCTION (index, symmerge) (p, data, stride, a, start, mid);
+
+  if (mid < end && end < b)
+    FUNCTION (index, symmerge) (p, data, stride, mid, end, b);
+}
+
+/* stable sort of the permutation p without workspace, in O(n log^2 n)
+ * comparisons through data */
+static void
+FUNCTION (index, inplace) (size_t * p, const BASE * data, const size_t stride, const size_t n)
+{
+  size_t start, width;
+
+  for (start = 0; start < n; start += SORT_INSERTION_THRESHOLD)
+    {
+      const size_t end = GSL_MIN (start + SORT_INSERTION_THRESHOLD, n);
+      size_t i;
+
+      for (i = start + 1; i < end; ++i)
+        {
+          const size_t pv = p[i];
+          size_t j = i;
+
+          while (j > start && FUNCTION (index, less) (data, stride, pv, p[j - 1]))
+            {
+              p[j] = p[j - 1];
+              --j;
+            }
+
+          p[j] = pv;
+        }
     }
 
-  p[k] = pki;
+  for (width = SORT_INSERTION_THRESHOLD; width < n; width *= 2)
+    {
+      for (start = 0; start + width < n; start += 2 * width)
+        {
+          FUNCTION (index, symmerge) (p, data, stride, start, start + width,
+                                      GSL_MIN (start + 2 * width, n));
+        }
+    }
 }
 
+/*
+FUNCTION (index, mergesort)
+  Stable bottom up merge sort of the pairs (x[i], p[i]), i = 0..n-1,
+starting from insertion sorted runs
+
+Inputs: x     - keys, length n
+        p     - index, length n
+        n     - number of elements
+        xwork - workspace, length n
+        pwork - workspace, length n
+*/
+
+static void
+FUNCTION (index, mergesort) (BASE * x, size_t * p, const size_t n,
+                             BASE * xwork, size_t * pwork)
+{
+  BASE *xsrc = x, *xdest = xwork;
+  size_t *psrc = p, *pdest = pwork;
+  size_t start, width;
+
+  for (start = 0; start < n; start += SORT_INSERTION_THRESHOLD)
+    {
+      const size_t end = GSL_MIN (start + SORT_INSERTION_THRESHOLD, n);
+      size_t i;
+
+      for (i = start + 1; i < end; ++i)
+        {
+          const BASE v = x[i];
+          const size_t pv = p[i];
+          size_t j = i;
+
+          while (j > start && v < x[j - 1])
+            {
+              x[j] = x[j - 1];
+              p[j] = p[j - 1];
+              --j;
+            }
+
+          x[j] = v;
+          p[j] = pv;
+        }
+    }
+
+  for (width = SORT_INSERTION_THRESHOLD; width < n; width *= 2)
+    {
+      for (start = 0; start < n; start += 2 * width)
+        {
+          const size_t mid = GSL_MIN (start + width, n);
+          const size_t end = GSL_MIN (start + 2 * width, n);
+          size_t i = start, j = mid, k = start;
+
+          /* take from the right run only if strictly smaller */
+          while (i < mid && j < end)
+            {
+              if (xsrc[j] < xsrc[i])
+                {
+                  xdest[k] = xsrc[j];
+                  pdest[k++] = psrc[j++];
+                }
+              else
+                {
+                  xdest[k] = xsrc[i];
+                  pdest[k++] = psrc[i++];
+                }
+            }
+
+          while (i < mid)
+            {
+              xdest[k] = xsrc[i];
+              pdest[k++] = psrc[i++];
+            }
+
+          while (j < end)
+            {
+              xdest[k] = xsrc[j];
+              pdest[k++] = psrc[j++];
+            }
+        }
+
+      {
+        BASE *xtmp = xsrc;
+        size_t *ptmp = psrc;
+
+        xsrc = xdest;
+        xdest = xtmp;
+        psrc = pdest;
+        pdest = ptmp;
+      }
+    }
+
+  if (psrc != p)
+    {
+      memcpy (x, xsrc, n * sizeof (BASE));
+      memcpy (p, psrc, n * sizeof (size_t));
+    }
+}
+
+#ifdef RADIX_UTYPE
+
+/*
+FUNCTION (index, radixsort)
+  Stable LSD radix sort of the pairs (x[i], p[i]), i = 0..n-1
+
+Inputs: x     - keys, length n
+        p     - index, length n
+        n     - number of elements
+        xwork - workspace, length n
+        pwork - workspace, length n
+
+Return: 1 on success, 0 if the keys contain NaNs
+*/
+
+static int
+FUNCTION (index, radixsort) (BASE * x, size_t * p, const size_t n,
+                             BASE * xwork, size_t * pwork)
+{
+  size_t count[sizeof (RADIX_UTYPE)][256];
+  BASE *xsrc = x, *xdest = xwork;
+  size_t *psrc = p, *pdest = pwork;
+  size_t i, b;
+
+  switch (FUNCTION (my, radix_count) (x, n, count))
+    {
+      case RADIX_NAN:
+        return 0;
+
+      case RADIX_SORTED:
+        return 1;
+
+      case RADIX_REVERSED:
+        /* keys are distinct, so reversing is stable */
+        for (i = 0; i < n / 2; ++i)
+          {
+            size_t tmp = p[i];
+            p[i] = p[n - 1 - i];
+            p[n - 1 - i] = tmp;
+          }
+        return 1;
+    }
+
+  for (b = 0; b < sizeof (RADIX_UTYPE); ++b)
+    {
+      size_t *c = count[b];
+
+      if (!FUNCTION (my, radix_offsets) (c, n))
+        continue;
+
+      for (i = 0; i < n; ++i)
+        {
+          const size_t j = c[FUNCTION (my, radix_digit) (xsrc[i], b)]++;
+          xdest[j] = xsrc[i];
+          pdest[j] = psrc[i];
+        }
+
+      {
+        BASE *xtmp = xsrc;
+        size_t *ptmp = psrc;
+
+        xsrc = xdest;
+        xdest = xtmp;
+        psrc = pdest;
+        pdest = ptmp;
+      }
+    }
+
+  if (psrc != p)
+    {
+      memcpy (x, xsrc, n * sizeof (BASE));
+      memcpy (p, psrc, n * sizeof (size_t));
+    }
+
+  return 1;
+}
+
+#endif /* RADIX_UTYPE */
+
 void
 FUNCTION (gsl_sort, index) (size_t * p, const BASE * data, const size_t stride, const size_t n)
 {
-  size_t N;
-  size_t i, k;
+  BASE *x;
+  size_t *pwork;
+  size_t i;
 
   if (n == 0)
     {
@@ -64,32 +378,141 @@ FUNCTION (gsl_sort, index) (size_t * p, const BASE * data, const size_t stride,
       p[i] = i ;
     }
 
-  /* We have n_data elements, last element is at 'n_data-1', first at
-     '0' Set N to the last element number. */
+  if (n == 1)
+    {
+      return;
+    }
 
-  N = n - 1;
+  x = malloc (2 * n * sizeof (BASE));
+  pwork = malloc (n * sizeof (size_t));
 
-  k = N / 2;
-  k++;                          /* Compensate the first use of 'k--' */
-  do
+  if (x == NULL || pwork == NULL)
     {
-      k--;
-      FUNCTION (index, downheap) (p, data, stride, N, k);
+      free (x);
+      free (pwork);
+      FUNCTION (index, inplace) (p, data, stride, n);
+      return;
     }
-  while (k > 0);
 
-  while (N > 0)
+  /* gather keys, so that they move with the index */
+  for (i = 0; i < n; ++i)
+    x[i] = data[i * stride];
+
+#ifdef RADIX_UTYPE
+  if (n < SORT_RADIX_THRESHOLD || !FUNCTION (index, radixsort) (x, p, n, x + n, pwork))
+#endif
+    FUNCTION (index, mergesort) (x, p, n, x + n, pwork);
+
+  free (x);
+  free (pwork);
+}
+
+#include "parallel_source.c"
+
+/* gather and sort block t for gsl_sort_index_parallel */
+static void
+FUNCTION (index, parallel_block) (size_t t, void *vw)
+{
+  FUNCTION (parallel, workspace) * w = (FUNCTION (parallel, workspace) *) vw;
+  const size_t lo = gsl_executor_block (w->n, w->ntasks, t);
+  const size_t hi = gsl_executor_block (w->n, w->ntasks, t + 1);
+  const size_t len = hi - lo;
+  BASE *x = w->x[0] + lo;
+  size_t *p = w->p[0] + lo;
+  size_t i;
+
+  for (i = 0; i < len; ++i)
+    {
+      x[i] = w->cdata[(lo + i) * w->stride];
+      p[i] = lo + i;
+    }
+
+  if (FUNCTION (parallel, hasnan) (x, len))
+    {
+      w->nan[t] = 1;
+      return;
+    }
+
+#ifdef RADIX_UTYPE
+  if (len < SORT_RADIX_THRESHOLD || !FUNCTION (index, radixsort) (x, p, len, w->x[1] + lo, w->p[1] + lo))
+#endif
+    FUNCTION (index, mergesort) (x, p, len, w->x[1] + lo, w->p[1] + lo);
+}
+
+/* copy block t of the sorted index into the caller's array */
+static void
+FUNCTION (index, parallel_copy) (size_t t, void *vw)
+{
+  FUNCTION (parallel, workspace) * w = (FUNCTION (parallel, workspace) *) vw;
+  const size_t lo = gsl_executor_block (w->n, w->ntasks, t);
+  const size_t hi = gsl_executor_block (w->n, w->ntasks, t + 1);
+
+  memcpy (w->p[0] + lo, w->p[1] + lo, (hi - lo) * sizeof (size_t));
+}
+
+int
+FUNCTION (gsl_sort, index_parallel) (size_t * p, const BASE * data, const size_t stride,
+                                     const size_t n, const size_t ntasks,
+                                     const gsl_executor * exec)
+{
+  FUNCTION (parallel, workspace) w;
+  int nan = 0;
+  size_t t;
+
+  if (ntasks == 0)
     {
-      /* first swap the elements */
-      size_t tmp = p[0];
-      p[0] = p[N];
-      p[N] = tmp;
+      GSL_ERROR ("number of tasks must be positive", GSL_EINVAL);
+    }
+
+  if (n < 2)
+    {
+      FUNCTION (gsl_sort, index) (p, data, stride, n);
+      return GSL_SUCCESS;
+    }
+
+  w.ntasks = GSL_MIN (ntasks, n);
+  w.x[0] = malloc (2 * n * sizeof (BASE));
+  w.p[1] = malloc (n * sizeof (size_t));
+  w.nan = calloc (w.ntasks, sizeof (int));
+
+  if (w.x[0] == NULL || w.p[1] == NULL || w.nan == NULL)
+    {
+      free (w.x[0]);
+      free (w.p[1]);
+      free (w.nan);
+      GSL_ERROR ("failed to allocate space for workspace", GSL_ENOMEM);
+    }
 
-      /* then process the heap */
-      N--;
+  w.x[1] = w.x[0] + n;
+  w.p[0] = p;
+  w.src = 0;
+  w.n = n;
+  w.data = NULL;
+  w.cdata = data;
+  w.stride = stride;
 
-      FUNCTION (index, downheap) (p, data, stride, N, 0);
+  gsl_executor_run (exec, w.ntasks, &FUNCTION (index, parallel_block), &w);
+
+  for (t = 0; t < w.ntasks; ++t)
+    nan |= w.nan[t];
+
+  if (nan)
+    {
+      FUNCTION (gsl_sort, index) (p, data, stride, n);
     }
+  else
+    {
+      FUNCTION (parallel, merge) (&w, exec);
+
+      if (w.src == 1)
+        gsl_executor_run (exec, w.ntasks, &FUNCTION (index, parallel_copy), &w);
+    }
+
+  free (w.x[0]);
+  free (w.p[1]);
+  free (w.nan);
+
+  return GSL_SUCCESS;
 }
 
 int
@@ -104,3 +527,5 @@ FUNCTION (gsl_sort_vector, index) (gsl_permutation * permutation, const TYPE (gs
   
   return GSL_SUCCESS ;
 }
+
+#undef RADIX_UTYPE
@@ -14,10 +14,16 @@
  */
 
 #include <config.h>
+#include <stdlib.h>
 #include <gsl/gsl_errno.h>
 #include <gsl/gsl_vector.h>
+#include <gsl/gsl_matrix.h>
 #include <gsl/gsl_sort.h>
 #include <gsl/gsl_sort_vector.h>
+#include <gsl/gsl_sort_matrix.h>
+
+/* use quickselect instead of a heap when k > n / SUBSET_SELECT_RATIO */
+#define SUBSET_SELECT_RATIO 16
 
 #define BASE_LONG_DOUBLE
 #include "templates_on.h"
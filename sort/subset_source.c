@@ -15,60 +15,233 @@
 
 /* find the k-th smallest elements of the vector data, in ascending order */
 
-int
-FUNCTION (gsl_sort, smallest) (BASE * dest, const size_t k,
-                               const BASE * src, const size_t stride,
-                               const size_t n)
+/*
+ * 2026: the k smallest or largest elements are found with a bounded
+ * heap, O(n log k), when k is small compared to n, and otherwise by
+ * quickselect on a copy of the data followed by a sort of the first k
+ * elements, O(n + k log k). The previous version kept a sorted array by
+ * insertion, which is O(n k).
+ */
+
+/* x comes before y in the output: x < y for the smallest elements,
+ * x > y for the largest */
+static inline int
+FUNCTION (subset, before) (const BASE x, const BASE y, const int largest)
+{
+  return largest ? (y < x) : (x < y);
+}
+
+/* restore the heap property below h[i], for a heap with the last
+ * element in output order at the root */
+static inline void
+FUNCTION (subset, siftdown) (BASE * h, const size_t n, size_t i, const int largest)
 {
-  size_t i, j;
-  BASE xbound;
+  const BASE v = h[i];
 
-  if (k > n)
+  while (2 * i + 1 < n)
     {
-      GSL_ERROR ("subset length k exceeds vector length n", GSL_EINVAL);
+      size_t j = 2 * i + 1;
+
+      if (j + 1 < n && FUNCTION (subset, before) (h[j], h[j + 1], largest))
+        j++;
+
+      if (!FUNCTION (subset, before) (v, h[j], largest))
+        break;
+
+      h[i] = h[j];
+      i = j;
     }
 
-  if (k == 0 || n == 0)
+  h[i] = v;
+}
+
+static void
+FUNCTION (subset, heap) (BASE * dest, const size_t k, const BASE * src,
+                         const size_t stride, const size_t n, const int largest)
+{
+  size_t i;
+
+  for (i = 0; i < k; ++i)
+    dest[i] = src[i * stride];
+
+  for (i = k / 2; i-- > 0; )
+    FUNCTION (subset, siftdown) (dest, k, i, largest);
+
+  for (i = k; i < n; ++i)
     {
-      return GSL_SUCCESS;
+      const BASE xi = src[i * stride];
+
+      if (FUNCTION (subset, before) (xi, dest[0], largest))
+        {
+          dest[0] = xi;
+          FUNCTION (subset, siftdown) (dest, k, 0, largest);
+        }
+    }
+
+  /* sort the heap into output order */
+  for (i = k; i-- > 1; )
+    {
+      BASE tmp = dest[0];
+      dest[0] = dest[i];
+      dest[i] = tmp;
+      FUNCTION (subset, siftdown) (dest, i, 0, largest);
     }
+}
+
+/*
+FUNCTION (subset, select)
+  Rearrange x[0..n-1] so that x[0..k-1] are the first k elements in
+output order, using quickselect with a median of 3 pivot
 
-  /* take the first element */
+Return: 1 on success, 0 if the partitions did not shrink fast enough,
+        in which case the caller falls back to the heap
+*/
 
-  j = 1;
-  xbound = src[0 * stride];
-  dest[0] = xbound;
+static int
+FUNCTION (subset, select) (BASE * x, const size_t k, const size_t n, const int largest)
+{
+  size_t lo = 0, hi = n;
+  size_t budget = 2;
+  size_t i;
 
-  /* examine the remaining elements */
+  for (i = n; i > 1; i >>= 1)
+    budget += 2;
 
-  for (i = 1; i < n; i++)
+  while (hi - lo > 16)
     {
-      size_t i1;
+      const size_t mid = lo + (hi - lo) / 2;
+      size_t a = lo, b = mid, c = hi - 1, m, j;
+      BASE pivot, tmp;
+
+      if (budget-- == 0)
+        return 0;
 
-      BASE xi = src[i * stride];
+      /* median of x[a], x[b], x[c] */
+      if (FUNCTION (subset, before) (x[b], x[a], largest))
+        { m = a; a = b; b = m; }
+      if (FUNCTION (subset, before) (x[c], x[b], largest))
+        b = FUNCTION (subset, before) (x[c], x[a], largest) ? a : c;
+      m = b;
 
-      if (j < k)
+      tmp = x[lo]; x[lo] = x[m]; x[m] = tmp;
+      pivot = x[lo];
+
+      /* Hoare partition of x[lo+1..hi-1], as in the introsort */
+      i = lo + 1;
+      j = hi - 1;
+
+      while (1)
         {
-          j++;
+          while (i <= j && FUNCTION (subset, before) (x[i], pivot, largest))
+            ++i;
+          while (i <= j && FUNCTION (subset, before) (pivot, x[j], largest))
+            --j;
+
+          if (i >= j)
+            break;
+
+          tmp = x[i]; x[i] = x[j]; x[j] = tmp;
+          ++i;
+          --j;
         }
-      else if (xi >= xbound)
+
+      x[lo] = x[j];
+      x[j] = pivot;
+
+      if (j == k || j + 1 == k)
+        return 1;
+      else if (j > k)
+        hi = j;
+      else
+        lo = j + 1;
+    }
+
+  /* insertion sort of the remaining range */
+  for (i = lo + 1; i < hi; ++i)
+    {
+      const BASE v = x[i];
+      size_t j = i;
+
+      while (j > lo && FUNCTION (subset, before) (v, x[j - 1], largest))
         {
-          continue;
+          x[j] = x[j - 1];
+          --j;
         }
 
-      for (i1 = j - 1; i1 > 0 ; i1--)
-        {
-          if (xi > dest[i1 - 1])
-            break;
+      x[j] = v;
+    }
 
-          dest[i1] = dest[i1 - 1];
-        }
+  return 1;
+}
+
+/*
+FUNCTION (subset, find)
+  Store the k smallest (largest) elements of src in ascending
+(descending) order in dest
+
+Inputs: dest    - output, length k
+        k       - number of elements to find
+        src     - input data
+        stride  - stride of src
+        n       - length of src
+        largest - 0 for the smallest elements, 1 for the largest
+        work    - workspace of length n for the quickselect, or NULL
+                  to allocate it here
+*/
+
+static void
+FUNCTION (subset, find) (BASE * dest, const size_t k, const BASE * src,
+                         const size_t stride, const size_t n, const int largest,
+                         BASE * work)
+{
+  BASE *x = work;
+  size_t i;
+
+  if (k * SUBSET_SELECT_RATIO > n && x == NULL)
+    x = malloc (n * sizeof (BASE));
+
+  if (k * SUBSET_SELECT_RATIO <= n || x == NULL)
+    {
+      FUNCTION (subset, heap) (dest, k, src, stride, n, largest);
+      return;
+    }
+
+  for (i = 0; i < n; ++i)
+    x[i] = src[i * stride];
+
+  if (FUNCTION (subset, select) (x, k, n, largest))
+    {
+      TYPE (gsl_sort) (x, 1, k);
+
+      for (i = 0; i < k; ++i)
+        dest[i] = largest ? x[k - 1 - i] : x[i];
+    }
+  else
+    {
+      FUNCTION (subset, heap) (dest, k, src, stride, n, largest);
+    }
+
+  if (work == NULL)
+    free (x);
+}
 
-      dest[i1] = xi;
+int
+FUNCTION (gsl_sort, smallest) (BASE * dest, const size_t k,
+                               const BASE * src, const size_t stride,
+                               const size_t n)
+{
+  if (k > n)
+    {
+      GSL_ERROR ("subset length k exceeds vector length n", GSL_EINVAL);
+    }
 
-      xbound = dest[j-1];
+  if (k == 0 || n == 0)
+    {
+      return GSL_SUCCESS;
     }
 
+  FUNCTION (subset, find) (dest, k, src, stride, n, 0, NULL);
+
   return GSL_SUCCESS;
 }
 
@@ -85,9 +258,6 @@ FUNCTION (gsl_sort, largest) (BASE * dest, const size_t k,
                               const BASE * src, const size_t stride,
                               const size_t n)
 {
-  size_t i, j;
-  BASE xbound;
-
   if (k > n)
     {
       GSL_ERROR ("subset length k exceeds vector length n", GSL_EINVAL);
@@ -98,49 +268,79 @@ FUNCTION (gsl_sort, largest) (BASE * dest, const size_t k,
       return GSL_SUCCESS;
     }
 
-  /* take the first element */
+  FUNCTION (subset, find) (dest, k, src, stride, n, 1, NULL);
 
-  j = 1;
-  xbound = src[0 * stride];
-  dest[0] = xbound;
+  return GSL_SUCCESS;
+}
 
-  /* examine the remaining elements */
 
-  for (i = 1; i < n; i++)
-    {
-      size_t i1;
+int
+FUNCTION (gsl_sort_vector,largest) (BASE * dest, const size_t k, 
+                                    const TYPE (gsl_vector) * v)
+{
+  return FUNCTION (gsl_sort, largest) (dest, k, v->data, v->stride, v->size);
+}
 
-      BASE xi = src[i * stride];
+/* batched versions: the first k columns of row i of dest receive the k
+ * smallest (largest) elements of row i of A, sharing one workspace */
 
-      if (j < k)
-        {
-          j++;
-        }
-      else if (xi <= xbound)
+static int
+FUNCTION (subset, matrix_rows) (TYPE (gsl_matrix) * dest, const size_t k,
+                                const TYPE (gsl_matrix) * A, const int largest)
+{
+  const size_t M = A->size1;
+  const size_t N = A->size2;
+
+  if (dest->size1 != M)
+    {
+      GSL_ERROR ("dest and A must have the same number of rows", GSL_EBADLEN);
+    }
+  else if (dest->size2 < k)
+    {
+      GSL_ERROR ("dest must have at least k columns", GSL_EBADLEN);
+    }
+  else if (k > N)
+    {
+      GSL_ERROR ("subset length k exceeds number of columns", GSL_EINVAL);
+    }
+  else if (k == 0)
+    {
+      return GSL_SUCCESS;
+    }
+  else
+    {
+      BASE *work = NULL;
+      size_t i;
+
+      if (k * SUBSET_SELECT_RATIO > N)
         {
-          continue;
+          work = malloc (N * sizeof (BASE));
+          if (work == NULL)
+            {
+              GSL_ERROR ("failed to allocate workspace", GSL_ENOMEM);
+            }
         }
 
-      for (i1 = j - 1; i1 > 0 ; i1--)
+      for (i = 0; i < M; ++i)
         {
-          if (xi < dest[i1 - 1])
-            break;
-
-          dest[i1] = dest[i1 - 1];
+          FUNCTION (subset, find) (dest->data + i * dest->tda, k,
+                                   A->data + i * A->tda, 1, N, largest, work);
         }
 
-      dest[i1] = xi;
+      free (work);
 
-      xbound = dest[j-1];
+      return GSL_SUCCESS;
     }
-
-  return GSL_SUCCESS;
 }
 
+int
+FUNCTION (gsl_sort_matrix, rows_smallest) (TYPE (gsl_matrix) * dest, const size_t k, const TYPE (gsl_matrix) * A)
+{
+  return FUNCTION (subset, matrix_rows) (dest, k, A, 0);
+}
 
 int
-FUNCTION (gsl_sort_vector,largest) (BASE * dest, const size_t k, 
-                                    const TYPE (gsl_vector) * v)
+FUNCTION (gsl_sort_matrix, rows_largest) (TYPE (gsl_matrix) * dest, const size_t k, const TYPE (gsl_matrix) * A)
 {
-  return FUNCTION (gsl_sort, largest) (dest, k, v->data, v->stride, v->size);
+  return FUNCTION (subset, matrix_rows) (dest, k, A, 1);
 }
@@ -15,60 +15,265 @@
 
 /* find the k-th smallest elements of the vector data, in ascending order */
 
-int
-FUNCTION (gsl_sort, smallest_index) (size_t * p, const size_t k,
-                                     const BASE * src, const size_t stride,
-                                     const size_t n)
+/*
+ * 2026: as in subset_source.c, a bounded heap is used when k is small
+ * compared to n and quickselect otherwise. Equal elements are returned
+ * in order of increasing index.
+ */
+
+/* element a comes before element b in the output; ties are broken by
+ * index */
+static inline int
+FUNCTION (subsetind, before) (const BASE xa, const size_t a, const BASE xb, const size_t b,
+                              const int largest)
 {
-  size_t i, j;
-  BASE xbound;
+  if (largest ? (xb < xa) : (xa < xb))
+    return 1;
+  else if (largest ? (xa < xb) : (xb < xa))
+    return 0;
+  else
+    return a < b;
+}
 
-  if (k > n)
+static inline void
+FUNCTION (subsetind, siftdown) (size_t * h, const size_t n, size_t i,
+                                const BASE * src, const size_t stride, const int largest)
+{
+  const size_t v = h[i];
+  const BASE xv = src[v * stride];
+
+  while (2 * i + 1 < n)
     {
-      GSL_ERROR ("subset length k exceeds vector length n", GSL_EINVAL);
+      size_t j = 2 * i + 1;
+
+      if (j + 1 < n && FUNCTION (subsetind, before) (src[h[j] * stride], h[j],
+                                                     src[h[j + 1] * stride], h[j + 1], largest))
+        j++;
+
+      if (!FUNCTION (subsetind, before) (xv, v, src[h[j] * stride], h[j], largest))
+        break;
+
+      h[i] = h[j];
+      i = j;
     }
 
-  if (k == 0 || n == 0)
+  h[i] = v;
+}
+
+/* sort the heap p[0..k-1] into output order */
+static void
+FUNCTION (subsetind, heapsort) (size_t * p, const size_t k, const BASE * src,
+                                const size_t stride, const int largest)
+{
+  size_t i;
+
+  for (i = k; i-- > 1; )
     {
-      return GSL_SUCCESS;
+      size_t tmp = p[0];
+      p[0] = p[i];
+      p[i] = tmp;
+      FUNCTION (subsetind, siftdown) (p, i, 0, src, stride, largest);
     }
+}
 
-  /* take the first element */
+static void
+FUNCTION (subsetind, heap) (size_t * p, const size_t k, const BASE * src,
+                            const size_t stride, const size_t n, const int largest)
+{
+  size_t i;
 
-  j = 1;
-  xbound = src[0 * stride];
-  p[0] = 0;
+  for (i = 0; i < k; ++i)
+    p[i] = i;
 
-  /* examine the remaining elements */
+  for (i = k / 2; i-- > 0; )
+    FUNCTION (subsetind, siftdown) (p, k, i, src, stride, largest);
 
-  for (i = 1; i < n; i++)
+  for (i = k; i < n; ++i)
     {
-      size_t i1;
+      /* i is larger than every index in the heap, so ties are rejected */
+      if (FUNCTION (subsetind, before) (src[i * stride], i, src[p[0] * stride], p[0], largest))
+        {
+          p[0] = i;
+          FUNCTION (subsetind, siftdown) (p, k, 0, src, stride, largest);
+        }
+    }
 
-      BASE xi = src[i * stride];
+  FUNCTION (subsetind, heapsort) (p, k, src, stride, largest);
+}
 
-      if (j < k)
+/* quickselect on the pairs (x[i], ind[i]), see subset_source.c */
+static int
+FUNCTION (subsetind, select) (BASE * x, size_t * ind, const size_t k, const size_t n,
+                              const int largest)
+{
+  size_t lo = 0, hi = n;
+  size_t budget = 2;
+  size_t i;
+
+  for (i = n; i > 1; i >>= 1)
+    budget += 2;
+
+  while (hi - lo > 16)
+    {
+      const size_t mid = lo + (hi - lo) / 2;
+      size_t a = lo, b = mid, c = hi - 1, m, j;
+      BASE pivot, tmp;
+      size_t ipivot, itmp;
+
+      if (budget-- == 0)
+        return 0;
+
+      if (FUNCTION (subsetind, before) (x[b], ind[b], x[a], ind[a], largest))
+        { m = a; a = b; b = m; }
+      if (FUNCTION (subsetind, before) (x[c], ind[c], x[b], ind[b], largest))
+        b = FUNCTION (subsetind, before) (x[c], ind[c], x[a], ind[a], largest) ? a : c;
+      m = b;
+
+      tmp = x[lo]; x[lo] = x[m]; x[m] = tmp;
+      itmp = ind[lo]; ind[lo] = ind[m]; ind[m] = itmp;
+      pivot = x[lo];
+      ipivot = ind[lo];
+
+      i = lo + 1;
+      j = hi - 1;
+
+      while (1)
         {
-          j++;
+          while (i <= j && FUNCTION (subsetind, before) (x[i], ind[i], pivot, ipivot, largest))
+            ++i;
+          while (i <= j && FUNCTION (subsetind, before) (pivot, ipivot, x[j], ind[j], largest))
+            --j;
+
+          if (i >= j)
+            break;
+
+          tmp = x[i]; x[i] = x[j]; x[j] = tmp;
+          itmp = ind[i]; ind[i] = ind[j]; ind[j] = itmp;
+          ++i;
+          --j;
         }
-      else if (xi >= xbound)
+
+      x[lo] = x[j];
+      x[j] = pivot;
+      ind[lo] = ind[j];
+      ind[j] = ipivot;
+
+      if (j == k || j + 1 == k)
+        return 1;
+      else if (j > k)
+        hi = j;
+      else
+        lo = j + 1;
+    }
+
+  /* selection sort of the part of the small range x[lo..hi-1] which
+   * is needed */
+  for (i = lo; i < k && i < hi; ++i)
+    {
+      size_t j, jmin = i;
+
+      for (j = i + 1; j < hi; ++j)
         {
-          continue;
+          if (FUNCTION (subsetind, before) (x[j], ind[j], x[jmin], ind[jmin], largest))
+            jmin = j;
         }
 
-      for (i1 = j - 1; i1 > 0 ; i1--)
+      if (jmin != i)
         {
-          if (xi > src[p[i1 - 1] * stride])
-            break;
+          BASE tmp = x[i];
+          size_t itmp = ind[i];
 
-          p[i1] = p[i1 - 1];
+          x[i] = x[jmin];
+          x[jmin] = tmp;
+          ind[i] = ind[jmin];
+          ind[jmin] = itmp;
         }
+    }
 
-      p[i1] = i;
+  return 1;
+}
+
+/*
+FUNCTION (subsetind, find)
+  Store the indices of the k smallest (largest) elements of src in p,
+in ascending (descending) order of the elements. The workspaces x and
+ind of length n are used for the quickselect; if they are NULL they are
+allocated here
+*/
+
+static void
+FUNCTION (subsetind, find) (size_t * p, const size_t k, const BASE * src,
+                            const size_t stride, const size_t n, const int largest,
+                            BASE * x, size_t * ind)
+{
+  const int alloc = (x == NULL);
+  size_t i;
+
+  if (k * SUBSET_SELECT_RATIO <= n)
+    {
+      FUNCTION (subsetind, heap) (p, k, src, stride, n, largest);
+      return;
+    }
+
+  if (alloc)
+    {
+      x = malloc (n * sizeof (BASE));
+      ind = malloc (n * sizeof (size_t));
 
-      xbound = src[p[j-1] * stride];
+      if (x == NULL || ind == NULL)
+        {
+          free (x);
+          free (ind);
+          FUNCTION (subsetind, heap) (p, k, src, stride, n, largest);
+          return;
+        }
     }
 
+  for (i = 0; i < n; ++i)
+    {
+      x[i] = src[i * stride];
+      ind[i] = i;
+    }
+
+  if (FUNCTION (subsetind, select) (x, ind, k, n, largest))
+    {
+      for (i = 0; i < k; ++i)
+        p[i] = ind[i];
+
+      for (i = k / 2; i-- > 0; )
+        FUNCTION (subsetind, siftdown) (p, k, i, src, stride, largest);
+
+      FUNCTION (subsetind, heapsort) (p, k, src, stride, largest);
+    }
+  else
+    {
+      FUNCTION (subsetind, heap) (p, k, src, stride, n, largest);
+    }
+
+  if (alloc)
+    {
+      free (x);
+      free (ind);
+    }
+}
+
+int
+FUNCTION (gsl_sort, smallest_index) (size_t * p, const size_t k,
+                                     const BASE * src, const size_t stride,
+                                     const size_t n)
+{
+  if (k > n)
+    {
+      GSL_ERROR ("subset length k exceeds vector length n", GSL_EINVAL);
+    }
+
+  if (k == 0 || n == 0)
+    {
+      return GSL_SUCCESS;
+    }
+
+  FUNCTION (subsetind, find) (p, k, src, stride, n, 0, NULL, NULL);
+
   return GSL_SUCCESS;
 }
 
@@ -85,9 +290,6 @@ FUNCTION (gsl_sort, largest_index) (size_t * p, const size_t k,
                                     const BASE * src, const size_t stride,
                                     const size_t n)
 {
-  size_t i, j;
-  BASE xbound;
-
   if (k > n)
     {
       GSL_ERROR ("subset length k exceeds vector length n", GSL_EINVAL);
@@ -98,49 +300,77 @@ FUNCTION (gsl_sort, largest_index) (size_t * p, const size_t k,
       return GSL_SUCCESS;
     }
 
-  /* take the first element */
+  FUNCTION (subsetind, find) (p, k, src, stride, n, 1, NULL, NULL);
+
+  return GSL_SUCCESS;
+}
+
 
-  j = 1;
-  xbound = src[0 * stride];
-  p[0] = 0;
+int
+FUNCTION (gsl_sort_vector,largest_index) (size_t * p, const size_t k, 
+                                          const TYPE (gsl_vector) * v)
+{
+  return FUNCTION (gsl_sort, largest_index) (p, k, v->data, v->stride, v->size);
+}
 
-  /* examine the remaining elements */
+/* batched versions: p[i*k..i*k+k-1] receives the column indices of the
+ * k smallest (largest) elements of row i of A */
 
-  for (i = 1; i < n; i++)
-    {
-      size_t i1;
+static int
+FUNCTION (subsetind, matrix_rows) (size_t * p, const size_t k, const TYPE (gsl_matrix) * A,
+                                   const int largest)
+{
+  const size_t M = A->size1;
+  const size_t N = A->size2;
 
-      BASE xi = src[i * stride];
+  if (k > N)
+    {
+      GSL_ERROR ("subset length k exceeds number of columns", GSL_EINVAL);
+    }
+  else if (k == 0)
+    {
+      return GSL_SUCCESS;
+    }
+  else
+    {
+      BASE *x = NULL;
+      size_t *ind = NULL;
+      size_t i;
 
-      if (j < k)
-        {
-          j++;
-        }
-      else if (xi <= xbound)
+      if (k * SUBSET_SELECT_RATIO > N)
         {
-          continue;
+          x = malloc (N * sizeof (BASE));
+          ind = malloc (N * sizeof (size_t));
+
+          if (x == NULL || ind == NULL)
+            {
+              free (x);
+              free (ind);
+              GSL_ERROR ("failed to allocate workspace", GSL_ENOMEM);
+            }
         }
 
-      for (i1 = j - 1; i1 > 0 ; i1--)
+      for (i = 0; i < M; ++i)
         {
-          if (xi < src[stride * p[i1 - 1]])
-            break;
-
-          p[i1] = p[i1 - 1];
+          FUNCTION (subsetind, find) (p + i * k, k, A->data + i * A->tda, 1, N,
+                                      largest, x, ind);
         }
 
-      p[i1] = i;
+      free (x);
+      free (ind);
 
-      xbound = src[stride * p[j-1]];
+      return GSL_SUCCESS;
     }
-
-  return GSL_SUCCESS;
 }
 
+int
+FUNCTION (gsl_sort_matrix, rows_smallest_index) (size_t * p, const size_t k, const TYPE (gsl_matrix) * A)
+{
+  return FUNCTION (subsetind, matrix_rows) (p, k, A, 0);
+}
 
 int
-FUNCTION (gsl_sort_vector,largest_index) (size_t * p, const size_t k, 
-                                          const TYPE (gsl_vector) * v)
+FUNCTION (gsl_sort_matrix, rows_largest_index) (size_t * p, const size_t k, const TYPE (gsl_matrix) * A)
 {
-  return FUNCTION (gsl_sort, largest_index) (p, k, v->data, v->stride, v->size);
+  return FUNCTION (subsetind, matrix_rows) (p, k, A, 1);
 }
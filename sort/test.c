@@ -26,9 +26,31 @@
 #include <gsl/gsl_heapsort.h>
 #include <gsl/gsl_sort.h>
 #include <gsl/gsl_sort_vector.h>
+#include <gsl/gsl_sort_matrix.h>
+#include <gsl/gsl_matrix.h>
 #include <gsl/gsl_ieee_utils.h>
 
 size_t urand (size_t);
+void test_sort_signed_zeros (size_t N);
+
+/* An executor which runs the tasks in reverse order, to check that
+   the results do not depend on the order of the tasks */
+
+static void
+reverse_run (size_t ntasks, void (*task) (size_t i, void * data),
+             void * data, void * params)
+{
+  size_t i;
+
+  (void) params;
+
+  for (i = ntasks; i-- > 0;)
+    {
+      task (i, data);
+    }
+}
+
+const gsl_executor reverse_exec = { &reverse_run, 0 };
 
 #include "test_heapsort.c"
 
@@ -128,9 +150,105 @@ main (void)
         }
     }
 
+  /* longer inputs, large enough for the radix sort */
+  for (i = 100; i <= 100000; i *= 10)
+    {
+      test_sort_patterns (i);
+      test_sort_patterns_float (i);
+      test_sort_patterns_long_double (i);
+      test_sort_patterns_ulong (i);
+      test_sort_patterns_long (i);
+      test_sort_patterns_uint (i);
+      test_sort_patterns_int (i);
+      test_sort_patterns_ushort (i);
+      test_sort_patterns_short (i);
+      test_sort_patterns_uchar (i);
+      test_sort_patterns_char (i);
+
+      test_sort_parallel (i);
+      test_sort_parallel_float (i);
+      test_sort_parallel_long_double (i);
+      test_sort_parallel_ulong (i);
+      test_sort_parallel_long (i);
+      test_sort_parallel_uint (i);
+      test_sort_parallel_int (i);
+      test_sort_parallel_ushort (i);
+      test_sort_parallel_short (i);
+      test_sort_parallel_uchar (i);
+      test_sort_parallel_char (i);
+
+      if (i > 10000)
+        continue;
+
+      test_sort_topk (i);
+      test_sort_topk_float (i);
+      test_sort_topk_long_double (i);
+      test_sort_topk_ulong (i);
+      test_sort_topk_long (i);
+      test_sort_topk_uint (i);
+      test_sort_topk_int (i);
+      test_sort_topk_ushort (i);
+      test_sort_topk_short (i);
+      test_sort_topk_uchar (i);
+      test_sort_topk_char (i);
+    }
+
+  test_sort_signed_zeros (1000);
+
   exit (gsl_test_summary ());
 }
 
+/* -0.0 and +0.0 compare equal, so the stable index sort must keep
+ * them in index order; N is large enough for the radix sort */
+void
+test_sort_signed_zeros (size_t N)
+{
+  const double xd[3] = { 1.0, 0.0, -0.0 };
+  const float xf[3] = { 1.0f, 0.0f, -0.0f };
+  double *d = (double *) malloc (N * sizeof (double));
+  float *f = (float *) malloc (N * sizeof (float));
+  size_t *pd = (size_t *) malloc (N * sizeof (size_t));
+  size_t *pf = (size_t *) malloc (N * sizeof (size_t));
+  size_t i, k;
+  int sd = 0, sf = 0;
+
+  for (i = 0; i < N; i++)
+    {
+      d[i] = xd[i % 3];
+      f[i] = xf[i % 3];
+    }
+
+  gsl_sort_index (pd, d, 1, N);
+  gsl_sort_float_index (pf, f, 1, N);
+
+  /* zeros first in index order (1 2 4 5 ...), then the ones */
+  k = 0;
+  for (i = 0; i < N; i++)
+    {
+      if (i % 3 != 0)
+        {
+          sd |= (pd[k] != i);
+          sf |= (pf[k] != i);
+          k++;
+        }
+    }
+
+  for (i = 0; i < N; i += 3)
+    {
+      sd |= (pd[k] != i);
+      sf |= (pf[k] != i);
+      k++;
+    }
+
+  gsl_test (sd, "indexing, gsl_vector, n = %u, signed zeros, stable", N);
+  gsl_test (sf, "indexing, gsl_vector_float, n = %u, signed zeros, stable", N);
+
+  free (d);
+  free (f);
+  free (pd);
+  free (pf);
+}
+
 size_t 
 urand (size_t N)
 {
@@ -18,6 +18,9 @@
  */
 
 void TYPE (test_sort_vector) (size_t N, size_t stride);
+void TYPE (test_sort_patterns) (size_t N);
+void TYPE (test_sort_parallel) (size_t N);
+void TYPE (test_sort_topk) (size_t N);
 void FUNCTION (my, initialize) (TYPE (gsl_vector) * v);
 void FUNCTION (my, randomize) (TYPE (gsl_vector) * v);
 int FUNCTION (my, check) (TYPE (gsl_vector) * data, TYPE (gsl_vector) * orig);
@@ -175,6 +178,321 @@ TYPE (test_sort_vector) (size_t N, size_t stride)
 }
 
 
+/* sort inputs with duplicates, negative values and the usual quicksort
+ * worst cases, comparing unit stride (radix) and strided (introsort)
+ * results, and check that gsl_sort2 keeps pairs together */
+void
+TYPE (test_sort_patterns) (size_t N)
+{
+  const char *desc[] = { "random", "sorted", "reversed", "few unique", "organ pipe" };
+  BASE *x = (BASE *) malloc (N * sizeof (BASE));
+  BASE *y = (BASE *) malloc (2 * N * sizeof (BASE));
+  BASE *z = (BASE *) malloc (N * sizeof (BASE));
+  size_t *p = (size_t *) malloc (N * sizeof (size_t));
+  size_t pattern, i;
+
+  for (pattern = 0; pattern < 5; ++pattern)
+    {
+      int status = 0;
+
+      for (i = 0; i < N; ++i)
+        {
+          long v;
+
+          switch (pattern)
+            {
+              case 0:
+                v = (long) urand (65536) - 32768;
+                break;
+              case 1:
+                v = (long) i;
+                break;
+              case 2:
+                v = (long) (N - i);
+                break;
+              case 3:
+                v = (long) urand (4) - 2;
+                break;
+              default:
+                v = (long) ((i < N / 2) ? i : N - i);
+                break;
+            }
+
+          x[i] = (BASE) v;
+          y[2 * i] = x[i];
+          z[i] = x[i];
+        }
+
+      /* the index sort is stable: ties are ordered by index */
+      FUNCTION (gsl_sort, index) (p, x, 1, N);
+
+      for (i = 1; i < N; ++i)
+        {
+          if (x[p[i]] < x[p[i - 1]] || (x[p[i]] == x[p[i - 1]] && p[i] < p[i - 1]))
+            status = 1;
+        }
+
+      gsl_test (status, "indexing, " NAME (gsl_vector) ", n = %u, %s, stable", N, desc[pattern]);
+
+      TYPE (gsl_sort) (x, 1, N);
+      TYPE (gsl_sort) (y, 2, N);
+      TYPE (gsl_sort2) (z, 1, y + 1, 2, N);
+
+      for (i = 0; i < N; ++i)
+        {
+          if (i > 0 && x[i] < x[i - 1])
+            status = 1;
+          if (x[i] != y[2 * i] || x[i] != z[i])
+            status = 1;
+        }
+
+      gsl_test (status, "sorting, " NAME (gsl_vector) ", n = %u, %s", N, desc[pattern]);
+    }
+
+  /* gsl_sort2 on pairs with distinct keys; the payload must follow its key */
+  {
+    int status = 0;
+
+    for (i = 0; i < N; ++i)
+      {
+        x[i] = (BASE) i;
+        z[i] = (BASE) i;
+      }
+
+    for (i = 0; i < N; ++i)
+      {
+        size_t j = urand (N);
+        BASE tmp;
+
+        tmp = x[i]; x[i] = x[j]; x[j] = tmp;
+        tmp = z[i]; z[i] = z[j]; z[j] = tmp;
+      }
+
+    TYPE (gsl_sort2) (x, 1, z, 1, N);
+
+    for (i = 0; i < N; ++i)
+      {
+        if (x[i] != z[i] || (i > 0 && x[i] < x[i - 1]))
+          status = 1;
+      }
+
+    gsl_test (status, "sorting pairs, " NAME (gsl_vector) ", n = %u", N);
+  }
+
+  free (x);
+  free (y);
+  free (z);
+  free (p);
+}
+
+/* the parallel sorts must give the same results as the serial ones
+ * for any number of tasks and any order of running them */
+void
+TYPE (test_sort_parallel) (size_t N)
+{
+  const char *desc[] = { "random", "few unique", "nan" };
+  const size_t ntasks[] = { 1, 2, 3, 8, 13 };
+  BASE *x = (BASE *) malloc (N * sizeof (BASE));
+  BASE *y = (BASE *) malloc (2 * N * sizeof (BASE));
+  BASE *z = (BASE *) malloc (N * sizeof (BASE));
+  size_t *p = (size_t *) malloc (N * sizeof (size_t));
+  size_t *q = (size_t *) malloc (N * sizeof (size_t));
+  size_t npattern = 2, pattern, i, k;
+
+#if defined(FP)
+  npattern = 3;
+#endif
+
+  for (pattern = 0; pattern < npattern; ++pattern)
+    {
+      for (i = 0; i < N; ++i)
+        {
+          if (pattern == 0)
+            x[i] = (BASE) ((long) urand (65536) - 32768);
+          else
+            x[i] = (BASE) ((long) urand (4) - 2);
+        }
+
+      if (pattern == 2)
+        {
+          for (i = 0; i < N; i += 7)
+            x[i] = (BASE) GSL_NAN;
+        }
+
+      for (i = 0; i < N; ++i)
+        z[i] = x[i];
+
+      FUNCTION (gsl_sort, index) (q, x, 1, N);
+      TYPE (gsl_sort) (z, 1, N);
+
+      for (k = 0; k < sizeof (ntasks) / sizeof (ntasks[0]); ++k)
+        {
+          int status = 0, s;
+
+          s = FUNCTION (gsl_sort, index_parallel) (p, x, 1, N, ntasks[k], &reverse_exec);
+
+          for (i = 0; i < N; ++i)
+            status |= (p[i] != q[i]);
+
+          gsl_test (s || status, "parallel indexing, " NAME (gsl_vector) ", n = %u, ntasks = %u, %s",
+                    N, ntasks[k], desc[pattern]);
+
+          for (i = 0; i < N; ++i)
+            {
+              y[2 * i] = x[i];
+              y[2 * i + 1] = (BASE) 1;
+            }
+
+          status = 0;
+          s = FUNCTION (gsl_sort, parallel) (y, 2, N, ntasks[k], (k % 2) ? &reverse_exec : NULL);
+
+          for (i = 0; i < N; ++i)
+            {
+              if (y[2 * i + 1] != (BASE) 1)
+                status = 1;
+              if (pattern < 2 && y[2 * i] != z[i])
+                status = 1;
+              if (pattern == 2 && !(y[2 * i] == z[i] || (y[2 * i] != y[2 * i] && z[i] != z[i])))
+                status = 1;
+            }
+
+          gsl_test (s || status, "parallel sorting, " NAME (gsl_vector) ", n = %u, ntasks = %u, %s",
+                    N, ntasks[k], desc[pattern]);
+        }
+    }
+
+  free (x);
+  free (y);
+  free (z);
+  free (p);
+  free (q);
+}
+
+/* k smallest and largest elements for k on both sides of the switch
+ * from the heap to quickselect, with ties broken by index, and the
+ * batched matrix versions */
+void
+TYPE (test_sort_topk) (size_t N)
+{
+  const size_t M = 3;
+  const size_t kvals[] = { 1, 5, N / 20, N / 2, N };
+  TYPE (gsl_matrix) * A = FUNCTION (gsl_matrix, alloc) (M, N);
+  BASE *sorted = (BASE *) malloc (N * sizeof (BASE));
+  BASE *dest = (BASE *) malloc (N * sizeof (BASE));
+  size_t *perm = (size_t *) malloc (N * sizeof (size_t));
+  size_t *p = (size_t *) malloc (M * N * sizeof (size_t));
+  size_t i, j, ik;
+
+  for (i = 0; i < M; ++i)
+    {
+      for (j = 0; j < N; ++j)
+        {
+          /* row 1 has many ties */
+          long v = (i == 1) ? (long) urand (8) : (long) urand (65536) - 32768;
+          FUNCTION (gsl_matrix, set) (A, i, j, (BASE) v);
+        }
+    }
+
+  for (ik = 0; ik < sizeof (kvals) / sizeof (kvals[0]); ++ik)
+    {
+      const size_t k = kvals[ik];
+      int status = 0;
+
+      if (k == 0)
+        continue;
+
+      for (i = 0; i < M; ++i)
+        {
+          const BASE *row = A->data + i * A->tda;
+
+          for (j = 0; j < N; ++j)
+            sorted[j] = row[j];
+
+          TYPE (gsl_sort) (sorted, 1, N);
+          FUNCTION (gsl_sort, index) (perm, row, 1, N);
+
+          FUNCTION (gsl_sort, smallest) (dest, k, row, 1, N);
+          for (j = 0; j < k; ++j)
+            status |= (dest[j] != sorted[j]);
+
+          FUNCTION (gsl_sort, largest) (dest, k, row, 1, N);
+          for (j = 0; j < k; ++j)
+            status |= (dest[j] != sorted[N - 1 - j]);
+
+          /* the stable index sort also orders ties by index */
+          FUNCTION (gsl_sort, smallest_index) (p, k, row, 1, N);
+          for (j = 0; j < k; ++j)
+            status |= (p[j] != perm[j]);
+
+          FUNCTION (gsl_sort, largest_index) (p, k, row, 1, N);
+          for (j = 0; j < k; ++j)
+            {
+              status |= (row[p[j]] != sorted[N - 1 - j]);
+              if (j > 0 && row[p[j]] == row[p[j - 1]])
+                status |= (p[j] < p[j - 1]);
+            }
+        }
+
+      gsl_test (status, "smallest/largest, " NAME (gsl_vector) ", n = %u, k = %u", N, k);
+
+      /* batched versions must agree with the row by row results */
+      {
+        TYPE (gsl_matrix) * B = FUNCTION (gsl_matrix, alloc) (M, k + 1);
+        gsl_error_handler_t *handler;
+
+        status = 0;
+
+        /* dest must have at least k columns */
+        handler = gsl_set_error_handler_off ();
+        status |= (FUNCTION (gsl_sort_matrix, rows_smallest) (B, k + 2, A) != GSL_EBADLEN);
+        status |= (FUNCTION (gsl_sort_matrix, rows_largest) (B, k + 2, A) != GSL_EBADLEN);
+        gsl_set_error_handler (handler);
+
+        FUNCTION (gsl_sort_matrix, rows_smallest) (B, k, A);
+        for (i = 0; i < M; ++i)
+          {
+            FUNCTION (gsl_sort, smallest) (dest, k, A->data + i * A->tda, 1, N);
+            for (j = 0; j < k; ++j)
+              status |= (dest[j] != FUNCTION (gsl_matrix, get) (B, i, j));
+          }
+
+        FUNCTION (gsl_sort_matrix, rows_largest) (B, k, A);
+        for (i = 0; i < M; ++i)
+          {
+            FUNCTION (gsl_sort, largest) (dest, k, A->data + i * A->tda, 1, N);
+            for (j = 0; j < k; ++j)
+              status |= (dest[j] != FUNCTION (gsl_matrix, get) (B, i, j));
+          }
+
+        FUNCTION (gsl_sort_matrix, rows_smallest_index) (p, k, A);
+        for (i = 0; i < M; ++i)
+          {
+            FUNCTION (gsl_sort, smallest_index) (perm, k, A->data + i * A->tda, 1, N);
+            for (j = 0; j < k; ++j)
+              status |= (perm[j] != p[i * k + j]);
+          }
+
+        FUNCTION (gsl_sort_matrix, rows_largest_index) (p, k, A);
+        for (i = 0; i < M; ++i)
+          {
+            FUNCTION (gsl_sort, largest_index) (perm, k, A->data + i * A->tda, 1, N);
+            for (j = 0; j < k; ++j)
+              status |= (perm[j] != p[i * k + j]);
+          }
+
+        gsl_test (status, "matrix rows smallest/largest, " NAME (gsl_vector) ", n = %u, k = %u", N, k);
+
+        FUNCTION (gsl_matrix, free) (B);
+      }
+    }
+
+  FUNCTION (gsl_matrix, free) (A);
+  free (sorted);
+  free (dest);
+  free (perm);
+  free (p);
+}
+
 void
 FUNCTION (my, initialize) (TYPE (gsl_vector) * v)
 {
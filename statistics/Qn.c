@@ -1,5 +1,7 @@
 #include <config.h>
+#include <stdlib.h>
 #include <gsl/gsl_math.h>
+#include <gsl/gsl_errno.h>
 #include <gsl/gsl_statistics.h>
 #include <gsl/gsl_sort.h>
 
@@ -58,61 +58,251 @@ licence it under the GNU Public Licence.
 
 static BASE FUNCTION(Qn,whimed)(BASE * a, int * w, int n, BASE * a_cand, BASE * a_srt, int * w_cand);
 
-/*
-gsl_stats_Qn0_from_sorted_data()
-  Efficient algorithm for the scale estimator:
+/* state of the rows of one task in the search for Q_n0 */
+typedef struct
+{
+  int64_t sump;                 /* sum of p[i] over the rows */
+  int64_t sumq;                 /* sum of q[i] - 1 over the rows */
+  int count;                    /* number of entries written to work */
+  int offset;                   /* position of the first entry in work */
+} FUNCTION(Qn,block);
 
-    Q_n0 = { |x_i - x_j|; i<j }_(k) [ = Qn without scaling ]
+typedef struct
+{
+  const BASE *sorted_data;
+  size_t stride;
+  int n;
+  size_t ntasks;
+  BASE *work;
+  int *left, *right, *p, *q, *weight;
+  BASE trial;
+  int update;                   /* 1: right := p, 2: left := q, 0: none */
+  int all;                      /* store all remaining differences */
+  FUNCTION(Qn,block) *block;
+} FUNCTION(Qn,params);
+
+/* apply the pending update of left or right to the rows of block t,
+ * and count the entries which these rows contribute to work */
+static void
+FUNCTION(Qn,count_task) (size_t t, void *vparams)
+{
+  FUNCTION(Qn,params) * P = (FUNCTION(Qn,params) *) vparams;
+  const int i0 = (int) gsl_executor_block (P->n, P->ntasks, t);
+  const int i1 = (int) gsl_executor_block (P->n, P->ntasks, t + 1);
+  int count = 0;
+  int i;
 
-i.e. the k-th order statistic of the |x_i - x_j|, where:
+  for (i = i0; i < i1; ++i)
+    {
+      if (P->update == 1)
+        P->right[i] = P->p[i];
+      else if (P->update == 2)
+        P->left[i] = P->q[i];
 
-k = (floor(n/2) + 1 choose 2)
+      if (i > 0 && P->left[i] <= P->right[i])
+        count += P->all ? P->right[i] - P->left[i] + 1 : 1;
+    }
+
+  P->block[t].count = count;
+}
+
+/* write the entries of the rows of block t to work, in row order */
+static void
+FUNCTION(Qn,fill_task) (size_t t, void *vparams)
+{
+  FUNCTION(Qn,params) * P = (FUNCTION(Qn,params) *) vparams;
+  const BASE *x = P->sorted_data;
+  const size_t stride = P->stride;
+  const int ni = P->n;
+  const int i1 = (int) gsl_executor_block (P->n, P->ntasks, t + 1);
+  int i = (int) gsl_executor_block (P->n, P->ntasks, t);
+  int j = P->block[t].offset;
+
+  if (i == 0)
+    i = 1;
+
+  for (; i < i1; ++i)
+    {
+      if (P->all)
+        {
+          int jj;
+
+          for (jj = P->left[i]; jj <= P->right[i]; ++jj)
+            {
+              P->work[j] = x[i * stride] - x[(ni - jj) * stride];
+              j++;
+            }
+        }
+      else if (P->left[i] <= P->right[i])
+        {
+          int jh;
+
+          P->weight[j] = P->right[i] - P->left[i] + 1;
+          jh = P->left[i] + P->weight[j] / 2;
+          P->work[j] = x[i * stride] - x[(ni - jh) * stride];
+          ++j;
+        }
+    }
+}
+
+/* compute p[i] and q[i] for the rows of block t; each block finds its
+ * starting position by bisection and then proceeds as the serial loop */
+static void
+FUNCTION(Qn,pq_task) (size_t t, void *vparams)
+{
+  FUNCTION(Qn,params) * P = (FUNCTION(Qn,params) *) vparams;
+  const BASE *x = P->sorted_data;
+  const size_t stride = P->stride;
+  const int ni = P->n;
+  const BASE trial = P->trial;
+  const int i0 = (int) gsl_executor_block (P->n, P->ntasks, t);
+  const int i1 = (int) gsl_executor_block (P->n, P->ntasks, t + 1);
+  int64_t sump = 0, sumq = 0;
+  int i, j, lo, hi;
+
+  if (i0 == i1)
+    {
+      P->block[t].sump = 0;
+      P->block[t].sumq = 0;
+      return;
+    }
+
+  /* p[i1-1] = smallest j with x[i1-1] - x[ni-j-1] >= trial, or ni;
+     when trial > 0 it is at least ni - i1, and starting there keeps
+     the differences nonnegative, as in the serial loop, which matters
+     for unsigned types */
+  lo = (trial > 0) ? ni - i1 : 0;
+  hi = ni;
+  while (lo < hi)
+    {
+      const int mid = lo + (hi - lo) / 2;
+
+      if (((double)(x[(i1 - 1) * stride] - x[(ni - mid - 1) * stride])) < trial)
+        lo = mid + 1;
+      else
+        hi = mid;
+    }
+
+  j = lo;
+  for (i = i1 - 1; i >= i0; --i)
+    {
+      while (j < ni && ((double)(x[i * stride] - x[(ni - j - 1) * stride])) < trial)
+        ++j;
+
+      P->p[i] = j;
+      sump += j;
+    }
+
+  /* q[i0] = largest j <= ni + 1 with x[i0] - x[ni-j+1] <= trial,
+     which is at least ni + 1 - i0 */
+  lo = ni + 1 - i0;
+  hi = ni + 1;
+  while (lo < hi)
+    {
+      const int mid = lo + (hi - lo + 1) / 2;
+
+      if ((double)(x[i0 * stride] - x[(ni - mid + 1) * stride]) > trial)
+        hi = mid - 1;
+      else
+        lo = mid;
+    }
+
+  j = lo;
+  for (i = i0; i < i1; ++i)
+    {
+      while ((double)(x[i * stride] - x[(ni - j + 1) * stride]) > trial)
+        --j;
+
+      P->q[i] = j;
+      sumq += j - 1;
+    }
+
+  P->block[t].sump = sump;
+  P->block[t].sumq = sumq;
+}
+
+/* count and store the entries of work, returning their number */
+static int
+FUNCTION(Qn,gather) (FUNCTION(Qn,params) * P, const gsl_executor * exec)
+{
+  int total = 0;
+  size_t t;
+
+  gsl_executor_run (exec, P->ntasks, &FUNCTION(Qn,count_task), P);
+  P->update = 0;
+
+  for (t = 0; t < P->ntasks; ++t)
+    {
+      P->block[t].offset = total;
+      total += P->block[t].count;
+    }
+
+  gsl_executor_run (exec, P->ntasks, &FUNCTION(Qn,fill_task), P);
+
+  return total;
+}
+
+/*
+FUNCTION(Qn,Qn0)()
+  Compute Q_n0 as gsl_stats_Qn0_from_sorted_data, with the loops over
+the rows divided into ntasks tasks run by exec. The weighted high
+median is computed on the calling thread.
 
 Inputs: sorted_data - sorted array containing the observations
         stride      - stride
         n           - length of 'sorted_data'
         work        - workspace of length 3n of type BASE
         work_int    - workspace of length 5n of type int
-
-Return: Q_n statistic (without scale/correction factor); same type as input data
+        ntasks      - number of tasks
+        exec        - executor, or NULL to run the tasks in order
+        block       - state of the tasks, length ntasks
 */
 
-BASE
-FUNCTION(gsl_stats,Qn0_from_sorted_data) (const BASE sorted_data[],
-                                          const size_t stride,
-                                          const size_t n,
-                                          BASE work[],
-                                          int work_int[])
+static BASE
+FUNCTION(Qn,Qn0) (const BASE sorted_data[], const size_t stride,
+                  const size_t n, BASE work[], int work_int[],
+                  const size_t ntasks, const gsl_executor * exec,
+                  FUNCTION(Qn,block) * block)
 {
   const int ni = (int) n;
   BASE * a_srt = &work[n];
   BASE * a_cand = &work[2*n];
+  FUNCTION(Qn,params) P;
 
-  int *left = &work_int[0];
-  int *right = &work_int[n];
-  int *p = &work_int[2*n];
-  int *q = &work_int[3*n];
-  int *weight = &work_int[4*n];
-
-  BASE trial = (BASE) 0.0;
   int found = 0;
 
-  int h, i, j, jh;
+  int h, i, j;
 
   /* following should be `long long int' : they can be of order n^2 */
   int64_t k, knew, nl,nr, sump, sumq;
+  size_t t;
 
   /* check for quick return */
   if (n < 2)
     return ((BASE) 0.0);
 
+  P.sorted_data = sorted_data;
+  P.stride = stride;
+  P.n = ni;
+  P.ntasks = ntasks;
+  P.work = work;
+  P.left = &work_int[0];
+  P.right = &work_int[n];
+  P.p = &work_int[2*n];
+  P.q = &work_int[3*n];
+  P.weight = &work_int[4*n];
+  P.trial = (BASE) 0.0;
+  P.update = 0;
+  P.all = 0;
+  P.block = block;
+
   h = n / 2 + 1;
   k = (int64_t)h * (h - 1) / 2;
 
   for (i = 0; i < ni; ++i)
     {
-      left[i] = ni - i + 1;
-      right[i] = (i <= h) ? ni : ni - (i - h);
+      P.left[i] = ni - i + 1;
+      P.right[i] = (i <= h) ? ni : ni - (i - h);
 
       /* the n - (i-h) is from the paper; original code had `n' */
     }
@@ -124,60 +314,30 @@ FUNCTION(gsl_stats,Qn0_from_sorted_data) (const BASE sorted_data[],
 /* L200: */
   while (!found && nr - nl > ni)
     {
-      j = 0;
       /* Truncation to float : try to make sure that the same values are got later (guard bits !) */
-      for (i = 1; i < ni; ++i)
-        {
-          if (left[i] <= right[i])
-            {
-              weight[j] = right[i] - left[i] + 1;
-              jh = left[i] + weight[j] / 2;
-              work[j] = sorted_data[i * stride] - sorted_data[(ni - jh) * stride];
-              ++j;
-            }
-        }
-
-      trial = FUNCTION(Qn,whimed)(work, weight, j, a_cand, a_srt, /*iw_cand*/ p);
-
-      j = 0;
-      for (i = ni - 1; i >= 0; --i)
-        {
-          while (j < ni && ((double)(sorted_data[i * stride] - sorted_data[(ni - j - 1) * stride])) < trial)
-            ++j;
+      j = FUNCTION(Qn,gather) (&P, exec);
 
-          p[i] = j;
-        }
+      P.trial = FUNCTION(Qn,whimed)(work, P.weight, j, a_cand, a_srt, /*iw_cand*/ P.p);
 
-      j = ni + 1;
-      for (i = 0; i < ni; ++i)
-        {
-          while ((double)(sorted_data[i * stride] - sorted_data[(ni - j + 1) * stride]) > trial)
-            --j;
-
-          q[i] = j;
-        }
+      gsl_executor_run (exec, ntasks, &FUNCTION(Qn,pq_task), &P);
 
       sump = 0;
       sumq = 0;
 
-      for (i = 0; i < ni; ++i)
+      for (t = 0; t < ntasks; ++t)
         {
-          sump += p[i];
-          sumq += q[i] - 1;
+          sump += block[t].sump;
+          sumq += block[t].sumq;
         }
 
       if (knew <= sump)
         {
-          for (i = 0; i < ni; ++i)
-            right[i] = p[i];
-
+          P.update = 1;         /* right := p */
           nr = sump;
         }
       else if (knew > sumq)
         {
-          for (i = 0; i < ni; ++i)
-            left[i] = q[i];
-
+          P.update = 2;         /* left := q */
           nl = sumq;
         }
       else /* sump < knew <= sumq */
@@ -188,64 +348,59 @@ FUNCTION(gsl_stats,Qn0_from_sorted_data) (const BASE sorted_data[],
 
   if (found)
     {
-      return trial;
+      return P.trial;
     }
   else
     {
-      j = 0;
-      for (i = 1; i < ni; ++i)
-        {
-          int jj;
-
-          for (jj = left[i]; jj <= right[i]; ++jj)
-            {
-              work[j] = sorted_data[i * stride] - sorted_data[(ni - jj) * stride];
-              j++;
-            }/* j will be = sum_{i=2}^n (right[i] - left[i] + 1)_{+}  */
-        }
+      /* j will be = sum_{i=2}^n (right[i] - left[i] + 1)_{+}  */
+      P.all = 1;
+      j = FUNCTION(Qn,gather) (&P, exec);
 
       /* return pull(work, j - 1, knew - nl)	: */
       knew -= (nl + 1); /* -1: 0-indexing */
 
-      /* sort work array */
-      TYPE (gsl_sort) (work, 1, j);
-
-      return (work[knew]);
+      /* select knew-th element of work array */
+      return FUNCTION(gsl_stats,select) (work, 1, j, knew);
     }
 }
 
 /*
-gsl_stats_Qn_from_sorted_data()
+gsl_stats_Qn0_from_sorted_data()
   Efficient algorithm for the scale estimator:
 
-    Q_n = 2.219 * d_n * { |x_i - x_j|; i<j }_(k)
+    Q_n0 = { |x_i - x_j|; i<j }_(k) [ = Qn without scaling ]
 
-with:
+i.e. the k-th order statistic of the |x_i - x_j|, where:
 
 k = (floor(n/2) + 1 choose 2)
 
-and d_n is a correction factor for finite sample bias
-
 Inputs: sorted_data - sorted array containing the observations
         stride      - stride
         n           - length of 'sorted_data'
         work        - workspace of length 3n of type BASE
         work_int    - workspace of length 5n of type int
 
-Return: Q_n statistic
+Return: Q_n statistic (without scale/correction factor); same type as input data
 */
 
-double
-FUNCTION(gsl_stats,Qn_from_sorted_data) (const BASE sorted_data[],
-                                         const size_t stride,
-                                         const size_t n,
-                                         BASE work[],
-                                         int work_int[])
+BASE
+FUNCTION(gsl_stats,Qn0_from_sorted_data) (const BASE sorted_data[],
+                                          const size_t stride,
+                                          const size_t n,
+                                          BASE work[],
+                                          int work_int[])
+{
+  FUNCTION(Qn,block) block;
+
+  return FUNCTION(Qn,Qn0) (sorted_data, stride, n, work, work_int, 1, NULL, &block);
+}
+
+/* apply the consistency and small sample correction factors to Q_n0 */
+static double
+FUNCTION(Qn,scale) (const double Qn0, const size_t n)
 {
   const double scale = 2.21914; /* asymptotic consistency for sigma^2 */
-  double Qn0 = (double) FUNCTION(gsl_stats,Qn0_from_sorted_data)(sorted_data, stride, n, work, work_int);
   double dn = 1.0;
-  double Qn;
 
   /* this correction factor deviates from the original paper Croux and Rousseeuw, 1992, and
    * comes from the 'robustbase' R package */
@@ -273,9 +428,108 @@ FUNCTION(gsl_stats,Qn_from_sorted_data) (const BASE sorted_data[],
       dn = 1.0 / (dn / (double)n + 1.0);
     }
 
-  Qn = scale * dn * Qn0;
+  return scale * dn * Qn0;
+}
+
+/*
+gsl_stats_Qn_from_sorted_data()
+  Efficient algorithm for the scale estimator:
+
+    Q_n = 2.219 * d_n * { |x_i - x_j|; i<j }_(k)
+
+with:
+
+k = (floor(n/2) + 1 choose 2)
+
+and d_n is a correction factor for finite sample bias
+
+Inputs: sorted_data - sorted array containing the observations
+        stride      - stride
+        n           - length of 'sorted_data'
+        work        - workspace of length 3n of type BASE
+        work_int    - workspace of length 5n of type int
+
+Return: Q_n statistic
+*/
+
+double
+FUNCTION(gsl_stats,Qn_from_sorted_data) (const BASE sorted_data[],
+                                         const size_t stride,
+                                         const size_t n,
+                                         BASE work[],
+                                         int work_int[])
+{
+  double Qn0 = (double) FUNCTION(gsl_stats,Qn0_from_sorted_data)(sorted_data, stride, n, work, work_int);
+  return FUNCTION(Qn,scale) (Qn0, n);
+}
+
+/*
+gsl_stats_Qn()
+  Compute Q_n for unsorted data. The data are sorted in place, so
+the input array is rearranged on output.
+
+Inputs: data     - unsorted array containing the observations
+        stride   - stride
+        n        - length of 'data'
+        work     - workspace of length 3n of type BASE
+        work_int - workspace of length 5n of type int
+
+Return: Q_n statistic
+*/
+
+double
+FUNCTION(gsl_stats,Qn) (BASE data[],
+                        const size_t stride,
+                        const size_t n,
+                        BASE work[],
+                        int work_int[])
+{
+  TYPE (gsl_sort) (data, stride, n);
+  return FUNCTION(gsl_stats,Qn_from_sorted_data) (data, stride, n, work, work_int);
+}
+
+/*
+gsl_stats_Qn_parallel()
+  Compute Q_n for unsorted data, dividing the sort and the loops over
+the observations into ntasks tasks run by exec. The data are sorted
+in place.
+
+Inputs: data     - unsorted array containing the observations
+        stride   - stride
+        n        - length of 'data'
+        work     - workspace of length 3n of type BASE
+        work_int - workspace of length 5n of type int
+        ntasks   - number of tasks
+        exec     - executor, or NULL to run the tasks in order
+
+Return: Q_n statistic, or NaN if the data could not be sorted
+*/
+
+double
+FUNCTION(gsl_stats,Qn_parallel) (BASE data[],
+                                 const size_t stride,
+                                 const size_t n,
+                                 BASE work[],
+                                 int work_int[],
+                                 const size_t ntasks,
+                                 const gsl_executor * exec)
+{
+  FUNCTION(Qn,block) * block;
+  double Qn0;
+
+  if (FUNCTION(gsl_sort,parallel) (data, stride, n, ntasks, exec) != GSL_SUCCESS)
+    return GSL_NAN;
+
+  block = malloc (ntasks * sizeof (FUNCTION(Qn,block)));
+  if (block == NULL)
+    {
+      GSL_ERROR_VAL ("failed to allocate space for task state", GSL_ENOMEM, GSL_NAN);
+    }
+
+  Qn0 = (double) FUNCTION(Qn,Qn0) (data, stride, n, work, work_int, ntasks, exec, block);
+  free (block);
 
-  return Qn;
+  return FUNCTION(Qn,scale) (Qn0, n);
 }
 
 /*
@@ -314,12 +568,9 @@ FUNCTION(Qn,whimed)(BASE * a, int * w, int n, BASE * a_cand, BASE * a_srt, int *
         a_srt[i] = a[i];
 
       n2 = n/2; /* =^= n/2 +1 with 0-indexing */
-#if 0
-      rPsort(a_srt, n, n2);
-#else
-      TYPE (gsl_sort) (a_srt, 1, n);
-#endif
-      trial = a_srt[n2];
+
+      /* partial sort in O(n), as rPsort() in the original */
+      trial = FUNCTION(gsl_stats,select) (a_srt, 1, n, n2);
 
       wleft = 0;
       wmid = 0;
@@ -53,40 +53,36 @@ licence it under the GNU Public Licence.
 */
 
 /*
-gsl_stats_Sn0_from_sorted_data()
-  Efficient algorithm for the scale estimator:
-
-    S_n0 = LOMED_{i} HIMED_{i} |x_i - x_j|
-
-which can equivalently be written as
-
-    S_n0 = LOMED_{i} LOMED_{j != i} |x_i - x_j|
+FUNCTION(Sn,lomed)()
+  Compute LOMED_{j != i} |x_i - x_j| for one observation
 
 Inputs: sorted_data - sorted array containing the observations
         stride      - stride
         n           - length of 'sorted_data'
-        work        - workspace of length n
-                      work[i] := LOMED_{j != i} | x_i - x_j |
+        i           - index of the observation, 1 <= i <= n
 
-Return: S_n statistic (without scale/correction factor)
+Return: LOMED_{j != i} |x_i - x_j|
 */
 
-BASE
-FUNCTION(gsl_stats,Sn0_from_sorted_data) (const BASE sorted_data[],
-                                          const size_t stride,
-                                          const size_t n,
-                                          BASE work[])
+static BASE
+FUNCTION(Sn,lomed) (const BASE sorted_data[], const size_t stride,
+                    const size_t n, const int i)
 {
   /* Local variables */
   double medA, medB;
-  int i, diff, half, Amin, Amax, even, length;
+  int diff, half, Amin, Amax, even, length;
   int leftA, leftB, nA, nB, tryA, tryB, rightA, rightB;
   int np1_2 = (n + 1) / 2;
 
-  work[0] = sorted_data[n / 2 * stride] - sorted_data[0];
-
-  /* first half for() loop : */
-  for (i = 2; i <= np1_2; ++i)
+  if (i == (int) n)
+    {
+      return sorted_data[(n - 1) * stride] - sorted_data[(np1_2 - 1) * stride];
+    }
+  else if (i == 1)
+    {
+      return sorted_data[n / 2 * stride] - sorted_data[0];
+    }
+  else if (i <= np1_2)
     {
       nA = i - 1;
       nB = n - i;
@@ -135,18 +131,16 @@ FUNCTION(gsl_stats,Sn0_from_sorted_data) (const BASE sorted_data[],
 
       if (leftA > Amax)
         {
-          work[i - 1] = sorted_data[(leftB + i - 1) * stride] - sorted_data[(i - 1) * stride];
+          return sorted_data[(leftB + i - 1) * stride] - sorted_data[(i - 1) * stride];
         }
       else
         {
           medA = sorted_data[(i - 1) * stride] - sorted_data[(i - leftA + Amin - 2) * stride];
           medB = sorted_data[(leftB + i - 1) * stride] - sorted_data[(i - 1) * stride];
-          work[i - 1] = GSL_MIN(medA, medB);
+          return GSL_MIN(medA, medB);
         }
     }
-
-  /* second half for() loop : */
-  for (i = np1_2 + 1; i <= (int) n - 1; ++i)
+  else
     {
       nA = n - i;
       nB = i - 1;
@@ -196,22 +190,112 @@ FUNCTION(gsl_stats,Sn0_from_sorted_data) (const BASE sorted_data[],
 
       if (leftA > Amax)
         {
-          work[i - 1] = sorted_data[(i - 1) * stride] - sorted_data[(i - leftB - 1) * stride];
+          return sorted_data[(i - 1) * stride] - sorted_data[(i - leftB - 1) * stride];
         }
       else
         {
           medA = sorted_data[(i + leftA - Amin) * stride] - sorted_data[(i - 1) * stride];
           medB = sorted_data[(i - 1) * stride] - sorted_data[(i - leftB - 1) * stride];
-          work[i - 1] = GSL_MIN(medA, medB);
+          return GSL_MIN(medA, medB);
         }
     }
+}
+
+typedef struct
+{
+  const BASE *sorted_data;
+  size_t stride;
+  size_t n;
+  size_t ntasks;
+  BASE *work;
+} FUNCTION(Sn,params);
+
+/* fill work[i-1] for the rows i of block t */
+static void
+FUNCTION(Sn,task) (size_t t, void *vparams)
+{
+  FUNCTION(Sn,params) * params = (FUNCTION(Sn,params) *) vparams;
+  const size_t i0 = gsl_executor_block (params->n, params->ntasks, t);
+  const size_t i1 = gsl_executor_block (params->n, params->ntasks, t + 1);
+  size_t i;
+
+  for (i = i0; i < i1; ++i)
+    params->work[i] = FUNCTION(Sn,lomed) (params->sorted_data, params->stride, params->n, i + 1);
+}
+
+/* S_n0 with the work array filled by ntasks tasks */
+static BASE
+FUNCTION(Sn,Sn0) (const BASE sorted_data[], const size_t stride,
+                  const size_t n, BASE work[],
+                  const size_t ntasks, const gsl_executor * exec)
+{
+  FUNCTION(Sn,params) params;
 
-  work[n - 1] = sorted_data[(n - 1) * stride] - sorted_data[(np1_2 - 1) * stride];
+  params.sorted_data = sorted_data;
+  params.stride = stride;
+  params.n = n;
+  params.ntasks = ntasks;
+  params.work = work;
 
-  /* sort work array */
-  TYPE (gsl_sort) (work, 1, n);
+  gsl_executor_run (exec, ntasks, &FUNCTION(Sn,task), &params);
 
-  return work[np1_2 - 1];
+  /* LOMED of work array */
+  return FUNCTION(gsl_stats,select) (work, 1, n, (n + 1) / 2 - 1);
+}
+
+/* apply the consistency and small sample correction factors to S_n0 */
+static double
+FUNCTION(Sn,scale) (const double Sn0, const size_t n)
+{
+  const double scale = 1.1926; /* asymptotic consistency for sigma^2 */
+  double cn = 1.0;
+
+  /* determine correction factor for finite sample bias */
+  if (n <= 9)
+    {
+      if (n == 2) cn = 0.743;
+      else if (n == 3) cn = 1.851;
+      else if (n == 4) cn = 0.954;
+      else if (n == 5) cn = 1.351;
+      else if (n == 6) cn = 0.993;
+      else if (n == 7) cn = 1.198;
+      else if (n == 8) cn = 1.005;
+      else if (n == 9) cn = 1.131;
+    }
+  else if (n % 2 == 1) /* n odd, >= 11 */
+    {
+      cn = (double) n / (n - 0.9);
+    }
+
+  return scale * cn * Sn0;
+}
+
+/*
+gsl_stats_Sn0_from_sorted_data()
+  Efficient algorithm for the scale estimator:
+
+    S_n0 = LOMED_{i} HIMED_{i} |x_i - x_j|
+
+which can equivalently be written as
+
+    S_n0 = LOMED_{i} LOMED_{j != i} |x_i - x_j|
+
+Inputs: sorted_data - sorted array containing the observations
+        stride      - stride
+        n           - length of 'sorted_data'
+        work        - workspace of length n
+                      work[i] := LOMED_{j != i} | x_i - x_j |
+
+Return: S_n statistic (without scale/correction factor)
+*/
+
+BASE
+FUNCTION(gsl_stats,Sn0_from_sorted_data) (const BASE sorted_data[],
+                                          const size_t stride,
+                                          const size_t n,
+                                          BASE work[])
+{
+  return FUNCTION(Sn,Sn0) (sorted_data, stride, n, work, 1, NULL);
 }
 
 /*
@@ -241,29 +325,63 @@ FUNCTION(gsl_stats,Sn_from_sorted_data) (const BASE sorted_data[],
                                          const size_t n,
                                          BASE work[])
 {
-  const double scale = 1.1926; /* asymptotic consistency for sigma^2 */
   double Sn0 = (double) FUNCTION(gsl_stats,Sn0_from_sorted_data)(sorted_data, stride, n, work);
-  double cn = 1.0;
-  double Sn;
+  return FUNCTION(Sn,scale) (Sn0, n);
+}
 
-  /* determine correction factor for finite sample bias */
-  if (n <= 9)
-    {
-      if (n == 2) cn = 0.743;
-      else if (n == 3) cn = 1.851;
-      else if (n == 4) cn = 0.954;
-      else if (n == 5) cn = 1.351;
-      else if (n == 6) cn = 0.993;
-      else if (n == 7) cn = 1.198;
-      else if (n == 8) cn = 1.005;
-      else if (n == 9) cn = 1.131;
-    }
-  else if (n % 2 == 1) /* n odd, >= 11 */
-    {
-      cn = (double) n / (n - 0.9);
-    }
+/*
+gsl_stats_Sn()
+  Compute S_n for unsorted data. The data are sorted in place, so
+the input array is rearranged on output.
+
+Inputs: data   - unsorted array containing the observations
+        stride - stride
+        n      - length of 'data'
+        work   - workspace of length n
+
+Return: S_n statistic
+*/
+
+double
+FUNCTION(gsl_stats,Sn) (BASE data[],
+                        const size_t stride,
+                        const size_t n,
+                        BASE work[])
+{
+  TYPE (gsl_sort) (data, stride, n);
+  return FUNCTION(gsl_stats,Sn_from_sorted_data) (data, stride, n, work);
+}
+
+/*
+gsl_stats_Sn_parallel()
+  Compute S_n for unsorted data, dividing the sort and the evaluation
+of LOMED_{j != i} |x_i - x_j| for each i into ntasks tasks run by
+exec. The data are sorted in place.
+
+Inputs: data   - unsorted array containing the observations
+        stride - stride
+        n      - length of 'data'
+        work   - workspace of length n
+        ntasks - number of tasks
+        exec   - executor, or NULL to run the tasks in order
+
+Return: S_n statistic, or NaN if the data could not be sorted
+*/
+
+double
+FUNCTION(gsl_stats,Sn_parallel) (BASE data[],
+                                 const size_t stride,
+                                 const size_t n,
+                                 BASE work[],
+                                 const size_t ntasks,
+                                 const gsl_executor * exec)
+{
+  double Sn0;
+
+  if (FUNCTION(gsl_sort,parallel) (data, stride, n, ntasks, exec) != GSL_SUCCESS)
+    return GSL_NAN;
 
-  Sn = scale * cn * Sn0;
+  Sn0 = (double) FUNCTION(Sn,Sn0) (data, stride, n, work, ntasks, exec);
 
-  return Sn;
+  return FUNCTION(Sn,scale) (Sn0, n);
 }
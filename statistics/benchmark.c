@@ -0,0 +1,143 @@
+/* statistics/benchmark.c
+ *
+ * Copyright (C) 2026 Patrick Alken
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* timings of the robust scale estimators as a function of n, followed
+ * by the wall clock times of gsl_stats_Sn_parallel and
+ * gsl_stats_Qn_parallel on unsorted data of length nmax for 1, 2, 4, ...
+ * tasks up to max_tasks.  The tasks are run by an OpenMP executor when
+ * compiled with -fopenmp, and serially otherwise; usage:
+ * benchmark [nmax] [max_tasks] */
+
+#include <config.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <gsl/gsl_statistics.h>
+#include <gsl/gsl_sort.h>
+#include <gsl/gsl_rng.h>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+static double
+seconds (clock_t start)
+{
+  return (clock () - start) / (double) CLOCKS_PER_SEC;
+}
+
+static double
+wall_seconds (void)
+{
+#ifdef _OPENMP
+  return omp_get_wtime ();
+#else
+  return clock () / (double) CLOCKS_PER_SEC;
+#endif
+}
+
+static void
+run_omp (size_t ntasks, void (*task) (size_t i, void *data),
+         void *data, void *params)
+{
+  int i;
+
+  (void) params;
+
+#pragma omp parallel for schedule(static)
+  for (i = 0; i < (int) ntasks; i++)
+    task (i, data);
+}
+
+int
+main (int argc, char *argv[])
+{
+  const size_t nmax = (argc > 1) ? (size_t) atol (argv[1]) : 10000000;
+  const size_t max_tasks = (argc > 2) ? (size_t) atol (argv[2]) : 8;
+  gsl_executor exec;
+  size_t ntasks;
+  gsl_rng *r = gsl_rng_alloc (gsl_rng_default);
+  double *x = malloc (nmax * sizeof (double));
+  double *work = malloc (3 * nmax * sizeof (double));
+  int *work_int = malloc (5 * nmax * sizeof (int));
+  size_t n, i;
+
+  printf ("%10s %10s %10s %10s %10s\n", "n", "sort", "Sn", "Qn", "median");
+
+  for (n = 10000; n <= nmax; n *= 10)
+    {
+      double t_sort, t_Sn, t_Qn, t_median;
+      clock_t start;
+
+      for (i = 0; i < n; ++i)
+        x[i] = gsl_rng_uniform (r);
+
+      start = clock ();
+      gsl_stats_median (x, 1, n);
+      t_median = seconds (start);
+
+      start = clock ();
+      gsl_sort (x, 1, n);
+      t_sort = seconds (start);
+
+      start = clock ();
+      gsl_stats_Sn_from_sorted_data (x, 1, n, work);
+      t_Sn = seconds (start);
+
+      start = clock ();
+      gsl_stats_Qn_from_sorted_data (x, 1, n, work, work_int);
+      t_Qn = seconds (start);
+
+      printf ("%10zu %10.3f %10.3f %10.3f %10.3f\n",
+              n, t_sort, t_Sn, t_Qn, t_median);
+    }
+
+  exec.run = &run_omp;
+  exec.params = 0;
+
+  printf ("\nn = %zu\n%10s %10s %10s\n", nmax, "ntasks", "Sn", "Qn");
+
+  for (ntasks = 1; ntasks <= max_tasks; ntasks *= 2)
+    {
+      double t_Sn, t_Qn, start;
+
+      for (i = 0; i < nmax; ++i)
+        x[i] = gsl_rng_uniform (r);
+
+      start = wall_seconds ();
+      gsl_stats_Sn_parallel (x, 1, nmax, work, ntasks, &exec);
+      t_Sn = wall_seconds () - start;
+
+      for (i = 0; i < nmax; ++i)
+        x[i] = gsl_rng_uniform (r);
+
+      start = wall_seconds ();
+      gsl_stats_Qn_parallel (x, 1, nmax, work, work_int, ntasks, &exec);
+      t_Qn = wall_seconds () - start;
+
+      printf ("%10zu %10.3f %10.3f\n", ntasks, t_Sn, t_Qn);
+    }
+
+  free (x);
+  free (work);
+  free (work_int);
+  gsl_rng_free (r);
+
+  return 0;
+}
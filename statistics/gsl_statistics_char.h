@@ -22,6 +22,7 @@
 
 #include <stddef.h>
 #include <stdlib.h>
+#include <gsl/gsl_executor.h>
 
 #undef __BEGIN_DECLS
 #undef __END_DECLS
@@ -68,6 +69,7 @@ double gsl_stats_char_ttest (const char data1[], const size_t stride1, const siz
 char gsl_stats_char_max (const char data[], const size_t stride, const size_t n);
 char gsl_stats_char_min (const char data[], const size_t stride, const size_t n);
 void gsl_stats_char_minmax (char * min, char * max, const char data[], const size_t stride, const size_t n);
+int gsl_stats_char_summary (double * mean, double * variance, double * skew, double * kurtosis, double * absdev, char * min, char * max, const char data[], const size_t stride, const size_t n);
 
 size_t gsl_stats_char_max_index (const char data[], const size_t stride, const size_t n);
 size_t gsl_stats_char_min_index (const char data[], const size_t stride, const size_t n);
@@ -78,6 +80,7 @@ char gsl_stats_char_select(char data[], const size_t stride, const size_t n, con
 double gsl_stats_char_median_from_sorted_data (const char sorted_data[], const size_t stride, const size_t n) ;
 double gsl_stats_char_median (char sorted_data[], const size_t stride, const size_t n);
 double gsl_stats_char_quantile_from_sorted_data (const char sorted_data[], const size_t stride, const size_t n, const double f) ;
+int gsl_stats_char_quantiles (char data[], const size_t stride, const size_t n, const double p[], const size_t np, double result[]);
 
 double gsl_stats_char_trmean_from_sorted_data (const double trim, const char sorted_data[], const size_t stride, const size_t n) ;
 double gsl_stats_char_gastwirth_from_sorted_data (const char sorted_data[], const size_t stride, const size_t n) ;
@@ -87,9 +90,13 @@ double gsl_stats_char_mad(const char data[], const size_t stride, const size_t n
 
 char gsl_stats_char_Sn0_from_sorted_data (const char sorted_data[], const size_t stride, const size_t n, char work[]) ;
 double gsl_stats_char_Sn_from_sorted_data (const char sorted_data[], const size_t stride, const size_t n, char work[]) ;
+double gsl_stats_char_Sn (char data[], const size_t stride, const size_t n, char work[]) ;
+double gsl_stats_char_Sn_parallel (char data[], const size_t stride, const size_t n, char work[], const size_t ntasks, const gsl_executor * exec) ;
 
 char gsl_stats_char_Qn0_from_sorted_data (const char sorted_data[], const size_t stride, const size_t n, char work[], int work_int[]) ;
 double gsl_stats_char_Qn_from_sorted_data (const char sorted_data[], const size_t stride, const size_t n, char work[], int work_int[]) ;
+double gsl_stats_char_Qn (char data[], const size_t stride, const size_t n, char work[], int work_int[]) ;
+double gsl_stats_char_Qn_parallel (char data[], const size_t stride, const size_t n, char work[], int work_int[], const size_t ntasks, const gsl_executor * exec) ;
 
 __END_DECLS
 
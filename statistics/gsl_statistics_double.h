@@ -22,6 +22,7 @@
 
 #include <stddef.h>
 #include <stdlib.h>
+#include <gsl/gsl_executor.h>
 
 #undef __BEGIN_DECLS
 #undef __END_DECLS
@@ -80,6 +81,8 @@ double gsl_stats_wabsdev_m (const double w[], const size_t wstride, const double
 double gsl_stats_wskew_m_sd (const double w[], const size_t wstride, const double data[], const size_t stride, const size_t n, const double wmean, const double wsd);
 double gsl_stats_wkurtosis_m_sd (const double w[], const size_t wstride, const double data[], const size_t stride, const size_t n, const double wmean, const double wsd);
 
+int gsl_stats_wsummary (double * wmean, double * wvariance, double * wskew, double * wkurtosis, double * wabsdev, const double w[], const size_t wstride, const double data[], const size_t stride, const size_t n);
+
 /* END OF FLOATING POINT TYPES */
 
 double gsl_stats_pvariance (const double data1[], const size_t stride1, const size_t n1, const double data2[], const size_t stride2, const size_t n2);
@@ -88,6 +91,7 @@ double gsl_stats_ttest (const double data1[], const size_t stride1, const size_t
 double gsl_stats_max (const double data[], const size_t stride, const size_t n);
 double gsl_stats_min (const double data[], const size_t stride, const size_t n);
 void gsl_stats_minmax (double * min, double * max, const double data[], const size_t stride, const size_t n);
+int gsl_stats_summary (double * mean, double * variance, double * skew, double * kurtosis, double * absdev, double * min, double * max, const double data[], const size_t stride, const size_t n);
 
 size_t gsl_stats_max_index (const double data[], const size_t stride, const size_t n);
 size_t gsl_stats_min_index (const double data[], const size_t stride, const size_t n);
@@ -98,6 +102,7 @@ double gsl_stats_select(double data[], const size_t stride, const size_t n, cons
 double gsl_stats_median_from_sorted_data (const double sorted_data[], const size_t stride, const size_t n) ;
 double gsl_stats_median (double sorted_data[], const size_t stride, const size_t n);
 double gsl_stats_quantile_from_sorted_data (const double sorted_data[], const size_t stride, const size_t n, const double f) ;
+int gsl_stats_quantiles (double data[], const size_t stride, const size_t n, const double p[], const size_t np, double result[]);
 
 double gsl_stats_trmean_from_sorted_data (const double trim, const double sorted_data[], const size_t stride, const size_t n) ;
 double gsl_stats_gastwirth_from_sorted_data (const double sorted_data[], const size_t stride, const size_t n) ;
@@ -107,9 +112,13 @@ double gsl_stats_mad(const double data[], const size_t stride, const size_t n, d
 
 double gsl_stats_Sn0_from_sorted_data (const double sorted_data[], const size_t stride, const size_t n, double work[]) ;
 double gsl_stats_Sn_from_sorted_data (const double sorted_data[], const size_t stride, const size_t n, double work[]) ;
+double gsl_stats_Sn (double data[], const size_t stride, const size_t n, double work[]) ;
+double gsl_stats_Sn_parallel (double data[], const size_t stride, const size_t n, double work[], const size_t ntasks, const gsl_executor * exec) ;
 
 double gsl_stats_Qn0_from_sorted_data (const double sorted_data[], const size_t stride, const size_t n, double work[], int work_int[]) ;
 double gsl_stats_Qn_from_sorted_data (const double sorted_data[], const size_t stride, const size_t n, double work[], int work_int[]) ;
+double gsl_stats_Qn (double data[], const size_t stride, const size_t n, double work[], int work_int[]) ;
+double gsl_stats_Qn_parallel (double data[], const size_t stride, const size_t n, double work[], int work_int[], const size_t ntasks, const gsl_executor * exec) ;
 
 __END_DECLS
 
@@ -22,6 +22,7 @@
 
 #include <stddef.h>
 #include <stdlib.h>
+#include <gsl/gsl_executor.h>
 
 #undef __BEGIN_DECLS
 #undef __END_DECLS
@@ -80,6 +81,8 @@ double gsl_stats_float_wabsdev_m (const float w[], const size_t wstride, const f
 double gsl_stats_float_wskew_m_sd (const float w[], const size_t wstride, const float data[], const size_t stride, const size_t n, const double wmean, const double wsd);
 double gsl_stats_float_wkurtosis_m_sd (const float w[], const size_t wstride, const float data[], const size_t stride, const size_t n, const double wmean, const double wsd);
 
+int gsl_stats_float_wsummary (double * wmean, double * wvariance, double * wskew, double * wkurtosis, double * wabsdev, const float w[], const size_t wstride, const float data[], const size_t stride, const size_t n);
+
 /* END OF FLOATING POINT TYPES */
 
 double gsl_stats_float_pvariance (const float data1[], const size_t stride1, const size_t n1, const float data2[], const size_t stride2, const size_t n2);
@@ -88,6 +91,7 @@ double gsl_stats_float_ttest (const float data1[], const size_t stride1, const s
 float gsl_stats_float_max (const float data[], const size_t stride, const size_t n);
 float gsl_stats_float_min (const float data[], const size_t stride, const size_t n);
 void gsl_stats_float_minmax (float * min, float * max, const float data[], const size_t stride, const size_t n);
+int gsl_stats_float_summary (double * mean, double * variance, double * skew, double * kurtosis, double * absdev, float * min, float * max, const float data[], const size_t stride, const size_t n);
 
 size_t gsl_stats_float_max_index (const float data[], const size_t stride, const size_t n);
 size_t gsl_stats_float_min_index (const float data[], const size_t stride, const size_t n);
@@ -98,6 +102,7 @@ float gsl_stats_float_select(float data[], const size_t stride, const size_t n,
 double gsl_stats_float_median_from_sorted_data (const float sorted_data[], const size_t stride, const size_t n) ;
 double gsl_stats_float_median (float sorted_data[], const size_t stride, const size_t n);
 double gsl_stats_float_quantile_from_sorted_data (const float sorted_data[], const size_t stride, const size_t n, const double f) ;
+int gsl_stats_float_quantiles (float data[], const size_t stride, const size_t n, const double p[], const size_t np, double result[]);
 
 double gsl_stats_float_trmean_from_sorted_data (const double trim, const float sorted_data[], const size_t stride, const size_t n) ;
 double gsl_stats_float_gastwirth_from_sorted_data (const float sorted_data[], const size_t stride, const size_t n) ;
@@ -107,9 +112,13 @@ double gsl_stats_float_mad(const float data[], const size_t stride, const size_t
 
 float gsl_stats_float_Sn0_from_sorted_data (const float sorted_data[], const size_t stride, const size_t n, float work[]) ;
 double gsl_stats_float_Sn_from_sorted_data (const float sorted_data[], const size_t stride, const size_t n, float work[]) ;
+double gsl_stats_float_Sn (float data[], const size_t stride, const size_t n, float work[]) ;
+double gsl_stats_float_Sn_parallel (float data[], const size_t stride, const size_t n, float work[], const size_t ntasks, const gsl_executor * exec) ;
 
 float gsl_stats_float_Qn0_from_sorted_data (const float sorted_data[], const size_t stride, const size_t n, float work[], int work_int[]) ;
 double gsl_stats_float_Qn_from_sorted_data (const float sorted_data[], const size_t stride, const size_t n, float work[], int work_int[]) ;
+double gsl_stats_float_Qn (float data[], const size_t stride, const size_t n, float work[], int work_int[]) ;
+double gsl_stats_float_Qn_parallel (float data[], const size_t stride, const size_t n, float work[], int work_int[], const size_t ntasks, const gsl_executor * exec) ;
 
 __END_DECLS
 
@@ -22,6 +22,7 @@
 
 #include <stddef.h>
 #include <stdlib.h>
+#include <gsl/gsl_executor.h>
 
 #undef __BEGIN_DECLS
 #undef __END_DECLS
@@ -68,6 +69,7 @@ double gsl_stats_int_ttest (const int data1[], const size_t stride1, const size_
 int gsl_stats_int_max (const int data[], const size_t stride, const size_t n);
 int gsl_stats_int_min (const int data[], const size_t stride, const size_t n);
 void gsl_stats_int_minmax (int * min, int * max, const int data[], const size_t stride, const size_t n);
+int gsl_stats_int_summary (double * mean, double * variance, double * skew, double * kurtosis, double * absdev, int * min, int * max, const int data[], const size_t stride, const size_t n);
 
 size_t gsl_stats_int_max_index (const int data[], const size_t stride, const size_t n);
 size_t gsl_stats_int_min_index (const int data[], const size_t stride, const size_t n);
@@ -78,6 +80,7 @@ int gsl_stats_int_select(int data[], const size_t stride, const size_t n, const
 double gsl_stats_int_median_from_sorted_data (const int sorted_data[], const size_t stride, const size_t n) ;
 double gsl_stats_int_median (int sorted_data[], const size_t stride, const size_t n);
 double gsl_stats_int_quantile_from_sorted_data (const int sorted_data[], const size_t stride, const size_t n, const double f) ;
+int gsl_stats_int_quantiles (int data[], const size_t stride, const size_t n, const double p[], const size_t np, double result[]);
 
 double gsl_stats_int_trmean_from_sorted_data (const double trim, const int sorted_data[], const size_t stride, const size_t n) ;
 double gsl_stats_int_gastwirth_from_sorted_data (const int sorted_data[], const size_t stride, const size_t n) ;
@@ -87,9 +90,13 @@ double gsl_stats_int_mad(const int data[], const size_t stride, const size_t n,
 
 int gsl_stats_int_Sn0_from_sorted_data (const int sorted_data[], const size_t stride, const size_t n, int work[]) ;
 double gsl_stats_int_Sn_from_sorted_data (const int sorted_data[], const size_t stride, const size_t n, int work[]) ;
+double gsl_stats_int_Sn (int data[], const size_t stride, const size_t n, int work[]) ;
+double gsl_stats_int_Sn_parallel (int data[], const size_t stride, const size_t n, int work[], const size_t ntasks, const gsl_executor * exec) ;
 
 int gsl_stats_int_Qn0_from_sorted_data (const int sorted_data[], const size_t stride, const size_t n, int work[], int work_int[]) ;
 double gsl_stats_int_Qn_from_sorted_data (const int sorted_data[], const size_t stride, const size_t n, int work[], int work_int[]) ;
+double gsl_stats_int_Qn (int data[], const size_t stride, const size_t n, int work[], int work_int[]) ;
+double gsl_stats_int_Qn_parallel (int data[], const size_t stride, const size_t n, int work[], int work_int[], const size_t ntasks, const gsl_executor * exec) ;
 
 __END_DECLS
 
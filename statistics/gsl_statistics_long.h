@@ -22,6 +22,7 @@
 
 #include <stddef.h>
 #include <stdlib.h>
+#include <gsl/gsl_executor.h>
 
 #undef __BEGIN_DECLS
 #undef __END_DECLS
@@ -68,6 +69,7 @@ double gsl_stats_long_ttest (const long data1[], const size_t stride1, const siz
 long gsl_stats_long_max (const long data[], const size_t stride, const size_t n);
 long gsl_stats_long_min (const long data[], const size_t stride, const size_t n);
 void gsl_stats_long_minmax (long * min, long * max, const long data[], const size_t stride, const size_t n);
+int gsl_stats_long_summary (double * mean, double * variance, double * skew, double * kurtosis, double * absdev, long * min, long * max, const long data[], const size_t stride, const size_t n);
 
 size_t gsl_stats_long_max_index (const long data[], const size_t stride, const size_t n);
 size_t gsl_stats_long_min_index (const long data[], const size_t stride, const size_t n);
@@ -78,6 +80,7 @@ long gsl_stats_long_select(long data[], const size_t stride, const size_t n, con
 double gsl_stats_long_median_from_sorted_data (const long sorted_data[], const size_t stride, const size_t n) ;
 double gsl_stats_long_median (long sorted_data[], const size_t stride, const size_t n);
 double gsl_stats_long_quantile_from_sorted_data (const long sorted_data[], const size_t stride, const size_t n, const double f) ;
+int gsl_stats_long_quantiles (long data[], const size_t stride, const size_t n, const double p[], const size_t np, double result[]);
 
 double gsl_stats_long_trmean_from_sorted_data (const double trim, const long sorted_data[], const size_t stride, const size_t n) ;
 double gsl_stats_long_gastwirth_from_sorted_data (const long sorted_data[], const size_t stride, const size_t n) ;
@@ -87,9 +90,13 @@ double gsl_stats_long_mad(const long data[], const size_t stride, const size_t n
 
 long gsl_stats_long_Sn0_from_sorted_data (const long sorted_data[], const size_t stride, const size_t n, long work[]) ;
 double gsl_stats_long_Sn_from_sorted_data (const long sorted_data[], const size_t stride, const size_t n, long work[]) ;
+double gsl_stats_long_Sn (long data[], const size_t stride, const size_t n, long work[]) ;
+double gsl_stats_long_Sn_parallel (long data[], const size_t stride, const size_t n, long work[], const size_t ntasks, const gsl_executor * exec) ;
 
 long gsl_stats_long_Qn0_from_sorted_data (const long sorted_data[], const size_t stride, const size_t n, long work[], int work_int[]) ;
 double gsl_stats_long_Qn_from_sorted_data (const long sorted_data[], const size_t stride, const size_t n, long work[], int work_int[]) ;
+double gsl_stats_long_Qn (long data[], const size_t stride, const size_t n, long work[], int work_int[]) ;
+double gsl_stats_long_Qn_parallel (long data[], const size_t stride, const size_t n, long work[], int work_int[], const size_t ntasks, const gsl_executor * exec) ;
 
 __END_DECLS
 
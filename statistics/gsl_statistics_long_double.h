@@ -22,6 +22,7 @@
 
 #include <stddef.h>
 #include <stdlib.h>
+#include <gsl/gsl_executor.h>
 
 #undef __BEGIN_DECLS
 #undef __END_DECLS
@@ -80,6 +81,8 @@ double gsl_stats_long_double_wabsdev_m (const long double w[], const size_t wstr
 double gsl_stats_long_double_wskew_m_sd (const long double w[], const size_t wstride, const long double data[], const size_t stride, const size_t n, const double wmean, const double wsd);
 double gsl_stats_long_double_wkurtosis_m_sd (const long double w[], const size_t wstride, const long double data[], const size_t stride, const size_t n, const double wmean, const double wsd);
 
+int gsl_stats_long_double_wsummary (double * wmean, double * wvariance, double * wskew, double * wkurtosis, double * wabsdev, const long double w[], const size_t wstride, const long double data[], const size_t stride, const size_t n);
+
 /* END OF FLOATING POINT TYPES */
 
 double gsl_stats_long_double_pvariance (const long double data1[], const size_t stride1, const size_t n1, const long double data2[], const size_t stride2, const size_t n2);
@@ -88,6 +91,7 @@ double gsl_stats_long_double_ttest (const long double data1[], const size_t stri
 long double gsl_stats_long_double_max (const long double data[], const size_t stride, const size_t n);
 long double gsl_stats_long_double_min (const long double data[], const size_t stride, const size_t n);
 void gsl_stats_long_double_minmax (long double * min, long double * max, const long double data[], const size_t stride, const size_t n);
+int gsl_stats_long_double_summary (double * mean, double * variance, double * skew, double * kurtosis, double * absdev, long double * min, long double * max, const long double data[], const size_t stride, const size_t n);
 
 size_t gsl_stats_long_double_max_index (const long double data[], const size_t stride, const size_t n);
 size_t gsl_stats_long_double_min_index (const long double data[], const size_t stride, const size_t n);
@@ -98,6 +102,7 @@ long double gsl_stats_long_double_select(long double data[], const size_t stride
 double gsl_stats_long_double_median_from_sorted_data (const long double sorted_data[], const size_t stride, const size_t n) ;
 double gsl_stats_long_double_median (long double sorted_data[], const size_t stride, const size_t n);
 double gsl_stats_long_double_quantile_from_sorted_data (const long double sorted_data[], const size_t stride, const size_t n, const double f) ;
+int gsl_stats_long_double_quantiles (long double data[], const size_t stride, const size_t n, const double p[], const size_t np, double result[]);
 
 double gsl_stats_long_double_trmean_from_sorted_data (const double trim, const long double sorted_data[], const size_t stride, const size_t n) ;
 double gsl_stats_long_double_gastwirth_from_sorted_data (const long double sorted_data[], const size_t stride, const size_t n) ;
@@ -107,9 +112,13 @@ double gsl_stats_long_double_mad(const long double data[], const size_t stride,
 
 long double gsl_stats_long_double_Sn0_from_sorted_data (const long double sorted_data[], const size_t stride, const size_t n, long double work[]) ;
 double gsl_stats_long_double_Sn_from_sorted_data (const long double sorted_data[], const size_t stride, const size_t n, long double work[]) ;
+double gsl_stats_long_double_Sn (long double data[], const size_t stride, const size_t n, long double work[]) ;
+double gsl_stats_long_double_Sn_parallel (long double data[], const size_t stride, const size_t n, long double work[], const size_t ntasks, const gsl_executor * exec) ;
 
 long double gsl_stats_long_double_Qn0_from_sorted_data (const long double sorted_data[], const size_t stride, const size_t n, long double work[], int work_int[]) ;
 double gsl_stats_long_double_Qn_from_sorted_data (const long double sorted_data[], const size_t stride, const size_t n, long double work[], int work_int[]) ;
+double gsl_stats_long_double_Qn (long double data[], const size_t stride, const size_t n, long double work[], int work_int[]) ;
+double gsl_stats_long_double_Qn_parallel (long double data[], const size_t stride, const size_t n, long double work[], int work_int[], const size_t ntasks, const gsl_executor * exec) ;
 
 __END_DECLS
 
@@ -22,6 +22,7 @@
 
 #include <stddef.h>
 #include <stdlib.h>
+#include <gsl/gsl_executor.h>
 
 #undef __BEGIN_DECLS
 #undef __END_DECLS
@@ -68,6 +69,7 @@ double gsl_stats_short_ttest (const short data1[], const size_t stride1, const s
 short gsl_stats_short_max (const short data[], const size_t stride, const size_t n);
 short gsl_stats_short_min (const short data[], const size_t stride, const size_t n);
 void gsl_stats_short_minmax (short * min, short * max, const short data[], const size_t stride, const size_t n);
+int gsl_stats_short_summary (double * mean, double * variance, double * skew, double * kurtosis, double * absdev, short * min, short * max, const short data[], const size_t stride, const size_t n);
 
 size_t gsl_stats_short_max_index (const short data[], const size_t stride, const size_t n);
 size_t gsl_stats_short_min_index (const short data[], const size_t stride, const size_t n);
@@ -78,6 +80,7 @@ short gsl_stats_short_select(short data[], const size_t stride, const size_t n,
 double gsl_stats_short_median_from_sorted_data (const short sorted_data[], const size_t stride, const size_t n) ;
 double gsl_stats_short_median (short sorted_data[], const size_t stride, const size_t n);
 double gsl_stats_short_quantile_from_sorted_data (const short sorted_data[], const size_t stride, const size_t n, const double f) ;
+int gsl_stats_short_quantiles (short data[], const size_t stride, const size_t n, const double p[], const size_t np, double result[]);
 
 double gsl_stats_short_trmean_from_sorted_data (const double trim, const short sorted_data[], const size_t stride, const size_t n) ;
 double gsl_stats_short_gastwirth_from_sorted_data (const short sorted_data[], const size_t stride, const size_t n) ;
@@ -87,9 +90,13 @@ double gsl_stats_short_mad(const short data[], const size_t stride, const size_t
 
 short gsl_stats_short_Sn0_from_sorted_data (const short sorted_data[], const size_t stride, const size_t n, short work[]) ;
 double gsl_stats_short_Sn_from_sorted_data (const short sorted_data[], const size_t stride, const size_t n, short work[]) ;
+double gsl_stats_short_Sn (short data[], const size_t stride, const size_t n, short work[]) ;
+double gsl_stats_short_Sn_parallel (short data[], const size_t stride, const size_t n, short work[], const size_t ntasks, const gsl_executor * exec) ;
 
 short gsl_stats_short_Qn0_from_sorted_data (const short sorted_data[], const size_t stride, const size_t n, short work[], int work_int[]) ;
 double gsl_stats_short_Qn_from_sorted_data (const short sorted_data[], const size_t stride, const size_t n, short work[], int work_int[]) ;
+double gsl_stats_short_Qn (short data[], const size_t stride, const size_t n, short work[], int work_int[]) ;
+double gsl_stats_short_Qn_parallel (short data[], const size_t stride, const size_t n, short work[], int work_int[], const size_t ntasks, const gsl_executor * exec) ;
 
 __END_DECLS
 
@@ -22,6 +22,7 @@
 
 #include <stddef.h>
 #include <stdlib.h>
+#include <gsl/gsl_executor.h>
 
 #undef __BEGIN_DECLS
 #undef __END_DECLS
@@ -68,6 +69,7 @@ double gsl_stats_uchar_ttest (const unsigned char data1[], const size_t stride1,
 unsigned char gsl_stats_uchar_max (const unsigned char data[], const size_t stride, const size_t n);
 unsigned char gsl_stats_uchar_min (const unsigned char data[], const size_t stride, const size_t n);
 void gsl_stats_uchar_minmax (unsigned char * min, unsigned char * max, const unsigned char data[], const size_t stride, const size_t n);
+int gsl_stats_uchar_summary (double * mean, double * variance, double * skew, double * kurtosis, double * absdev, unsigned char * min, unsigned char * max, const unsigned char data[], const size_t stride, const size_t n);
 
 size_t gsl_stats_uchar_max_index (const unsigned char data[], const size_t stride, const size_t n);
 size_t gsl_stats_uchar_min_index (const unsigned char data[], const size_t stride, const size_t n);
@@ -78,6 +80,7 @@ unsigned char gsl_stats_uchar_select(unsigned char data[], const size_t stride,
 double gsl_stats_uchar_median_from_sorted_data (const unsigned char sorted_data[], const size_t stride, const size_t n) ;
 double gsl_stats_uchar_median (unsigned char sorted_data[], const size_t stride, const size_t n);
 double gsl_stats_uchar_quantile_from_sorted_data (const unsigned char sorted_data[], const size_t stride, const size_t n, const double f) ;
+int gsl_stats_uchar_quantiles (unsigned char data[], const size_t stride, const size_t n, const double p[], const size_t np, double result[]);
 
 double gsl_stats_uchar_trmean_from_sorted_data (const double trim, const unsigned char sorted_data[], const size_t stride, const size_t n) ;
 double gsl_stats_uchar_gastwirth_from_sorted_data (const unsigned char sorted_data[], const size_t stride, const size_t n) ;
@@ -87,9 +90,13 @@ double gsl_stats_uchar_mad(const unsigned char data[], const size_t stride, cons
 
 unsigned char gsl_stats_uchar_Sn0_from_sorted_data (const unsigned char sorted_data[], const size_t stride, const size_t n, unsigned char work[]) ;
 double gsl_stats_uchar_Sn_from_sorted_data (const unsigned char sorted_data[], const size_t stride, const size_t n, unsigned char work[]) ;
+double gsl_stats_uchar_Sn (unsigned char data[], const size_t stride, const size_t n, unsigned char work[]) ;
+double gsl_stats_uchar_Sn_parallel (unsigned char data[], const size_t stride, const size_t n, unsigned char work[], const size_t ntasks, const gsl_executor * exec) ;
 
 unsigned char gsl_stats_uchar_Qn0_from_sorted_data (const unsigned char sorted_data[], const size_t stride, const size_t n, unsigned char work[], int work_int[]) ;
 double gsl_stats_uchar_Qn_from_sorted_data (const unsigned char sorted_data[], const size_t stride, const size_t n, unsigned char work[], int work_int[]) ;
+double gsl_stats_uchar_Qn (unsigned char data[], const size_t stride, const size_t n, unsigned char work[], int work_int[]) ;
+double gsl_stats_uchar_Qn_parallel (unsigned char data[], const size_t stride, const size_t n, unsigned char work[], int work_int[], const size_t ntasks, const gsl_executor * exec) ;
 
 __END_DECLS
 
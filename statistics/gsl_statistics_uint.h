@@ -22,6 +22,7 @@
 
 #include <stddef.h>
 #include <stdlib.h>
+#include <gsl/gsl_executor.h>
 
 #undef __BEGIN_DECLS
 #undef __END_DECLS
@@ -68,6 +69,7 @@ double gsl_stats_uint_ttest (const unsigned int data1[], const size_t stride1, c
 unsigned int gsl_stats_uint_max (const unsigned int data[], const size_t stride, const size_t n);
 unsigned int gsl_stats_uint_min (const unsigned int data[], const size_t stride, const size_t n);
 void gsl_stats_uint_minmax (unsigned int * min, unsigned int * max, const unsigned int data[], const size_t stride, const size_t n);
+int gsl_stats_uint_summary (double * mean, double * variance, double * skew, double * kurtosis, double * absdev, unsigned int * min, unsigned int * max, const unsigned int data[], const size_t stride, const size_t n);
 
 size_t gsl_stats_uint_max_index (const unsigned int data[], const size_t stride, const size_t n);
 size_t gsl_stats_uint_min_index (const unsigned int data[], const size_t stride, const size_t n);
@@ -78,6 +80,7 @@ unsigned int gsl_stats_uint_select(unsigned int data[], const size_t stride, con
 double gsl_stats_uint_median_from_sorted_data (const unsigned int sorted_data[], const size_t stride, const size_t n) ;
 double gsl_stats_uint_median (unsigned int sorted_data[], const size_t stride, const size_t n);
 double gsl_stats_uint_quantile_from_sorted_data (const unsigned int sorted_data[], const size_t stride, const size_t n, const double f) ;
+int gsl_stats_uint_quantiles (unsigned int data[], const size_t stride, const size_t n, const double p[], const size_t np, double result[]);
 
 double gsl_stats_uint_trmean_from_sorted_data (const double trim, const unsigned int sorted_data[], const size_t stride, const size_t n) ;
 double gsl_stats_uint_gastwirth_from_sorted_data (const unsigned int sorted_data[], const size_t stride, const size_t n) ;
@@ -87,9 +90,13 @@ double gsl_stats_uint_mad(const unsigned int data[], const size_t stride, const
 
 unsigned int gsl_stats_uint_Sn0_from_sorted_data (const unsigned int sorted_data[], const size_t stride, const size_t n, unsigned int work[]) ;
 double gsl_stats_uint_Sn_from_sorted_data (const unsigned int sorted_data[], const size_t stride, const size_t n, unsigned int work[]) ;
+double gsl_stats_uint_Sn (unsigned int data[], const size_t stride, const size_t n, unsigned int work[]) ;
+double gsl_stats_uint_Sn_parallel (unsigned int data[], const size_t stride, const size_t n, unsigned int work[], const size_t ntasks, const gsl_executor * exec) ;
 
 unsigned int gsl_stats_uint_Qn0_from_sorted_data (const unsigned int sorted_data[], const size_t stride, const size_t n, unsigned int work[], int work_int[]) ;
 double gsl_stats_uint_Qn_from_sorted_data (const unsigned int sorted_data[], const size_t stride, const size_t n, unsigned int work[], int work_int[]) ;
+double gsl_stats_uint_Qn (unsigned int data[], const size_t stride, const size_t n, unsigned int work[], int work_int[]) ;
+double gsl_stats_uint_Qn_parallel (unsigned int data[], const size_t stride, const size_t n, unsigned int work[], int work_int[], const size_t ntasks, const gsl_executor * exec) ;
 
 __END_DECLS
 
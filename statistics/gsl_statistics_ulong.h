@@ -22,6 +22,7 @@
 
 #include <stddef.h>
 #include <stdlib.h>
+#include <gsl/gsl_executor.h>
 
 #undef __BEGIN_DECLS
 #undef __END_DECLS
@@ -68,6 +69,7 @@ double gsl_stats_ulong_ttest (const unsigned long data1[], const size_t stride1,
 unsigned long gsl_stats_ulong_max (const unsigned long data[], const size_t stride, const size_t n);
 unsigned long gsl_stats_ulong_min (const unsigned long data[], const size_t stride, const size_t n);
 void gsl_stats_ulong_minmax (unsigned long * min, unsigned long * max, const unsigned long data[], const size_t stride, const size_t n);
+int gsl_stats_ulong_summary (double * mean, double * variance, double * skew, double * kurtosis, double * absdev, unsigned long * min, unsigned long * max, const unsigned long data[], const size_t stride, const size_t n);
 
 size_t gsl_stats_ulong_max_index (const unsigned long data[], const size_t stride, const size_t n);
 size_t gsl_stats_ulong_min_index (const unsigned long data[], const size_t stride, const size_t n);
@@ -78,6 +80,7 @@ unsigned long gsl_stats_ulong_select(unsigned long data[], const size_t stride,
 double gsl_stats_ulong_median_from_sorted_data (const unsigned long sorted_data[], const size_t stride, const size_t n) ;
 double gsl_stats_ulong_median (unsigned long sorted_data[], const size_t stride, const size_t n);
 double gsl_stats_ulong_quantile_from_sorted_data (const unsigned long sorted_data[], const size_t stride, const size_t n, const double f) ;
+int gsl_stats_ulong_quantiles (unsigned long data[], const size_t stride, const size_t n, const double p[], const size_t np, double result[]);
 
 double gsl_stats_ulong_trmean_from_sorted_data (const double trim, const unsigned long sorted_data[], const size_t stride, const size_t n) ;
 double gsl_stats_ulong_gastwirth_from_sorted_data (const unsigned long sorted_data[], const size_t stride, const size_t n) ;
@@ -87,9 +90,13 @@ double gsl_stats_ulong_mad(const unsigned long data[], const size_t stride, cons
 
 unsigned long gsl_stats_ulong_Sn0_from_sorted_data (const unsigned long sorted_data[], const size_t stride, const size_t n, unsigned long work[]) ;
 double gsl_stats_ulong_Sn_from_sorted_data (const unsigned long sorted_data[], const size_t stride, const size_t n, unsigned long work[]) ;
+double gsl_stats_ulong_Sn (unsigned long data[], const size_t stride, const size_t n, unsigned long work[]) ;
+double gsl_stats_ulong_Sn_parallel (unsigned long data[], const size_t stride, const size_t n, unsigned long work[], const size_t ntasks, const gsl_executor * exec) ;
 
 unsigned long gsl_stats_ulong_Qn0_from_sorted_data (const unsigned long sorted_data[], const size_t stride, const size_t n, unsigned long work[], int work_int[]) ;
 double gsl_stats_ulong_Qn_from_sorted_data (const unsigned long sorted_data[], const size_t stride, const size_t n, unsigned long work[], int work_int[]) ;
+double gsl_stats_ulong_Qn (unsigned long data[], const size_t stride, const size_t n, unsigned long work[], int work_int[]) ;
+double gsl_stats_ulong_Qn_parallel (unsigned long data[], const size_t stride, const size_t n, unsigned long work[], int work_int[], const size_t ntasks, const gsl_executor * exec) ;
 
 __END_DECLS
 
@@ -22,6 +22,7 @@
 
 #include <stddef.h>
 #include <stdlib.h>
+#include <gsl/gsl_executor.h>
 
 #undef __BEGIN_DECLS
 #undef __END_DECLS
@@ -68,6 +69,7 @@ double gsl_stats_ushort_ttest (const unsigned short data1[], const size_t stride
 unsigned short gsl_stats_ushort_max (const unsigned short data[], const size_t stride, const size_t n);
 unsigned short gsl_stats_ushort_min (const unsigned short data[], const size_t stride, const size_t n);
 void gsl_stats_ushort_minmax (unsigned short * min, unsigned short * max, const unsigned short data[], const size_t stride, const size_t n);
+int gsl_stats_ushort_summary (double * mean, double * variance, double * skew, double * kurtosis, double * absdev, unsigned short * min, unsigned short * max, const unsigned short data[], const size_t stride, const size_t n);
 
 size_t gsl_stats_ushort_max_index (const unsigned short data[], const size_t stride, const size_t n);
 size_t gsl_stats_ushort_min_index (const unsigned short data[], const size_t stride, const size_t n);
@@ -78,6 +80,7 @@ unsigned short gsl_stats_ushort_select(unsigned short data[], const size_t strid
 double gsl_stats_ushort_median_from_sorted_data (const unsigned short sorted_data[], const size_t stride, const size_t n) ;
 double gsl_stats_ushort_median (unsigned short sorted_data[], const size_t stride, const size_t n);
 double gsl_stats_ushort_quantile_from_sorted_data (const unsigned short sorted_data[], const size_t stride, const size_t n, const double f) ;
+int gsl_stats_ushort_quantiles (unsigned short data[], const size_t stride, const size_t n, const double p[], const size_t np, double result[]);
 
 double gsl_stats_ushort_trmean_from_sorted_data (const double trim, const unsigned short sorted_data[], const size_t stride, const size_t n) ;
 double gsl_stats_ushort_gastwirth_from_sorted_data (const unsigned short sorted_data[], const size_t stride, const size_t n) ;
@@ -87,9 +90,13 @@ double gsl_stats_ushort_mad(const unsigned short data[], const size_t stride, co
 
 unsigned short gsl_stats_ushort_Sn0_from_sorted_data (const unsigned short sorted_data[], const size_t stride, const size_t n, unsigned short work[]) ;
 double gsl_stats_ushort_Sn_from_sorted_data (const unsigned short sorted_data[], const size_t stride, const size_t n, unsigned short work[]) ;
+double gsl_stats_ushort_Sn (unsigned short data[], const size_t stride, const size_t n, unsigned short work[]) ;
+double gsl_stats_ushort_Sn_parallel (unsigned short data[], const size_t stride, const size_t n, unsigned short work[], const size_t ntasks, const gsl_executor * exec) ;
 
 unsigned short gsl_stats_ushort_Qn0_from_sorted_data (const unsigned short sorted_data[], const size_t stride, const size_t n, unsigned short work[], int work_int[]) ;
 double gsl_stats_ushort_Qn_from_sorted_data (const unsigned short sorted_data[], const size_t stride, const size_t n, unsigned short work[], int work_int[]) ;
+double gsl_stats_ushort_Qn (unsigned short data[], const size_t stride, const size_t n, unsigned short work[], int work_int[]) ;
+double gsl_stats_ushort_Qn_parallel (unsigned short data[], const size_t stride, const size_t n, unsigned short work[], int work_int[], const size_t ntasks, const gsl_executor * exec) ;
 
 __END_DECLS
 
@@ -58,8 +58,18 @@ FUNCTION(gsl_stats,median) (BASE data[], const size_t stride, const size_t n)
     }
   else 
     {
-      BASE a = FUNCTION(gsl_stats,select)(data, stride, n, lhs);
+      /* after selecting rhs, data[0..rhs-1] <= data[rhs], so lhs
+       * is the maximum of the left partition */
       BASE b = FUNCTION(gsl_stats,select)(data, stride, n, rhs);
+      BASE a = data[0];
+      size_t i;
+
+      for (i = 1; i < rhs; ++i)
+        {
+          if (data[i * stride] > a)
+            a = data[i * stride];
+        }
+
       median = 0.5 * (a + b);
     }
 
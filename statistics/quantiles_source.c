@@ -43,3 +43,133 @@ FUNCTION(gsl_stats,quantile_from_sorted_data) (const BASE sorted_data[],
 
   return result ;
 }
+
+static void FUNCTION(quantiles,multiselect) (BASE data[], const size_t stride,
+                                             const size_t n, const double p[],
+                                             size_t left, size_t right,
+                                             size_t a, size_t b);
+
+/*
+gsl_stats_quantiles()
+  Compute several quantiles of an unsorted array. All order statistics
+required by the quantiles are selected in a single recursive partitioning
+of the data: the middle required order statistic is selected, and the
+remaining ones are then found in the left and right partitions, which
+costs O(n log np) instead of np separate selections or a full sort.
+
+Inputs: data   - unsorted array, rearranged on output
+        stride - stride
+        n      - length of 'data'
+        p      - quantiles in [0,1], in nondecreasing order, length np
+        np     - number of quantiles
+        result - (output) quantiles, length np; result[i] is equal to
+                 gsl_stats_quantile_from_sorted_data() of the sorted
+                 data with f = p[i]
+
+Return: success/error
+*/
+
+/* order statistic floor(p[j] * (n - 1)) needed by quantile j */
+#define QUANTILES_RANK(j) ((size_t) (p[j] * (n - 1)))
+
+int
+FUNCTION(gsl_stats,quantiles) (BASE data[], const size_t stride,
+                               const size_t n, const double p[],
+                               const size_t np, double result[])
+{
+  size_t i, end;
+
+  for (i = 0; i < np; ++i)
+    {
+      if (p[i] < 0.0 || p[i] > 1.0)
+        {
+          GSL_ERROR("quantiles must be in [0,1]", GSL_EDOM);
+        }
+      else if (i > 0 && p[i] < p[i - 1])
+        {
+          GSL_ERROR("quantiles must be in nondecreasing order", GSL_EINVAL);
+        }
+    }
+
+  if (n == 0)
+    {
+      for (i = 0; i < np; ++i)
+        result[i] = 0.0;
+
+      return GSL_SUCCESS;
+    }
+
+  FUNCTION(quantiles,multiselect) (data, stride, n, p, 0, n - 1, 0, np);
+
+  /*
+   * interpolation also needs order statistic lhs + 1, which is the
+   * minimum of the partition between lhs and the next selected order
+   * statistic; the partitions are disjoint so this costs at most n
+   */
+  end = n;
+  for (i = np; i-- > 0; )
+    {
+      const size_t lhs = QUANTILES_RANK(i);
+
+      if (lhs + 1 < end)
+        {
+          size_t j, jmin = lhs + 1;
+          BASE tmp;
+
+          for (j = lhs + 2; j < end; ++j)
+            {
+              if (data[j * stride] < data[jmin * stride])
+                jmin = j;
+            }
+
+          tmp = data[jmin * stride];
+          data[jmin * stride] = data[(lhs + 1) * stride];
+          data[(lhs + 1) * stride] = tmp;
+        }
+
+      if (lhs < end)
+        end = lhs;
+    }
+
+  for (i = 0; i < np; ++i)
+    result[i] = FUNCTION(gsl_stats,quantile_from_sorted_data) (data, stride, n, p[i]);
+
+  return GSL_SUCCESS;
+}
+
+/* place the order statistics of quantiles [a,b) which lie in
+ * data[left..right] into their sorted positions */
+static void
+FUNCTION(quantiles,multiselect) (BASE data[], const size_t stride,
+                                 const size_t n, const double p[],
+                                 size_t left, size_t right,
+                                 size_t a, size_t b)
+{
+  while (1)
+    {
+      size_t m, k;
+
+      /* ranks outside [left,right] are already in place */
+      while (a < b && QUANTILES_RANK(a) < left)
+        ++a;
+      while (b > a && QUANTILES_RANK(b - 1) > right)
+        --b;
+
+      if (a >= b || left > right)
+        return;
+
+      m = a + (b - a) / 2;
+      k = QUANTILES_RANK(m);
+
+      FUNCTION(gsl_stats,select) (&data[left * stride], stride,
+                                  right - left + 1, k - left);
+
+      if (k > left)
+        FUNCTION(quantiles,multiselect) (data, stride, n, p, left, k - 1, a, m);
+
+      left = k + 1;
+      a = m + 1;
+    }
+}
+
+#undef QUANTILES_RANK
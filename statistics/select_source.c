@@ -19,17 +19,42 @@
 
 #define SWAP(a,b) do { tmp = b ; b = a ; a = tmp ; } while(0)
 
+/*
+ * Selection is performed with the algorithm of
+ *
+ * [1] R. W. Floyd and R. L. Rivest, "Algorithm 489: The algorithm
+ *     SELECT - for finding the ith smallest of n elements",
+ *     Communications of the ACM, 18(3), 1975
+ *
+ * which recursively selects from a small sample to obtain a pivot
+ * very close to the k-th element, so that most of the array is
+ * partitioned only once. As in introsort, the number of partitioning
+ * passes is bounded; if it is exceeded, the pivot is chosen as the
+ * median of medians of groups of 5, which guarantees O(n) worst case
+ * running time.
+ */
+
+#define SELECT_SAMPLE_THRESHOLD 600
+
+static void FUNCTION(select,range) (BASE data[], const size_t stride,
+                                    size_t left, size_t right,
+                                    const size_t k, size_t budget);
+static size_t FUNCTION(select,mom) (BASE data[], const size_t stride,
+                                    const size_t left, const size_t right);
+
 /*
 gsl_stats_select()
-  Select k-th largest element from an unsorted array using
-quickselect algorithm
+  Select k-th smallest element from an unsorted array. On output,
+data[k] contains the selected element, elements data[0..k-1] are
+less than or equal to it, and elements data[k+1..n-1] are greater
+than or equal to it.
 
 Inputs: data   - unsorted array containing the observations
         stride - stride
         n      - length of 'data'
         k      - desired element in [0,n-1]
 
-Return: k-th largest element of data[]
+Return: k-th smallest element of data[]
 */
 
 BASE
@@ -42,71 +67,145 @@ FUNCTION(gsl_stats,select) (BASE data[],
     {
       GSL_ERROR_VAL("array size must be positive", GSL_EBADLEN, 0.0);
     }
+  else if (k >= n)
+    {
+      GSL_ERROR_VAL("k must be less than n", GSL_EINVAL, 0.0);
+    }
   else
     {
-      size_t left = 0;
-      size_t right = n - 1;
-      size_t mid, i, j;
-      BASE pivot, tmp;
+      size_t budget = 0, m;
 
-      while (1)
-        {
-          if (right <= left + 1)
-            {
-              if (right == left + 1 && data[right * stride] < data[left * stride])
-                {
-                  SWAP(data[left * stride], data[right * stride]);
-                }
+      /* allow 2 log2(n) partitioning passes before falling back */
+      for (m = n; m > 0; m >>= 1)
+        budget += 2;
 
-              return data[k * stride];
-            }
-          else
-            {
-              mid = (left + right) >> 1;
-              SWAP(data[mid * stride], data[(left + 1) * stride]);
+      FUNCTION(select,range) (data, stride, 0, n - 1, k, budget);
 
-              if (data[left * stride] > data[right * stride])
-                {
-                  SWAP(data[left * stride], data[right * stride]);
-                }
+      return data[k * stride];
+    }
+}
 
-              if (data[(left + 1) * stride] > data[right * stride])
-                {
-                  SWAP(data[(left + 1) * stride], data[right * stride]);
-                }
+/* partially order data[left..right] so that data[k] is in its sorted position */
+static void
+FUNCTION(select,range) (BASE data[], const size_t stride,
+                        size_t left, size_t right, const size_t k,
+                        size_t budget)
+{
+  BASE t, tmp;
+  size_t i, j;
 
-              if (data[left * stride] > data[(left + 1) * stride])
-                {
-                  SWAP(data[left * stride], data[(left + 1) * stride]);
-                }
+  while (right > left)
+    {
+      if (budget == 0)
+        {
+          /* guaranteed linear time pivot */
+          size_t p = FUNCTION(select,mom) (data, stride, left, right);
+          SWAP(data[p * stride], data[k * stride]);
+        }
+      else
+        {
+          --budget;
 
-              i = left + 1;
-              j = right;
-              pivot = data[(left + 1) * stride];
+          if (right - left > SELECT_SAMPLE_THRESHOLD)
+            {
+              /* select from a sample to move a good pivot into data[k] */
+              const double nd = (double) (right - left + 1);
+              const double id = (double) (k - left + 1);
+              const double z = log (nd);
+              const double s = 0.5 * exp (2.0 * z / 3.0);
+              const double sd = 0.5 * sqrt (z * s * (nd - s) / nd) *
+                                (id < 0.5 * nd ? -1.0 : 1.0);
+              const double lo = (double) k - id * s / nd + sd;
+              const double hi = (double) k + (nd - id) * s / nd + sd;
+              const size_t new_left = (lo > (double) left) ? (size_t) lo : left;
+              const size_t new_right = (hi < (double) right) ? (size_t) hi : right;
+
+              FUNCTION(select,range) (data, stride, new_left, new_right, k, budget);
+            }
+        }
 
-              while (1)
-                {
-                  do i++; while (data[i * stride] < pivot);
-                  do j--; while (data[j * stride] > pivot);
+      /* partition data[left..right] about t = data[k] */
+      t = data[k * stride];
+      i = left;
+      j = right;
 
-                  if (j < i)
-                    break;
+      SWAP(data[left * stride], data[k * stride]);
+      if (data[right * stride] > t)
+        {
+          SWAP(data[right * stride], data[left * stride]);
+        }
 
-                  SWAP(data[i * stride], data[j * stride]);
-                }
+      while (i < j)
+        {
+          SWAP(data[i * stride], data[j * stride]);
+          ++i;
+          --j;
+          while (data[i * stride] < t)
+            ++i;
+          while (data[j * stride] > t)
+            --j;
+        }
 
-              data[(left + 1) * stride] = data[j * stride];
-              data[j * stride] = pivot;
+      if (data[left * stride] == t)
+        {
+          SWAP(data[left * stride], data[j * stride]);
+        }
+      else
+        {
+          ++j;
+          SWAP(data[j * stride], data[right * stride]);
+        }
 
-              if (j >= k)
-                right = j - 1;
+      /* data[j] == t is now in its final position */
+      if (j == k)
+        return;
+      else if (j < k)
+        left = j + 1;
+      else
+        right = j - 1;
+    }
+}
+
+/* return index of the median of medians of groups of 5 in data[left..right] */
+static size_t
+FUNCTION(select,mom) (BASE data[], const size_t stride,
+                      const size_t left, const size_t right)
+{
+  const size_t n = right - left + 1;
+  size_t ngroup = 0;
+  size_t g;
+  BASE tmp;
 
-              if (j <= k)
-                left = i;
+  if (n <= 5)
+    {
+      size_t i, j;
+
+      /* insertion sort */
+      for (i = left + 1; i <= right; ++i)
+        {
+          for (j = i; j > left && data[(j - 1) * stride] > data[j * stride]; --j)
+            {
+              SWAP(data[(j - 1) * stride], data[j * stride]);
             }
         }
 
-      /* will never get here */
-      GSL_ERROR_VAL("select error", GSL_FAILURE, 0.0);
+      return left + (n - 1) / 2;
+    }
+
+  /* move the median of each full group of 5 to the front of the range */
+  for (g = left; g + 4 <= right; g += 5)
+    {
+      size_t m = FUNCTION(select,mom) (data, stride, g, g + 4);
+      SWAP(data[m * stride], data[(left + ngroup) * stride]);
+      ++ngroup;
     }
+
+  /* select median of the medians, with the guaranteed pivot rule */
+  FUNCTION(select,range) (data, stride, left, left + ngroup - 1,
+                          left + (ngroup - 1) / 2, 0);
+
+  return left + (ngroup - 1) / 2;
 }
+
+#undef SELECT_SAMPLE_THRESHOLD
+#undef SWAP
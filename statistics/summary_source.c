@@ -0,0 +1,160 @@
+/* statistics/summary_source.c
+ * 
+ * Copyright (C) 2026 Patrick Alken
+ * 
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/*
+gsl_stats_summary()
+  Compute the mean, variance, skewness, kurtosis, absolute deviation,
+minimum and maximum of a dataset with two passes over the data,
+instead of the six or more passes needed when calling gsl_stats_mean(),
+gsl_stats_variance(), gsl_stats_skew(), gsl_stats_kurtosis(),
+gsl_stats_absdev() and gsl_stats_minmax() separately. The statistics
+have the same definitions as those functions.
+
+The first pass finds the sum, minimum and maximum, and the second pass
+accumulates the powers of the deviations from the mean. Each pass uses
+four independent accumulators, which breaks the dependency chain of
+the sums and allows the compiler to vectorize the loop. A rounding
+correction is applied to the mean and the central moments using the
+sum of the deviations.
+
+Inputs: mean     - (output) mean
+        variance - (output) variance, normalized by n - 1
+        skew     - (output) skewness
+        kurtosis - (output) kurtosis
+        absdev   - (output) absolute deviation from the mean
+        min      - (output) minimum
+        max      - (output) maximum
+        data     - dataset
+        stride   - stride
+        n        - length of 'data'
+
+Return: success/error
+*/
+
+int
+FUNCTION(gsl_stats,summary) (double * mean, double * variance,
+                             double * skew, double * kurtosis,
+                             double * absdev, BASE * min, BASE * max,
+                             const BASE data[], const size_t stride,
+                             const size_t n)
+{
+  if (n == 0)
+    {
+      GSL_ERROR("array size must be positive", GSL_EBADLEN);
+    }
+  else
+    {
+      const double nd = (double) n;
+      double s0 = 0.0, s1 = 0.0, s2 = 0.0, s3 = 0.0;
+      double d1[4] = { 0.0, 0.0, 0.0, 0.0 };
+      double d2[4] = { 0.0, 0.0, 0.0, 0.0 };
+      double d3[4] = { 0.0, 0.0, 0.0, 0.0 };
+      double d4[4] = { 0.0, 0.0, 0.0, 0.0 };
+      double da[4] = { 0.0, 0.0, 0.0, 0.0 };
+      BASE xmin = data[0];
+      BASE xmax = data[0];
+      double m, c, M2, M3, M4, sd;
+      size_t i, j;
+
+      /* first pass: sum, min and max */
+      for (i = 0; i + 4 <= n; i += 4)
+        {
+          const BASE x0 = data[i * stride];
+          const BASE x1 = data[(i + 1) * stride];
+          const BASE x2 = data[(i + 2) * stride];
+          const BASE x3 = data[(i + 3) * stride];
+
+          s0 += x0;
+          s1 += x1;
+          s2 += x2;
+          s3 += x3;
+
+          xmin = GSL_MIN(xmin, GSL_MIN(GSL_MIN(x0, x1), GSL_MIN(x2, x3)));
+          xmax = GSL_MAX(xmax, GSL_MAX(GSL_MAX(x0, x1), GSL_MAX(x2, x3)));
+        }
+
+      for (; i < n; ++i)
+        {
+          const BASE xi = data[i * stride];
+
+          s0 += xi;
+          xmin = GSL_MIN(xmin, xi);
+          xmax = GSL_MAX(xmax, xi);
+        }
+
+      m = ((s0 + s1) + (s2 + s3)) / nd;
+
+#ifdef FP
+      if (isnan (m))
+        {
+          /* use the NaN conventions of gsl_stats_minmax() */
+          FUNCTION(gsl_stats,minmax) (&xmin, &xmax, data, stride, n);
+        }
+#endif
+
+      /* second pass: powers of deviations from the mean */
+      for (i = 0; i + 4 <= n; i += 4)
+        {
+          for (j = 0; j < 4; ++j)
+            {
+              const double d = data[(i + j) * stride] - m;
+              const double dsq = d * d;
+
+              d1[j] += d;
+              d2[j] += dsq;
+              d3[j] += dsq * d;
+              d4[j] += dsq * dsq;
+              da[j] += fabs(d);
+            }
+        }
+
+      for (; i < n; ++i)
+        {
+          const double d = data[i * stride] - m;
+          const double dsq = d * d;
+
+          d1[0] += d;
+          d2[0] += dsq;
+          d3[0] += dsq * d;
+          d4[0] += dsq * dsq;
+          da[0] += fabs(d);
+        }
+
+      /* correct for rounding error in the mean */
+      c = ((d1[0] + d1[1]) + (d1[2] + d1[3])) / nd;
+      M2 = (d2[0] + d2[1]) + (d2[2] + d2[3]);
+      M3 = (d3[0] + d3[1]) + (d3[2] + d3[3]);
+      M4 = (d4[0] + d4[1]) + (d4[2] + d4[3]);
+
+      M4 += c * (-4.0 * M3 + c * (6.0 * M2 - 3.0 * nd * c * c));
+      M3 += c * (-3.0 * M2 + 2.0 * nd * c * c);
+      M2 -= nd * c * c;
+
+      *mean = m + c;
+      *variance = M2 / (nd - 1.0);
+      sd = sqrt(*variance);
+      *skew = (M3 / nd) / (sd * sd * sd);
+      *kurtosis = (M4 / nd) / (*variance * *variance) - 3.0;
+      *absdev = ((da[0] + da[1]) + (da[2] + da[3])) / nd;
+      *min = xmin;
+      *max = xmax;
+
+      return GSL_SUCCESS;
+    }
+}
@@ -187,6 +187,24 @@ FUNCTION (test, func) (const size_t stridea, const size_t strideb)
     gsl_test_rel (wkurt, expected, rel, NAME(gsl_stats) "_wkurtosis");
   }
 
+  {
+    double wmean, wvariance, wskew, wkurtosis, wabsdev;
+    double expected_wmean = FUNCTION(gsl_stats,wmean) (w, strideb, groupa, stridea, na);
+    double expected_wvariance = FUNCTION(gsl_stats,wvariance) (w, strideb, groupa, stridea, na);
+    double expected_wskew = FUNCTION(gsl_stats,wskew) (w, strideb, groupa, stridea, na);
+    double expected_wkurtosis = FUNCTION(gsl_stats,wkurtosis) (w, strideb, groupa, stridea, na);
+    double expected_wabsdev = FUNCTION(gsl_stats,wabsdev) (w, strideb, groupa, stridea, na);
+
+    FUNCTION(gsl_stats,wsummary) (&wmean, &wvariance, &wskew, &wkurtosis, &wabsdev,
+                                  w, strideb, groupa, stridea, na);
+
+    gsl_test_rel (wmean, expected_wmean, rel, NAME(gsl_stats) "_wsummary wmean");
+    gsl_test_rel (wvariance, expected_wvariance, rel, NAME(gsl_stats) "_wsummary wvariance");
+    gsl_test_rel (wskew, expected_wskew, rel, NAME(gsl_stats) "_wsummary wskew");
+    gsl_test_rel (wkurtosis, expected_wkurtosis, rel, NAME(gsl_stats) "_wsummary wkurtosis");
+    gsl_test_rel (wabsdev, expected_wabsdev, rel, NAME(gsl_stats) "_wsummary wabsdev");
+  }
+
   {
     double c = FUNCTION(gsl_stats,covariance) (groupa, stridea, groupb, strideb, nb);
     double expected = -0.000139021538461539;
@@ -249,6 +267,28 @@ FUNCTION (test, func) (const size_t stridea, const size_t strideb)
                min, expected_min);
   }
 
+  {
+    double mean, variance, skew, kurtosis, absdev;
+    BASE min, max, expected_min, expected_max;
+    double expected_mean = FUNCTION(gsl_stats,mean) (groupa, stridea, na);
+    double expected_variance = FUNCTION(gsl_stats,variance) (groupa, stridea, na);
+    double expected_skew = FUNCTION(gsl_stats,skew) (groupa, stridea, na);
+    double expected_kurtosis = FUNCTION(gsl_stats,kurtosis) (groupa, stridea, na);
+    double expected_absdev = FUNCTION(gsl_stats,absdev) (groupa, stridea, na);
+
+    FUNCTION(gsl_stats,minmax) (&expected_min, &expected_max, groupa, stridea, na);
+    FUNCTION(gsl_stats,summary) (&mean, &variance, &skew, &kurtosis, &absdev,
+                                 &min, &max, groupa, stridea, na);
+
+    gsl_test_rel (mean, expected_mean, rel, NAME(gsl_stats) "_summary mean");
+    gsl_test_rel (variance, expected_variance, rel, NAME(gsl_stats) "_summary variance");
+    gsl_test_rel (skew, expected_skew, rel, NAME(gsl_stats) "_summary skew");
+    gsl_test_rel (kurtosis, expected_kurtosis, rel, NAME(gsl_stats) "_summary kurtosis");
+    gsl_test_rel (absdev, expected_absdev, rel, NAME(gsl_stats) "_summary absdev");
+    gsl_test (min != expected_min, NAME(gsl_stats) "_summary min");
+    gsl_test (max != expected_max, NAME(gsl_stats) "_summary max");
+  }
+
   {
     int max_index = FUNCTION(gsl_stats,max_index) (groupa, stridea, na);
     int expected = 4;
@@ -414,6 +454,27 @@ FUNCTION (test, func) (const size_t stridea, const size_t strideb)
     free(work);
   }
 
+  {
+    const double p[] = { 0.0, 0.1, 0.25, 0.25, 0.5, 0.6, 0.9, 1.0 };
+    const size_t np = sizeof(p) / sizeof(double);
+    double result[sizeof(p) / sizeof(double)];
+    BASE * work = (BASE *) malloc (stridea * na * sizeof(BASE));
+    size_t k;
+
+    for (i = 0; i < na; i++)
+      work[i * stridea] = (BASE) rawa[i];
+
+    FUNCTION(gsl_stats,quantiles)(work, stridea, na, p, np, result);
+
+    for (k = 0; k < np; ++k)
+      {
+        double expected = FUNCTION(gsl_stats,quantile_from_sorted_data)(sorted, stridea, na, p[k]);
+        gsl_test_rel (result[k], expected, rel, NAME(gsl_stats) "_quantiles p=%g", p[k]);
+      }
+
+    free(work);
+  }
+
   /* Test for IEEE handling - set third element to NaN */
 
   groupa [3*stridea] = GSL_NAN;
@@ -449,6 +510,18 @@ FUNCTION (test, func) (const size_t stridea, const size_t strideb)
                min, expected_min);
   }
 
+  {
+    double mean, variance, skew, kurtosis, absdev;
+    BASE min, max;
+
+    FUNCTION(gsl_stats,summary) (&mean, &variance, &skew, &kurtosis, &absdev,
+                                 &min, &max, groupa, stridea, na);
+
+    gsl_test (!isnan(mean), NAME(gsl_stats) "_summary mean NaN");
+    gsl_test (!isnan(min), NAME(gsl_stats) "_summary min NaN");
+    gsl_test (!isnan(max), NAME(gsl_stats) "_summary max NaN");
+  }
+
 #ifdef FAST
   {
     BASE min, max;
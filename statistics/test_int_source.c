@@ -176,6 +176,28 @@ FUNCTION (test, func) (const size_t stridea, const size_t strideb)
                min, expected_min);
   }
 
+  {
+    double mean, variance, skew, kurtosis, absdev;
+    BASE min, max, expected_min, expected_max;
+    double expected_mean = FUNCTION(gsl_stats,mean) (igroupa, stridea, ina);
+    double expected_variance = FUNCTION(gsl_stats,variance) (igroupa, stridea, ina);
+    double expected_skew = FUNCTION(gsl_stats,skew) (igroupa, stridea, ina);
+    double expected_kurtosis = FUNCTION(gsl_stats,kurtosis) (igroupa, stridea, ina);
+    double expected_absdev = FUNCTION(gsl_stats,absdev) (igroupa, stridea, ina);
+
+    FUNCTION(gsl_stats,minmax) (&expected_min, &expected_max, igroupa, stridea, ina);
+    FUNCTION(gsl_stats,summary) (&mean, &variance, &skew, &kurtosis, &absdev,
+                                 &min, &max, igroupa, stridea, ina);
+
+    gsl_test_rel (mean, expected_mean, rel, NAME(gsl_stats) "_summary mean");
+    gsl_test_rel (variance, expected_variance, rel, NAME(gsl_stats) "_summary variance");
+    gsl_test_rel (skew, expected_skew, rel, NAME(gsl_stats) "_summary skew");
+    gsl_test_rel (kurtosis, expected_kurtosis, rel, NAME(gsl_stats) "_summary kurtosis");
+    gsl_test_rel (absdev, expected_absdev, rel, NAME(gsl_stats) "_summary absdev");
+    gsl_test (min != expected_min, NAME(gsl_stats) "_summary min");
+    gsl_test (max != expected_max, NAME(gsl_stats) "_summary max");
+  }
+
   {
     int max_index = FUNCTION(gsl_stats,max_index) (igroupa, stridea, ina);
     int expected = 9 ;
@@ -343,6 +365,27 @@ FUNCTION (test, func) (const size_t stridea, const size_t strideb)
     free(work);
   }
 
+  {
+    const double p[] = { 0.0, 0.1, 0.25, 0.25, 0.5, 0.6, 0.9, 1.0 };
+    const size_t np = sizeof(p) / sizeof(double);
+    double result[sizeof(p) / sizeof(double)];
+    BASE * work = (BASE *) malloc (stridea * ina * sizeof(BASE));
+    size_t k;
+
+    for (i = 0; i < ina; i++)
+      work[i * stridea] = (BASE) irawa[i];
+
+    FUNCTION(gsl_stats,quantiles)(work, stridea, ina, p, np, result);
+
+    for (k = 0; k < np; ++k)
+      {
+        double expected = FUNCTION(gsl_stats,quantile_from_sorted_data)(sorted, stridea, ina, p[k]);
+        gsl_test_rel (result[k], expected, rel, NAME(gsl_stats) "_quantiles p=%g", p[k]);
+      }
+
+    free(work);
+  }
+
   {
     double * work = (double *) malloc (ina * sizeof(double));
     double expected = 2.0;
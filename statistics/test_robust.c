@@ -19,6 +19,7 @@
 
 #include <config.h>
 #include <stdlib.h>
+#include <string.h>
 #include <math.h>
 
 #include <gsl/gsl_math.h>
@@ -149,6 +150,95 @@ test_median(const double tol, const size_t n, gsl_rng * r)
   return 0;
 }
 
+/* test selection on random and adversarial inputs */
+static int
+test_select(const size_t n, gsl_rng * r)
+{
+  double * x = malloc(n * sizeof(double));
+  double * sorted = malloc(n * sizeof(double));
+  const size_t k[] = { 0, n / 10, n / 3, n / 2, n - 1 };
+  size_t pattern, i, j;
+
+  for (pattern = 0; pattern < 5; ++pattern)
+    {
+      for (j = 0; j < sizeof(k) / sizeof(size_t); ++j)
+        {
+          double s;
+
+          for (i = 0; i < n; ++i)
+            {
+              switch (pattern)
+                {
+                  case 0: /* random */
+                    x[i] = gsl_rng_uniform(r);
+                    break;
+                  case 1: /* sorted */
+                    x[i] = (double) i;
+                    break;
+                  case 2: /* reversed */
+                    x[i] = (double) (n - i);
+                    break;
+                  case 3: /* few unique */
+                    x[i] = (double) gsl_rng_uniform_int(r, 4);
+                    break;
+                  default: /* organ pipe */
+                    x[i] = (double) GSL_MIN(i, n - i);
+                    break;
+                }
+
+              sorted[i] = x[i];
+            }
+
+          gsl_sort(sorted, 1, n);
+          s = gsl_stats_select(x, 1, n, k[j]);
+
+          gsl_test_rel(s, sorted[k[j]], 0.0, "test_select n=%zu pattern=%zu k=%zu",
+                       n, pattern, k[j]);
+
+          /* check partitioning */
+          for (i = 0; i < n; ++i)
+            {
+              if ((i < k[j] && x[i] > s) || (i > k[j] && x[i] < s))
+                break;
+            }
+
+          gsl_test(i != n, "test_select partition n=%zu pattern=%zu k=%zu",
+                   n, pattern, k[j]);
+        }
+    }
+
+  free(x);
+  free(sorted);
+
+  return 0;
+}
+
+static int
+test_quantiles(const size_t n, gsl_rng * r)
+{
+  const double p[] = { 0.0, 0.001, 0.1, 0.2, 0.3, 0.4, 0.5, 0.5, 0.6,
+                       0.7, 0.8, 0.9, 0.999, 1.0 };
+  const size_t np = sizeof(p) / sizeof(double);
+  double * x = malloc(n * sizeof(double));
+  double result[sizeof(p) / sizeof(double)];
+  size_t i;
+
+  random_array(n, x, r);
+
+  gsl_stats_quantiles(x, 1, n, p, np, result);
+  gsl_sort(x, 1, n);
+
+  for (i = 0; i < np; ++i)
+    {
+      double expected = gsl_stats_quantile_from_sorted_data(x, 1, n, p[i]);
+      gsl_test_rel(result[i], expected, 0.0, "test_quantiles n=%zu p=%g", n, p[i]);
+    }
+
+  free(x);
+
+  return 0;
+}
+
 static int
 test_mad(const double tol, const size_t n, gsl_rng * r)
 {
@@ -176,18 +266,23 @@ test_Sn(const double tol, const size_t n, gsl_rng * r)
 {
   double * x = malloc(n * sizeof(double));
   double * work = malloc(n * sizeof(double));
-  double Sn1, Sn2;
+  double Sn1, Sn2, Sn3, Sn4;
 
   random_array(n, x, r);
 
   /* compute S_n with slow/naive algorithm */
   Sn1 = slow_Sn0(n, x);
 
+  /* compute S_n from unsorted data */
+  Sn3 = gsl_stats_Sn(x, 1, n, work);
+
   /* compute S_n with efficient algorithm */
   gsl_sort(x, 1, n);
   Sn2 = gsl_stats_Sn0_from_sorted_data(x, 1, n, work);
+  Sn4 = gsl_stats_Sn_from_sorted_data(x, 1, n, work);
 
   gsl_test_rel(Sn2, Sn1, tol, "test_Sn n=%zu", n);
+  gsl_test_rel(Sn3, Sn4, tol, "test_Sn unsorted n=%zu", n);
 
   free(x);
   free(work);
@@ -201,18 +296,23 @@ test_Qn(const double tol, const size_t n, gsl_rng * r)
   double * x = malloc(n * sizeof(double));
   double * work = malloc(3 * n * sizeof(double));
   int * work_int = malloc(5 * n * sizeof(int));
-  double Qn1, Qn2;
+  double Qn1, Qn2, Qn3, Qn4;
 
   random_array(n, x, r);
 
   /* compute Q_n with slow/naive algorithm */
   Qn1 = slow_Qn0(n, x);
 
+  /* compute Q_n from unsorted data */
+  Qn3 = gsl_stats_Qn(x, 1, n, work, work_int);
+
   /* compute Q_n with efficient algorithm */
   gsl_sort(x, 1, n);
   Qn2 = gsl_stats_Qn0_from_sorted_data(x, 1, n, work, work_int);
+  Qn4 = gsl_stats_Qn_from_sorted_data(x, 1, n, work, work_int);
 
   gsl_test_rel(Qn2, Qn1, tol, "test_Qn n=%zu", n);
+  gsl_test_rel(Qn3, Qn4, tol, "test_Qn unsorted n=%zu", n);
 
   free(x);
   free(work);
@@ -221,6 +321,68 @@ test_Qn(const double tol, const size_t n, gsl_rng * r)
   return 0;
 }
 
+/* an executor which runs the tasks in reverse order, to check that the
+ * results do not depend on the order of the tasks */
+static void
+reverse_run(size_t ntasks, void (*task) (size_t i, void * data),
+            void * data, void * params)
+{
+  size_t i;
+
+  (void) params;
+
+  for (i = ntasks; i-- > 0;)
+    task(i, data);
+}
+
+/* the parallel S_n and Q_n must equal the serial ones for any number
+ * of tasks; if 'ties' is set the data have few distinct values */
+static int
+test_SnQn_parallel(const size_t n, const int ties, gsl_rng * r)
+{
+  const gsl_executor exec = { &reverse_run, 0 };
+  const size_t ntasks[] = { 1, 2, 3, 8, 13 };
+  double * x = malloc(n * sizeof(double));
+  double * y = malloc(n * sizeof(double));
+  double * work = malloc(3 * n * sizeof(double));
+  int * work_int = malloc(5 * n * sizeof(int));
+  double Sn, Qn;
+  size_t i, k;
+
+  random_array(n, x, r);
+
+  if (ties)
+    {
+      for (i = 0; i < n; ++i)
+        x[i] = floor(8.0 * x[i]);
+    }
+
+  memcpy(y, x, n * sizeof(double));
+  Sn = gsl_stats_Sn(y, 1, n, work);
+  memcpy(y, x, n * sizeof(double));
+  Qn = gsl_stats_Qn(y, 1, n, work, work_int);
+
+  for (k = 0; k < sizeof(ntasks) / sizeof(ntasks[0]); ++k)
+    {
+      double val;
+
+      memcpy(y, x, n * sizeof(double));
+      val = gsl_stats_Sn_parallel(y, 1, n, work, ntasks[k], &exec);
+      gsl_test(val != Sn, "test_Sn parallel n=%zu ntasks=%zu ties=%d", n, ntasks[k], ties);
+
+      memcpy(y, x, n * sizeof(double));
+      val = gsl_stats_Qn_parallel(y, 1, n, work, work_int, ntasks[k], (k % 2) ? &exec : NULL);
+      gsl_test(val != Qn, "test_Qn parallel n=%zu ntasks=%zu ties=%d", n, ntasks[k], ties);
+    }
+
+  free(x);
+  free(y);
+  free(work);
+  free(work_int);
+
+  return 0;
+}
+
 int
 test_robust (void)
 {
@@ -234,6 +396,19 @@ test_robust (void)
   test_median(GSL_DBL_EPSILON, 101, r);
   test_median(GSL_DBL_EPSILON, 500, r);
   test_median(GSL_DBL_EPSILON, 501, r);
+  test_median(GSL_DBL_EPSILON, 10000, r);
+  test_median(GSL_DBL_EPSILON, 10001, r);
+
+  test_select(1, r);
+  test_select(10, r);
+  test_select(1000, r);
+  test_select(100001, r);
+
+  test_quantiles(1, r);
+  test_quantiles(2, r);
+  test_quantiles(100, r);
+  test_quantiles(10000, r);
+  test_quantiles(100001, r);
 
   test_mad(GSL_DBL_EPSILON, 1, r);
   test_mad(GSL_DBL_EPSILON, 2, r);
@@ -250,6 +425,7 @@ test_robust (void)
   test_Sn(tol, 101, r);
   test_Sn(tol, 500, r);
   test_Sn(tol, 501, r);
+  test_Sn(tol, 2000, r);
 
   test_Qn(tol, 1, r);
   test_Qn(tol, 2, r);
@@ -260,6 +436,15 @@ test_robust (void)
   test_Qn(tol, 101, r);
   test_Qn(tol, 500, r);
   test_Qn(tol, 501, r);
+  test_Qn(tol, 2000, r);
+
+  test_SnQn_parallel(1, 0, r);
+  test_SnQn_parallel(2, 0, r);
+  test_SnQn_parallel(5, 0, r);
+  test_SnQn_parallel(100, 1, r);
+  test_SnQn_parallel(2000, 0, r);
+  test_SnQn_parallel(2001, 1, r);
+  test_SnQn_parallel(100000, 0, r);
 
   gsl_rng_free(r);
 
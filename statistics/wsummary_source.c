@@ -0,0 +1,159 @@
+/* statistics/wsummary_source.c
+ * 
+ * Copyright (C) 2026 Patrick Alken
+ * 
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/*
+gsl_stats_wsummary()
+  Compute the weighted mean, variance, skewness, kurtosis and absolute
+deviation of a dataset with two passes over the data. The statistics
+have the same definitions as gsl_stats_wmean(), gsl_stats_wvariance(),
+gsl_stats_wskew(), gsl_stats_wkurtosis() and gsl_stats_wabsdev(); in
+particular data with nonpositive weights are ignored.
+
+Inputs: wmean     - (output) weighted mean
+        wvariance - (output) weighted variance
+        wskew     - (output) weighted skewness
+        wkurtosis - (output) weighted kurtosis
+        wabsdev   - (output) weighted absolute deviation
+        w         - weights
+        wstride   - stride of w
+        data      - dataset
+        stride    - stride of data
+        n         - length of 'data' and 'w'
+
+Return: success/error
+*/
+
+int
+FUNCTION(gsl_stats,wsummary) (double * wmean, double * wvariance,
+                              double * wskew, double * wkurtosis,
+                              double * wabsdev,
+                              const BASE w[], const size_t wstride,
+                              const BASE data[], const size_t stride,
+                              const size_t n)
+{
+  if (n == 0)
+    {
+      GSL_ERROR("array size must be positive", GSL_EBADLEN);
+    }
+  else
+    {
+      double W[4] = { 0.0, 0.0, 0.0, 0.0 };
+      double W2[4] = { 0.0, 0.0, 0.0, 0.0 };
+      double S[4] = { 0.0, 0.0, 0.0, 0.0 };
+      double d1[4] = { 0.0, 0.0, 0.0, 0.0 };
+      double d2[4] = { 0.0, 0.0, 0.0, 0.0 };
+      double d3[4] = { 0.0, 0.0, 0.0, 0.0 };
+      double d4[4] = { 0.0, 0.0, 0.0, 0.0 };
+      double da[4] = { 0.0, 0.0, 0.0, 0.0 };
+      double a, b, m, c, M2, M3, M4, var, factor;
+      size_t i, j;
+
+      /* first pass: sums of weights, squared weights and weighted data */
+      for (i = 0; i + 4 <= n; i += 4)
+        {
+          for (j = 0; j < 4; ++j)
+            {
+              const double wi = w[(i + j) * wstride];
+
+              if (wi > 0)
+                {
+                  W[j] += wi;
+                  W2[j] += wi * wi;
+                  S[j] += wi * data[(i + j) * stride];
+                }
+            }
+        }
+
+      for (; i < n; ++i)
+        {
+          const double wi = w[i * wstride];
+
+          if (wi > 0)
+            {
+              W[0] += wi;
+              W2[0] += wi * wi;
+              S[0] += wi * data[i * stride];
+            }
+        }
+
+      a = (W[0] + W[1]) + (W[2] + W[3]);
+      b = (W2[0] + W2[1]) + (W2[2] + W2[3]);
+      m = ((S[0] + S[1]) + (S[2] + S[3])) / a;
+
+      /* second pass: weighted powers of deviations from the mean */
+      for (i = 0; i + 4 <= n; i += 4)
+        {
+          for (j = 0; j < 4; ++j)
+            {
+              const double wi = w[(i + j) * wstride];
+
+              if (wi > 0)
+                {
+                  const double d = data[(i + j) * stride] - m;
+                  const double dsq = d * d;
+
+                  d1[j] += wi * d;
+                  d2[j] += wi * dsq;
+                  d3[j] += wi * dsq * d;
+                  d4[j] += wi * dsq * dsq;
+                  da[j] += wi * fabs(d);
+                }
+            }
+        }
+
+      for (; i < n; ++i)
+        {
+          const double wi = w[i * wstride];
+
+          if (wi > 0)
+            {
+              const double d = data[i * stride] - m;
+              const double dsq = d * d;
+
+              d1[0] += wi * d;
+              d2[0] += wi * dsq;
+              d3[0] += wi * dsq * d;
+              d4[0] += wi * dsq * dsq;
+              da[0] += wi * fabs(d);
+            }
+        }
+
+      /* correct for rounding error in the mean */
+      c = ((d1[0] + d1[1]) + (d1[2] + d1[3])) / a;
+      M2 = ((d2[0] + d2[1]) + (d2[2] + d2[3])) / a;
+      M3 = ((d3[0] + d3[1]) + (d3[2] + d3[3])) / a;
+      M4 = ((d4[0] + d4[1]) + (d4[2] + d4[3])) / a;
+
+      M4 += c * (-4.0 * M3 + c * (6.0 * M2 - 3.0 * c * c));
+      M3 += c * (-3.0 * M2 + 2.0 * c * c);
+      M2 -= c * c;
+
+      /* factor N/(N-1) of compute_factor() in wvariance_source.c */
+      factor = (a * a) / ((a * a) - b);
+      var = factor * M2;
+
+      *wmean = m + c;
+      *wvariance = var;
+      *wskew = M3 / (var * sqrt(var));
+      *wkurtosis = M4 / (var * var) - 3.0;
+      *wabsdev = ((da[0] + da[1]) + (da[2] + da[3])) / a;
+
+      return GSL_SUCCESS;
+    }
+}
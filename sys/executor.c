@@ -0,0 +1,52 @@
+/* sys/executor.c
+ * 
+ * Copyright (C) 2026 Patrick Alken
+ * 
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#include <config.h>
+#include <gsl/gsl_executor.h>
+
+/* run task(t, data) for t = 0, ..., ntasks-1 with the executor exec,
+   or in order on the calling thread if exec is null */
+
+void
+gsl_executor_run (const gsl_executor * exec, const size_t ntasks,
+                  void (*task) (size_t i, void * data), void * data)
+{
+  if (exec == 0)
+    {
+      size_t t;
+
+      for (t = 0; t < ntasks; t++)
+        task (t, data);
+    }
+  else
+    {
+      (exec->run) (ntasks, task, data, exec->params);
+    }
+}
+
+/* start of block t when n items are split into ntasks contiguous
+   blocks whose sizes differ by at most one, the larger ones first */
+
+size_t
+gsl_executor_block (const size_t n, const size_t ntasks, const size_t t)
+{
+  const size_t r = n % ntasks;
+
+  return (n / ntasks) * t + ((t < r) ? t : r);
+}